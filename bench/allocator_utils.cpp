@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Allocator-related utilities.
+/*! @file
+
+    See allocator_utils.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "allocator_utils.hpp"
+
+#include <algorithm>
+
+
+namespace bench
+{
+
+
+Arena::Arena( size_t block_size )
+{
+    blocks_.push_back( { std::unique_ptr< uint8_t[] >( new uint8_t[block_size] ), block_size } );
+    this->reset();
+}
+
+
+void *Arena::allocate_slow( size_t size, size_t alignment )
+{
+    const size_t needed = size + alignment - 1;
+
+    // Skip over any retained blocks that are too small, before growing the arena.
+    while (++current_ < blocks_.size() && blocks_[current_].size < needed) {}
+
+    if (current_ == blocks_.size())
+    {
+        const size_t block_size = std::max( 2 * blocks_.back().size, needed );
+        blocks_.push_back( { std::unique_ptr< uint8_t[] >( new uint8_t[block_size] ), block_size } );
+    }
+
+    const Block &block = blocks_[current_];
+    next_ = reinterpret_cast< uintptr_t >( block.data.get() );
+    end_ = next_ + block.size;
+
+    return this->allocate( size, alignment );
+}
+
+
+void Arena::reset()
+{
+    current_ = 0;
+    next_ = reinterpret_cast< uintptr_t >( blocks_.front().data.get() );
+    end_ = next_ + blocks_.front().size;
+}
+
+
+size_t Arena::capacity() const
+{
+    size_t total = 0;
+    for (const Block &block: blocks_) total += block.size;
+    return total;
+}
+
+
+} // namespace bench
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Allocator-related utilities.
+/*! @file
+
+    Provides a simple bump-pointer arena and a standard allocator that uses it,
+    as a baseline for comparing against the Boost.Container memory resources.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_ALLOCATOR_UTILS_HPP
+#define BENCH_ALLOCATOR_UTILS_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+
+namespace bench
+{
+
+
+    //! Bump-pointer allocator over a list of blocks.
+    /*!
+        Individual allocations are never freed.  Instead, reset() rewinds to
+        the first block, retaining all blocks for reuse.  So, once an arena has
+        grown to its high-water mark, it no longer calls the heap.
+    */
+class Arena
+{
+public:
+    explicit Arena(
+        size_t block_size = 1 << 16     //!< Size of first block to allocate.
+    );
+
+    Arena( const Arena & ) = delete;
+    Arena &operator=( const Arena & ) = delete;
+
+        //! Returns a block of size bytes with the specified alignment.
+    void *allocate( size_t size, size_t alignment );
+
+        //! Makes all of the arena's memory available for reuse.
+    void reset();
+
+        //! Returns the total size of all blocks.
+    size_t capacity() const;
+
+private:
+    void *allocate_slow( size_t size, size_t alignment );
+
+    struct Block
+    {
+        std::unique_ptr< uint8_t[] > data;
+        size_t size;
+    };
+
+    std::vector< Block > blocks_;
+    size_t current_ = 0;
+    uintptr_t next_ = 0;
+    uintptr_t end_ = 0;
+};
+
+
+    //! Standard allocator adapter for Arena.
+    /*!
+        deallocate() is a no-op, since memory is only reclaimed by Arena::reset().
+    */
+template<
+    typename T
+>
+struct ArenaAllocator
+{
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    Arena *arena_;
+
+    explicit ArenaAllocator( Arena &arena )
+    :
+        arena_( &arena )
+    {
+    }
+
+    template< typename U >
+        ArenaAllocator( const ArenaAllocator< U > &other )
+    :
+        arena_( other.arena_ )
+    {
+    }
+
+    T *allocate( size_t n )
+    {
+        return static_cast< T * >( arena_->allocate( n * sizeof( T ), alignof( T ) ) );
+    }
+
+    void deallocate( T *, size_t )
+    {
+    }
+};
+
+
+template< typename T, typename U >
+    bool operator==( const ArenaAllocator< T > &lhs, const ArenaAllocator< U > &rhs )
+{
+    return lhs.arena_ == rhs.arena_;
+}
+
+
+template< typename T, typename U >
+    bool operator!=( const ArenaAllocator< T > &lhs, const ArenaAllocator< U > &rhs )
+{
+    return lhs.arena_ != rhs.arena_;
+}
+
+
+// class Arena:
+inline void *Arena::allocate( size_t size, size_t alignment )
+{
+    const uintptr_t p = (next_ + alignment - 1) & ~static_cast< uintptr_t >( alignment - 1 );
+    if (p + size > end_ || p < next_) return this->allocate_slow( size, alignment );
+
+    next_ = p + size;
+    return reinterpret_cast< void * >( p );
+}
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_ALLOCATOR_UTILS_HPP
@@ -11,16 +11,18 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <atomic>
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
-#include <future>
 #include <memory>
-#include <thread>
 
-#include "autotime/os.hpp"
 #include "autotime/overhead.hpp"
 #include "autotime/time.hpp"
 
+#include "core_matrix.hpp"
+#include "description.hpp"
 #include "dispatch.hpp"
+#include "error_utils.hpp"
 #include "list.hpp"
 #include "thread_utils.hpp"
 
@@ -31,6 +33,38 @@ namespace bench
 {
 
 
+template<> Description Describe< Category::atomic >()
+{
+    Description desc;
+    desc.measures = "Atomic operations, fences, and their scaling with contending threads.";
+    desc.detail =
+        "The *_<N>t benchmarks have N threads jointly perform 1000 operations per iteration, and"
+        " divide the time by that, so it's the inverse of the aggregate throughput.  With"
+        " perfect scaling, it halves as the thread count doubles.  shared puts one counter on"
+        " one cache line, for all threads.  padded gives each thread its own counter, on its own"
+        " line.  sharded is like padded, except each thread also sums all of the counters after"
+        " every 100 of its increments.";
+    desc.notes =
+        {
+            "cas is an increment via a compare_exchange_weak() loop, which must retry when"
+                " another thread modifies the counter between its load and compare-exchange.",
+            "Unless their names specify otherwise, the N-thread operations use"
+                " memory_order_seq_cst.  On x86, all read-modify-write operations are locked"
+                " instructions, regardless of memory order.",
+            "The main thread runs on the primary core, while the other threads are pinned to the"
+                " secondary core and then round-robin to the other online cores.",
+            "atomic_pingpong bounces a cache line between the primary and secondary cores.  See"
+                " also --core-matrix, for every pair of cores.",
+        };
+    desc.limits =
+        {
+            "Thread counts exceeding the number of online cores oversubscribe them, which"
+                " measures scheduling more than contention.",
+        };
+    return desc;
+}
+
+
 template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_increment >()
 {
     static std::atomic< int > i{ 0 };
@@ -97,77 +131,523 @@ template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_cmp_exchg_strong_
 }
 
 
-    // Owns an atomic_int and a thread which increments it when its value is even.
-struct CounterParty
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_pingpong >()
 {
-    std::atomic< int > i_;
-    std::atomic< bool > stop_;
-    std::thread thread_;
+    using namespace std::placeholders;
+    std::shared_ptr< CounterParty > p_counterparty{ new CounterParty() };
+    return { std::bind( &PingPong, p_counterparty, _1 ), nullptr };
+}
+
+
+    // Operations per iteration of the N-thread benchmarks, to amortize waking the team.
+static constexpr int Ops_per_iter = 1000;
+
+    // Operations between reads of the total, by each thread incrementing a sharded counter.
+static constexpr int Shard_read_interval = 100;
+
 
-    CounterParty()
+enum class AtomicOp
+{
+    fetch_add,
+    cas,        // Increment via a compare-exchange loop.
+    exchange
+};
+
+
+enum class CounterLayout
+{
+    shared,     // All threads use one counter.
+    padded,     // Each thread uses its own counter, on its own cache line.
+    sharded     // Like padded, but threads periodically read the sum of all counters.
+};
+
+
+struct alignas( 64 ) PaddedCounter
+{
+    std::atomic< uint64_t > value;
+    char pad[64 - sizeof( std::atomic< uint64_t > )];
+};
+
+
+    // A team of threads, jointly performing an atomic operation on counters.
+class AtomicContention
+{
+public:
+    AtomicContention( AtomicOp op, CounterLayout layout, std::memory_order order, int num_threads )
     :
-        i_{ 0 },
-        stop_{ false }
+        op_( op ),
+        layout_( layout ),
+        order_( order ),
+        team_( num_threads, std::bind( &AtomicContention::run, this, std::placeholders::_1,
+            std::placeholders::_2 ) )
     {
-        std::promise< void > started_promise;
-        std::future< void > started_future = started_promise.get_future();
-        thread_ = std::thread( &CounterParty::threadfunc, this, std::move( started_promise ) );
-        started_future.get();
+        // std::allocator doesn't honor alignments beyond that of max_align_t, before C++17.
+        void *memory = nullptr;
+        if (int err = posix_memalign( &memory, 64, num_threads * sizeof( PaddedCounter ) ))
+        {
+            throw_system_error( err, "posix_memalign()" );
+        }
+        counters_.reset( static_cast< PaddedCounter * >( memory ) );
+        for (int i = 0; i < num_threads; ++i) counters_.get()[i].value = 0;
     }
 
-    ~CounterParty()
+    Durations time( int num_iters )
     {
-        stop_ = true;
-        thread_.join();
+        return team_.time( num_iters * Ops_per_iter ) / Ops_per_iter;
     }
 
-    void threadfunc( std::promise< void > started_promise )
+private:
+    void run( int idx, int num_ops )
     {
-        SetCoreAffinity( GetSecondaryCoreId() );
+        // Divide the operations evenly, with the remainder going to member 0.
+        const int num_threads = team_.size();
+        const int count = num_ops / num_threads + ((idx == 0) ? num_ops % num_threads : 0);
+
+        switch (order_)
+        {
+        case std::memory_order_relaxed:
+            return loop< std::memory_order_relaxed >( idx, count );
 
-        started_promise.set_value();
+        case std::memory_order_acq_rel:
+            return loop< std::memory_order_acq_rel >( idx, count );
 
-        int exp = 0;
-        int counter = 0;    // counter avoids sampling stop too often.
-        while ((counter++ % 4096) || !stop_)
+        default:
+            return loop< std::memory_order_seq_cst >( idx, count );
+        }
+    }
+
+    template<
+        std::memory_order Order
+    >
+    void loop( int idx, int count )
+    {
+        PaddedCounter *const counters = counters_.get();
+        std::atomic< uint64_t > &counter =
+            counters[(layout_ == CounterLayout::shared) ? 0 : idx].value;
+
+        switch (op_)
         {
-            int x = exp;
-            if (i_.compare_exchange_weak( x, exp + 1 )) exp += 2;
+        case AtomicOp::fetch_add:
+            for (int i = 0; i < count; ++i)
+            {
+                counter.fetch_add( 1, Order );
+                if (layout_ == CounterLayout::sharded && i % Shard_read_interval == 0)
+                {
+                    uint64_t sum = 0;
+                    for (int j = 0; j < team_.size(); ++j)
+                    {
+                        sum += counters[j].value.load( std::memory_order_relaxed );
+                    }
+                    sum_ = sum;
+                }
+            }
+            break;
+
+        case AtomicOp::cas:
+            for (int i = 0; i < count; ++i)
+            {
+                uint64_t value = counter.load( std::memory_order_relaxed );
+                while (!counter.compare_exchange_weak(
+                    value, value + 1, Order, std::memory_order_relaxed ));
+            }
+            break;
+
+        case AtomicOp::exchange:
+            for (int i = 0; i < count; ++i) counter.exchange( i, Order );
+            break;
         }
     }
+
+    const AtomicOp op_;
+    const CounterLayout layout_;
+    const std::memory_order order_;
+    std::unique_ptr< PaddedCounter, decltype( &free ) > counters_{ nullptr, &free };
+    volatile uint64_t sum_ = 0;
+
+    ThreadTeam team_;   // Last, since it starts the threads which use the other members.
 };
 
 
-static Durations PingPong( std::shared_ptr< CounterParty > p_counterparty, int num_iters )
+static autotime::BenchTimers MakeContentionTimers(
+    AtomicOp op, CounterLayout layout, std::memory_order order, int num_threads )
 {
-    std::atomic< int > &i = p_counterparty->i_;
+    using namespace std::placeholders;
+    auto contention = std::make_shared< AtomicContention >( op, layout, order, num_threads );
+    return { std::bind( &AtomicContention::time, contention, _1 ), nullptr };
+}
 
-    int exp = i;
-    if (exp % 2 == 0) exp += 1;     // Avoid race by ensuring exp is odd.
 
-    //  We want to start timing right after incrementing the counter again.
-    int x = exp;
-    while (!i.compare_exchange_weak( x, exp + 1 )) x = exp;
-    exp += 2;
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_1t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_seq_cst, 1 );
+}
 
-    TimePoints start_times = Start();
 
-    for (int count = 0; count < num_iters; ++count)
-    {
-        int x = exp;
-        while (!i.compare_exchange_weak( x, exp + 1 )) x = exp;
-        exp += 2;
-    }
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_2t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_seq_cst, 2 );
+}
+
 
-    return End( start_times );
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_4t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_seq_cst, 4 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_pingpong >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_8t >()
 {
-    using namespace std::placeholders;
-    std::shared_ptr< CounterParty > p_counterparty{ new CounterParty() };
-    return { std::bind( &PingPong, p_counterparty, _1 ), nullptr };
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_seq_cst, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_16t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_seq_cst, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_padded_1t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::padded, std::memory_order_seq_cst, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_padded_2t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::padded, std::memory_order_seq_cst, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_padded_4t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::padded, std::memory_order_seq_cst, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_padded_8t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::padded, std::memory_order_seq_cst, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_padded_16t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::padded, std::memory_order_seq_cst, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_sharded_1t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::sharded, std::memory_order_seq_cst, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_sharded_2t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::sharded, std::memory_order_seq_cst, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_sharded_4t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::sharded, std::memory_order_seq_cst, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_sharded_8t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::sharded, std::memory_order_seq_cst, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_sharded_16t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::sharded, std::memory_order_seq_cst, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_cas_shared_1t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::cas, CounterLayout::shared, std::memory_order_seq_cst, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_cas_shared_2t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::cas, CounterLayout::shared, std::memory_order_seq_cst, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_cas_shared_4t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::cas, CounterLayout::shared, std::memory_order_seq_cst, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_cas_shared_8t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::cas, CounterLayout::shared, std::memory_order_seq_cst, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_cas_shared_16t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::cas, CounterLayout::shared, std::memory_order_seq_cst, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_cas_padded_1t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::cas, CounterLayout::padded, std::memory_order_seq_cst, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_cas_padded_2t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::cas, CounterLayout::padded, std::memory_order_seq_cst, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_cas_padded_4t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::cas, CounterLayout::padded, std::memory_order_seq_cst, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_cas_padded_8t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::cas, CounterLayout::padded, std::memory_order_seq_cst, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_cas_padded_16t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::cas, CounterLayout::padded, std::memory_order_seq_cst, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_exchange_shared_1t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::exchange, CounterLayout::shared, std::memory_order_seq_cst, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_exchange_shared_2t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::exchange, CounterLayout::shared, std::memory_order_seq_cst, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_exchange_shared_4t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::exchange, CounterLayout::shared, std::memory_order_seq_cst, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_exchange_shared_8t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::exchange, CounterLayout::shared, std::memory_order_seq_cst, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_exchange_shared_16t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::exchange, CounterLayout::shared, std::memory_order_seq_cst, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_exchange_padded_1t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::exchange, CounterLayout::padded, std::memory_order_seq_cst, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_exchange_padded_2t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::exchange, CounterLayout::padded, std::memory_order_seq_cst, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_exchange_padded_4t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::exchange, CounterLayout::padded, std::memory_order_seq_cst, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_exchange_padded_8t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::exchange, CounterLayout::padded, std::memory_order_seq_cst, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_exchange_padded_16t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::exchange, CounterLayout::padded, std::memory_order_seq_cst, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_relaxed_1t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_relaxed, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_relaxed_2t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_relaxed, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_relaxed_4t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_relaxed, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_relaxed_8t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_relaxed, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_relaxed_16t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_relaxed, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_acq_rel_1t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_acq_rel, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_acq_rel_2t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_acq_rel, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_acq_rel_4t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_acq_rel, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_acq_rel_8t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_acq_rel, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fetch_add_shared_acq_rel_16t >()
+{
+    return MakeContentionTimers(
+        AtomicOp::fetch_add, CounterLayout::shared, std::memory_order_acq_rel, 16 );
+}
+
+
+static std::atomic< int > Stored{ 0 };
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_store_relaxed >()
+{
+    void (*f)() = []() { Stored.store( 1, std::memory_order_relaxed ); };
+
+    return { MakeTimer( f ), MakeTimer( &Overhead_void<> ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_store_release >()
+{
+    void (*f)() = []() { Stored.store( 1, std::memory_order_release ); };
+
+    return { MakeTimer( f ), MakeTimer( &Overhead_void<> ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_store_seq_cst >()
+{
+    void (*f)() = []() { Stored.store( 1, std::memory_order_seq_cst ); };
+
+    return { MakeTimer( f ), MakeTimer( &Overhead_void<> ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fence_acquire >()
+{
+    void (*f)() = []() { std::atomic_thread_fence( std::memory_order_acquire ); };
+
+    return { MakeTimer( f ), MakeTimer( &Overhead_void<> ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fence_release >()
+{
+    void (*f)() = []() { std::atomic_thread_fence( std::memory_order_release ); };
+
+    return { MakeTimer( f ), MakeTimer( &Overhead_void<> ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fence_acq_rel >()
+{
+    void (*f)() = []() { std::atomic_thread_fence( std::memory_order_acq_rel ); };
+
+    return { MakeTimer( f ), MakeTimer( &Overhead_void<> ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::atomic_fence_seq_cst >()
+{
+    void (*f)() = []() { std::atomic_thread_fence( std::memory_order_seq_cst ); };
+
+    return { MakeTimer( f ), MakeTimer( &Overhead_void<> ) };
 }
 
 
@@ -0,0 +1,367 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements bandwidth-category benchmarks.
+/*! @file
+
+    These run the STREAM kernels on a team of pinned threads, each of which owns a slice of the
+    arrays.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "dispatch.hpp"
+
+#include "autotime/time.hpp"
+#include "autotime/topology.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bandwidth_utils.hpp"
+#include "description.hpp"
+#include "error_utils.hpp"
+#include "thread_utils.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::bandwidth >()
+{
+    Description desc;
+    desc.measures = "Aggregate memory bandwidth of the STREAM kernels, by thread count.";
+    desc.detail =
+        "Three arrays of doubles, each 4x the total L3 cache (and at least 64 MiB), are divided"
+        " evenly among the threads.  Each thread allocates and first-touches its own"
+        " page-aligned slice, so that its pages are local to it, and then repeatedly runs the"
+        " kernel over its slice.  One iteration is one pass of all threads over the arrays.";
+    desc.notes =
+        {
+            "copy: c = a; scale: b = q * c; add: c = a + b; triad: a = b + q * c.",
+            "Bytes are counted by STREAM convention (i.e. 16 per element for copy & scale, 24 for"
+                " add & triad), which excludes write-allocate traffic.",
+            "The GB/s of each kernel by thread count, and the smallest thread count reaching 90%"
+                " of the peak, are printed after the results.",
+            "The main thread runs on the primary core, while the other threads are pinned to the"
+                " secondary core and then round-robin to the other online cores.  Waking them and"
+                " waiting for them to finish is included in the time.",
+            "Thread counts exceeding the number of online cores are skipped, since"
+                " oversubscribing the cores would measure scheduling more than bandwidth.",
+        };
+    return desc;
+}
+
+
+static constexpr size_t Page_size = 4096;
+
+static constexpr double Stream_scalar = 3.0;
+
+
+    // One thread's slice of each array.
+struct StreamSlice
+{
+    std::unique_ptr< double, decltype( &free ) > a_{ nullptr, &free };
+    std::unique_ptr< double, decltype( &free ) > b_{ nullptr, &free };
+    std::unique_ptr< double, decltype( &free ) > c_{ nullptr, &free };
+    size_t n_ = 0;
+
+        // Must be called by the thread which will use the slice, so that it owns the pages.
+    void allocate( size_t n )
+    {
+        n_ = n;
+        for (auto *array: { &a_, &b_, &c_ })
+        {
+            void *memory = nullptr;
+            if (int err = posix_memalign( &memory, Page_size, n * sizeof( double ) ))
+            {
+                throw_system_error( err, "posix_memalign()" );
+            }
+            array->reset( static_cast< double * >( memory ) );
+        }
+
+        double *a = a_.get(), *b = b_.get(), *c = c_.get();
+        for (size_t i = 0; i < n; ++i)
+        {
+            a[i] = 1.0;
+            b[i] = 2.0;
+            c[i] = 0.0;
+        }
+    }
+
+    void run( StreamKernel kernel )
+    {
+        double *const a = a_.get(), *const b = b_.get(), *const c = c_.get();
+        const size_t n = n_;
+        switch (kernel)
+        {
+        case StreamKernel::copy:
+            for (size_t i = 0; i < n; ++i) c[i] = a[i];
+            break;
+
+        case StreamKernel::scale:
+            for (size_t i = 0; i < n; ++i) b[i] = Stream_scalar * c[i];
+            break;
+
+        case StreamKernel::add:
+            for (size_t i = 0; i < n; ++i) c[i] = a[i] + b[i];
+            break;
+
+        case StreamKernel::triad:
+            for (size_t i = 0; i < n; ++i) a[i] = b[i] + Stream_scalar * c[i];
+            break;
+        }
+    }
+};
+
+
+    // Runs the kernel on a ThreadTeam, each member of which owns a slice of the arrays.
+class StreamTeam
+{
+public:
+    StreamTeam( StreamKernel kernel, int num_threads )
+    :
+        kernel_( kernel ),
+        n_( GetStreamArraySize() / sizeof( double ) / num_threads ),
+        slices_( num_threads ),
+        errors_( num_threads ),
+        team_( num_threads, std::bind( &StreamTeam::body, this, std::placeholders::_1,
+            std::placeholders::_2 ) )
+    {
+        // Have each member allocate its slice, and then rethrow the first failure (if any).
+        // The team's destructor stops & joins the members, if this throws.
+        team_.time( 0 );
+        for (const std::exception_ptr &error: errors_)
+        {
+            if (error) std::rethrow_exception( error );
+        }
+    }
+
+    Durations time( int num_iters )
+    {
+        return team_.time( num_iters );
+    }
+
+private:
+    void body( int idx, int num_iters )
+    {
+        StreamSlice &slice = slices_[idx];
+        if (!slice.n_)
+        {
+            try
+            {
+                slice.allocate( n_ );
+            }
+            catch (...)
+            {
+                errors_[idx] = std::current_exception();
+            }
+            return;
+        }
+
+        for (int iter = 0; iter < num_iters; ++iter) slice.run( kernel_ );
+    }
+
+    const StreamKernel kernel_;
+    const size_t n_;
+    std::vector< StreamSlice > slices_;
+    std::vector< std::exception_ptr > errors_;     // From allocating each member's slice.
+    ThreadTeam team_;   // Last, so that it's destroyed (and joined) first.
+};
+
+
+static autotime::BenchTimers MakeStreamTimers( StreamKernel kernel, int num_threads )
+{
+    using namespace std::placeholders;
+
+    const size_t num_cores = GetCpuTopology().size();
+    if (num_cores && static_cast< size_t >( num_threads ) > num_cores)
+    {
+        throw unavailable_error(
+            "More threads than the " + std::to_string( num_cores ) + " online core(s)." );
+    }
+    std::shared_ptr< StreamTeam > team = std::make_shared< StreamTeam >( kernel, num_threads );
+    return { std::bind( &StreamTeam::time, team, _1 ), nullptr };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_copy_1t >()
+{
+    return MakeStreamTimers( StreamKernel::copy, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_copy_2t >()
+{
+    return MakeStreamTimers( StreamKernel::copy, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_copy_4t >()
+{
+    return MakeStreamTimers( StreamKernel::copy, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_copy_8t >()
+{
+    return MakeStreamTimers( StreamKernel::copy, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_copy_16t >()
+{
+    return MakeStreamTimers( StreamKernel::copy, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_copy_32t >()
+{
+    return MakeStreamTimers( StreamKernel::copy, 32 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_copy_64t >()
+{
+    return MakeStreamTimers( StreamKernel::copy, 64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_scale_1t >()
+{
+    return MakeStreamTimers( StreamKernel::scale, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_scale_2t >()
+{
+    return MakeStreamTimers( StreamKernel::scale, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_scale_4t >()
+{
+    return MakeStreamTimers( StreamKernel::scale, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_scale_8t >()
+{
+    return MakeStreamTimers( StreamKernel::scale, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_scale_16t >()
+{
+    return MakeStreamTimers( StreamKernel::scale, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_scale_32t >()
+{
+    return MakeStreamTimers( StreamKernel::scale, 32 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_scale_64t >()
+{
+    return MakeStreamTimers( StreamKernel::scale, 64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_add_1t >()
+{
+    return MakeStreamTimers( StreamKernel::add, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_add_2t >()
+{
+    return MakeStreamTimers( StreamKernel::add, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_add_4t >()
+{
+    return MakeStreamTimers( StreamKernel::add, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_add_8t >()
+{
+    return MakeStreamTimers( StreamKernel::add, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_add_16t >()
+{
+    return MakeStreamTimers( StreamKernel::add, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_add_32t >()
+{
+    return MakeStreamTimers( StreamKernel::add, 32 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_add_64t >()
+{
+    return MakeStreamTimers( StreamKernel::add, 64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_triad_1t >()
+{
+    return MakeStreamTimers( StreamKernel::triad, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_triad_2t >()
+{
+    return MakeStreamTimers( StreamKernel::triad, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_triad_4t >()
+{
+    return MakeStreamTimers( StreamKernel::triad, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_triad_8t >()
+{
+    return MakeStreamTimers( StreamKernel::triad, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_triad_16t >()
+{
+    return MakeStreamTimers( StreamKernel::triad, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_triad_32t >()
+{
+    return MakeStreamTimers( StreamKernel::triad, 32 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::stream_triad_64t >()
+{
+    return MakeStreamTimers( StreamKernel::triad, 64 );
+}
+
+
+} // namespace bench
@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Memory bandwidth-related utilities.
+/*! @file
+
+    See bandwidth_utils.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "bandwidth_utils.hpp"
+
+#include <algorithm>
+#include <ostream>
+#include <set>
+
+#include "autotime/topology.hpp"
+
+
+namespace bench
+{
+
+
+size_t GetStreamArraySize()
+{
+    static const size_t result = []()
+        {
+            // Each L3 cache is counted once, by the lowest-numbered CPU sharing it.
+            std::set< int > l3_ids;
+            size_t l3_total = 0;
+            for (const autotime::CpuTopology &cpu: autotime::GetCpuTopology())
+            {
+                if (cpu.l3_id >= 0 && l3_ids.insert( cpu.l3_id ).second) l3_total += cpu.l3_size;
+            }
+
+            constexpr size_t granule = size_t{ 1 } << 20;
+            const size_t size = std::max( Min_stream_array_size, 4 * l3_total );
+            return (size + granule - 1) / granule * granule;
+        }();
+
+    return result;
+}
+
+
+const char *ToCStr( StreamKernel kernel )
+{
+    switch (kernel)
+    {
+#define CASE( n ) \
+    case StreamKernel::n: \
+        return #n
+
+    CASE( copy );
+    CASE( scale );
+    CASE( add );
+    CASE( triad );
+
+#undef CASE
+    }
+
+    return nullptr;
+}
+
+
+size_t BytesPerElement( StreamKernel kernel )
+{
+    switch (kernel)
+    {
+    case StreamKernel::copy:
+    case StreamKernel::scale:
+        return 2 * sizeof( double );
+
+    case StreamKernel::add:
+    case StreamKernel::triad:
+        return 3 * sizeof( double );
+    }
+
+    return 0;
+}
+
+
+bool GetStreamParams( Benchmark benchmark, StreamParams &params )
+{
+    switch (benchmark)
+    {
+#define CASE__STREAM( k, n ) \
+    case Benchmark::stream_ ## k ## _ ## n ## t: \
+        params = { StreamKernel::k, n }; \
+        return true
+
+    CASE__STREAM( copy, 1 );
+    CASE__STREAM( copy, 2 );
+    CASE__STREAM( copy, 4 );
+    CASE__STREAM( copy, 8 );
+    CASE__STREAM( copy, 16 );
+    CASE__STREAM( copy, 32 );
+    CASE__STREAM( copy, 64 );
+    CASE__STREAM( scale, 1 );
+    CASE__STREAM( scale, 2 );
+    CASE__STREAM( scale, 4 );
+    CASE__STREAM( scale, 8 );
+    CASE__STREAM( scale, 16 );
+    CASE__STREAM( scale, 32 );
+    CASE__STREAM( scale, 64 );
+    CASE__STREAM( add, 1 );
+    CASE__STREAM( add, 2 );
+    CASE__STREAM( add, 4 );
+    CASE__STREAM( add, 8 );
+    CASE__STREAM( add, 16 );
+    CASE__STREAM( add, 32 );
+    CASE__STREAM( add, 64 );
+    CASE__STREAM( triad, 1 );
+    CASE__STREAM( triad, 2 );
+    CASE__STREAM( triad, 4 );
+    CASE__STREAM( triad, 8 );
+    CASE__STREAM( triad, 16 );
+    CASE__STREAM( triad, 32 );
+    CASE__STREAM( triad, 64 );
+
+#undef CASE__STREAM
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
+
+size_t StreamBytes( StreamKernel kernel )
+{
+    return BytesPerElement( kernel ) * (GetStreamArraySize() / sizeof( double ));
+}
+
+
+int DetectSaturation( const std::map< int, double > &bandwidths, double fraction )
+{
+    double peak = 0.0;
+    for (const auto &threads_bw: bandwidths) peak = std::max( peak, threads_bw.second );
+
+    for (const auto &threads_bw: bandwidths)
+    {
+        if (threads_bw.second >= fraction * peak) return threads_bw.first;
+    }
+
+    return 0;
+}
+
+
+std::ostream &PrintStreamBandwidth(
+    std::ostream &ostream,
+    const std::map< StreamKernel, std::map< int, double > > &bandwidths
+)
+{
+    ostream << "Memory bandwidth (GB/s by thread count, estimated from stream_*):\n";
+
+    const auto precision_prev = ostream.precision( 4 );
+    for (const auto &kernel_bws: bandwidths)
+    {
+        ostream << "  " << ToCStr( kernel_bws.first ) << ":";
+        for (const auto &threads_bw: kernel_bws.second)
+        {
+            ostream << "  " << threads_bw.first << "t " << threads_bw.second;
+        }
+
+        if (kernel_bws.second.size() > 1)
+        {
+            ostream << "  (saturates at " << DetectSaturation( kernel_bws.second ) << "t)";
+        }
+        ostream << "\n";
+    }
+    ostream.precision( precision_prev );
+
+    return ostream;
+}
+
+
+} // namespace bench
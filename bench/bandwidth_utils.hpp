@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Memory bandwidth-related utilities.
+/*! @file
+
+    Supports converting the results of the stream_* benchmarks into aggregate
+    bandwidth, and finding the thread count at which it saturates.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_BANDWIDTH_UTILS_HPP
+#define BENCH_BANDWIDTH_UTILS_HPP
+
+
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+
+#include "list.hpp"
+
+
+namespace bench
+{
+
+
+    //! Minimum size of each of the STREAM arrays, which is divided among the threads.
+constexpr size_t Min_stream_array_size = size_t{ 1 } << 26;
+
+
+    //! Returns the size of each of the STREAM arrays.
+    /*!
+        By STREAM's rule, each array is at least 4x the total of the L3
+        caches, so that no thread count can fit them in cache.  It's a
+        multiple of 1 MiB, which divides evenly among up to 64 threads.
+    */
+size_t GetStreamArraySize();
+
+
+enum class StreamKernel
+{
+    copy,   //!< c = a
+    scale,  //!< b = q * c
+    add,    //!< c = a + b
+    triad   //!< a = b + q * c
+};
+
+
+const char *ToCStr( StreamKernel kernel );
+
+
+    //! Returns the bytes counted per element, by STREAM convention (i.e. excluding write-allocate).
+size_t BytesPerElement( StreamKernel kernel );
+
+
+    //! Describes one of the stream_* benchmarks.
+struct StreamParams
+{
+    StreamKernel kernel;
+    int num_threads;
+};
+
+
+    //! Returns true and sets params, if benchmark is one of the stream_* benchmarks.
+bool GetStreamParams( Benchmark benchmark, StreamParams &params );
+
+
+    //! Returns the bytes moved by one iteration of a stream_* benchmark (i.e. a pass over the arrays).
+size_t StreamBytes( StreamKernel kernel );
+
+
+    //! Returns the smallest thread count achieving the given fraction of peak bandwidth.
+int DetectSaturation(
+    const std::map< int, double > &bandwidths,  //!< Bandwidth, by thread count.
+    double fraction = 0.9
+);
+
+
+    //! Prints GB/s by thread count, for each kernel, with the point at which it saturates.
+std::ostream &PrintStreamBandwidth(
+    std::ostream &ostream,
+    const std::map< StreamKernel, std::map< int, double > > &bandwidths
+);
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_BANDWIDTH_UTILS_HPP
@@ -0,0 +1,740 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements cache-category benchmarks.
+/*! @file
+
+    These measure load-to-use latency by chasing pointers through buffers of different sizes, and
+    the cost of dTLB misses by chasing them through pages of different sizes.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "dispatch.hpp"
+
+#include "autotime/time.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "cache_utils.hpp"
+#include "description.hpp"
+#include "error_utils.hpp"
+#include "page_utils.hpp"
+#include "thread_utils.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::cache >()
+{
+    Description desc;
+    desc.measures =
+        "Load-to-use latency (i.e. of pointer-chasing), by working set size, and the cost of"
+        " threads sharing cache lines.";
+    desc.detail =
+        "Each cache line of the buffer holds a pointer to the next line to visit, so each load"
+        " must complete before the next can start.";
+    desc.notes =
+        {
+            "cache_chase_random_* visits the lines in a random, cyclic order, which defeats"
+                " prefetching.  It spans 4 KiB to 1 GiB, and the cache levels estimated from it"
+                " are printed after the results.",
+            "cache_chase_seq_* visits the lines in address order, while cache_chase_stride_*"
+                " steps by a page plus a line.  These show how much latency prefetching hides.",
+            "cache_page_chase_<size>_<page> touches one line per 4 KiB of the buffer, visiting them"
+                " in a random, cyclic order.  The lines touched fit in the cache hierarchy far"
+                " better than the buffer fits in the dTLB, so the difference between 4k pages and"
+                " thp, 2M, or 1G pages is the cost of dTLB misses & page walks.",
+            "cache_sharing_<distance>_<mix>_<N>t has N threads each access their own 8-byte field,"
+                " with the fields <distance> apart.  0b is true sharing (i.e. all threads use one"
+                " field), 8b is false sharing, 64b puts neighbors on adjacent lines, and 128b pads"
+                " each field to a pair of lines.  Where 64b is much slower than 128b, the adjacent"
+                " line prefetcher is pulling neighbors' lines in pairs.",
+            "In the write mix, every access is an increment (a relaxed load & store, rather than a"
+                " locked instruction).  In mixed, 1 in 4 is.  In readers, thread 0 only increments,"
+                " while the rest only load.",
+            "Each thread of cache_sharing_* makes 1000 accesses per iteration, and the time is"
+                " divided by that, so it's the inverse of the per-thread throughput.  The"
+                " throughput is summarized by distance, after the results.",
+        };
+    desc.limits =
+        {
+            "cache_chase_* uses 4 KiB pages, so the larger working sets also incur dTLB misses.",
+            "cache_page_chase_*_2M and cache_page_chase_*_1G are skipped, unless enough huge"
+                " pages are reserved (i.e. via vm.nr_hugepages, or at boot for 1 GiB pages).",
+            "cache_sharing_* runs on the primary core, the secondary core, and then round-robin on"
+                " the other online cores.  Thread counts exceeding the number of online cores"
+                " oversubscribe them, which measures scheduling more than sharing.",
+        };
+    return desc;
+}
+
+
+static constexpr size_t Line_size = 64;
+
+
+    // Stride of the strided chase, which is odd so that it visits every line of the buffer.
+static constexpr size_t Stride_lines = 4096 / Line_size + 1;
+
+
+enum class ChaseOrder
+{
+    random,
+    sequential,
+    strided
+};
+
+
+struct ChaseBuffer
+{
+    std::shared_ptr< void > memory;
+    void *const *next = nullptr;
+};
+
+
+static std::shared_ptr< ChaseBuffer > MakeChaseBuffer( size_t size, ChaseOrder order )
+{
+    const size_t n = size / Line_size;
+
+    std::shared_ptr< ChaseBuffer > buffer = std::make_shared< ChaseBuffer >();
+    void *memory = nullptr;
+    if (int err = posix_memalign( &memory, Line_size, size ))
+    {
+        throw_system_error( err, "posix_memalign()" );
+    }
+    buffer->memory.reset( memory, &free );
+
+    // The index of the line following each line.
+    std::vector< uint32_t > successors( n );
+    switch (order)
+    {
+    case ChaseOrder::random:
+        // Sattolo's algorithm, which produces a permutation consisting of a single cycle.
+        for (size_t i = 0; i < n; ++i) successors[i] = static_cast< uint32_t >( i );
+        srandom( 1 );
+        for (size_t i = n - 1; i > 0; --i) std::swap( successors[i], successors[random() % i] );
+        break;
+
+    case ChaseOrder::sequential:
+        for (size_t i = 0; i < n; ++i) successors[i] = static_cast< uint32_t >( (i + 1) % n );
+        break;
+
+    case ChaseOrder::strided:
+        for (size_t i = 0; i < n; ++i)
+        {
+            successors[i] = static_cast< uint32_t >( (i + Stride_lines) % n );
+        }
+        break;
+    }
+
+    uint8_t *lines = static_cast< uint8_t * >( memory );
+    for (size_t i = 0; i < n; ++i)
+    {
+        void *&line = *reinterpret_cast< void ** >( lines + i * Line_size );
+        line = lines + successors[i] * Line_size;
+    }
+    buffer->next = static_cast< void *const * >( memory );
+
+    return buffer;
+}
+
+
+    // Links one line in each 4 KiB of the mapping, in a random cycle.
+static std::shared_ptr< ChaseBuffer > MakePageChaseBuffer( size_t size, PageKind kind )
+{
+    constexpr size_t Small_page_size = 4096;
+    const size_t n = size / Small_page_size;
+
+    std::shared_ptr< PageMapping > mapping = MapPages( size, kind );
+    std::shared_ptr< ChaseBuffer > buffer = std::make_shared< ChaseBuffer >();
+    buffer->memory = mapping;
+
+    std::vector< uint32_t > successors( n );
+    for (size_t i = 0; i < n; ++i) successors[i] = static_cast< uint32_t >( i );
+    srandom( 1 );
+    for (size_t i = n - 1; i > 0; --i) std::swap( successors[i], successors[random() % i] );
+
+    // Vary the line within each page, so the lines touched don't all map to the same cache sets.
+    uint8_t *pages = static_cast< uint8_t * >( mapping->data() );
+    auto line_of = [pages]( size_t i )
+        {
+            return pages + i * Small_page_size + (i % (Small_page_size / Line_size)) * Line_size;
+        };
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        *reinterpret_cast< void ** >( line_of( i ) ) = line_of( successors[i] );
+    }
+    buffer->next = reinterpret_cast< void *const * >( line_of( 0 ) );
+
+    return buffer;
+}
+
+
+static Durations ChaseTimer( std::shared_ptr< ChaseBuffer > buffer, int num_iters )
+{
+    void *const *p = buffer->next;
+
+    TimePoints start_times = Start();
+    for (int i = 0; i < num_iters; ++i) p = static_cast< void *const * >( *p );
+    Durations durations = End( start_times );
+
+    // Resume from here, next time.  This also keeps the loads from being optimized away.
+    buffer->next = p;
+
+    return durations;
+}
+
+
+static autotime::BenchTimers MakeChaseTimers( size_t size, ChaseOrder order )
+{
+    using namespace std::placeholders;
+    return { std::bind( &ChaseTimer, MakeChaseBuffer( size, order ), _1 ), nullptr };
+}
+
+
+static autotime::BenchTimers MakePageChaseTimers( size_t size, PageKind kind )
+{
+    using namespace std::placeholders;
+    return { std::bind( &ChaseTimer, MakePageChaseBuffer( size, kind ), _1 ), nullptr };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_4k >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 12, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_8k >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 13, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_16k >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 14, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_32k >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 15, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_64k >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 16, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_128k >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 17, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_256k >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 18, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_512k >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 19, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_1M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 20, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_2M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 21, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_4M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 22, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_8M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 23, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_16M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 24, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_32M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 25, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_64M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 26, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_128M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 27, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_256M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 28, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_512M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 29, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_random_1G >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 30, ChaseOrder::random );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_seq_64k >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 16, ChaseOrder::sequential );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_seq_1M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 20, ChaseOrder::sequential );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_seq_16M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 24, ChaseOrder::sequential );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_seq_256M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 28, ChaseOrder::sequential );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_stride_64k >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 16, ChaseOrder::strided );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_stride_1M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 20, ChaseOrder::strided );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_stride_16M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 24, ChaseOrder::strided );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_chase_stride_256M >()
+{
+    return MakeChaseTimers( size_t{ 1 } << 28, ChaseOrder::strided );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_page_chase_4M_4k >()
+{
+    return MakePageChaseTimers( size_t{ 1 } << 22, PageKind::small );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_page_chase_4M_thp >()
+{
+    return MakePageChaseTimers( size_t{ 1 } << 22, PageKind::thp );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_page_chase_4M_2M >()
+{
+    return MakePageChaseTimers( size_t{ 1 } << 22, PageKind::huge_2M );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_page_chase_64M_4k >()
+{
+    return MakePageChaseTimers( size_t{ 1 } << 26, PageKind::small );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_page_chase_64M_thp >()
+{
+    return MakePageChaseTimers( size_t{ 1 } << 26, PageKind::thp );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_page_chase_64M_2M >()
+{
+    return MakePageChaseTimers( size_t{ 1 } << 26, PageKind::huge_2M );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_page_chase_1G_4k >()
+{
+    return MakePageChaseTimers( size_t{ 1 } << 30, PageKind::small );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_page_chase_1G_thp >()
+{
+    return MakePageChaseTimers( size_t{ 1 } << 30, PageKind::thp );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_page_chase_1G_2M >()
+{
+    return MakePageChaseTimers( size_t{ 1 } << 30, PageKind::huge_2M );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_page_chase_1G_1G >()
+{
+    return MakePageChaseTimers( size_t{ 1 } << 30, PageKind::huge_1G );
+}
+
+
+    // Accesses by each thread per iteration of cache_sharing_*, to amortize waking the team.
+static constexpr int Accesses_per_iter = 1000;
+
+    // In the mixed benchmarks, an access is an increment if its index has none of these bits set.
+static constexpr int Mixed_write_mask = 3;
+
+
+    // A team of threads, each accessing its own field of a shared buffer.
+class Sharing
+{
+public:
+    Sharing( size_t distance, SharingMix mix, int num_threads )
+    :
+        distance_( distance ),
+        mix_( mix ),
+        team_( num_threads, std::bind( &Sharing::run, this, std::placeholders::_1,
+            std::placeholders::_2 ) )
+    {
+        // Page-aligned, so that field 0 starts a pair of lines.
+        void *memory = nullptr;
+        const size_t size = (num_threads - 1) * distance + sizeof( Field );
+        if (int err = posix_memalign( &memory, 4096, size ))
+        {
+            throw_system_error( err, "posix_memalign()" );
+        }
+        memory_.reset( static_cast< uint8_t * >( memory ) );
+        for (int i = 0; i < num_threads; ++i) new (&field( i )) Field{ 0 };
+    }
+
+    Durations time( int num_iters )
+    {
+        return team_.time( num_iters ) / Accesses_per_iter;
+    }
+
+private:
+    using Field = std::atomic< uint64_t >;
+
+    Field &field( int idx )
+    {
+        return *reinterpret_cast< Field * >( memory_.get() + idx * distance_ );
+    }
+
+    void run( int idx, int num_iters )
+    {
+        Field &f = field( idx );
+
+        // Accesses are increments when their index has none of the bits of write_mask set.
+        bool writes = true;
+        int write_mask = 0;
+        if (mix_ == SharingMix::mixed) write_mask = Mixed_write_mask;
+        else if (mix_ == SharingMix::readers) writes = (idx == 0);
+
+        uint64_t sum = 0;
+        for (int iter = 0; iter < num_iters; ++iter)
+        {
+            for (int i = 0; i < Accesses_per_iter; ++i)
+            {
+                if (writes && (i & write_mask) == 0)
+                {
+                    f.store( f.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+                }
+                else sum += f.load( std::memory_order_relaxed );
+            }
+        }
+
+        volatile uint64_t sink = sum;
+        (void) sink;
+    }
+
+    const size_t distance_;
+    const SharingMix mix_;
+    std::unique_ptr< uint8_t, decltype( &free ) > memory_{ nullptr, &free };
+
+    ThreadTeam team_;   // Last, since it starts the threads which use the other members.
+};
+
+
+static autotime::BenchTimers MakeSharingTimers( size_t distance, SharingMix mix, int num_threads )
+{
+    using namespace std::placeholders;
+    auto sharing = std::make_shared< Sharing >( distance, mix, num_threads );
+    return { std::bind( &Sharing::time, sharing, _1 ), nullptr };
+}
+
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_0b_write_2t >()
+{
+    return MakeSharingTimers( 0, SharingMix::write, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_0b_write_4t >()
+{
+    return MakeSharingTimers( 0, SharingMix::write, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_0b_write_8t >()
+{
+    return MakeSharingTimers( 0, SharingMix::write, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_0b_mixed_2t >()
+{
+    return MakeSharingTimers( 0, SharingMix::mixed, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_0b_mixed_4t >()
+{
+    return MakeSharingTimers( 0, SharingMix::mixed, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_0b_mixed_8t >()
+{
+    return MakeSharingTimers( 0, SharingMix::mixed, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_0b_readers_2t >()
+{
+    return MakeSharingTimers( 0, SharingMix::readers, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_0b_readers_4t >()
+{
+    return MakeSharingTimers( 0, SharingMix::readers, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_0b_readers_8t >()
+{
+    return MakeSharingTimers( 0, SharingMix::readers, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_8b_write_2t >()
+{
+    return MakeSharingTimers( 8, SharingMix::write, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_8b_write_4t >()
+{
+    return MakeSharingTimers( 8, SharingMix::write, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_8b_write_8t >()
+{
+    return MakeSharingTimers( 8, SharingMix::write, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_8b_mixed_2t >()
+{
+    return MakeSharingTimers( 8, SharingMix::mixed, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_8b_mixed_4t >()
+{
+    return MakeSharingTimers( 8, SharingMix::mixed, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_8b_mixed_8t >()
+{
+    return MakeSharingTimers( 8, SharingMix::mixed, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_8b_readers_2t >()
+{
+    return MakeSharingTimers( 8, SharingMix::readers, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_8b_readers_4t >()
+{
+    return MakeSharingTimers( 8, SharingMix::readers, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_8b_readers_8t >()
+{
+    return MakeSharingTimers( 8, SharingMix::readers, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_64b_write_2t >()
+{
+    return MakeSharingTimers( 64, SharingMix::write, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_64b_write_4t >()
+{
+    return MakeSharingTimers( 64, SharingMix::write, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_64b_write_8t >()
+{
+    return MakeSharingTimers( 64, SharingMix::write, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_64b_mixed_2t >()
+{
+    return MakeSharingTimers( 64, SharingMix::mixed, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_64b_mixed_4t >()
+{
+    return MakeSharingTimers( 64, SharingMix::mixed, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_64b_mixed_8t >()
+{
+    return MakeSharingTimers( 64, SharingMix::mixed, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_64b_readers_2t >()
+{
+    return MakeSharingTimers( 64, SharingMix::readers, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_64b_readers_4t >()
+{
+    return MakeSharingTimers( 64, SharingMix::readers, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_64b_readers_8t >()
+{
+    return MakeSharingTimers( 64, SharingMix::readers, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_128b_write_2t >()
+{
+    return MakeSharingTimers( 128, SharingMix::write, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_128b_write_4t >()
+{
+    return MakeSharingTimers( 128, SharingMix::write, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_128b_write_8t >()
+{
+    return MakeSharingTimers( 128, SharingMix::write, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_128b_mixed_2t >()
+{
+    return MakeSharingTimers( 128, SharingMix::mixed, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_128b_mixed_4t >()
+{
+    return MakeSharingTimers( 128, SharingMix::mixed, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_128b_mixed_8t >()
+{
+    return MakeSharingTimers( 128, SharingMix::mixed, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_128b_readers_2t >()
+{
+    return MakeSharingTimers( 128, SharingMix::readers, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_128b_readers_4t >()
+{
+    return MakeSharingTimers( 128, SharingMix::readers, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::cache_sharing_128b_readers_8t >()
+{
+    return MakeSharingTimers( 128, SharingMix::readers, 8 );
+}
+
+
+} // namespace bench
@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Cache-related utilities.
+/*! @file
+
+    See cache_utils.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "cache_utils.hpp"
+
+#include <iomanip>
+#include <iterator>
+#include <ostream>
+#include <set>
+#include <utility>
+
+#include "format_utils.hpp"
+
+
+namespace bench
+{
+
+
+size_t ChaseWorkingSet( Benchmark benchmark )
+{
+    switch (benchmark)
+    {
+#define CASE__WORKING_SET( n, size ) \
+    case Benchmark::cache_chase_random_ ## n: \
+        return size
+
+    CASE__WORKING_SET( 4k, size_t{ 1 } << 12 );
+    CASE__WORKING_SET( 8k, size_t{ 1 } << 13 );
+    CASE__WORKING_SET( 16k, size_t{ 1 } << 14 );
+    CASE__WORKING_SET( 32k, size_t{ 1 } << 15 );
+    CASE__WORKING_SET( 64k, size_t{ 1 } << 16 );
+    CASE__WORKING_SET( 128k, size_t{ 1 } << 17 );
+    CASE__WORKING_SET( 256k, size_t{ 1 } << 18 );
+    CASE__WORKING_SET( 512k, size_t{ 1 } << 19 );
+    CASE__WORKING_SET( 1M, size_t{ 1 } << 20 );
+    CASE__WORKING_SET( 2M, size_t{ 1 } << 21 );
+    CASE__WORKING_SET( 4M, size_t{ 1 } << 22 );
+    CASE__WORKING_SET( 8M, size_t{ 1 } << 23 );
+    CASE__WORKING_SET( 16M, size_t{ 1 } << 24 );
+    CASE__WORKING_SET( 32M, size_t{ 1 } << 25 );
+    CASE__WORKING_SET( 64M, size_t{ 1 } << 26 );
+    CASE__WORKING_SET( 128M, size_t{ 1 } << 27 );
+    CASE__WORKING_SET( 256M, size_t{ 1 } << 28 );
+    CASE__WORKING_SET( 512M, size_t{ 1 } << 29 );
+    CASE__WORKING_SET( 1G, size_t{ 1 } << 30 );
+
+#undef CASE__WORKING_SET
+
+    default:
+        break;
+    }
+
+    return 0;
+}
+
+
+std::vector< CacheLevel > DetectCacheLevels( const std::map< size_t, double > &latencies )
+{
+    // Max latency increase between consecutive sizes on the same plateau.
+    constexpr double Plateau_ratio = 1.25;
+
+    std::vector< CacheLevel > levels;
+    std::vector< int > counts;
+    for (auto begin = latencies.begin(); begin != latencies.end(); )
+    {
+        auto last = begin;
+        double sum = begin->second;
+        int count = 1;
+        for (auto next = std::next( begin ); next != latencies.end(); ++next)
+        {
+            if (next->second > Plateau_ratio * last->second) break;
+
+            last = next;
+            sum += next->second;
+            ++count;
+        }
+        begin = std::next( last );
+
+        // Isolated sizes are transitions between plateaus.
+        if (count < 2) continue;
+
+        // A plateau that's no slower than the previous one must belong to the same level.
+        if (!levels.empty() && sum / count <= Plateau_ratio * levels.back().latency_ns)
+        {
+            sum += levels.back().latency_ns * counts.back();
+            count += counts.back();
+            levels.pop_back();
+            counts.pop_back();
+        }
+
+        const std::string name = "L" + std::to_string( levels.size() + 1 );
+        levels.push_back( { name, last->first, sum / count } );
+        counts.push_back( count );
+    }
+
+    const size_t largest = latencies.empty() ? 0 : latencies.rbegin()->first;
+    const bool reaches_dram = largest >= (size_t{ 1 } << 29);
+    if (reaches_dram && !levels.empty() && levels.back().max_size == largest)
+    {
+        levels.back().name = "DRAM";
+    }
+
+    return levels;
+}
+
+
+std::ostream &PrintCacheLevels( std::ostream &ostream, const std::vector< CacheLevel > &levels )
+{
+    ostream << "Cache levels (estimated from cache_chase_random_*):\n";
+    if (levels.empty()) return ostream << "  none found\n";
+
+    const auto precision_prev = ostream.precision( 4 );
+    for (const CacheLevel &level: levels)
+    {
+        ostream << "  " << level.name << ": up to ";
+        PrettyPrintSizeof( ostream, level.max_size ) << "B, " << level.latency_ns << " ns\n";
+    }
+    ostream.precision( precision_prev );
+
+    return ostream;
+}
+
+
+const char *ToCStr( SharingMix mix )
+{
+    switch (mix)
+    {
+#define CASE( n ) \
+    case SharingMix::n: \
+        return #n
+
+    CASE( write );
+    CASE( mixed );
+    CASE( readers );
+
+#undef CASE
+    }
+
+    return nullptr;
+}
+
+
+bool GetSharingParams( Benchmark benchmark, SharingParams &params )
+{
+    switch (benchmark)
+    {
+#define CASE( d, m, n ) \
+    case Benchmark::cache_sharing_##d##b_##m##_##n##t: \
+        params = { d, SharingMix::m, n }; \
+        return true
+
+#define CASES( d, m ) \
+    CASE( d, m, 2 ); \
+    CASE( d, m, 4 ); \
+    CASE( d, m, 8 )
+
+    CASES( 0, write );
+    CASES( 0, mixed );
+    CASES( 0, readers );
+    CASES( 8, write );
+    CASES( 8, mixed );
+    CASES( 8, readers );
+    CASES( 64, write );
+    CASES( 64, mixed );
+    CASES( 64, readers );
+    CASES( 128, write );
+    CASES( 128, mixed );
+    CASES( 128, readers );
+
+#undef CASES
+#undef CASE
+
+    default:
+        return false;
+    }
+}
+
+
+std::ostream &PrintSharingSummary(
+    std::ostream &ostream,
+    const std::vector< SharingResult > &results )
+{
+    std::set< size_t > distances;
+    std::map< std::pair< SharingMix, int >, std::map< size_t, double > > by_row;
+    for (const SharingResult &result: results)
+    {
+        const SharingParams &params = result.params;
+        distances.insert( params.distance );
+        by_row[std::make_pair( params.mix, params.num_threads )][params.distance] =
+            1e3 / result.ns_per_access;
+    }
+
+    ostream << "Cache line sharing (Mops/s per thread, by bytes between the threads' fields):\n";
+    ostream << "  " << std::setw( 8 ) << "mix" << std::setw( 8 ) << "threads";
+    for (size_t distance: distances) ostream << std::setw( 9 ) << (std::to_string( distance ) + " B");
+    ostream << "\n";
+
+    const auto flags_prev = ostream.flags();
+    const auto precision_prev = ostream.precision( 1 );
+    ostream << std::fixed;
+    for (const auto &row: by_row)
+    {
+        ostream << "  " << std::setw( 8 ) << ToCStr( row.first.first )
+            << std::setw( 8 ) << row.first.second;
+        for (size_t distance: distances)
+        {
+            auto it = row.second.find( distance );
+            if (it == row.second.end()) ostream << std::setw( 9 ) << "-";
+            else ostream << std::setw( 9 ) << it->second;
+        }
+        ostream << "\n";
+    }
+
+    ostream.precision( precision_prev );
+    ostream.flags( flags_prev );
+
+    return ostream;
+}
+
+
+} // namespace bench
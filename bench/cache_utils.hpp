@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Cache-related utilities.
+/*! @file
+
+    Supports estimating the sizes & latencies of the cache hierarchy, from the
+    results of the cache_chase_random_* benchmarks, and summarizing the
+    per-thread throughput of the cache_sharing_* benchmarks.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_CACHE_UTILS_HPP
+#define BENCH_CACHE_UTILS_HPP
+
+
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "list.hpp"
+
+
+namespace bench
+{
+
+
+    //! A plateau in the pointer-chasing latency ladder.
+struct CacheLevel
+{
+    std::string name;       //!< "L1", "L2", ..., or "DRAM".
+    size_t max_size;        //!< Largest working set that was measured on the plateau.
+    double latency_ns;      //!< Mean latency of the plateau.
+};
+
+
+    //! Returns the working set size of a cache_chase_random_* benchmark, or 0 for any other.
+size_t ChaseWorkingSet( Benchmark benchmark );
+
+
+    //! Groups a latency ladder (i.e. ns by working set size) into plateaus.
+    /*!
+        Consecutive sizes with similar latencies form a plateau, while isolated
+        sizes are taken to be transitions between levels and are skipped.  The
+        last plateau is named DRAM only if the ladder reaches 512 MiB.
+    */
+std::vector< CacheLevel > DetectCacheLevels( const std::map< size_t, double > &latencies );
+
+
+std::ostream &PrintCacheLevels( std::ostream &ostream, const std::vector< CacheLevel > &levels );
+
+
+    //! Which accesses the threads of a cache_sharing_* benchmark make to their fields.
+enum class SharingMix
+{
+    write,      //!< Every access is an increment.
+    mixed,      //!< 1 in 4 accesses is an increment, and the rest are loads.
+    readers     //!< Thread 0 only increments, while the others only load.
+};
+
+
+const char *ToCStr( SharingMix mix );
+
+
+    //! Parameters of a cache_sharing_* benchmark.
+struct SharingParams
+{
+    size_t distance;    //!< Bytes between the fields of consecutive threads (0 -> one field).
+    SharingMix mix;
+    int num_threads;
+};
+
+
+    //! Returns true and sets params, if benchmark is one of the cache_sharing_* benchmarks.
+bool GetSharingParams( Benchmark benchmark, SharingParams &params );
+
+
+struct SharingResult
+{
+    SharingParams params;
+    double ns_per_access;   //!< By each thread, so its inverse is the per-thread throughput.
+};
+
+
+    //! Prints per-thread throughput by mix & thread count, with a column per distance.
+std::ostream &PrintSharingSummary(
+    std::ostream &ostream,
+    const std::vector< SharingResult > &results );
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_CACHE_UTILS_HPP
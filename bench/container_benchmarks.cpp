@@ -19,14 +19,23 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+#include <boost/container/pmr/synchronized_pool_resource.hpp>
+#include <boost/container/pmr/unsynchronized_pool_resource.hpp>
+
 #include "autotime/overhead.hpp"
 #include "autotime/time.hpp"
 
+#include "allocator_utils.hpp"
 #include "container_utils.hpp"
+#include "description.hpp"
 #include "dispatch.hpp"
+#include "flat_containers.hpp"
 #include "list.hpp"
 
 
@@ -52,6 +61,61 @@ template<> bool CheckElement< std::string >( const std::string &val )
 }
 
 
+    // Mapped type of a given size, for the map benchmarks.
+template< size_t size > struct Payload
+{
+    uint8_t bytes[size];
+};
+
+
+template< typename key_t, size_t size >
+    using MapOf = std::map< key_t, Payload< size > >;
+
+
+template< typename key_t, size_t size >
+    using HashmapOf = std::unordered_map< key_t, Payload< size > >;
+
+
+    // The type of test data, which is the key type of maps.
+template< typename container_t > struct DataElement
+{
+    using type = typename container_t::value_type;
+};
+
+
+template< typename key_t, typename mapped_t > struct DataElement< FlatMap< key_t, mapped_t > >
+{
+    using type = key_t;
+};
+
+
+template< typename key_t, typename... params_t >
+    struct DataElement< std::map< key_t, params_t... > >
+{
+    using type = key_t;
+};
+
+
+template< typename key_t, typename... params_t >
+    struct DataElement< std::unordered_map< key_t, params_t... > >
+{
+    using type = key_t;
+};
+
+
+template< typename elem_t > inline const elem_t &Key( const elem_t &elem )
+{
+    return elem;
+}
+
+
+template< typename key_t, typename mapped_t >
+    inline const key_t &Key( const std::pair< key_t, mapped_t > &elem )
+{
+    return elem.first;
+}
+
+
 ////////////////////////////////
 // Dummy containers:
 ////////////////////////////////
@@ -63,49 +127,113 @@ template< typename container_t > container_t &Writable();
 // Insert generics:
 ////////////////////////////////
 
-template< typename element_t >
-    inline void InsertElement( std::unordered_set< element_t > &set, element_t value )
+template< typename element_t, typename... params_t >
+    inline void InsertElement( std::unordered_set< element_t, params_t... > &set, element_t value )
+{
+    set.insert( value );
+}
+
+
+template< typename element_t, typename... params_t >
+    inline void InsertElement( std::set< element_t, params_t... > &set, element_t value )
 {
     set.insert( value );
 }
 
 
+template< typename element_t, typename... params_t >
+    inline void InsertElement( std::deque< element_t, params_t... > &d, element_t value )
+{
+    d.push_back( value );
+}
+
+
+template< typename element_t, typename... params_t >
+    inline void InsertElement( std::list< element_t, params_t... > &l, element_t value )
+{
+    l.push_back( value );
+}
+
+
+template< typename element_t, typename... params_t >
+    inline void InsertElement( std::vector< element_t, params_t... > &v, element_t value )
+{
+    v.push_back( value );
+}
+
+
+template< typename element_t, typename mapped_t, typename... params_t >
+    inline void InsertElement(
+        std::map< element_t, mapped_t, params_t... > &map, element_t value )
+{
+    map.emplace( value, mapped_t() );
+}
+
+
+template< typename element_t, typename mapped_t, typename... params_t >
+    inline void InsertElement(
+        std::unordered_map< element_t, mapped_t, params_t... > &map, element_t value )
+{
+    map.emplace( value, mapped_t() );
+}
+
+
 template< typename element_t >
-    inline void InsertElement( std::set< element_t > &set, element_t value )
+    inline void InsertElement( FlatSet< element_t > &set, element_t value )
 {
     set.insert( value );
 }
 
 
+template< typename element_t, typename mapped_t >
+    inline void InsertElement( FlatMap< element_t, mapped_t > &map, element_t value )
+{
+    map.insert( { value, mapped_t() } );
+}
+
+
 template< typename element_t >
-    inline void InsertElement( std::deque< element_t > &d, element_t value )
+    inline void InsertElement( EytzingerSet< element_t > &set, element_t value )
 {
-    d.push_back( value );
+    set.insert( value );
 }
 
 
 template< typename element_t >
-    inline void InsertElement( std::list< element_t > &l, element_t value )
+    inline void InsertElement( LinearHashSet< element_t > &set, element_t value )
 {
-    l.push_back( value );
+    set.insert( value );
 }
 
 
 template< typename element_t >
-    inline void InsertElement( std::vector< element_t > &v, element_t value )
+    inline void InsertElement( SwissHashSet< element_t > &set, element_t value )
 {
-    v.push_back( value );
+    set.insert( value );
+}
+
+
+    // Completes a series of InsertElement() calls, for containers that need it.
+template< typename container_t > inline void FinishInsert( container_t & )
+{
+}
+
+
+template< typename element_t > inline void FinishInsert( EytzingerSet< element_t > &set )
+{
+    set.build();
 }
 
 
 template< typename container_t >
-    container_t Insert( const typename container_t::value_type *data, size_t n )
+    container_t Insert( const typename DataElement< container_t >::type *data, size_t n )
 {
     container_t result;
 
 #if 1
-    using element_t = typename container_t::value_type;
+    using element_t = typename DataElement< container_t >::type;
     for (size_t i = 0; i < n; ++i) InsertElement< element_t >( result, data[i] );
+    FinishInsert( result );
 #else
     for (size_t i = 0; i < n; ++i) result.insert( data[i] );
 #endif
@@ -115,30 +243,37 @@ template< typename container_t >
 
 
 template< typename container_t >
-    static Durations InsertTimer(
-        std::shared_ptr< typename container_t::value_type[] > data, size_t n, int num_iters )
+    container_t Insert(
+        const typename DataElement< container_t >::type *data, size_t n,
+        const typename container_t::allocator_type &allocator )
 {
-    Durations durations{};
-    for (int count = 0; count < num_iters; ++count)
-    {
-        TimePoints start_times = Start();
-        container_t tmp = Insert< container_t >( data.get(), n );
-        durations += End( start_times );
+    container_t result( allocator );
 
-        tmp.swap( Writable< container_t >() );
-    }
+    using element_t = typename DataElement< container_t >::type;
+    for (size_t i = 0; i < n; ++i) InsertElement< element_t >( result, data[i] );
 
-    return durations;
+    return result;
 }
 
 
 template< typename container_t >
     static autotime::BenchTimers MakeInsertTimers( size_t n )
 {
-    using namespace std::placeholders;
-    using value_t = typename container_t::value_type;
+    using value_t = typename DataElement< container_t >::type;
     std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
-    return { std::bind( &InsertTimer< container_t >, data, n, _1 ), nullptr };
+
+    std::function< void( TimingState & ) > f = [data, n]( TimingState &state )
+        {
+            {
+                container_t tmp = Insert< container_t >( data.get(), n );
+
+                state.pause();
+                tmp.swap( Writable< container_t >() );
+            }   // The previous iteration's container is destroyed, here.
+            state.resume();
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void, TimingState & >() ) };
 }
 
 
@@ -150,7 +285,7 @@ template< typename container_t >
     static size_t Count( const container_t &c )
 {
     size_t count = 0;
-    for (const auto &e: c) if (CheckElement< typename container_t::value_type >( e )) ++count;
+    for (const auto &e: c) if (CheckElement( Key( e ) )) ++count;
     return count;
 }
 
@@ -191,7 +326,7 @@ template< typename container_t >
     static autotime::BenchTimers MakeCountTimers( size_t n )
 {
     using namespace std::placeholders;
-    using value_t = typename container_t::value_type;
+    using value_t = typename DataElement< container_t >::type;
     std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
     std::shared_ptr< container_t > container{
         new container_t{ Insert< container_t >( data.get(), n ) } };
@@ -207,45 +342,95 @@ template< typename container_t >
 // Find generics:
 ////////////////////////////////
 
-template< typename element_t >
-    inline bool HasElement( const std::unordered_set< element_t > &set, element_t value )
+template< typename element_t, typename... params_t >
+    inline bool HasElement( const std::unordered_set< element_t, params_t... > &set, element_t value )
+{
+    return set.find( value ) != set.end();
+}
+
+
+template< typename element_t, typename... params_t >
+    inline bool HasElement( const std::set< element_t, params_t... > &set, element_t value )
 {
     return set.find( value ) != set.end();
 }
 
 
+template< typename element_t, typename... params_t >
+    inline bool HasElement( const std::deque< element_t, params_t... > &d, element_t value )
+{
+    return std::find( d.begin(), d.end(), value ) != d.end();
+}
+
+
+template< typename element_t, typename... params_t >
+    inline bool HasElement( const std::list< element_t, params_t... > &l, element_t value )
+{
+    return std::find( l.begin(), l.end(), value ) != l.end();
+}
+
+
+template< typename element_t, typename... params_t >
+    inline bool HasElement( const std::vector< element_t, params_t... > &v, element_t value )
+{
+    return std::find( v.begin(), v.end(), value ) != v.end();
+}
+
+
+template< typename element_t, typename... params_t >
+    inline bool HasElement( const std::map< element_t, params_t... > &map, element_t value )
+{
+    return map.find( value ) != map.end();
+}
+
+
+template< typename element_t, typename... params_t >
+    inline bool HasElement(
+        const std::unordered_map< element_t, params_t... > &map, element_t value )
+{
+    return map.find( value ) != map.end();
+}
+
+
 template< typename element_t >
-    inline bool HasElement( const std::set< element_t > &set, element_t value )
+    inline bool HasElement( const FlatSet< element_t > &set, element_t value )
 {
     return set.find( value ) != set.end();
 }
 
 
+template< typename element_t, typename mapped_t >
+    inline bool HasElement( const FlatMap< element_t, mapped_t > &map, element_t value )
+{
+    return map.find( value ) != map.end();
+}
+
+
 template< typename element_t >
-    inline bool HasElement( const std::deque< element_t > &d, element_t value )
+    inline bool HasElement( const EytzingerSet< element_t > &set, element_t value )
 {
-    return std::find( d.begin(), d.end(), value ) != d.end();
+    return set.find( value ) != set.end();
 }
 
 
 template< typename element_t >
-    inline bool HasElement( const std::list< element_t > &l, element_t value )
+    inline bool HasElement( const LinearHashSet< element_t > &set, element_t value )
 {
-    return std::find( l.begin(), l.end(), value ) != l.end();
+    return set.find( value ) != set.end();
 }
 
 
 template< typename element_t >
-    inline bool HasElement( const std::vector< element_t > &v, element_t value )
+    inline bool HasElement( const SwissHashSet< element_t > &set, element_t value )
 {
-    return std::find( v.begin(), v.end(), value ) != v.end();
+    return set.find( value ) != set.end();
 }
 
 
 template< typename container_t >
     static Durations FindTimer(
         std::shared_ptr< container_t > container,
-        std::shared_ptr< typename container_t::value_type[] > data,
+        std::shared_ptr< typename DataElement< container_t >::type[] > data,
         int data_size,
         int num_iters )
 {
@@ -255,7 +440,7 @@ template< typename container_t >
     TimePoints start_times = Start();
     for (int i = 0; i < num_iters; ++i)
     {
-        using element_t = typename container_t::value_type;
+        using element_t = typename DataElement< container_t >::type;
         if (HasElement< element_t >( c, data[i % data_size] )) ++count;
     }
     CountResult = count;
@@ -268,7 +453,7 @@ template< typename container_t >
     static autotime::BenchTimers MakeFindTimers( bool sort, size_t n )
 {
     using namespace std::placeholders;
-    using value_t = typename container_t::value_type;
+    using value_t = typename DataElement< container_t >::type;
     std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
     std::shared_ptr< container_t > container{
         new container_t{ Insert< container_t >( data.get(), n ) } };
@@ -279,6 +464,22 @@ template< typename container_t >
 }
 
 
+template< typename container_t >
+    static autotime::BenchTimers MakeFindMissTimers( size_t n )
+{
+    using namespace std::placeholders;
+    using value_t = typename DataElement< container_t >::type;
+
+    // Only the first half of the (unique) elements is inserted, so the second half are misses.
+    std::shared_ptr< value_t[] > data = MakeData< value_t >( 2 * n );
+    std::shared_ptr< container_t > container{
+        new container_t{ Insert< container_t >( data.get(), n ) } };
+    std::shared_ptr< value_t[] > misses( data, data.get() + n );
+
+    return { std::bind( &FindTimer< container_t >, container, misses, n, _1 ), nullptr };
+}
+
+
 ////////////////////////////////
 // Copy generics:
 ////////////////////////////////
@@ -323,7 +524,7 @@ template< typename container_t >
     static autotime::BenchTimers MakeCopyTimers( size_t n )
 {
     using namespace std::placeholders;
-    using value_t = typename container_t::value_type;
+    using value_t = typename DataElement< container_t >::type;
     std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
     std::shared_ptr< container_t > container{
         new container_t{ Insert< container_t >( data.get(), n ) } };
@@ -365,7 +566,7 @@ template< typename container_t >
     static autotime::BenchTimers MakeDestroyTimers( size_t n )
 {
     using namespace std::placeholders;
-    using value_t = typename container_t::value_type;
+    using value_t = typename DataElement< container_t >::type;
     std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
     std::shared_ptr< container_t > container{
         new container_t{ Insert< container_t >( data.get(), n ) } };
@@ -377,951 +578,3994 @@ template< typename container_t >
 }
 
 
-////////////////////////////////////////////////////////////
-// Category::std_deque:
-////////////////////////////////////////////////////////////
+////////////////////////////////
+// Erase generics:
+////////////////////////////////
 
-std::deque< int32_t > Deque_int32;
-std::deque< int64_t > Deque_int64;
-std::deque< float > Deque_float;
-std::deque< double > Deque_double;
-std::deque< std::string > Deque_string;
+template< typename container_t >
+    static autotime::BenchTimers MakeEraseTimers( size_t n )
+{
+    using value_t = typename DataElement< container_t >::type;
+    std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
+    std::shared_ptr< container_t > src{
+        new container_t{ Insert< container_t >( data.get(), n ) } };
 
+    std::function< void( TimingState & ) > f = [src, data, n]( TimingState &state )
+        {
+            state.pause();
+            {
+                container_t tmp = *src;
 
-template<> std::deque< int32_t > &Writable< std::deque< int32_t > >()
-{
-    return Deque_int32;
+                state.resume();
+                for (size_t i = 0; i < n; ++i) tmp.erase( data[i] );
+                state.pause();
+            }
+            state.resume();
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void, TimingState & >() ) };
 }
 
 
-template<> std::deque< int64_t > &Writable< std::deque< int64_t > >()
+////////////////////////////////
+// Hash table generics:
+////////////////////////////////
+
+template< typename container_t >
+    static autotime::BenchTimers MakeReservedInsertTimers( size_t n )
 {
-    return Deque_int64;
-}
+    using value_t = typename DataElement< container_t >::type;
+    std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
+
+    std::function< void( TimingState & ) > f = [data, n]( TimingState &state )
+        {
+            {
+                container_t tmp;
+                tmp.reserve( n );
+                for (size_t i = 0; i < n; ++i) InsertElement< value_t >( tmp, data[i] );
 
+                state.pause();
+                tmp.swap( Writable< container_t >() );
+            }   // The previous iteration's container is destroyed, here.
+            state.resume();
+        };
 
-template<> std::deque< float > &Writable< std::deque< float > >()
-{
-    return Deque_float;
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void, TimingState & >() ) };
 }
 
 
-template<> std::deque< double > &Writable< std::deque< double > >()
+    // Times the rehash that growth would trigger, by doubling the bucket count of a full table.
+template< typename container_t >
+    static autotime::BenchTimers MakeRehashTimers( size_t n )
 {
-    return Deque_double;
-}
+    using value_t = typename DataElement< container_t >::type;
+    std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
+    std::shared_ptr< container_t > src{
+        new container_t{ Insert< container_t >( data.get(), n ) } };
 
+    std::function< void( TimingState & ) > f = [src]( TimingState &state )
+        {
+            state.pause();
+            {
+                container_t tmp = *src;
 
-template<> std::deque< std::string > &Writable< std::deque< std::string > >()
-{
-    return Deque_string;
-}
+                state.resume();
+                tmp.rehash( 2 * tmp.bucket_count() );
+                state.pause();
+            }
+            state.resume();
+        };
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_insert16 >()
-{
-    return MakeInsertTimers< std::deque< int32_t > >( 1 << 4 );
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void, TimingState & >() ) };
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_insert256 >()
-{
-    return MakeInsertTimers< std::deque< int32_t > >( 1 << 8 );
-}
+////////////////////////////////
+// Allocator fixtures:
+////////////////////////////////
 
+namespace pmr = boost::container::pmr;
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_insert4k >()
+
+    // Owns a memory resource and hands out polymorphic allocators which use it.
+template< typename resource_t, bool release >
+    struct PmrFixture
 {
-    return MakeInsertTimers< std::deque< int32_t > >( 1 << 12 );
-}
+    template< typename T > using allocator = pmr::polymorphic_allocator< T >;
 
+    resource_t resource_;
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_insert64k >()
-{
-    return MakeInsertTimers< std::deque< int32_t > >( 1 << 16 );
-}
+    allocator< char > get_allocator()
+    {
+        return allocator< char >( &resource_ );
+    }
+
+        // Pools keep their memory, while monotonic resources can only be reclaimed in bulk.
+    void reset()
+    {
+        if (release) resource_.release();
+    }
+};
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_insert1M >()
-{
-    return MakeInsertTimers< std::deque< int32_t > >( 1 << 20 );
-}
+using MonotonicFixture = PmrFixture< pmr::monotonic_buffer_resource, true >;
+using UnsyncPoolFixture = PmrFixture< pmr::unsynchronized_pool_resource, false >;
+using SyncPoolFixture = PmrFixture< pmr::synchronized_pool_resource, false >;
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int64_insert4k >()
+    // Owns an Arena and hands out (non-polymorphic) allocators which use it.
+struct ArenaFixture
 {
-    return MakeInsertTimers< std::deque< int64_t > >( 1 << 12 );
-}
+    template< typename T > using allocator = ArenaAllocator< T >;
 
+    Arena arena_;
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_float_insert4k >()
-{
-    return MakeInsertTimers< std::deque< float > >( 1 << 12 );
-}
+    allocator< char > get_allocator()
+    {
+        return allocator< char >( arena_ );
+    }
+
+    void reset()
+    {
+        arena_.reset();
+    }
+};
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_double_insert4k >()
+    // Notes on the _arena, _mono, _spool & _upool variants, shared by the categories with them.
+static std::vector< std::string > FixtureNotes()
 {
-    return MakeInsertTimers< std::deque< double > >( 1 << 12 );
+    return
+        {
+            "The _arena, _mono, _spool, and _upool variants use int32 elements with a bench"
+                " Arena, or a Boost.Container monotonic_buffer_resource,"
+                " synchronized_pool_resource, or unsynchronized_pool_resource, respectively.",
+            "Between iterations, the arena is rewound and the monotonic resource is released"
+                " (so its upstream allocations are timed), while the pools retain their memory.",
+        };
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_string_insert4k >()
-{
-    return MakeInsertTimers< std::deque< std::string > >( 1 << 12 );
-}
+    // Applies a fixture's allocator to one of the container families.
+template<
+    template< typename, typename > class family_t,
+    typename fixture_t,
+    typename element_t
+>
+using Allocated = family_t< element_t, typename fixture_t::template allocator< element_t > >;
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_iterate16 >()
-{
-    return MakeCountTimers< std::deque< int32_t > >( 1 << 4 );
-}
+template< typename element_t, typename allocator_t >
+    using SetOf = std::set< element_t, std::less< element_t >, allocator_t >;
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_iterate256 >()
-{
-    return MakeCountTimers< std::deque< int32_t > >( 1 << 8 );
-}
+template< typename element_t, typename allocator_t >
+    using HashsetOf =
+        std::unordered_set<
+            element_t, std::hash< element_t >, std::equal_to< element_t >, allocator_t >;
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_iterate4k >()
+    // Bundles a fixture with a container that uses it (and must be destroyed first).
+template< typename container_t, typename fixture_t >
+    struct FixtureContainer
 {
-    return MakeCountTimers< std::deque< int32_t > >( 1 << 12 );
-}
+    fixture_t fixture_;
+    container_t container_;
 
+    FixtureContainer(
+        const typename DataElement< container_t >::type *data, size_t n, bool copy )
+    :
+        container_( Insert< container_t >( data, n, fixture_.get_allocator() ) )
+    {
+        // Like CountTimer() & DestroyTimer(), use a copy, which allocates in traversal order.
+        if (copy)
+        {
+            const container_t src = std::move( container_ );
+            container_ = src;
+        }
+    }
+};
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_iterate64k >()
+
+template< typename container_t, typename fixture_t >
+    static std::shared_ptr< container_t > MakeFixtureContainer(
+        const typename DataElement< container_t >::type *data, size_t n, bool copy )
 {
-    return MakeCountTimers< std::deque< int32_t > >( 1 << 16 );
+    using bundle_t = FixtureContainer< container_t, fixture_t >;
+    auto p_bundle = std::make_shared< bundle_t >( data, n, copy );
+    return std::shared_ptr< container_t >( p_bundle, &p_bundle->container_ );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_iterate1M >()
+template< typename container_t, typename fixture_t >
+    static autotime::BenchTimers MakeFixtureInsertTimers( size_t n )
 {
-    return MakeCountTimers< std::deque< int32_t > >( 1 << 20 );
-}
+    using value_t = typename DataElement< container_t >::type;
+    std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
+    std::shared_ptr< fixture_t > fixture = std::make_shared< fixture_t >();
 
+    std::function< void( TimingState & ) > f = [data, n, fixture]( TimingState &state )
+        {
+            {
+                container_t tmp =
+                    Insert< container_t >( data.get(), n, fixture->get_allocator() );
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int64_iterate64k >()
+                state.pause();
+            }
+            fixture->reset();
+            state.resume();
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void, TimingState & >() ) };
+}
+
+
+template< typename container_t, typename fixture_t >
+    static autotime::BenchTimers MakeFixtureCountTimers( size_t n )
 {
-    return MakeCountTimers< std::deque< int64_t > >( 1 << 16 );
+    using value_t = typename DataElement< container_t >::type;
+    std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
+    std::shared_ptr< container_t > container =
+        MakeFixtureContainer< container_t, fixture_t >( data.get(), n, true );
+
+    // Unlike CountTimer(), mustn't copy the container, which would use the default allocator.
+    std::function< void() > f = [container]()
+        {
+            CountResult = Count< container_t >( *container );
+        };
+
+    std::function< void() > o = [container]()
+        {
+            ContainerEmpty = container->empty();
+        };
+
+    return { MakeTimer( f ), MakeTimer( o ) };
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_float_iterate64k >()
+template< typename container_t, typename fixture_t >
+    static autotime::BenchTimers MakeFixtureFindTimers( bool sort, size_t n )
 {
-    return MakeCountTimers< std::deque< float > >( 1 << 16 );
+    using namespace std::placeholders;
+    using value_t = typename DataElement< container_t >::type;
+    std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
+    std::shared_ptr< container_t > container =
+        MakeFixtureContainer< container_t, fixture_t >( data.get(), n, false );
+
+    if (sort) std::sort( data.get(), data.get() + n );
+
+    return { std::bind( &FindTimer< container_t >, container, data, n, _1 ), nullptr };
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_double_iterate64k >()
+template< typename container_t, typename fixture_t >
+    static autotime::BenchTimers MakeFixtureDestroyTimers( size_t n )
 {
-    return MakeCountTimers< std::deque< double > >( 1 << 16 );
+    using value_t = typename DataElement< container_t >::type;
+    std::shared_ptr< value_t[] > data = MakeData< value_t >( n );
+    std::shared_ptr< container_t > src =
+        MakeFixtureContainer< container_t, fixture_t >( data.get(), n, false );
+    std::shared_ptr< fixture_t > fixture = std::make_shared< fixture_t >();
+
+    std::function< void( TimingState & ) > f = [src, fixture]( TimingState &state )
+        {
+            state.pause();
+            fixture->reset();
+            {
+                container_t tmp( fixture->get_allocator() );
+                tmp = *src;
+
+                state.resume();
+            }
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void, TimingState & >() ) };
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_string_iterate64k >()
+////////////////////////////////////////////////////////////
+// Category::eytzinger:
+////////////////////////////////////////////////////////////
+
+template<> Description Describe< Category::eytzinger >()
 {
-    return MakeCountTimers< std::deque< std::string > >( 1 << 16 );
+    Description desc;
+    desc.measures =
+        "Eytzinger array copy, destroy, find, insert, and iteration, by element type and size.";
+    desc.notes =
+        {
+            "Insert appends each element, then sorts and lays out the array once (i.e. it"
+                " measures bulk construction).",
+            "Iteration is in layout order, rather than sorted order.",
+            "Find queries are in the same (random) order as std_set's.",
+        };
+    return desc;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find1 >()
+EytzingerSet< int32_t > Eytzinger_int32;
+EytzingerSet< int64_t > Eytzinger_int64;
+EytzingerSet< float > Eytzinger_float;
+EytzingerSet< double > Eytzinger_double;
+EytzingerSet< std::string > Eytzinger_string;
+
+
+template<> EytzingerSet< int32_t > &Writable< EytzingerSet< int32_t > >()
 {
-    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 0 );
+    return Eytzinger_int32;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find16 >()
+template<> EytzingerSet< int64_t > &Writable< EytzingerSet< int64_t > >()
 {
-    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 4 );
+    return Eytzinger_int64;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find256 >()
+template<> EytzingerSet< float > &Writable< EytzingerSet< float > >()
 {
-    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 8 );
+    return Eytzinger_float;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find4k >()
+template<> EytzingerSet< double > &Writable< EytzingerSet< double > >()
 {
-    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 12 );
+    return Eytzinger_double;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find64k >()
+template<> EytzingerSet< std::string > &Writable< EytzingerSet< std::string > >()
 {
-    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 16 );
+    return Eytzinger_string;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_copy16 >()
 {
-    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 20 );
+    return MakeCopyTimers< EytzingerSet< int32_t > >( 1 << 4 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int64_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_copy256 >()
 {
-    return MakeFindTimers< std::deque< int64_t > >( true, 1 << 16 );
+    return MakeCopyTimers< EytzingerSet< int32_t > >( 1 << 8 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_float_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_copy4k >()
 {
-    return MakeFindTimers< std::deque< float > >( true, 1 << 16 );
+    return MakeCopyTimers< EytzingerSet< int32_t > >( 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_double_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_copy64k >()
 {
-    return MakeFindTimers< std::deque< double > >( true, 1 << 16 );
+    return MakeCopyTimers< EytzingerSet< int32_t > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_string_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_copy1M >()
 {
-    return MakeFindTimers< std::deque< std::string > >( true, 1 << 16 );
+    return MakeCopyTimers< EytzingerSet< int32_t > >( 1 << 20 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_copy16 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_destroy16 >()
 {
-    return MakeCopyTimers< std::deque< int32_t > >( 1 << 4 );
+    return MakeDestroyTimers< EytzingerSet< int32_t > >( 1 << 4 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_copy256 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_destroy256 >()
 {
-    return MakeCopyTimers< std::deque< int32_t > >( 1 << 8 );
+    return MakeDestroyTimers< EytzingerSet< int32_t > >( 1 << 8 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_copy4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_destroy4k >()
 {
-    return MakeCopyTimers< std::deque< int32_t > >( 1 << 12 );
+    return MakeDestroyTimers< EytzingerSet< int32_t > >( 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_destroy64k >()
 {
-    return MakeCopyTimers< std::deque< int32_t > >( 1 << 16 );
+    return MakeDestroyTimers< EytzingerSet< int32_t > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_copy1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_destroy1M >()
 {
-    return MakeCopyTimers< std::deque< int32_t > >( 1 << 20 );
+    return MakeDestroyTimers< EytzingerSet< int32_t > >( 1 << 20 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int64_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_find1 >()
 {
-    return MakeCopyTimers< std::deque< int64_t > >( 1 << 16 );
+    return MakeFindTimers< EytzingerSet< int32_t > >( false, 1 << 0 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_float_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_find16 >()
 {
-    return MakeCopyTimers< std::deque< float > >( 1 << 16 );
+    return MakeFindTimers< EytzingerSet< int32_t > >( false, 1 << 4 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_double_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_find256 >()
 {
-    return MakeCopyTimers< std::deque< double > >( 1 << 16 );
+    return MakeFindTimers< EytzingerSet< int32_t > >( false, 1 << 8 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_string_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_find4k >()
 {
-    return MakeCopyTimers< std::deque< std::string > >( 1 << 16 );
+    return MakeFindTimers< EytzingerSet< int32_t > >( false, 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_destroy16 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_find64k >()
 {
-    return MakeDestroyTimers< std::deque< int32_t > >( 1 << 4 );
+    return MakeFindTimers< EytzingerSet< int32_t > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_destroy256 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_find1M >()
 {
-    return MakeDestroyTimers< std::deque< int32_t > >( 1 << 8 );
+    return MakeFindTimers< EytzingerSet< int32_t > >( false, 1 << 20 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_destroy4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_insert16 >()
 {
-    return MakeDestroyTimers< std::deque< int32_t > >( 1 << 12 );
+    return MakeInsertTimers< EytzingerSet< int32_t > >( 1 << 4 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_insert256 >()
 {
-    return MakeDestroyTimers< std::deque< int32_t > >( 1 << 16 );
+    return MakeInsertTimers< EytzingerSet< int32_t > >( 1 << 8 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_destroy1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_insert4k >()
 {
-    return MakeDestroyTimers< std::deque< int32_t > >( 1 << 20 );
+    return MakeInsertTimers< EytzingerSet< int32_t > >( 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int64_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_insert64k >()
 {
-    return MakeDestroyTimers< std::deque< int64_t > >( 1 << 16 );
+    return MakeInsertTimers< EytzingerSet< int32_t > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_float_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_insert1M >()
 {
-    return MakeDestroyTimers< std::deque< float > >( 1 << 16 );
+    return MakeInsertTimers< EytzingerSet< int32_t > >( 1 << 20 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_double_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_iterate16 >()
 {
-    return MakeDestroyTimers< std::deque< double > >( 1 << 16 );
+    return MakeCountTimers< EytzingerSet< int32_t > >( 1 << 4 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::deque_string_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_iterate256 >()
 {
-    return MakeDestroyTimers< std::deque< std::string > >( 1 << 16 );
+    return MakeCountTimers< EytzingerSet< int32_t > >( 1 << 8 );
 }
 
 
-////////////////////////////////////////////////////////////
-// Category::std_hashset:
-////////////////////////////////////////////////////////////
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_iterate4k >()
+{
+    return MakeCountTimers< EytzingerSet< int32_t > >( 1 << 12 );
+}
 
-std::unordered_set< int32_t > Hashset_int32;
-std::unordered_set< int64_t > Hashset_int64;
-std::unordered_set< float > Hashset_float;
-std::unordered_set< double > Hashset_double;
-std::unordered_set< std::string > Hashset_string;
 
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_iterate64k >()
+{
+    return MakeCountTimers< EytzingerSet< int32_t > >( 1 << 16 );
+}
 
-template<> std::unordered_set< int32_t > &Writable< std::unordered_set< int32_t > >()
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int32_iterate1M >()
 {
-    return Hashset_int32;
+    return MakeCountTimers< EytzingerSet< int32_t > >( 1 << 20 );
 }
 
 
-template<> std::unordered_set< int64_t > &Writable< std::unordered_set< int64_t > >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int64_copy64k >()
 {
-    return Hashset_int64;
+    return MakeCopyTimers< EytzingerSet< int64_t > >( 1 << 16 );
 }
 
 
-template<> std::unordered_set< float > &Writable< std::unordered_set< float > >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int64_destroy64k >()
 {
-    return Hashset_float;
+    return MakeDestroyTimers< EytzingerSet< int64_t > >( 1 << 16 );
 }
 
 
-template<> std::unordered_set< double > &Writable< std::unordered_set< double > >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int64_find64k >()
 {
-    return Hashset_double;
+    return MakeFindTimers< EytzingerSet< int64_t > >( false, 1 << 16 );
 }
 
 
-template<> std::unordered_set< std::string > &Writable< std::unordered_set< std::string > >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int64_insert4k >()
 {
-    return Hashset_string;
+    return MakeInsertTimers< EytzingerSet< int64_t > >( 1 << 12 );
 }
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_insert16 >()
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_int64_iterate64k >()
 {
-    return MakeInsertTimers< std::unordered_set< int32_t > >( 1 << 4 );
+    return MakeCountTimers< EytzingerSet< int64_t > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_insert256 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_float_copy64k >()
 {
-    return MakeInsertTimers< std::unordered_set< int32_t > >( 1 << 8 );
+    return MakeCopyTimers< EytzingerSet< float > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_insert4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_float_destroy64k >()
 {
-    return MakeInsertTimers< std::unordered_set< int32_t > >( 1 << 12 );
+    return MakeDestroyTimers< EytzingerSet< float > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_insert64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_float_find64k >()
 {
-    return MakeInsertTimers< std::unordered_set< int32_t > >( 1 << 16 );
+    return MakeFindTimers< EytzingerSet< float > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_insert1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_float_insert4k >()
 {
-    return MakeInsertTimers< std::unordered_set< int32_t > >( 1 << 20 );
+    return MakeInsertTimers< EytzingerSet< float > >( 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int64_insert4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_float_iterate64k >()
 {
-    return MakeInsertTimers< std::unordered_set< int64_t > >( 1 << 12 );
+    return MakeCountTimers< EytzingerSet< float > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_float_insert4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_double_copy64k >()
 {
-    return MakeInsertTimers< std::unordered_set< float > >( 1 << 12 );
+    return MakeCopyTimers< EytzingerSet< double > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_double_insert4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_double_destroy64k >()
 {
-    return MakeInsertTimers< std::unordered_set< double > >( 1 << 12 );
+    return MakeDestroyTimers< EytzingerSet< double > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_string_insert4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_double_find64k >()
 {
-    return MakeInsertTimers< std::unordered_set< std::string > >( 1 << 12 );
+    return MakeFindTimers< EytzingerSet< double > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_iterate16 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_double_insert4k >()
 {
-    return MakeCountTimers< std::unordered_set< int32_t > >( 1 << 4 );
+    return MakeInsertTimers< EytzingerSet< double > >( 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_iterate256 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_double_iterate64k >()
 {
-    return MakeCountTimers< std::unordered_set< int32_t > >( 1 << 8 );
+    return MakeCountTimers< EytzingerSet< double > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_iterate4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_string_copy64k >()
 {
-    return MakeCountTimers< std::unordered_set< int32_t > >( 1 << 12 );
+    return MakeCopyTimers< EytzingerSet< std::string > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_iterate64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_string_destroy64k >()
 {
-    return MakeCountTimers< std::unordered_set< int32_t > >( 1 << 16 );
+    return MakeDestroyTimers< EytzingerSet< std::string > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_iterate1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_string_find64k >()
 {
-    return MakeCountTimers< std::unordered_set< int32_t > >( 1 << 20 );
+    return MakeFindTimers< EytzingerSet< std::string > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int64_iterate64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_string_insert4k >()
 {
-    return MakeCountTimers< std::unordered_set< int64_t > >( 1 << 16 );
+    return MakeInsertTimers< EytzingerSet< std::string > >( 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_float_iterate64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::eytzinger_string_iterate64k >()
 {
-    return MakeCountTimers< std::unordered_set< float > >( 1 << 16 );
+    return MakeCountTimers< EytzingerSet< std::string > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_double_iterate64k >()
+////////////////////////////////////////////////////////////
+// Category::flat_hashset:
+////////////////////////////////////////////////////////////
+
+template<> Description Describe< Category::flat_hashset >()
 {
-    return MakeCountTimers< std::unordered_set< double > >( 1 << 16 );
+    Description desc;
+    desc.measures =
+        "Open-addressing hash set copy, destroy, find, insert, and iteration, by element type &"
+            " size.";
+    desc.notes =
+        {
+            "linearset_ uses linear probing, with a max load factor of 1/2.",
+            "swissset_ probes groups of 16 control bytes via SSE2 compares (i.e. Swiss table"
+                " style), with a max load factor of 7/8.",
+            "Both finalize std::hash<> with a 64-bit mixer, since it's the identity function"
+                " for integers and the table sizes are powers of 2.",
+            "Find queries are in the same (sorted) order as std_hashset's, but the mixer"
+                " scatters them across the table.",
+        };
+    return desc;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_string_iterate64k >()
+LinearHashSet< int32_t > LinearSet_int32;
+LinearHashSet< int64_t > LinearSet_int64;
+LinearHashSet< float > LinearSet_float;
+LinearHashSet< double > LinearSet_double;
+LinearHashSet< std::string > LinearSet_string;
+
+
+template<> LinearHashSet< int32_t > &Writable< LinearHashSet< int32_t > >()
 {
-    return MakeCountTimers< std::unordered_set< std::string > >( 1 << 16 );
+    return LinearSet_int32;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find1 >()
+template<> LinearHashSet< int64_t > &Writable< LinearHashSet< int64_t > >()
 {
-    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 0 );
+    return LinearSet_int64;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find16 >()
+template<> LinearHashSet< float > &Writable< LinearHashSet< float > >()
 {
-    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 4 );
+    return LinearSet_float;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find256 >()
+template<> LinearHashSet< double > &Writable< LinearHashSet< double > >()
 {
-    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 8 );
+    return LinearSet_double;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find4k >()
+template<> LinearHashSet< std::string > &Writable< LinearHashSet< std::string > >()
 {
-    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 12 );
+    return LinearSet_string;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_copy16 >()
 {
-    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 16 );
+    return MakeCopyTimers< LinearHashSet< int32_t > >( 1 << 4 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_copy256 >()
 {
-    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 20 );
+    return MakeCopyTimers< LinearHashSet< int32_t > >( 1 << 8 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int64_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_copy4k >()
 {
-    return MakeFindTimers< std::unordered_set< int64_t > >( true, 1 << 16 );
+    return MakeCopyTimers< LinearHashSet< int32_t > >( 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_float_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_copy64k >()
 {
-    return MakeFindTimers< std::unordered_set< float > >( true, 1 << 16 );
+    return MakeCopyTimers< LinearHashSet< int32_t > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_double_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_copy1M >()
 {
-    return MakeFindTimers< std::unordered_set< double > >( true, 1 << 16 );
+    return MakeCopyTimers< LinearHashSet< int32_t > >( 1 << 20 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_string_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_destroy16 >()
 {
-    return MakeFindTimers< std::unordered_set< std::string > >( true, 1 << 16 );
+    return MakeDestroyTimers< LinearHashSet< int32_t > >( 1 << 4 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_copy16 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_destroy256 >()
 {
-    return MakeCopyTimers< std::unordered_set< int32_t > >( 1 << 4 );
+    return MakeDestroyTimers< LinearHashSet< int32_t > >( 1 << 8 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_copy256 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_destroy4k >()
 {
-    return MakeCopyTimers< std::unordered_set< int32_t > >( 1 << 8 );
+    return MakeDestroyTimers< LinearHashSet< int32_t > >( 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_copy4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_destroy64k >()
 {
-    return MakeCopyTimers< std::unordered_set< int32_t > >( 1 << 12 );
+    return MakeDestroyTimers< LinearHashSet< int32_t > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_destroy1M >()
 {
-    return MakeCopyTimers< std::unordered_set< int32_t > >( 1 << 16 );
+    return MakeDestroyTimers< LinearHashSet< int32_t > >( 1 << 20 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_copy1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_find1 >()
 {
-    return MakeCopyTimers< std::unordered_set< int32_t > >( 1 << 20 );
+    return MakeFindTimers< LinearHashSet< int32_t > >( true, 1 << 0 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int64_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_find16 >()
 {
-    return MakeCopyTimers< std::unordered_set< int64_t > >( 1 << 16 );
+    return MakeFindTimers< LinearHashSet< int32_t > >( true, 1 << 4 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_float_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_find256 >()
 {
-    return MakeCopyTimers< std::unordered_set< float > >( 1 << 16 );
+    return MakeFindTimers< LinearHashSet< int32_t > >( true, 1 << 8 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_double_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_find4k >()
 {
-    return MakeCopyTimers< std::unordered_set< double > >( 1 << 16 );
+    return MakeFindTimers< LinearHashSet< int32_t > >( true, 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_string_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_find64k >()
 {
-    return MakeCopyTimers< std::unordered_set< std::string > >( 1 << 16 );
+    return MakeFindTimers< LinearHashSet< int32_t > >( true, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_destroy16 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_find1M >()
 {
-    return MakeDestroyTimers< std::unordered_set< int32_t > >( 1 << 4 );
+    return MakeFindTimers< LinearHashSet< int32_t > >( true, 1 << 20 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_destroy256 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_insert16 >()
 {
-    return MakeDestroyTimers< std::unordered_set< int32_t > >( 1 << 8 );
+    return MakeInsertTimers< LinearHashSet< int32_t > >( 1 << 4 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_destroy4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_insert256 >()
 {
-    return MakeDestroyTimers< std::unordered_set< int32_t > >( 1 << 12 );
+    return MakeInsertTimers< LinearHashSet< int32_t > >( 1 << 8 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_insert4k >()
 {
-    return MakeDestroyTimers< std::unordered_set< int32_t > >( 1 << 16 );
+    return MakeInsertTimers< LinearHashSet< int32_t > >( 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_destroy1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_insert64k >()
 {
-    return MakeDestroyTimers< std::unordered_set< int32_t > >( 1 << 20 );
+    return MakeInsertTimers< LinearHashSet< int32_t > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int64_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_insert1M >()
 {
-    return MakeDestroyTimers< std::unordered_set< int64_t > >( 1 << 16 );
+    return MakeInsertTimers< LinearHashSet< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_iterate16 >()
+{
+    return MakeCountTimers< LinearHashSet< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_iterate256 >()
+{
+    return MakeCountTimers< LinearHashSet< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_iterate4k >()
+{
+    return MakeCountTimers< LinearHashSet< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_iterate64k >()
+{
+    return MakeCountTimers< LinearHashSet< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int32_iterate1M >()
+{
+    return MakeCountTimers< LinearHashSet< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int64_copy64k >()
+{
+    return MakeCopyTimers< LinearHashSet< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int64_destroy64k >()
+{
+    return MakeDestroyTimers< LinearHashSet< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int64_find64k >()
+{
+    return MakeFindTimers< LinearHashSet< int64_t > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int64_insert4k >()
+{
+    return MakeInsertTimers< LinearHashSet< int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_int64_iterate64k >()
+{
+    return MakeCountTimers< LinearHashSet< int64_t > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_float_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_float_copy64k >()
+{
+    return MakeCopyTimers< LinearHashSet< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_float_destroy64k >()
+{
+    return MakeDestroyTimers< LinearHashSet< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_float_find64k >()
+{
+    return MakeFindTimers< LinearHashSet< float > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_float_insert4k >()
+{
+    return MakeInsertTimers< LinearHashSet< float > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_float_iterate64k >()
+{
+    return MakeCountTimers< LinearHashSet< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_double_copy64k >()
+{
+    return MakeCopyTimers< LinearHashSet< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_double_destroy64k >()
+{
+    return MakeDestroyTimers< LinearHashSet< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_double_find64k >()
+{
+    return MakeFindTimers< LinearHashSet< double > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_double_insert4k >()
+{
+    return MakeInsertTimers< LinearHashSet< double > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_double_iterate64k >()
+{
+    return MakeCountTimers< LinearHashSet< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_string_copy64k >()
+{
+    return MakeCopyTimers< LinearHashSet< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_string_destroy64k >()
+{
+    return MakeDestroyTimers< LinearHashSet< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_string_find64k >()
+{
+    return MakeFindTimers< LinearHashSet< std::string > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_string_insert4k >()
+{
+    return MakeInsertTimers< LinearHashSet< std::string > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::linearset_string_iterate64k >()
+{
+    return MakeCountTimers< LinearHashSet< std::string > >( 1 << 16 );
+}
+
+
+SwissHashSet< int32_t > SwissSet_int32;
+SwissHashSet< int64_t > SwissSet_int64;
+SwissHashSet< float > SwissSet_float;
+SwissHashSet< double > SwissSet_double;
+SwissHashSet< std::string > SwissSet_string;
+
+
+template<> SwissHashSet< int32_t > &Writable< SwissHashSet< int32_t > >()
+{
+    return SwissSet_int32;
+}
+
+
+template<> SwissHashSet< int64_t > &Writable< SwissHashSet< int64_t > >()
+{
+    return SwissSet_int64;
+}
+
+
+template<> SwissHashSet< float > &Writable< SwissHashSet< float > >()
+{
+    return SwissSet_float;
+}
+
+
+template<> SwissHashSet< double > &Writable< SwissHashSet< double > >()
+{
+    return SwissSet_double;
+}
+
+
+template<> SwissHashSet< std::string > &Writable< SwissHashSet< std::string > >()
+{
+    return SwissSet_string;
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_copy16 >()
+{
+    return MakeCopyTimers< SwissHashSet< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_copy256 >()
+{
+    return MakeCopyTimers< SwissHashSet< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_copy4k >()
+{
+    return MakeCopyTimers< SwissHashSet< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_copy64k >()
+{
+    return MakeCopyTimers< SwissHashSet< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_copy1M >()
+{
+    return MakeCopyTimers< SwissHashSet< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_destroy16 >()
+{
+    return MakeDestroyTimers< SwissHashSet< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_destroy256 >()
+{
+    return MakeDestroyTimers< SwissHashSet< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_destroy4k >()
+{
+    return MakeDestroyTimers< SwissHashSet< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_destroy64k >()
+{
+    return MakeDestroyTimers< SwissHashSet< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_destroy1M >()
+{
+    return MakeDestroyTimers< SwissHashSet< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_find1 >()
+{
+    return MakeFindTimers< SwissHashSet< int32_t > >( true, 1 << 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_find16 >()
+{
+    return MakeFindTimers< SwissHashSet< int32_t > >( true, 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_find256 >()
+{
+    return MakeFindTimers< SwissHashSet< int32_t > >( true, 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_find4k >()
+{
+    return MakeFindTimers< SwissHashSet< int32_t > >( true, 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_find64k >()
+{
+    return MakeFindTimers< SwissHashSet< int32_t > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_find1M >()
+{
+    return MakeFindTimers< SwissHashSet< int32_t > >( true, 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_insert16 >()
+{
+    return MakeInsertTimers< SwissHashSet< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_insert256 >()
+{
+    return MakeInsertTimers< SwissHashSet< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_insert4k >()
+{
+    return MakeInsertTimers< SwissHashSet< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_insert64k >()
+{
+    return MakeInsertTimers< SwissHashSet< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_insert1M >()
+{
+    return MakeInsertTimers< SwissHashSet< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_iterate16 >()
+{
+    return MakeCountTimers< SwissHashSet< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_iterate256 >()
+{
+    return MakeCountTimers< SwissHashSet< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_iterate4k >()
+{
+    return MakeCountTimers< SwissHashSet< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_iterate64k >()
+{
+    return MakeCountTimers< SwissHashSet< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int32_iterate1M >()
+{
+    return MakeCountTimers< SwissHashSet< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int64_copy64k >()
+{
+    return MakeCopyTimers< SwissHashSet< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int64_destroy64k >()
+{
+    return MakeDestroyTimers< SwissHashSet< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int64_find64k >()
+{
+    return MakeFindTimers< SwissHashSet< int64_t > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int64_insert4k >()
+{
+    return MakeInsertTimers< SwissHashSet< int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_int64_iterate64k >()
+{
+    return MakeCountTimers< SwissHashSet< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_float_copy64k >()
+{
+    return MakeCopyTimers< SwissHashSet< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_float_destroy64k >()
+{
+    return MakeDestroyTimers< SwissHashSet< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_float_find64k >()
+{
+    return MakeFindTimers< SwissHashSet< float > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_float_insert4k >()
+{
+    return MakeInsertTimers< SwissHashSet< float > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_float_iterate64k >()
+{
+    return MakeCountTimers< SwissHashSet< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_double_copy64k >()
+{
+    return MakeCopyTimers< SwissHashSet< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_double_destroy64k >()
+{
+    return MakeDestroyTimers< SwissHashSet< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_double_find64k >()
+{
+    return MakeFindTimers< SwissHashSet< double > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_double_insert4k >()
+{
+    return MakeInsertTimers< SwissHashSet< double > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_double_iterate64k >()
+{
+    return MakeCountTimers< SwissHashSet< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_string_copy64k >()
+{
+    return MakeCopyTimers< SwissHashSet< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_string_destroy64k >()
+{
+    return MakeDestroyTimers< SwissHashSet< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_string_find64k >()
+{
+    return MakeFindTimers< SwissHashSet< std::string > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_string_insert4k >()
+{
+    return MakeInsertTimers< SwissHashSet< std::string > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::swissset_string_iterate64k >()
+{
+    return MakeCountTimers< SwissHashSet< std::string > >( 1 << 16 );
+}
+
+
+////////////////////////////////////////////////////////////
+// Category::flat_map:
+////////////////////////////////////////////////////////////
+
+template<> Description Describe< Category::flat_map >()
+{
+    Description desc;
+    desc.measures =
+        "Sorted-vector map copy, destroy, find, insert, and iteration, by key type and size.";
+    desc.notes =
+        {
+            "Values are int64_t.  Find uses std::lower_bound().",
+            "Each insert is O(n), so insert64k and insert1M are excluded from the category.",
+        };
+    return desc;
+}
+
+
+FlatMap< int32_t, int64_t > FlatMap_int32;
+FlatMap< int64_t, int64_t > FlatMap_int64;
+FlatMap< float, int64_t > FlatMap_float;
+FlatMap< double, int64_t > FlatMap_double;
+FlatMap< std::string, int64_t > FlatMap_string;
+
+
+template<> FlatMap< int32_t, int64_t > &Writable< FlatMap< int32_t, int64_t > >()
+{
+    return FlatMap_int32;
+}
+
+
+template<> FlatMap< int64_t, int64_t > &Writable< FlatMap< int64_t, int64_t > >()
+{
+    return FlatMap_int64;
+}
+
+
+template<> FlatMap< float, int64_t > &Writable< FlatMap< float, int64_t > >()
+{
+    return FlatMap_float;
+}
+
+
+template<> FlatMap< double, int64_t > &Writable< FlatMap< double, int64_t > >()
+{
+    return FlatMap_double;
+}
+
+
+template<> FlatMap< std::string, int64_t > &Writable< FlatMap< std::string, int64_t > >()
+{
+    return FlatMap_string;
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_copy16 >()
+{
+    return MakeCopyTimers< FlatMap< int32_t, int64_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_copy256 >()
+{
+    return MakeCopyTimers< FlatMap< int32_t, int64_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_copy4k >()
+{
+    return MakeCopyTimers< FlatMap< int32_t, int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_copy64k >()
+{
+    return MakeCopyTimers< FlatMap< int32_t, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_copy1M >()
+{
+    return MakeCopyTimers< FlatMap< int32_t, int64_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_destroy16 >()
+{
+    return MakeDestroyTimers< FlatMap< int32_t, int64_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_destroy256 >()
+{
+    return MakeDestroyTimers< FlatMap< int32_t, int64_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_destroy4k >()
+{
+    return MakeDestroyTimers< FlatMap< int32_t, int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_destroy64k >()
+{
+    return MakeDestroyTimers< FlatMap< int32_t, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_destroy1M >()
+{
+    return MakeDestroyTimers< FlatMap< int32_t, int64_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_find1 >()
+{
+    return MakeFindTimers< FlatMap< int32_t, int64_t > >( false, 1 << 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_find16 >()
+{
+    return MakeFindTimers< FlatMap< int32_t, int64_t > >( false, 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_find256 >()
+{
+    return MakeFindTimers< FlatMap< int32_t, int64_t > >( false, 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_find4k >()
+{
+    return MakeFindTimers< FlatMap< int32_t, int64_t > >( false, 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_find64k >()
+{
+    return MakeFindTimers< FlatMap< int32_t, int64_t > >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_find1M >()
+{
+    return MakeFindTimers< FlatMap< int32_t, int64_t > >( false, 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_insert16 >()
+{
+    return MakeInsertTimers< FlatMap< int32_t, int64_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_insert256 >()
+{
+    return MakeInsertTimers< FlatMap< int32_t, int64_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_insert4k >()
+{
+    return MakeInsertTimers< FlatMap< int32_t, int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_insert64k >()
+{
+    return MakeInsertTimers< FlatMap< int32_t, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_insert1M >()
+{
+    return MakeInsertTimers< FlatMap< int32_t, int64_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_iterate16 >()
+{
+    return MakeCountTimers< FlatMap< int32_t, int64_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_iterate256 >()
+{
+    return MakeCountTimers< FlatMap< int32_t, int64_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_iterate4k >()
+{
+    return MakeCountTimers< FlatMap< int32_t, int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_iterate64k >()
+{
+    return MakeCountTimers< FlatMap< int32_t, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int32_iterate1M >()
+{
+    return MakeCountTimers< FlatMap< int32_t, int64_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int64_copy64k >()
+{
+    return MakeCopyTimers< FlatMap< int64_t, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int64_destroy64k >()
+{
+    return MakeDestroyTimers< FlatMap< int64_t, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int64_find64k >()
+{
+    return MakeFindTimers< FlatMap< int64_t, int64_t > >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int64_insert4k >()
+{
+    return MakeInsertTimers< FlatMap< int64_t, int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_int64_iterate64k >()
+{
+    return MakeCountTimers< FlatMap< int64_t, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_float_copy64k >()
+{
+    return MakeCopyTimers< FlatMap< float, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_float_destroy64k >()
+{
+    return MakeDestroyTimers< FlatMap< float, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_float_find64k >()
+{
+    return MakeFindTimers< FlatMap< float, int64_t > >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_float_insert4k >()
+{
+    return MakeInsertTimers< FlatMap< float, int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_float_iterate64k >()
+{
+    return MakeCountTimers< FlatMap< float, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_double_copy64k >()
+{
+    return MakeCopyTimers< FlatMap< double, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_double_destroy64k >()
+{
+    return MakeDestroyTimers< FlatMap< double, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_double_find64k >()
+{
+    return MakeFindTimers< FlatMap< double, int64_t > >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_double_insert4k >()
+{
+    return MakeInsertTimers< FlatMap< double, int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_double_iterate64k >()
+{
+    return MakeCountTimers< FlatMap< double, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_string_copy64k >()
+{
+    return MakeCopyTimers< FlatMap< std::string, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_string_destroy64k >()
+{
+    return MakeDestroyTimers< FlatMap< std::string, int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_string_find64k >()
+{
+    return MakeFindTimers< FlatMap< std::string, int64_t > >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_string_insert4k >()
+{
+    return MakeInsertTimers< FlatMap< std::string, int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatmap_string_iterate64k >()
+{
+    return MakeCountTimers< FlatMap< std::string, int64_t > >( 1 << 16 );
+}
+
+
+////////////////////////////////////////////////////////////
+// Category::flat_set:
+////////////////////////////////////////////////////////////
+
+template<> Description Describe< Category::flat_set >()
+{
+    Description desc;
+    desc.measures =
+        "Sorted-vector set copy, destroy, find, insert, & iteration, by element type & size.";
+    desc.notes =
+        {
+            "Find uses std::lower_bound().",
+            "Each insert is O(n), so insert64k and insert1M are excluded from the category.",
+        };
+    return desc;
+}
+
+
+FlatSet< int32_t > FlatSet_int32;
+FlatSet< int64_t > FlatSet_int64;
+FlatSet< float > FlatSet_float;
+FlatSet< double > FlatSet_double;
+FlatSet< std::string > FlatSet_string;
+
+
+template<> FlatSet< int32_t > &Writable< FlatSet< int32_t > >()
+{
+    return FlatSet_int32;
+}
+
+
+template<> FlatSet< int64_t > &Writable< FlatSet< int64_t > >()
+{
+    return FlatSet_int64;
+}
+
+
+template<> FlatSet< float > &Writable< FlatSet< float > >()
+{
+    return FlatSet_float;
+}
+
+
+template<> FlatSet< double > &Writable< FlatSet< double > >()
+{
+    return FlatSet_double;
+}
+
+
+template<> FlatSet< std::string > &Writable< FlatSet< std::string > >()
+{
+    return FlatSet_string;
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_copy16 >()
+{
+    return MakeCopyTimers< FlatSet< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_copy256 >()
+{
+    return MakeCopyTimers< FlatSet< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_copy4k >()
+{
+    return MakeCopyTimers< FlatSet< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_copy64k >()
+{
+    return MakeCopyTimers< FlatSet< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_copy1M >()
+{
+    return MakeCopyTimers< FlatSet< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_destroy16 >()
+{
+    return MakeDestroyTimers< FlatSet< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_destroy256 >()
+{
+    return MakeDestroyTimers< FlatSet< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_destroy4k >()
+{
+    return MakeDestroyTimers< FlatSet< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_destroy64k >()
+{
+    return MakeDestroyTimers< FlatSet< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_destroy1M >()
+{
+    return MakeDestroyTimers< FlatSet< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_find1 >()
+{
+    return MakeFindTimers< FlatSet< int32_t > >( false, 1 << 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_find16 >()
+{
+    return MakeFindTimers< FlatSet< int32_t > >( false, 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_find256 >()
+{
+    return MakeFindTimers< FlatSet< int32_t > >( false, 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_find4k >()
+{
+    return MakeFindTimers< FlatSet< int32_t > >( false, 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_find64k >()
+{
+    return MakeFindTimers< FlatSet< int32_t > >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_find1M >()
+{
+    return MakeFindTimers< FlatSet< int32_t > >( false, 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_insert16 >()
+{
+    return MakeInsertTimers< FlatSet< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_insert256 >()
+{
+    return MakeInsertTimers< FlatSet< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_insert4k >()
+{
+    return MakeInsertTimers< FlatSet< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_insert64k >()
+{
+    return MakeInsertTimers< FlatSet< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_insert1M >()
+{
+    return MakeInsertTimers< FlatSet< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_iterate16 >()
+{
+    return MakeCountTimers< FlatSet< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_iterate256 >()
+{
+    return MakeCountTimers< FlatSet< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_iterate4k >()
+{
+    return MakeCountTimers< FlatSet< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_iterate64k >()
+{
+    return MakeCountTimers< FlatSet< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int32_iterate1M >()
+{
+    return MakeCountTimers< FlatSet< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int64_copy64k >()
+{
+    return MakeCopyTimers< FlatSet< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int64_destroy64k >()
+{
+    return MakeDestroyTimers< FlatSet< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int64_find64k >()
+{
+    return MakeFindTimers< FlatSet< int64_t > >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int64_insert4k >()
+{
+    return MakeInsertTimers< FlatSet< int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_int64_iterate64k >()
+{
+    return MakeCountTimers< FlatSet< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_float_copy64k >()
+{
+    return MakeCopyTimers< FlatSet< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_float_destroy64k >()
+{
+    return MakeDestroyTimers< FlatSet< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_float_find64k >()
+{
+    return MakeFindTimers< FlatSet< float > >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_float_insert4k >()
+{
+    return MakeInsertTimers< FlatSet< float > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_float_iterate64k >()
+{
+    return MakeCountTimers< FlatSet< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_double_copy64k >()
+{
+    return MakeCopyTimers< FlatSet< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_double_destroy64k >()
+{
+    return MakeDestroyTimers< FlatSet< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_double_find64k >()
+{
+    return MakeFindTimers< FlatSet< double > >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_double_insert4k >()
+{
+    return MakeInsertTimers< FlatSet< double > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_double_iterate64k >()
+{
+    return MakeCountTimers< FlatSet< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_string_copy64k >()
+{
+    return MakeCopyTimers< FlatSet< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_string_destroy64k >()
+{
+    return MakeDestroyTimers< FlatSet< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_string_find64k >()
+{
+    return MakeFindTimers< FlatSet< std::string > >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_string_insert4k >()
+{
+    return MakeInsertTimers< FlatSet< std::string > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::flatset_string_iterate64k >()
+{
+    return MakeCountTimers< FlatSet< std::string > >( 1 << 16 );
+}
+
+
+////////////////////////////////////////////////////////////
+// Category::std_deque:
+////////////////////////////////////////////////////////////
+
+template<> Description Describe< Category::std_deque >()
+{
+    Description desc;
+    desc.measures =
+        "std::deque<> copy, destroy, find, insert, and iteration, by element type and size.";
+    desc.notes = FixtureNotes();
+    return desc;
+}
+
+
+std::deque< int32_t > Deque_int32;
+std::deque< int64_t > Deque_int64;
+std::deque< float > Deque_float;
+std::deque< double > Deque_double;
+std::deque< std::string > Deque_string;
+
+
+template<> std::deque< int32_t > &Writable< std::deque< int32_t > >()
+{
+    return Deque_int32;
+}
+
+
+template<> std::deque< int64_t > &Writable< std::deque< int64_t > >()
+{
+    return Deque_int64;
+}
+
+
+template<> std::deque< float > &Writable< std::deque< float > >()
+{
+    return Deque_float;
+}
+
+
+template<> std::deque< double > &Writable< std::deque< double > >()
+{
+    return Deque_double;
+}
+
+
+template<> std::deque< std::string > &Writable< std::deque< std::string > >()
+{
+    return Deque_string;
+}
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_insert16 >()
+{
+    return MakeInsertTimers< std::deque< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_insert256 >()
+{
+    return MakeInsertTimers< std::deque< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_insert4k >()
+{
+    return MakeInsertTimers< std::deque< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_insert64k >()
+{
+    return MakeInsertTimers< std::deque< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_insert1M >()
+{
+    return MakeInsertTimers< std::deque< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int64_insert4k >()
+{
+    return MakeInsertTimers< std::deque< int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_float_insert4k >()
+{
+    return MakeInsertTimers< std::deque< float > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_double_insert4k >()
+{
+    return MakeInsertTimers< std::deque< double > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_string_insert4k >()
+{
+    return MakeInsertTimers< std::deque< std::string > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_iterate16 >()
+{
+    return MakeCountTimers< std::deque< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_iterate256 >()
+{
+    return MakeCountTimers< std::deque< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_iterate4k >()
+{
+    return MakeCountTimers< std::deque< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_iterate64k >()
+{
+    return MakeCountTimers< std::deque< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_iterate1M >()
+{
+    return MakeCountTimers< std::deque< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int64_iterate64k >()
+{
+    return MakeCountTimers< std::deque< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_float_iterate64k >()
+{
+    return MakeCountTimers< std::deque< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_double_iterate64k >()
+{
+    return MakeCountTimers< std::deque< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_string_iterate64k >()
+{
+    return MakeCountTimers< std::deque< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find1 >()
+{
+    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find16 >()
+{
+    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find256 >()
+{
+    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find4k >()
+{
+    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find64k >()
+{
+    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_find1M >()
+{
+    return MakeFindTimers< std::deque< int32_t > >( true, 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int64_find64k >()
+{
+    return MakeFindTimers< std::deque< int64_t > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_float_find64k >()
+{
+    return MakeFindTimers< std::deque< float > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_double_find64k >()
+{
+    return MakeFindTimers< std::deque< double > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_string_find64k >()
+{
+    return MakeFindTimers< std::deque< std::string > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_copy16 >()
+{
+    return MakeCopyTimers< std::deque< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_copy256 >()
+{
+    return MakeCopyTimers< std::deque< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_copy4k >()
+{
+    return MakeCopyTimers< std::deque< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_copy64k >()
+{
+    return MakeCopyTimers< std::deque< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_copy1M >()
+{
+    return MakeCopyTimers< std::deque< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int64_copy64k >()
+{
+    return MakeCopyTimers< std::deque< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_float_copy64k >()
+{
+    return MakeCopyTimers< std::deque< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_double_copy64k >()
+{
+    return MakeCopyTimers< std::deque< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_string_copy64k >()
+{
+    return MakeCopyTimers< std::deque< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_destroy16 >()
+{
+    return MakeDestroyTimers< std::deque< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_destroy256 >()
+{
+    return MakeDestroyTimers< std::deque< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_destroy4k >()
+{
+    return MakeDestroyTimers< std::deque< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_destroy64k >()
+{
+    return MakeDestroyTimers< std::deque< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int32_destroy1M >()
+{
+    return MakeDestroyTimers< std::deque< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_int64_destroy64k >()
+{
+    return MakeDestroyTimers< std::deque< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_float_destroy64k >()
+{
+    return MakeDestroyTimers< std::deque< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_double_destroy64k >()
+{
+    return MakeDestroyTimers< std::deque< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_string_destroy64k >()
+{
+    return MakeDestroyTimers< std::deque< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_arena_int32_destroy64k >()
+{
+    using container_t = Allocated< std::deque, ArenaFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, ArenaFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_arena_int32_find64k >()
+{
+    using container_t = Allocated< std::deque, ArenaFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, ArenaFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_arena_int32_insert64k >()
+{
+    using container_t = Allocated< std::deque, ArenaFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, ArenaFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_arena_int32_iterate1M >()
+{
+    using container_t = Allocated< std::deque, ArenaFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, ArenaFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_mono_int32_destroy64k >()
+{
+    using container_t = Allocated< std::deque, MonotonicFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, MonotonicFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_mono_int32_find64k >()
+{
+    using container_t = Allocated< std::deque, MonotonicFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, MonotonicFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_mono_int32_insert64k >()
+{
+    using container_t = Allocated< std::deque, MonotonicFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, MonotonicFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_mono_int32_iterate1M >()
+{
+    using container_t = Allocated< std::deque, MonotonicFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, MonotonicFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_spool_int32_destroy64k >()
+{
+    using container_t = Allocated< std::deque, SyncPoolFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, SyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_spool_int32_find64k >()
+{
+    using container_t = Allocated< std::deque, SyncPoolFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, SyncPoolFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_spool_int32_insert64k >()
+{
+    using container_t = Allocated< std::deque, SyncPoolFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, SyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_spool_int32_iterate1M >()
+{
+    using container_t = Allocated< std::deque, SyncPoolFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, SyncPoolFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_upool_int32_destroy64k >()
+{
+    using container_t = Allocated< std::deque, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, UnsyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_upool_int32_find64k >()
+{
+    using container_t = Allocated< std::deque, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, UnsyncPoolFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_upool_int32_insert64k >()
+{
+    using container_t = Allocated< std::deque, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, UnsyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::deque_upool_int32_iterate1M >()
+{
+    using container_t = Allocated< std::deque, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, UnsyncPoolFixture >( 1 << 20 );
+}
+
+
+////////////////////////////////////////////////////////////
+// Category::std_hashmap:
+////////////////////////////////////////////////////////////
+
+template<> Description Describe< Category::std_hashmap >()
+{
+    Description desc;
+    desc.measures =
+        "std::unordered_map<> copy, destroy, erase, find, insert, and iteration, by key type"
+            " and payload size.";
+    desc.notes =
+        {
+            "The _pN suffix is the size of the mapped type, in bytes, which affects node size.",
+            "findmiss searches for keys that aren't present, and erase removes every element"
+                " of a copy, in random order.",
+            "insertreserved calls reserve() before inserting.  So, its difference from insert"
+                " is the cost of rehashing during growth.",
+            "rehash times doubling the bucket count of a full table.",
+        };
+    return desc;
+}
+
+
+HashmapOf< int32_t, 8 > Hashmap_int32_p8;
+HashmapOf< int32_t, 16 > Hashmap_int32_p16;
+HashmapOf< int32_t, 32 > Hashmap_int32_p32;
+HashmapOf< int32_t, 64 > Hashmap_int32_p64;
+HashmapOf< int32_t, 128 > Hashmap_int32_p128;
+HashmapOf< int32_t, 256 > Hashmap_int32_p256;
+HashmapOf< int64_t, 64 > Hashmap_int64_p64;
+HashmapOf< std::string, 64 > Hashmap_string_p64;
+
+
+template<> HashmapOf< int32_t, 8 > &Writable< HashmapOf< int32_t, 8 > >()
+{
+    return Hashmap_int32_p8;
+}
+
+
+template<> HashmapOf< int32_t, 16 > &Writable< HashmapOf< int32_t, 16 > >()
+{
+    return Hashmap_int32_p16;
+}
+
+
+template<> HashmapOf< int32_t, 32 > &Writable< HashmapOf< int32_t, 32 > >()
+{
+    return Hashmap_int32_p32;
+}
+
+
+template<> HashmapOf< int32_t, 64 > &Writable< HashmapOf< int32_t, 64 > >()
+{
+    return Hashmap_int32_p64;
+}
+
+
+template<> HashmapOf< int32_t, 128 > &Writable< HashmapOf< int32_t, 128 > >()
+{
+    return Hashmap_int32_p128;
+}
+
+
+template<> HashmapOf< int32_t, 256 > &Writable< HashmapOf< int32_t, 256 > >()
+{
+    return Hashmap_int32_p256;
+}
+
+
+template<> HashmapOf< int64_t, 64 > &Writable< HashmapOf< int64_t, 64 > >()
+{
+    return Hashmap_int64_p64;
+}
+
+
+template<> HashmapOf< std::string, 64 > &Writable< HashmapOf< std::string, 64 > >()
+{
+    return Hashmap_string_p64;
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p8_copy64k >()
+{
+    return MakeCopyTimers< HashmapOf< int32_t, 8 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p8_destroy64k >()
+{
+    return MakeDestroyTimers< HashmapOf< int32_t, 8 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p8_erase64k >()
+{
+    return MakeEraseTimers< HashmapOf< int32_t, 8 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p8_find64k >()
+{
+    return MakeFindTimers< HashmapOf< int32_t, 8 > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p8_findmiss64k >()
+{
+    return MakeFindMissTimers< HashmapOf< int32_t, 8 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p8_insert64k >()
+{
+    return MakeInsertTimers< HashmapOf< int32_t, 8 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p8_insertreserved64k >()
+{
+    return MakeReservedInsertTimers< HashmapOf< int32_t, 8 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p8_iterate64k >()
+{
+    return MakeCountTimers< HashmapOf< int32_t, 8 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p8_rehash64k >()
+{
+    return MakeRehashTimers< HashmapOf< int32_t, 8 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p16_copy64k >()
+{
+    return MakeCopyTimers< HashmapOf< int32_t, 16 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p16_destroy64k >()
+{
+    return MakeDestroyTimers< HashmapOf< int32_t, 16 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p16_find64k >()
+{
+    return MakeFindTimers< HashmapOf< int32_t, 16 > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p16_insert64k >()
+{
+    return MakeInsertTimers< HashmapOf< int32_t, 16 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p16_iterate64k >()
+{
+    return MakeCountTimers< HashmapOf< int32_t, 16 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p32_copy64k >()
+{
+    return MakeCopyTimers< HashmapOf< int32_t, 32 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p32_destroy64k >()
+{
+    return MakeDestroyTimers< HashmapOf< int32_t, 32 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p32_find64k >()
+{
+    return MakeFindTimers< HashmapOf< int32_t, 32 > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p32_insert64k >()
+{
+    return MakeInsertTimers< HashmapOf< int32_t, 32 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p32_iterate64k >()
+{
+    return MakeCountTimers< HashmapOf< int32_t, 32 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p64_copy64k >()
+{
+    return MakeCopyTimers< HashmapOf< int32_t, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p64_destroy64k >()
+{
+    return MakeDestroyTimers< HashmapOf< int32_t, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p64_erase64k >()
+{
+    return MakeEraseTimers< HashmapOf< int32_t, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p64_find64k >()
+{
+    return MakeFindTimers< HashmapOf< int32_t, 64 > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p64_findmiss64k >()
+{
+    return MakeFindMissTimers< HashmapOf< int32_t, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p64_insert64k >()
+{
+    return MakeInsertTimers< HashmapOf< int32_t, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p64_insertreserved64k >()
+{
+    return MakeReservedInsertTimers< HashmapOf< int32_t, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p64_iterate64k >()
+{
+    return MakeCountTimers< HashmapOf< int32_t, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p64_rehash64k >()
+{
+    return MakeRehashTimers< HashmapOf< int32_t, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p128_copy64k >()
+{
+    return MakeCopyTimers< HashmapOf< int32_t, 128 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p128_destroy64k >()
+{
+    return MakeDestroyTimers< HashmapOf< int32_t, 128 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p128_find64k >()
+{
+    return MakeFindTimers< HashmapOf< int32_t, 128 > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p128_insert64k >()
+{
+    return MakeInsertTimers< HashmapOf< int32_t, 128 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p128_iterate64k >()
+{
+    return MakeCountTimers< HashmapOf< int32_t, 128 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p256_copy64k >()
+{
+    return MakeCopyTimers< HashmapOf< int32_t, 256 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p256_destroy64k >()
+{
+    return MakeDestroyTimers< HashmapOf< int32_t, 256 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p256_erase64k >()
+{
+    return MakeEraseTimers< HashmapOf< int32_t, 256 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p256_find64k >()
+{
+    return MakeFindTimers< HashmapOf< int32_t, 256 > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p256_findmiss64k >()
+{
+    return MakeFindMissTimers< HashmapOf< int32_t, 256 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p256_insert64k >()
+{
+    return MakeInsertTimers< HashmapOf< int32_t, 256 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p256_insertreserved64k >()
+{
+    return MakeReservedInsertTimers< HashmapOf< int32_t, 256 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p256_iterate64k >()
+{
+    return MakeCountTimers< HashmapOf< int32_t, 256 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int32_p256_rehash64k >()
+{
+    return MakeRehashTimers< HashmapOf< int32_t, 256 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int64_p64_copy64k >()
+{
+    return MakeCopyTimers< HashmapOf< int64_t, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int64_p64_destroy64k >()
+{
+    return MakeDestroyTimers< HashmapOf< int64_t, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int64_p64_find64k >()
+{
+    return MakeFindTimers< HashmapOf< int64_t, 64 > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int64_p64_insert4k >()
+{
+    return MakeInsertTimers< HashmapOf< int64_t, 64 > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_int64_p64_iterate64k >()
+{
+    return MakeCountTimers< HashmapOf< int64_t, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_string_p64_copy64k >()
+{
+    return MakeCopyTimers< HashmapOf< std::string, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_string_p64_destroy64k >()
+{
+    return MakeDestroyTimers< HashmapOf< std::string, 64 > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_string_p64_find64k >()
+{
+    return MakeFindTimers< HashmapOf< std::string, 64 > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_string_p64_insert4k >()
+{
+    return MakeInsertTimers< HashmapOf< std::string, 64 > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashmap_string_p64_iterate64k >()
+{
+    return MakeCountTimers< HashmapOf< std::string, 64 > >( 1 << 16 );
+}
+
+
+////////////////////////////////////////////////////////////
+// Category::std_hashset:
+////////////////////////////////////////////////////////////
+
+template<> Description Describe< Category::std_hashset >()
+{
+    Description desc;
+    desc.measures =
+        "std::unordered_set<> copy, destroy, find, insert, & iteration, by element type & size.";
+    desc.notes = FixtureNotes();
+    return desc;
+}
+
+
+std::unordered_set< int32_t > Hashset_int32;
+std::unordered_set< int64_t > Hashset_int64;
+std::unordered_set< float > Hashset_float;
+std::unordered_set< double > Hashset_double;
+std::unordered_set< std::string > Hashset_string;
+
+
+template<> std::unordered_set< int32_t > &Writable< std::unordered_set< int32_t > >()
+{
+    return Hashset_int32;
+}
+
+
+template<> std::unordered_set< int64_t > &Writable< std::unordered_set< int64_t > >()
+{
+    return Hashset_int64;
+}
+
+
+template<> std::unordered_set< float > &Writable< std::unordered_set< float > >()
+{
+    return Hashset_float;
+}
+
+
+template<> std::unordered_set< double > &Writable< std::unordered_set< double > >()
+{
+    return Hashset_double;
+}
+
+
+template<> std::unordered_set< std::string > &Writable< std::unordered_set< std::string > >()
+{
+    return Hashset_string;
+}
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_insert16 >()
+{
+    return MakeInsertTimers< std::unordered_set< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_insert256 >()
+{
+    return MakeInsertTimers< std::unordered_set< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_insert4k >()
+{
+    return MakeInsertTimers< std::unordered_set< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_insert64k >()
+{
+    return MakeInsertTimers< std::unordered_set< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_insert1M >()
+{
+    return MakeInsertTimers< std::unordered_set< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int64_insert4k >()
+{
+    return MakeInsertTimers< std::unordered_set< int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_float_insert4k >()
+{
+    return MakeInsertTimers< std::unordered_set< float > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_double_insert4k >()
+{
+    return MakeInsertTimers< std::unordered_set< double > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_string_insert4k >()
+{
+    return MakeInsertTimers< std::unordered_set< std::string > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_iterate16 >()
+{
+    return MakeCountTimers< std::unordered_set< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_iterate256 >()
+{
+    return MakeCountTimers< std::unordered_set< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_iterate4k >()
+{
+    return MakeCountTimers< std::unordered_set< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_iterate64k >()
+{
+    return MakeCountTimers< std::unordered_set< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_iterate1M >()
+{
+    return MakeCountTimers< std::unordered_set< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int64_iterate64k >()
+{
+    return MakeCountTimers< std::unordered_set< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_float_iterate64k >()
+{
+    return MakeCountTimers< std::unordered_set< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_double_iterate64k >()
+{
+    return MakeCountTimers< std::unordered_set< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_string_iterate64k >()
+{
+    return MakeCountTimers< std::unordered_set< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find1 >()
+{
+    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find16 >()
+{
+    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find256 >()
+{
+    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find4k >()
+{
+    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find64k >()
+{
+    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_find1M >()
+{
+    return MakeFindTimers< std::unordered_set< int32_t > >( true, 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int64_find64k >()
+{
+    return MakeFindTimers< std::unordered_set< int64_t > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_float_find64k >()
+{
+    return MakeFindTimers< std::unordered_set< float > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_double_find64k >()
+{
+    return MakeFindTimers< std::unordered_set< double > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_string_find64k >()
+{
+    return MakeFindTimers< std::unordered_set< std::string > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_copy16 >()
+{
+    return MakeCopyTimers< std::unordered_set< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_copy256 >()
+{
+    return MakeCopyTimers< std::unordered_set< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_copy4k >()
+{
+    return MakeCopyTimers< std::unordered_set< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_copy64k >()
+{
+    return MakeCopyTimers< std::unordered_set< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_copy1M >()
+{
+    return MakeCopyTimers< std::unordered_set< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int64_copy64k >()
+{
+    return MakeCopyTimers< std::unordered_set< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_float_copy64k >()
+{
+    return MakeCopyTimers< std::unordered_set< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_double_copy64k >()
+{
+    return MakeCopyTimers< std::unordered_set< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_string_copy64k >()
+{
+    return MakeCopyTimers< std::unordered_set< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_destroy16 >()
+{
+    return MakeDestroyTimers< std::unordered_set< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_destroy256 >()
+{
+    return MakeDestroyTimers< std::unordered_set< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_destroy4k >()
+{
+    return MakeDestroyTimers< std::unordered_set< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_destroy64k >()
+{
+    return MakeDestroyTimers< std::unordered_set< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int32_destroy1M >()
+{
+    return MakeDestroyTimers< std::unordered_set< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_int64_destroy64k >()
+{
+    return MakeDestroyTimers< std::unordered_set< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_float_destroy64k >()
+{
+    return MakeDestroyTimers< std::unordered_set< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_double_destroy64k >()
+{
+    return MakeDestroyTimers< std::unordered_set< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_string_destroy64k >()
+{
+    return MakeDestroyTimers< std::unordered_set< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_arena_int32_destroy64k >()
+{
+    using container_t = Allocated< HashsetOf, ArenaFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, ArenaFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_arena_int32_find64k >()
+{
+    using container_t = Allocated< HashsetOf, ArenaFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, ArenaFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_arena_int32_insert64k >()
+{
+    using container_t = Allocated< HashsetOf, ArenaFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, ArenaFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_arena_int32_iterate1M >()
+{
+    using container_t = Allocated< HashsetOf, ArenaFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, ArenaFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_mono_int32_destroy64k >()
+{
+    using container_t = Allocated< HashsetOf, MonotonicFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, MonotonicFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_mono_int32_find64k >()
+{
+    using container_t = Allocated< HashsetOf, MonotonicFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, MonotonicFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_mono_int32_insert64k >()
+{
+    using container_t = Allocated< HashsetOf, MonotonicFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, MonotonicFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_mono_int32_iterate1M >()
+{
+    using container_t = Allocated< HashsetOf, MonotonicFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, MonotonicFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_spool_int32_destroy64k >()
+{
+    using container_t = Allocated< HashsetOf, SyncPoolFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, SyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_spool_int32_find64k >()
+{
+    using container_t = Allocated< HashsetOf, SyncPoolFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, SyncPoolFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_spool_int32_insert64k >()
+{
+    using container_t = Allocated< HashsetOf, SyncPoolFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, SyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_spool_int32_iterate1M >()
+{
+    using container_t = Allocated< HashsetOf, SyncPoolFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, SyncPoolFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_upool_int32_destroy64k >()
+{
+    using container_t = Allocated< HashsetOf, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, UnsyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_upool_int32_find64k >()
+{
+    using container_t = Allocated< HashsetOf, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, UnsyncPoolFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_upool_int32_insert64k >()
+{
+    using container_t = Allocated< HashsetOf, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, UnsyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_upool_int32_iterate1M >()
+{
+    using container_t = Allocated< HashsetOf, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, UnsyncPoolFixture >( 1 << 20 );
+}
+
+
+////////////////////////////////////////////////////////////
+// Category::std_list:
+////////////////////////////////////////////////////////////
+
+template<> Description Describe< Category::std_list >()
+{
+    Description desc;
+    desc.measures =
+        "std::list<> copy, destroy, find, insert, and iteration, by element type and size.";
+    desc.notes = FixtureNotes();
+    return desc;
+}
+
+
+std::list< int32_t > List_int32;
+std::list< int64_t > List_int64;
+std::list< float > List_float;
+std::list< double > List_double;
+std::list< std::string > List_string;
+
+
+template<> std::list< int32_t > &Writable< std::list< int32_t > >()
+{
+    return List_int32;
+}
+
+
+template<> std::list< int64_t > &Writable< std::list< int64_t > >()
+{
+    return List_int64;
+}
+
+
+template<> std::list< float > &Writable< std::list< float > >()
+{
+    return List_float;
+}
+
+
+template<> std::list< double > &Writable< std::list< double > >()
+{
+    return List_double;
+}
+
+
+template<> std::list< std::string > &Writable< std::list< std::string > >()
+{
+    return List_string;
+}
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_insert16 >()
+{
+    return MakeInsertTimers< std::list< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_insert256 >()
+{
+    return MakeInsertTimers< std::list< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_insert4k >()
+{
+    return MakeInsertTimers< std::list< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_insert64k >()
+{
+    return MakeInsertTimers< std::list< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_insert1M >()
+{
+    return MakeInsertTimers< std::list< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int64_insert4k >()
+{
+    return MakeInsertTimers< std::list< int64_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_float_insert4k >()
+{
+    return MakeInsertTimers< std::list< float > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_double_insert4k >()
+{
+    return MakeInsertTimers< std::list< double > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_string_insert4k >()
+{
+    return MakeInsertTimers< std::list< std::string > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_iterate16 >()
+{
+    return MakeCountTimers< std::list< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_iterate256 >()
+{
+    return MakeCountTimers< std::list< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_iterate4k >()
+{
+    return MakeCountTimers< std::list< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_iterate64k >()
+{
+    return MakeCountTimers< std::list< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_iterate1M >()
+{
+    return MakeCountTimers< std::list< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int64_iterate64k >()
+{
+    return MakeCountTimers< std::list< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_float_iterate64k >()
+{
+    return MakeCountTimers< std::list< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_double_iterate64k >()
+{
+    return MakeCountTimers< std::list< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_string_iterate64k >()
+{
+    return MakeCountTimers< std::list< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find1 >()
+{
+    return MakeFindTimers< std::list< int32_t > >( true, 1 << 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find16 >()
+{
+    return MakeFindTimers< std::list< int32_t > >( true, 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find256 >()
+{
+    return MakeFindTimers< std::list< int32_t > >( true, 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find4k >()
+{
+    return MakeFindTimers< std::list< int32_t > >( true, 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find64k >()
+{
+    return MakeFindTimers< std::list< int32_t > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find1M >()
+{
+    return MakeFindTimers< std::list< int32_t > >( true, 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int64_find64k >()
+{
+    return MakeFindTimers< std::list< int64_t > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_float_find64k >()
+{
+    return MakeFindTimers< std::list< float > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_double_find64k >()
+{
+    return MakeFindTimers< std::list< double > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_string_find64k >()
+{
+    return MakeFindTimers< std::list< std::string > >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_copy16 >()
+{
+    return MakeCopyTimers< std::list< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_copy256 >()
+{
+    return MakeCopyTimers< std::list< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_copy4k >()
+{
+    return MakeCopyTimers< std::list< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_copy64k >()
+{
+    return MakeCopyTimers< std::list< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_copy1M >()
+{
+    return MakeCopyTimers< std::list< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int64_copy64k >()
+{
+    return MakeCopyTimers< std::list< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_float_copy64k >()
+{
+    return MakeCopyTimers< std::list< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_double_copy64k >()
+{
+    return MakeCopyTimers< std::list< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_string_copy64k >()
+{
+    return MakeCopyTimers< std::list< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_destroy16 >()
+{
+    return MakeDestroyTimers< std::list< int32_t > >( 1 << 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_destroy256 >()
+{
+    return MakeDestroyTimers< std::list< int32_t > >( 1 << 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_destroy4k >()
+{
+    return MakeDestroyTimers< std::list< int32_t > >( 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_destroy64k >()
+{
+    return MakeDestroyTimers< std::list< int32_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_destroy1M >()
+{
+    return MakeDestroyTimers< std::list< int32_t > >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_int64_destroy64k >()
+{
+    return MakeDestroyTimers< std::list< int64_t > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_float_destroy64k >()
+{
+    return MakeDestroyTimers< std::list< float > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_double_destroy64k >()
+{
+    return MakeDestroyTimers< std::list< double > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_string_destroy64k >()
+{
+    return MakeDestroyTimers< std::list< std::string > >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_arena_int32_destroy64k >()
+{
+    using container_t = Allocated< std::list, ArenaFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, ArenaFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_arena_int32_find64k >()
+{
+    using container_t = Allocated< std::list, ArenaFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, ArenaFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_arena_int32_insert64k >()
+{
+    using container_t = Allocated< std::list, ArenaFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, ArenaFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_arena_int32_iterate1M >()
+{
+    using container_t = Allocated< std::list, ArenaFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, ArenaFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_mono_int32_destroy64k >()
+{
+    using container_t = Allocated< std::list, MonotonicFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, MonotonicFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_mono_int32_find64k >()
+{
+    using container_t = Allocated< std::list, MonotonicFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, MonotonicFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_mono_int32_insert64k >()
+{
+    using container_t = Allocated< std::list, MonotonicFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, MonotonicFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_mono_int32_iterate1M >()
+{
+    using container_t = Allocated< std::list, MonotonicFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, MonotonicFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_spool_int32_destroy64k >()
+{
+    using container_t = Allocated< std::list, SyncPoolFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, SyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_spool_int32_find64k >()
+{
+    using container_t = Allocated< std::list, SyncPoolFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, SyncPoolFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_spool_int32_insert64k >()
+{
+    using container_t = Allocated< std::list, SyncPoolFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, SyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_spool_int32_iterate1M >()
+{
+    using container_t = Allocated< std::list, SyncPoolFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, SyncPoolFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_upool_int32_destroy64k >()
+{
+    using container_t = Allocated< std::list, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, UnsyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_upool_int32_find64k >()
+{
+    using container_t = Allocated< std::list, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, UnsyncPoolFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_upool_int32_insert64k >()
+{
+    using container_t = Allocated< std::list, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, UnsyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::list_upool_int32_iterate1M >()
+{
+    using container_t = Allocated< std::list, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, UnsyncPoolFixture >( 1 << 20 );
+}
+
+
+////////////////////////////////////////////////////////////
+// Category::std_map:
+////////////////////////////////////////////////////////////
+
+template<> Description Describe< Category::std_map >()
+{
+    Description desc;
+    desc.measures =
+        "std::map<> copy, destroy, erase, find, insert, and iteration, by key type and payload"
+            " size.";
+    desc.notes =
+        {
+            "The _pN suffix is the size of the mapped type, in bytes, which affects node size.",
+            "findmiss searches for keys that aren't present, and erase removes every element"
+                " of a copy, in random order.",
+        };
+    return desc;
+}
+
+
+MapOf< int32_t, 8 > Map_int32_p8;
+MapOf< int32_t, 16 > Map_int32_p16;
+MapOf< int32_t, 32 > Map_int32_p32;
+MapOf< int32_t, 64 > Map_int32_p64;
+MapOf< int32_t, 128 > Map_int32_p128;
+MapOf< int32_t, 256 > Map_int32_p256;
+MapOf< int64_t, 64 > Map_int64_p64;
+MapOf< std::string, 64 > Map_string_p64;
+
+
+template<> MapOf< int32_t, 8 > &Writable< MapOf< int32_t, 8 > >()
 {
-    return MakeDestroyTimers< std::unordered_set< float > >( 1 << 16 );
+    return Map_int32_p8;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_double_destroy64k >()
+template<> MapOf< int32_t, 16 > &Writable< MapOf< int32_t, 16 > >()
 {
-    return MakeDestroyTimers< std::unordered_set< double > >( 1 << 16 );
+    return Map_int32_p16;
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::hashset_string_destroy64k >()
+template<> MapOf< int32_t, 32 > &Writable< MapOf< int32_t, 32 > >()
 {
-    return MakeDestroyTimers< std::unordered_set< std::string > >( 1 << 16 );
+    return Map_int32_p32;
 }
 
 
-////////////////////////////////////////////////////////////
-// Category::std_list:
-////////////////////////////////////////////////////////////
-
-std::list< int32_t > List_int32;
-std::list< int64_t > List_int64;
-std::list< float > List_float;
-std::list< double > List_double;
-std::list< std::string > List_string;
-
-
-template<> std::list< int32_t > &Writable< std::list< int32_t > >()
+template<> MapOf< int32_t, 64 > &Writable< MapOf< int32_t, 64 > >()
 {
-    return List_int32;
+    return Map_int32_p64;
 }
 
 
-template<> std::list< int64_t > &Writable< std::list< int64_t > >()
+template<> MapOf< int32_t, 128 > &Writable< MapOf< int32_t, 128 > >()
 {
-    return List_int64;
+    return Map_int32_p128;
 }
 
 
-template<> std::list< float > &Writable< std::list< float > >()
+template<> MapOf< int32_t, 256 > &Writable< MapOf< int32_t, 256 > >()
 {
-    return List_float;
+    return Map_int32_p256;
 }
 
 
-template<> std::list< double > &Writable< std::list< double > >()
+template<> MapOf< int64_t, 64 > &Writable< MapOf< int64_t, 64 > >()
 {
-    return List_double;
+    return Map_int64_p64;
 }
 
 
-template<> std::list< std::string > &Writable< std::list< std::string > >()
+template<> MapOf< std::string, 64 > &Writable< MapOf< std::string, 64 > >()
 {
-    return List_string;
+    return Map_string_p64;
 }
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_insert16 >()
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p8_copy64k >()
 {
-    return MakeInsertTimers< std::list< int32_t > >( 1 << 4 );
+    return MakeCopyTimers< MapOf< int32_t, 8 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_insert256 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p8_destroy64k >()
 {
-    return MakeInsertTimers< std::list< int32_t > >( 1 << 8 );
+    return MakeDestroyTimers< MapOf< int32_t, 8 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_insert4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p8_erase64k >()
 {
-    return MakeInsertTimers< std::list< int32_t > >( 1 << 12 );
+    return MakeEraseTimers< MapOf< int32_t, 8 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_insert64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p8_find64k >()
 {
-    return MakeInsertTimers< std::list< int32_t > >( 1 << 16 );
+    return MakeFindTimers< MapOf< int32_t, 8 > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_insert1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p8_findmiss64k >()
 {
-    return MakeInsertTimers< std::list< int32_t > >( 1 << 20 );
+    return MakeFindMissTimers< MapOf< int32_t, 8 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int64_insert4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p8_insert64k >()
 {
-    return MakeInsertTimers< std::list< int64_t > >( 1 << 12 );
+    return MakeInsertTimers< MapOf< int32_t, 8 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_float_insert4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p8_iterate64k >()
 {
-    return MakeInsertTimers< std::list< float > >( 1 << 12 );
+    return MakeCountTimers< MapOf< int32_t, 8 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_double_insert4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p16_copy64k >()
 {
-    return MakeInsertTimers< std::list< double > >( 1 << 12 );
+    return MakeCopyTimers< MapOf< int32_t, 16 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_string_insert4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p16_destroy64k >()
 {
-    return MakeInsertTimers< std::list< std::string > >( 1 << 12 );
+    return MakeDestroyTimers< MapOf< int32_t, 16 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_iterate16 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p16_find64k >()
 {
-    return MakeCountTimers< std::list< int32_t > >( 1 << 4 );
+    return MakeFindTimers< MapOf< int32_t, 16 > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_iterate256 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p16_insert64k >()
 {
-    return MakeCountTimers< std::list< int32_t > >( 1 << 8 );
+    return MakeInsertTimers< MapOf< int32_t, 16 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_iterate4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p16_iterate64k >()
 {
-    return MakeCountTimers< std::list< int32_t > >( 1 << 12 );
+    return MakeCountTimers< MapOf< int32_t, 16 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_iterate64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p32_copy64k >()
 {
-    return MakeCountTimers< std::list< int32_t > >( 1 << 16 );
+    return MakeCopyTimers< MapOf< int32_t, 32 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_iterate1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p32_destroy64k >()
 {
-    return MakeCountTimers< std::list< int32_t > >( 1 << 20 );
+    return MakeDestroyTimers< MapOf< int32_t, 32 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int64_iterate64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p32_find64k >()
 {
-    return MakeCountTimers< std::list< int64_t > >( 1 << 16 );
+    return MakeFindTimers< MapOf< int32_t, 32 > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_float_iterate64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p32_insert64k >()
 {
-    return MakeCountTimers< std::list< float > >( 1 << 16 );
+    return MakeInsertTimers< MapOf< int32_t, 32 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_double_iterate64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p32_iterate64k >()
 {
-    return MakeCountTimers< std::list< double > >( 1 << 16 );
+    return MakeCountTimers< MapOf< int32_t, 32 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_string_iterate64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p64_copy64k >()
 {
-    return MakeCountTimers< std::list< std::string > >( 1 << 16 );
+    return MakeCopyTimers< MapOf< int32_t, 64 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find1 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p64_destroy64k >()
 {
-    return MakeFindTimers< std::list< int32_t > >( true, 1 << 0 );
+    return MakeDestroyTimers< MapOf< int32_t, 64 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find16 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p64_erase64k >()
 {
-    return MakeFindTimers< std::list< int32_t > >( true, 1 << 4 );
+    return MakeEraseTimers< MapOf< int32_t, 64 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find256 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p64_find64k >()
 {
-    return MakeFindTimers< std::list< int32_t > >( true, 1 << 8 );
+    return MakeFindTimers< MapOf< int32_t, 64 > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p64_findmiss64k >()
 {
-    return MakeFindTimers< std::list< int32_t > >( true, 1 << 12 );
+    return MakeFindMissTimers< MapOf< int32_t, 64 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p64_insert64k >()
 {
-    return MakeFindTimers< std::list< int32_t > >( true, 1 << 16 );
+    return MakeInsertTimers< MapOf< int32_t, 64 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_find1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p64_iterate64k >()
 {
-    return MakeFindTimers< std::list< int32_t > >( true, 1 << 20 );
+    return MakeCountTimers< MapOf< int32_t, 64 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int64_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p128_copy64k >()
 {
-    return MakeFindTimers< std::list< int64_t > >( true, 1 << 16 );
+    return MakeCopyTimers< MapOf< int32_t, 128 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_float_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p128_destroy64k >()
 {
-    return MakeFindTimers< std::list< float > >( true, 1 << 16 );
+    return MakeDestroyTimers< MapOf< int32_t, 128 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_double_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p128_find64k >()
 {
-    return MakeFindTimers< std::list< double > >( true, 1 << 16 );
+    return MakeFindTimers< MapOf< int32_t, 128 > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_string_find64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p128_insert64k >()
 {
-    return MakeFindTimers< std::list< std::string > >( true, 1 << 16 );
+    return MakeInsertTimers< MapOf< int32_t, 128 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_copy16 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p128_iterate64k >()
 {
-    return MakeCopyTimers< std::list< int32_t > >( 1 << 4 );
+    return MakeCountTimers< MapOf< int32_t, 128 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_copy256 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p256_copy64k >()
 {
-    return MakeCopyTimers< std::list< int32_t > >( 1 << 8 );
+    return MakeCopyTimers< MapOf< int32_t, 256 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_copy4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p256_destroy64k >()
 {
-    return MakeCopyTimers< std::list< int32_t > >( 1 << 12 );
+    return MakeDestroyTimers< MapOf< int32_t, 256 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p256_erase64k >()
 {
-    return MakeCopyTimers< std::list< int32_t > >( 1 << 16 );
+    return MakeEraseTimers< MapOf< int32_t, 256 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_copy1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p256_find64k >()
 {
-    return MakeCopyTimers< std::list< int32_t > >( 1 << 20 );
+    return MakeFindTimers< MapOf< int32_t, 256 > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int64_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p256_findmiss64k >()
 {
-    return MakeCopyTimers< std::list< int64_t > >( 1 << 16 );
+    return MakeFindMissTimers< MapOf< int32_t, 256 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_float_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p256_insert64k >()
 {
-    return MakeCopyTimers< std::list< float > >( 1 << 16 );
+    return MakeInsertTimers< MapOf< int32_t, 256 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_double_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int32_p256_iterate64k >()
 {
-    return MakeCopyTimers< std::list< double > >( 1 << 16 );
+    return MakeCountTimers< MapOf< int32_t, 256 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_string_copy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int64_p64_copy64k >()
 {
-    return MakeCopyTimers< std::list< std::string > >( 1 << 16 );
+    return MakeCopyTimers< MapOf< int64_t, 64 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_destroy16 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int64_p64_destroy64k >()
 {
-    return MakeDestroyTimers< std::list< int32_t > >( 1 << 4 );
+    return MakeDestroyTimers< MapOf< int64_t, 64 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_destroy256 >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int64_p64_find64k >()
 {
-    return MakeDestroyTimers< std::list< int32_t > >( 1 << 8 );
+    return MakeFindTimers< MapOf< int64_t, 64 > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_destroy4k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int64_p64_insert4k >()
 {
-    return MakeDestroyTimers< std::list< int32_t > >( 1 << 12 );
+    return MakeInsertTimers< MapOf< int64_t, 64 > >( 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_int64_p64_iterate64k >()
 {
-    return MakeDestroyTimers< std::list< int32_t > >( 1 << 16 );
+    return MakeCountTimers< MapOf< int64_t, 64 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int32_destroy1M >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_string_p64_copy64k >()
 {
-    return MakeDestroyTimers< std::list< int32_t > >( 1 << 20 );
+    return MakeCopyTimers< MapOf< std::string, 64 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_int64_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_string_p64_destroy64k >()
 {
-    return MakeDestroyTimers< std::list< int64_t > >( 1 << 16 );
+    return MakeDestroyTimers< MapOf< std::string, 64 > >( 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_float_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_string_p64_find64k >()
 {
-    return MakeDestroyTimers< std::list< float > >( 1 << 16 );
+    return MakeFindTimers< MapOf< std::string, 64 > >( false, 1 << 16 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_double_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_string_p64_insert4k >()
 {
-    return MakeDestroyTimers< std::list< double > >( 1 << 16 );
+    return MakeInsertTimers< MapOf< std::string, 64 > >( 1 << 12 );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::list_string_destroy64k >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::map_string_p64_iterate64k >()
 {
-    return MakeDestroyTimers< std::list< std::string > >( 1 << 16 );
+    return MakeCountTimers< MapOf< std::string, 64 > >( 1 << 16 );
 }
 
 
@@ -1329,6 +4573,16 @@ template<> autotime::BenchTimers MakeTimers< Benchmark::list_string_destroy64k >
 // Category::std_set:
 ////////////////////////////////////////////////////////////
 
+template<> Description Describe< Category::std_set >()
+{
+    Description desc;
+    desc.measures =
+        "std::set<> copy, destroy, find, insert, and iteration, by element type and size.";
+    desc.notes = FixtureNotes();
+    return desc;
+}
+
+
 std::set< int32_t > Set_int32;
 std::set< int64_t > Set_int64;
 std::set< float > Set_float;
@@ -1641,10 +4895,132 @@ template<> autotime::BenchTimers MakeTimers< Benchmark::set_string_destroy64k >(
 }
 
 
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_arena_int32_destroy64k >()
+{
+    using container_t = Allocated< SetOf, ArenaFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, ArenaFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_arena_int32_find64k >()
+{
+    using container_t = Allocated< SetOf, ArenaFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, ArenaFixture >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_arena_int32_insert64k >()
+{
+    using container_t = Allocated< SetOf, ArenaFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, ArenaFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_arena_int32_iterate1M >()
+{
+    using container_t = Allocated< SetOf, ArenaFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, ArenaFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_mono_int32_destroy64k >()
+{
+    using container_t = Allocated< SetOf, MonotonicFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, MonotonicFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_mono_int32_find64k >()
+{
+    using container_t = Allocated< SetOf, MonotonicFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, MonotonicFixture >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_mono_int32_insert64k >()
+{
+    using container_t = Allocated< SetOf, MonotonicFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, MonotonicFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_mono_int32_iterate1M >()
+{
+    using container_t = Allocated< SetOf, MonotonicFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, MonotonicFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_spool_int32_destroy64k >()
+{
+    using container_t = Allocated< SetOf, SyncPoolFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, SyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_spool_int32_find64k >()
+{
+    using container_t = Allocated< SetOf, SyncPoolFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, SyncPoolFixture >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_spool_int32_insert64k >()
+{
+    using container_t = Allocated< SetOf, SyncPoolFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, SyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_spool_int32_iterate1M >()
+{
+    using container_t = Allocated< SetOf, SyncPoolFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, SyncPoolFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_upool_int32_destroy64k >()
+{
+    using container_t = Allocated< SetOf, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, UnsyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_upool_int32_find64k >()
+{
+    using container_t = Allocated< SetOf, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, UnsyncPoolFixture >( false, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_upool_int32_insert64k >()
+{
+    using container_t = Allocated< SetOf, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, UnsyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::set_upool_int32_iterate1M >()
+{
+    using container_t = Allocated< SetOf, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, UnsyncPoolFixture >( 1 << 20 );
+}
+
+
 ////////////////////////////////////////////////////////////
 // Category::std_vector:
 ////////////////////////////////////////////////////////////
 
+template<> Description Describe< Category::std_vector >()
+{
+    Description desc;
+    desc.measures =
+        "std::vector<> copy, destroy, find, insert, and iteration, by element type and size.";
+    desc.notes = FixtureNotes();
+    return desc;
+}
+
+
 std::vector< int32_t > Vector_int32;
 std::vector< int64_t > Vector_int64;
 std::vector< float > Vector_float;
@@ -1927,5 +5303,117 @@ template<> autotime::BenchTimers MakeTimers< Benchmark::vec_string_destroy64k >(
 }
 
 
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_arena_int32_destroy64k >()
+{
+    using container_t = Allocated< std::vector, ArenaFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, ArenaFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_arena_int32_find64k >()
+{
+    using container_t = Allocated< std::vector, ArenaFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, ArenaFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_arena_int32_insert64k >()
+{
+    using container_t = Allocated< std::vector, ArenaFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, ArenaFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_arena_int32_iterate1M >()
+{
+    using container_t = Allocated< std::vector, ArenaFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, ArenaFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_mono_int32_destroy64k >()
+{
+    using container_t = Allocated< std::vector, MonotonicFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, MonotonicFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_mono_int32_find64k >()
+{
+    using container_t = Allocated< std::vector, MonotonicFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, MonotonicFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_mono_int32_insert64k >()
+{
+    using container_t = Allocated< std::vector, MonotonicFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, MonotonicFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_mono_int32_iterate1M >()
+{
+    using container_t = Allocated< std::vector, MonotonicFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, MonotonicFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_spool_int32_destroy64k >()
+{
+    using container_t = Allocated< std::vector, SyncPoolFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, SyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_spool_int32_find64k >()
+{
+    using container_t = Allocated< std::vector, SyncPoolFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, SyncPoolFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_spool_int32_insert64k >()
+{
+    using container_t = Allocated< std::vector, SyncPoolFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, SyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_spool_int32_iterate1M >()
+{
+    using container_t = Allocated< std::vector, SyncPoolFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, SyncPoolFixture >( 1 << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_upool_int32_destroy64k >()
+{
+    using container_t = Allocated< std::vector, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureDestroyTimers< container_t, UnsyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_upool_int32_find64k >()
+{
+    using container_t = Allocated< std::vector, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureFindTimers< container_t, UnsyncPoolFixture >( true, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_upool_int32_insert64k >()
+{
+    using container_t = Allocated< std::vector, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureInsertTimers< container_t, UnsyncPoolFixture >( 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vec_upool_int32_iterate1M >()
+{
+    using container_t = Allocated< std::vector, UnsyncPoolFixture, int32_t >;
+    return MakeFixtureCountTimers< container_t, UnsyncPoolFixture >( 1 << 20 );
+}
+
+
 } // namespace bench
 
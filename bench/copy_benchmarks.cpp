@@ -0,0 +1,918 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements copy-category benchmarks.
+/*! @file
+
+    These compare explicit memcpy() & memset() strategies against libc, by size and alignment.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "dispatch.hpp"
+
+#include "autotime/overhead.hpp"
+#include "autotime/time.hpp"
+
+#include <cstring>
+#include <functional>
+#include <memory>
+
+#include "copy_kernels.hpp"
+#include "description.hpp"
+#include "page_utils.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::copy >()
+{
+    Description desc;
+    desc.measures = "memcpy(), memset(), and memmove() strategies, by size and alignment.";
+    desc.detail =
+        "copy_<op>_<method>_<size> repeatedly copies or sets the same buffers, which start on"
+        " page boundaries, so the smaller sizes run from cache.  The methods are libc (i.e."
+        " memcpy() or memset()), rep (rep movsb or rep stosb), avx2 (an unrolled loop of"
+        " unaligned 32-byte loads & stores), and nt (non-temporal 16-byte stores with movntdq,"
+        " after aligning the destination to a cache line, and followed by sfence).";
+    desc.notes =
+        {
+            "copy_memcpy_<method>_4k_src<n> & _dst<n> offset the source or destination by n bytes"
+                " from a page boundary.",
+            "copy_memmove_up_* & _down_* move a region by 64 bytes toward higher or lower"
+                " addresses, so that the source and destination overlap.",
+            "The GB/s of each method by size, and the sizes at which each one beats libc, are"
+                " printed after the results, as is the change due to misalignment.",
+            "Buffers use 4 KiB pages, so that results don't depend on THP availability.",
+        };
+    desc.limits =
+        {
+            "Since nt bypasses the cache, a following read of the destination would miss, which"
+                " isn't measured here.  The crossover to nt is therefore optimistic for data that's"
+                " consumed soon after it's copied.",
+            "libc typically selects among several of these strategies by size and CPU features,"
+                " so its results are a moving target across versions.",
+        };
+    return desc;
+}
+
+
+    // Distance moved by the copy_memmove_* benchmarks.
+static constexpr size_t Move_distance = 64;
+
+
+    // Maps a page-aligned buffer of at least size + offset bytes.
+static std::shared_ptr< PageMapping > MapBuffer( size_t size, int offset )
+{
+    return MapPages( size + offset, PageKind::small );
+}
+
+
+static autotime::BenchTimers MakeCopy(
+    CopyMethod method, size_t size, int src_offset, int dst_offset )
+{
+    const CopyFn copy = GetCopyFn( method );
+    std::shared_ptr< PageMapping > src = MapBuffer( size, src_offset );
+    std::shared_ptr< PageMapping > dst = MapBuffer( size, dst_offset );
+    memset( src->data(), 0xa5, src->size() );
+
+    std::function< void() > f = [copy, src, dst, size, src_offset, dst_offset]()
+        {
+            copy( static_cast< char * >( dst->data() ) + dst_offset,
+                static_cast< const char * >( src->data() ) + src_offset, size );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+static autotime::BenchTimers MakeSet( CopyMethod method, size_t size )
+{
+    const SetFn set = GetSetFn( method );
+    std::shared_ptr< PageMapping > dst = MapBuffer( size, 0 );
+
+    std::function< void() > f = [set, dst, size]()
+        {
+            set( dst->data(), 0xcc, size );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+static autotime::BenchTimers MakeMove( size_t size, bool up )
+{
+    std::shared_ptr< PageMapping > buf = MapBuffer( size, Move_distance );
+    char *const lower = static_cast< char * >( buf->data() );
+    char *const upper = lower + Move_distance;
+    char *const dst = up ? upper : lower;
+    const char *const src = up ? lower : upper;
+
+    std::function< void() > f = [buf, dst, src, size]()
+        {
+            memmove( dst, src, size );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_64 >()
+{
+    return MakeCopy( CopyMethod::libc, 64, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_256 >()
+{
+    return MakeCopy( CopyMethod::libc, 256, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_1k >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 10, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_16k >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 14, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_64k >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 16, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_256k >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 18, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_1M >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 20, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4M >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 22, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_16M >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 24, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_64M >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 26, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_64 >()
+{
+    return MakeCopy( CopyMethod::rep, 64, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_256 >()
+{
+    return MakeCopy( CopyMethod::rep, 256, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_1k >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 10, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_16k >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 14, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_64k >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 16, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_256k >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 18, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_1M >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 20, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4M >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 22, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_16M >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 24, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_64M >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 26, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_64 >()
+{
+    return MakeCopy( CopyMethod::avx2, 64, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_256 >()
+{
+    return MakeCopy( CopyMethod::avx2, 256, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_1k >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 10, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_16k >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 14, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_64k >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 16, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_256k >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 18, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_1M >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 20, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4M >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 22, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_16M >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 24, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_64M >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 26, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_nt_64 >()
+{
+    return MakeCopy( CopyMethod::nt, 64, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_nt_256 >()
+{
+    return MakeCopy( CopyMethod::nt, 256, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_nt_1k >()
+{
+    return MakeCopy( CopyMethod::nt, size_t{ 1 } << 10, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_nt_4k >()
+{
+    return MakeCopy( CopyMethod::nt, size_t{ 1 } << 12, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_nt_16k >()
+{
+    return MakeCopy( CopyMethod::nt, size_t{ 1 } << 14, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_nt_64k >()
+{
+    return MakeCopy( CopyMethod::nt, size_t{ 1 } << 16, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_nt_256k >()
+{
+    return MakeCopy( CopyMethod::nt, size_t{ 1 } << 18, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_nt_1M >()
+{
+    return MakeCopy( CopyMethod::nt, size_t{ 1 } << 20, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_nt_4M >()
+{
+    return MakeCopy( CopyMethod::nt, size_t{ 1 } << 22, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_nt_16M >()
+{
+    return MakeCopy( CopyMethod::nt, size_t{ 1 } << 24, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_nt_64M >()
+{
+    return MakeCopy( CopyMethod::nt, size_t{ 1 } << 26, 0, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_libc_64 >()
+{
+    return MakeSet( CopyMethod::libc, 64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_libc_256 >()
+{
+    return MakeSet( CopyMethod::libc, 256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_libc_1k >()
+{
+    return MakeSet( CopyMethod::libc, size_t{ 1 } << 10 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_libc_4k >()
+{
+    return MakeSet( CopyMethod::libc, size_t{ 1 } << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_libc_16k >()
+{
+    return MakeSet( CopyMethod::libc, size_t{ 1 } << 14 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_libc_64k >()
+{
+    return MakeSet( CopyMethod::libc, size_t{ 1 } << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_libc_256k >()
+{
+    return MakeSet( CopyMethod::libc, size_t{ 1 } << 18 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_libc_1M >()
+{
+    return MakeSet( CopyMethod::libc, size_t{ 1 } << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_libc_4M >()
+{
+    return MakeSet( CopyMethod::libc, size_t{ 1 } << 22 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_libc_16M >()
+{
+    return MakeSet( CopyMethod::libc, size_t{ 1 } << 24 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_libc_64M >()
+{
+    return MakeSet( CopyMethod::libc, size_t{ 1 } << 26 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_rep_64 >()
+{
+    return MakeSet( CopyMethod::rep, 64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_rep_256 >()
+{
+    return MakeSet( CopyMethod::rep, 256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_rep_1k >()
+{
+    return MakeSet( CopyMethod::rep, size_t{ 1 } << 10 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_rep_4k >()
+{
+    return MakeSet( CopyMethod::rep, size_t{ 1 } << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_rep_16k >()
+{
+    return MakeSet( CopyMethod::rep, size_t{ 1 } << 14 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_rep_64k >()
+{
+    return MakeSet( CopyMethod::rep, size_t{ 1 } << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_rep_256k >()
+{
+    return MakeSet( CopyMethod::rep, size_t{ 1 } << 18 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_rep_1M >()
+{
+    return MakeSet( CopyMethod::rep, size_t{ 1 } << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_rep_4M >()
+{
+    return MakeSet( CopyMethod::rep, size_t{ 1 } << 22 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_rep_16M >()
+{
+    return MakeSet( CopyMethod::rep, size_t{ 1 } << 24 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_rep_64M >()
+{
+    return MakeSet( CopyMethod::rep, size_t{ 1 } << 26 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_avx2_64 >()
+{
+    return MakeSet( CopyMethod::avx2, 64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_avx2_256 >()
+{
+    return MakeSet( CopyMethod::avx2, 256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_avx2_1k >()
+{
+    return MakeSet( CopyMethod::avx2, size_t{ 1 } << 10 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_avx2_4k >()
+{
+    return MakeSet( CopyMethod::avx2, size_t{ 1 } << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_avx2_16k >()
+{
+    return MakeSet( CopyMethod::avx2, size_t{ 1 } << 14 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_avx2_64k >()
+{
+    return MakeSet( CopyMethod::avx2, size_t{ 1 } << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_avx2_256k >()
+{
+    return MakeSet( CopyMethod::avx2, size_t{ 1 } << 18 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_avx2_1M >()
+{
+    return MakeSet( CopyMethod::avx2, size_t{ 1 } << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_avx2_4M >()
+{
+    return MakeSet( CopyMethod::avx2, size_t{ 1 } << 22 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_avx2_16M >()
+{
+    return MakeSet( CopyMethod::avx2, size_t{ 1 } << 24 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_avx2_64M >()
+{
+    return MakeSet( CopyMethod::avx2, size_t{ 1 } << 26 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_nt_64 >()
+{
+    return MakeSet( CopyMethod::nt, 64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_nt_256 >()
+{
+    return MakeSet( CopyMethod::nt, 256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_nt_1k >()
+{
+    return MakeSet( CopyMethod::nt, size_t{ 1 } << 10 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_nt_4k >()
+{
+    return MakeSet( CopyMethod::nt, size_t{ 1 } << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_nt_16k >()
+{
+    return MakeSet( CopyMethod::nt, size_t{ 1 } << 14 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_nt_64k >()
+{
+    return MakeSet( CopyMethod::nt, size_t{ 1 } << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_nt_256k >()
+{
+    return MakeSet( CopyMethod::nt, size_t{ 1 } << 18 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_nt_1M >()
+{
+    return MakeSet( CopyMethod::nt, size_t{ 1 } << 20 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_nt_4M >()
+{
+    return MakeSet( CopyMethod::nt, size_t{ 1 } << 22 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_nt_16M >()
+{
+    return MakeSet( CopyMethod::nt, size_t{ 1 } << 24 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memset_nt_64M >()
+{
+    return MakeSet( CopyMethod::nt, size_t{ 1 } << 26 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_src1 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 1, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_src4 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 4, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_src8 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 8, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_src16 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 16, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_src32 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 32, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_src63 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 63, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_dst1 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 0, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_dst4 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 0, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_dst8 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 0, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_dst16 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 0, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_dst32 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 0, 32 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_libc_4k_dst63 >()
+{
+    return MakeCopy( CopyMethod::libc, size_t{ 1 } << 12, 0, 63 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_src1 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 1, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_src4 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 4, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_src8 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 8, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_src16 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 16, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_src32 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 32, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_src63 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 63, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_dst1 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 0, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_dst4 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 0, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_dst8 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 0, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_dst16 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 0, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_dst32 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 0, 32 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_rep_4k_dst63 >()
+{
+    return MakeCopy( CopyMethod::rep, size_t{ 1 } << 12, 0, 63 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_src1 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 1, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_src4 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 4, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_src8 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 8, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_src16 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 16, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_src32 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 32, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_src63 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 63, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_dst1 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 0, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_dst4 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 0, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_dst8 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 0, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_dst16 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 0, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_dst32 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 0, 32 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memcpy_avx2_4k_dst63 >()
+{
+    return MakeCopy( CopyMethod::avx2, size_t{ 1 } << 12, 0, 63 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memmove_up_256 >()
+{
+    return MakeMove( 256, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memmove_up_4k >()
+{
+    return MakeMove( size_t{ 1 } << 12, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memmove_up_64k >()
+{
+    return MakeMove( size_t{ 1 } << 16, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memmove_up_1M >()
+{
+    return MakeMove( size_t{ 1 } << 20, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memmove_down_256 >()
+{
+    return MakeMove( 256, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memmove_down_4k >()
+{
+    return MakeMove( size_t{ 1 } << 12, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memmove_down_64k >()
+{
+    return MakeMove( size_t{ 1 } << 16, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::copy_memmove_down_1M >()
+{
+    return MakeMove( size_t{ 1 } << 20, false );
+}
+
+
+} // namespace bench
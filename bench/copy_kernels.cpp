@@ -0,0 +1,469 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Explicit memcpy() and memset() implementations.
+/*! @file
+
+    See copy_kernels.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "copy_kernels.hpp"
+#include "format_utils.hpp"
+
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include <immintrin.h>
+
+#include "error_utils.hpp"
+#include "simd_kernels.hpp"
+
+
+#define AVX2_KERNEL __attribute__(( target( "avx2" ) ))
+
+
+namespace bench
+{
+
+
+const char *ToCStr( CopyMethod method )
+{
+    switch (method)
+    {
+#define CASE( n ) \
+    case CopyMethod::n: \
+        return #n
+
+    CASE( libc );
+    CASE( rep );
+    CASE( avx2 );
+    CASE( nt );
+
+#undef CASE
+    }
+
+    return nullptr;
+}
+
+
+const char *ToCStr( CopyOp op )
+{
+    switch (op)
+    {
+#define CASE( n ) \
+    case CopyOp::n: \
+        return #n
+
+    CASE( memcpy );
+    CASE( memset );
+
+#undef CASE
+    }
+
+    return nullptr;
+}
+
+
+
+// Copy functions:
+static void CopyLibc( void *dst, const void *src, size_t n )
+{
+    memcpy( dst, src, n );
+}
+
+
+static void CopyRep( void *dst, const void *src, size_t n )
+{
+    asm volatile ( "rep movsb" : "+D"( dst ), "+S"( src ), "+c"( n ) : : "memory" );
+}
+
+
+AVX2_KERNEL static void CopyAvx2( void *dst, const void *src, size_t n )
+{
+    if (n < 32) return CopyRep( dst, src, n );
+
+    uint8_t *d = static_cast< uint8_t * >( dst );
+    const uint8_t *s = static_cast< const uint8_t * >( src );
+
+    // The final vector overlaps the loop's last one, unless n is a multiple of 32.
+    const __m256i last = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( s + n - 32 ) );
+
+    size_t i = 0;
+    for (; i + 128 <= n; i += 128)
+    {
+        const __m256i v0 = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( s + i ) );
+        const __m256i v1 = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( s + i + 32 ) );
+        const __m256i v2 = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( s + i + 64 ) );
+        const __m256i v3 = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( s + i + 96 ) );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + i ), v0 );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + i + 32 ), v1 );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + i + 64 ), v2 );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + i + 96 ), v3 );
+    }
+
+    for (; i + 32 <= n; i += 32)
+    {
+        const __m256i v = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( s + i ) );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + i ), v );
+    }
+
+    _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + n - 32 ), last );
+}
+
+
+    // Bytes preceding the next 64-byte boundary.
+static size_t HeadBytes( const void *p )
+{
+    return (64 - (reinterpret_cast< uintptr_t >( p ) & 63)) & 63;
+}
+
+
+static void CopyNt( void *dst, const void *src, size_t n )
+{
+    if (n < 128) return CopyRep( dst, src, n );
+
+    uint8_t *d = static_cast< uint8_t * >( dst );
+    const uint8_t *s = static_cast< const uint8_t * >( src );
+
+    // Align the destination, so that each group of streaming stores fills a whole line.
+    const size_t head = HeadBytes( d );
+    CopyRep( d, s, head );
+    d += head;
+    s += head;
+    n -= head;
+
+    for (; n >= 64; d += 64, s += 64, n -= 64)
+    {
+        const __m128i v0 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( s ) );
+        const __m128i v1 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( s + 16 ) );
+        const __m128i v2 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( s + 32 ) );
+        const __m128i v3 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( s + 48 ) );
+        _mm_stream_si128( reinterpret_cast< __m128i * >( d ), v0 );
+        _mm_stream_si128( reinterpret_cast< __m128i * >( d + 16 ), v1 );
+        _mm_stream_si128( reinterpret_cast< __m128i * >( d + 32 ), v2 );
+        _mm_stream_si128( reinterpret_cast< __m128i * >( d + 48 ), v3 );
+    }
+
+    // Order the streaming stores before any subsequent ones, as a real memcpy() must.
+    _mm_sfence();
+
+    CopyRep( d, s, n );
+}
+
+
+
+// Set functions:
+static void SetLibc( void *dst, uint8_t value, size_t n )
+{
+    memset( dst, value, n );
+}
+
+
+static void SetRep( void *dst, uint8_t value, size_t n )
+{
+    asm volatile ( "rep stosb" : "+D"( dst ), "+c"( n ) : "a"( value ) : "memory" );
+}
+
+
+AVX2_KERNEL static void SetAvx2( void *dst, uint8_t value, size_t n )
+{
+    if (n < 32) return SetRep( dst, value, n );
+
+    uint8_t *d = static_cast< uint8_t * >( dst );
+    const __m256i v = _mm256_set1_epi8( static_cast< char >( value ) );
+
+    size_t i = 0;
+    for (; i + 128 <= n; i += 128)
+    {
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + i ), v );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + i + 32 ), v );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + i + 64 ), v );
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + i + 96 ), v );
+    }
+
+    for (; i + 32 <= n; i += 32) _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + i ), v );
+
+    _mm256_storeu_si256( reinterpret_cast< __m256i * >( d + n - 32 ), v );
+}
+
+
+static void SetNt( void *dst, uint8_t value, size_t n )
+{
+    if (n < 128) return SetRep( dst, value, n );
+
+    uint8_t *d = static_cast< uint8_t * >( dst );
+    const __m128i v = _mm_set1_epi8( static_cast< char >( value ) );
+
+    const size_t head = HeadBytes( d );
+    SetRep( d, value, head );
+    d += head;
+    n -= head;
+
+    for (; n >= 64; d += 64, n -= 64)
+    {
+        _mm_stream_si128( reinterpret_cast< __m128i * >( d ), v );
+        _mm_stream_si128( reinterpret_cast< __m128i * >( d + 16 ), v );
+        _mm_stream_si128( reinterpret_cast< __m128i * >( d + 32 ), v );
+        _mm_stream_si128( reinterpret_cast< __m128i * >( d + 48 ), v );
+    }
+
+    _mm_sfence();
+
+    SetRep( d, value, n );
+}
+
+
+
+static void CheckSupported( CopyMethod method )
+{
+    if (method == CopyMethod::avx2 && !IsSupported( Isa::avx2 ))
+    {
+        throw unavailable_error( "avx2 isn't supported by this CPU" );
+    }
+}
+
+
+CopyFn GetCopyFn( CopyMethod method )
+{
+    CheckSupported( method );
+
+    switch (method)
+    {
+    case CopyMethod::libc:
+        return &CopyLibc;
+
+    case CopyMethod::rep:
+        return &CopyRep;
+
+    case CopyMethod::avx2:
+        return &CopyAvx2;
+
+    case CopyMethod::nt:
+        return &CopyNt;
+    }
+
+    return &CopyLibc;
+}
+
+
+SetFn GetSetFn( CopyMethod method )
+{
+    CheckSupported( method );
+
+    switch (method)
+    {
+    case CopyMethod::libc:
+        return &SetLibc;
+
+    case CopyMethod::rep:
+        return &SetRep;
+
+    case CopyMethod::avx2:
+        return &SetAvx2;
+
+    case CopyMethod::nt:
+        return &SetNt;
+    }
+
+    return &SetLibc;
+}
+
+
+bool GetCopyParams( Benchmark benchmark, CopyParams &params )
+{
+    switch (benchmark)
+    {
+#define CASE__SIZE( o, m, s, n ) \
+    case Benchmark::copy_ ## o ## _ ## m ## _ ## s: \
+        params = { CopyOp::o, CopyMethod::m, n, 0, 0 }; \
+        return true
+
+#define CASE__SIZES( o, m ) \
+    CASE__SIZE( o, m, 64, 64 ); \
+    CASE__SIZE( o, m, 256, 256 ); \
+    CASE__SIZE( o, m, 1k, size_t{ 1 } << 10 ); \
+    CASE__SIZE( o, m, 4k, size_t{ 1 } << 12 ); \
+    CASE__SIZE( o, m, 16k, size_t{ 1 } << 14 ); \
+    CASE__SIZE( o, m, 64k, size_t{ 1 } << 16 ); \
+    CASE__SIZE( o, m, 256k, size_t{ 1 } << 18 ); \
+    CASE__SIZE( o, m, 1M, size_t{ 1 } << 20 ); \
+    CASE__SIZE( o, m, 4M, size_t{ 1 } << 22 ); \
+    CASE__SIZE( o, m, 16M, size_t{ 1 } << 24 ); \
+    CASE__SIZE( o, m, 64M, size_t{ 1 } << 26 )
+
+    CASE__SIZES( memcpy, libc );
+    CASE__SIZES( memcpy, rep );
+    CASE__SIZES( memcpy, avx2 );
+    CASE__SIZES( memcpy, nt );
+    CASE__SIZES( memset, libc );
+    CASE__SIZES( memset, rep );
+    CASE__SIZES( memset, avx2 );
+    CASE__SIZES( memset, nt );
+
+#undef CASE__SIZES
+#undef CASE__SIZE
+
+#define CASE__MISALIGN( m, n ) \
+    case Benchmark::copy_memcpy_ ## m ## _4k_src ## n: \
+        params = { CopyOp::memcpy, CopyMethod::m, size_t{ 1 } << 12, n, 0 }; \
+        return true; \
+    case Benchmark::copy_memcpy_ ## m ## _4k_dst ## n: \
+        params = { CopyOp::memcpy, CopyMethod::m, size_t{ 1 } << 12, 0, n }; \
+        return true
+
+#define CASE__MISALIGNS( m ) \
+    CASE__MISALIGN( m, 1 ); \
+    CASE__MISALIGN( m, 4 ); \
+    CASE__MISALIGN( m, 8 ); \
+    CASE__MISALIGN( m, 16 ); \
+    CASE__MISALIGN( m, 32 ); \
+    CASE__MISALIGN( m, 63 )
+
+    CASE__MISALIGNS( libc );
+    CASE__MISALIGNS( rep );
+    CASE__MISALIGNS( avx2 );
+
+#undef CASE__MISALIGNS
+#undef CASE__MISALIGN
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
+
+static std::string SizeStr( size_t size )
+{
+    std::ostringstream oss;
+    PrettyPrintSizeof( oss, size ) << "B";
+    return oss.str();
+}
+
+
+std::ostream &PrintCopySummary( std::ostream &ostream, const std::vector< CopyResult > &results )
+{
+    // Bandwidth (GB/s) of page-aligned copies, by operation, size, and method.
+    std::map< CopyOp, std::map< size_t, std::map< CopyMethod, double > > > aligned;
+
+    // Bandwidth (GB/s) of misaligned copies, by method, (destination?), and offset.
+    std::map< CopyMethod, std::map< bool, std::map< int, double > > > misaligned;
+
+    for (const CopyResult &result: results)
+    {
+        const CopyParams &p = result.params;
+        if (p.src_offset == 0 && p.dst_offset == 0)
+        {
+            aligned[p.op][p.size][p.method] = result.gb_per_s;
+        }
+        else misaligned[p.method][p.dst_offset != 0][p.src_offset + p.dst_offset] = result.gb_per_s;
+    }
+
+    const auto precision_prev = ostream.precision( 4 );
+    for (const auto &op_sizes: aligned)
+    {
+        // Determine which methods were run, to use as columns.
+        std::map< CopyMethod, std::vector< std::string > > wins;    // Sizes at which it beats libc.
+        for (const auto &size_methods: op_sizes.second)
+        {
+            for (const auto &method_bw: size_methods.second) wins[method_bw.first];
+        }
+
+        ostream << ToCStr( op_sizes.first ) << " (GB/s by size, * marks the fastest):\n";
+        ostream << "  " << std::setw( 8 ) << "size";
+        for (const auto &method_wins: wins)
+        {
+            ostream << std::setw( 10 ) << ToCStr( method_wins.first );
+        }
+        ostream << "\n";
+
+        for (const auto &size_methods: op_sizes.second)
+        {
+            const std::map< CopyMethod, double > &bws = size_methods.second;
+            double best = 0.0;
+            for (const auto &method_bw: bws) best = std::max( best, method_bw.second );
+
+            const auto libc = bws.find( CopyMethod::libc );
+            ostream << "  " << std::setw( 8 ) << SizeStr( size_methods.first );
+            for (auto &method_wins: wins)
+            {
+                const auto found = bws.find( method_wins.first );
+                if (found == bws.end())
+                {
+                    ostream << std::setw( 10 ) << "-";
+                    continue;
+                }
+
+                std::ostringstream cell;
+                cell.precision( 4 );
+                cell << found->second << (found->second == best ? "*" : " ");
+                ostream << std::setw( 10 ) << cell.str();
+
+                // Require a 5% margin, so noise isn't reported as a crossover.
+                if (libc != bws.end() && found != libc && found->second > 1.05 * libc->second)
+                {
+                    method_wins.second.push_back( SizeStr( size_methods.first ) );
+                }
+            }
+            ostream << "\n";
+        }
+
+        for (const auto &method_wins: wins)
+        {
+            if (method_wins.first == CopyMethod::libc) continue;
+
+            ostream << "  " << ToCStr( method_wins.first ) << " beats libc by >5% at:";
+            if (method_wins.second.empty()) ostream << " (none)";
+            for (const std::string &size: method_wins.second) ostream << " " << size;
+            ostream << "\n";
+        }
+    }
+
+    if (!misaligned.empty())
+    {
+        const size_t size = size_t{ 1 } << 12;
+        ostream << "memcpy misalignment (% change in GB/s vs. aligned, at " << SizeStr( size )
+            << "):\n";
+
+        for (const auto &method_dirs: misaligned)
+        {
+            double aligned_bw = 0.0;
+            auto found = aligned[CopyOp::memcpy][size].find( method_dirs.first );
+            if (found != aligned[CopyOp::memcpy][size].end()) aligned_bw = found->second;
+
+            for (const auto &dir_offsets: method_dirs.second)
+            {
+                ostream << "  " << std::setw( 4 ) << ToCStr( method_dirs.first )
+                    << (dir_offsets.first ? " dst:" : " src:");
+                for (const auto &offset_bw: dir_offsets.second)
+                {
+                    std::ostringstream cell;
+                    if (aligned_bw > 0.0)
+                    {
+                        const double change = 100.0 * (offset_bw.second / aligned_bw - 1.0);
+                        cell << std::showpos << std::fixed << std::setprecision( 1 )
+                            << change << "%";
+                    }
+                    else cell << offset_bw.second << " GB/s";
+                    ostream << "  +" << offset_bw.first << " " << cell.str();
+                }
+                ostream << "\n";
+            }
+        }
+    }
+    ostream.precision( precision_prev );
+
+    return ostream;
+}
+
+
+} // namespace bench
@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Explicit memcpy() and memset() implementations, for comparison with libc.
+/*! @file
+
+    These let the copy_* benchmarks find the sizes at which a particular
+    strategy (e.g. rep movsb or non-temporal stores) beats libc, which
+    already switches between several internally.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_COPY_KERNELS_HPP
+#define BENCH_COPY_KERNELS_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+#include "list.hpp"
+
+
+namespace bench
+{
+
+
+enum class CopyMethod
+{
+    libc,   //!< memcpy() / memset()
+    rep,    //!< rep movsb / rep stosb
+    avx2,   //!< Unrolled loop of unaligned 32-byte loads & stores.
+    nt      //!< Non-temporal 16-byte stores (movntdq), to aligned lines, followed by sfence.
+};
+
+
+const char *ToCStr( CopyMethod method );
+
+
+using CopyFn = void (*)( void *dst, const void *src, size_t n );
+using SetFn = void (*)( void *dst, uint8_t value, size_t n );
+
+
+    //! Returns the memcpy() implementation for the specified method.
+    /*!
+        @throws unavailable_error, if the CPU doesn't support the method.
+    */
+CopyFn GetCopyFn( CopyMethod method );
+
+
+    //! Returns the memset() implementation for the specified method.
+    /*!
+        @throws unavailable_error, if the CPU doesn't support the method.
+    */
+SetFn GetSetFn( CopyMethod method );
+
+
+enum class CopyOp
+{
+    memcpy,
+    memset
+};
+
+
+const char *ToCStr( CopyOp op );
+
+
+    //! Describes one of the copy_memcpy_* or copy_memset_* benchmarks.
+struct CopyParams
+{
+    CopyOp op;
+    CopyMethod method;
+    size_t size;
+    int src_offset;     //!< From a page boundary.
+    int dst_offset;     //!< From a page boundary.
+};
+
+
+    //! Returns true and sets params, if benchmark is one of the copy_memcpy_* or copy_memset_*.
+bool GetCopyParams( Benchmark benchmark, CopyParams &params );
+
+
+struct CopyResult
+{
+    CopyParams params;
+    double gb_per_s;
+};
+
+
+    //! Prints bandwidth by size & method, where each method beats libc, and misalignment costs.
+std::ostream &PrintCopySummary( std::ostream &ostream, const std::vector< CopyResult > &results );
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_COPY_KERNELS_HPP
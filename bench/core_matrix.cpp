@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Core-to-core latency, via cache-line ping-pong.
+/*! @file
+
+    See core_matrix.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "core_matrix.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <ostream>
+
+#include "autotime/os.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+CounterParty::CounterParty( int core_id )
+:
+    i_{ 0 },
+    stop_{ false }
+{
+    std::promise< void > started_promise;
+    std::future< void > started_future = started_promise.get_future();
+    thread_ = std::thread( &CounterParty::threadfunc, this, core_id, std::move( started_promise ) );
+    started_future.get();
+}
+
+
+CounterParty::~CounterParty()
+{
+    stop_ = true;
+    thread_.join();
+}
+
+
+void CounterParty::threadfunc( int core_id, std::promise< void > started_promise )
+{
+    SetCoreAffinity( core_id );
+
+    started_promise.set_value();
+
+    int exp = 0;
+    int counter = 0;    // counter avoids sampling stop too often.
+    while ((counter++ % 4096) || !stop_)
+    {
+        int x = exp;
+        if (i_.compare_exchange_weak( x, exp + 1 )) exp += 2;
+    }
+}
+
+
+Durations PingPong( std::shared_ptr< CounterParty > p_counterparty, int num_iters )
+{
+    std::atomic< int > &i = p_counterparty->i_;
+
+    int exp = i;
+    if (exp % 2 == 0) exp += 1;     // Avoid race by ensuring exp is odd.
+
+    //  We want to start timing right after incrementing the counter again.
+    int x = exp;
+    while (!i.compare_exchange_weak( x, exp + 1 )) x = exp;
+    exp += 2;
+
+    TimePoints start_times = Start();
+
+    for (int count = 0; count < num_iters; ++count)
+    {
+        int x = exp;
+        while (!i.compare_exchange_weak( x, exp + 1 )) x = exp;
+        exp += 2;
+    }
+
+    return End( start_times );
+}
+
+
+    // Round trips per sample, and samples per pair (of which the fastest is used).
+static constexpr int Matrix_round_trips = 1000;
+static constexpr int Matrix_samples = 5;
+
+
+    // Returns the best round-trip time (ns) from the current core to core_id.
+static double MeasureRoundTrip( int core_id )
+{
+    std::shared_ptr< CounterParty > p_counterparty{ new CounterParty( core_id ) };
+
+    // The first sample just brings both cores out of any idle state.
+    PingPong( p_counterparty, Matrix_round_trips );
+
+    double best = std::numeric_limits< double >::infinity();
+    for (int sample = 0; sample < Matrix_samples; ++sample)
+    {
+        const Durations durs = PingPong( p_counterparty, Matrix_round_trips );
+        const double ns = std::chrono::duration< double, std::nano >( durs.real ).count();
+        best = std::min( best, ns / Matrix_round_trips );
+    }
+
+    return best;
+}
+
+
+CoreLatencyMatrix MeasureCoreLatencies( int max_cores )
+{
+    std::vector< CpuTopology > topology = GetCpuTopology();
+
+    CoreLatencyMatrix matrix;
+    const size_t num_online = topology.size();
+    const size_t n = std::min( num_online, static_cast< size_t >( std::max( max_cores, 2 ) ) );
+    for (size_t i = 0; i < n; ++i) matrix.cores.push_back( topology[i * num_online / n].cpu_id );
+
+    const int home_core = GetCurrentCoreId();
+    const double nan = std::numeric_limits< double >::quiet_NaN();
+    matrix.ns.assign( n, std::vector< double >( n, nan ) );
+    for (size_t i = 0; i < n; ++i)
+    {
+        SetCoreAffinity( matrix.cores[i] );
+        for (size_t j = 0; j < n; ++j)
+        {
+            if (i != j) matrix.ns[i][j] = MeasureRoundTrip( matrix.cores[j] );
+        }
+    }
+    SetCoreAffinity( home_core );
+
+    return matrix;
+}
+
+
+std::ostream &PrintCoreLatencies(
+    std::ostream &ostream,
+    const CoreLatencyMatrix &matrix,
+    const std::vector< CpuTopology > &topology )
+{
+    const size_t n = matrix.cores.size();
+    if (n < 2) return ostream << "Core-to-core latency needs at least 2 online cores.\n";
+
+    ostream << "Core-to-core round trip (ns, from row to column):\n";
+    ostream << "  " << std::setw( 5 ) << "core";
+    for (int core: matrix.cores) ostream << std::setw( 6 ) << core;
+    ostream << "\n";
+
+    // Round trips (ns), by placement of the pair.
+    std::map< CorePlacement, std::vector< double > > by_placement;
+
+    const auto flags_prev = ostream.flags();
+    const auto precision_prev = ostream.precision( 0 );
+    ostream << std::fixed;
+    for (size_t i = 0; i < n; ++i)
+    {
+        ostream << "  " << std::setw( 5 ) << matrix.cores[i];
+        for (size_t j = 0; j < n; ++j)
+        {
+            const double ns = matrix.ns[i][j];
+            if (std::isnan( ns ))
+            {
+                ostream << std::setw( 6 ) << "-";
+                continue;
+            }
+
+            ostream << std::setw( 6 ) << ns;
+            by_placement[ClassifyCorePair( topology, matrix.cores[i], matrix.cores[j] )].push_back( ns );
+        }
+        ostream << "\n";
+    }
+
+    ostream << "\nBy placement (ns):\n";
+    ostream << "  " << std::setw( 14 ) << "placement" << std::setw( 7 ) << "pairs"
+        << std::setw( 8 ) << "min" << std::setw( 8 ) << "mean" << std::setw( 8 ) << "max" << "\n";
+
+    ostream.precision( 1 );
+    for (const auto &placement_ns: by_placement)
+    {
+        const std::vector< double > &ns = placement_ns.second;
+        double sum = 0.0;
+        for (double x: ns) sum += x;
+
+        ostream << "  " << std::setw( 14 ) << ToCStr( placement_ns.first )
+            << std::setw( 7 ) << ns.size()
+            << std::setw( 8 ) << *std::min_element( ns.begin(), ns.end() )
+            << std::setw( 8 ) << sum / ns.size()
+            << std::setw( 8 ) << *std::max_element( ns.begin(), ns.end() ) << "\n";
+    }
+
+    ostream.precision( precision_prev );
+    ostream.flags( flags_prev );
+
+    return ostream;
+}
+
+
+} // namespace bench
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Core-to-core latency, via cache-line ping-pong.
+/*! @file
+
+    A pair of threads alternately increment an atomic counter, so each
+    increment requires the cache line to move to the other thread's core.
+    The atomic_pingpong benchmark measures this between the primary and
+    secondary cores, while MeasureCoreLatencies() measures it between every
+    ordered pair of online cores.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_CORE_MATRIX_HPP
+#define BENCH_CORE_MATRIX_HPP
+
+
+#include <atomic>
+#include <future>
+#include <iosfwd>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "autotime/time.hpp"
+#include "autotime/topology.hpp"
+
+#include "thread_utils.hpp"
+
+
+namespace bench
+{
+
+
+    //! Owns an atomic_int and a thread which increments it when its value is even.
+struct CounterParty
+{
+    std::atomic< int > i_;
+    std::atomic< bool > stop_;
+    std::thread thread_;
+
+        //! Starts the thread, on the specified core.
+    explicit CounterParty( int core_id = GetSecondaryCoreId() );
+
+    ~CounterParty();
+
+    void threadfunc( int core_id, std::promise< void > started_promise );
+};
+
+
+    //! Times num_iters round trips of the counter, to and from the counterparty's core.
+autotime::Durations PingPong( std::shared_ptr< CounterParty > p_counterparty, int num_iters );
+
+
+    //! Round-trip latencies between each ordered pair of a set of cores.
+struct CoreLatencyMatrix
+{
+    std::vector< int > cores;
+
+        //! Round trip (ns) initiated from cores[i] to cores[j] (NaN, if i == j).
+    std::vector< std::vector< double > > ns;
+};
+
+
+    //! Measures the round-trip latency between each ordered pair of online cores.
+    /*!
+        If more than max_cores are online, an evenly-spaced sample of them is
+        used.  The calling thread is moved to the initiating core of each pair
+        and, upon completion, back to the core on which it started.
+    */
+CoreLatencyMatrix MeasureCoreLatencies( int max_cores );
+
+
+    //! Prints the matrix, followed by a summary of it, by topology class.
+std::ostream &PrintCoreLatencies(
+    std::ostream &ostream,
+    const CoreLatencyMatrix &matrix,
+    const std::vector< autotime::CpuTopology > &topology    //!< For classifying each pair.
+);
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_CORE_MATRIX_HPP
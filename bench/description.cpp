@@ -113,8 +113,6 @@ Description Describe( Benchmark benchmark )
     CASE__DESCRIBE( hash_string_4k );
     CASE__DESCRIBE( hash_string_64k );
 
-    CASE__DESCRIBE( cache_false_sharing );
-
 #undef CASE__DESCRIBE
 
     default:
@@ -134,12 +132,38 @@ Description Describe( Category category )
         return Describe< Category::n >()
 
     CASE__DESCRIBE( asio );
+    CASE__DESCRIBE( atomic );
+    CASE__DESCRIBE( bandwidth );
+    CASE__DESCRIBE( cache );
+    CASE__DESCRIBE( copy );
     CASE__DESCRIBE( directory );
+    CASE__DESCRIBE( eytzinger );
     CASE__DESCRIBE( file );
+    CASE__DESCRIBE( flat_hashset );
+    CASE__DESCRIBE( flat_map );
+    CASE__DESCRIBE( flat_set );
+    CASE__DESCRIBE( mutex );
+    CASE__DESCRIBE( network );
     CASE__DESCRIBE( pipe );
     CASE__DESCRIBE( poll );
     CASE__DESCRIBE( process );
+    CASE__DESCRIBE( queue );
+    CASE__DESCRIBE( simd );
+    CASE__DESCRIBE( socket );
+    CASE__DESCRIBE( std_deque );
     CASE__DESCRIBE( std_hash );
+    CASE__DESCRIBE( std_hashmap );
+    CASE__DESCRIBE( std_hashset );
+    CASE__DESCRIBE( std_list );
+    CASE__DESCRIBE( std_map );
+    CASE__DESCRIBE( std_set );
+    CASE__DESCRIBE( std_vector );
+    CASE__DESCRIBE( syscall );
+    CASE__DESCRIBE( thread );
+    CASE__DESCRIBE( timing );
+    CASE__DESCRIBE( uring );
+    CASE__DESCRIBE( vm );
+    CASE__DESCRIBE( wakeup );
 
 #undef CASE__DESCRIBE
 
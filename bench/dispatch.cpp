@@ -52,11 +52,336 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( atomic_cmp_exchg_strong_other );
     CASE__MAKE_TIMERS( atomic_pingpong );
 
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_1t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_2t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_4t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_8t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_16t );
+
+    CASE__MAKE_TIMERS( atomic_fetch_add_padded_1t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_padded_2t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_padded_4t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_padded_8t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_padded_16t );
+
+    CASE__MAKE_TIMERS( atomic_fetch_add_sharded_1t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_sharded_2t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_sharded_4t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_sharded_8t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_sharded_16t );
+
+    CASE__MAKE_TIMERS( atomic_cas_shared_1t );
+    CASE__MAKE_TIMERS( atomic_cas_shared_2t );
+    CASE__MAKE_TIMERS( atomic_cas_shared_4t );
+    CASE__MAKE_TIMERS( atomic_cas_shared_8t );
+    CASE__MAKE_TIMERS( atomic_cas_shared_16t );
+
+    CASE__MAKE_TIMERS( atomic_cas_padded_1t );
+    CASE__MAKE_TIMERS( atomic_cas_padded_2t );
+    CASE__MAKE_TIMERS( atomic_cas_padded_4t );
+    CASE__MAKE_TIMERS( atomic_cas_padded_8t );
+    CASE__MAKE_TIMERS( atomic_cas_padded_16t );
+
+    CASE__MAKE_TIMERS( atomic_exchange_shared_1t );
+    CASE__MAKE_TIMERS( atomic_exchange_shared_2t );
+    CASE__MAKE_TIMERS( atomic_exchange_shared_4t );
+    CASE__MAKE_TIMERS( atomic_exchange_shared_8t );
+    CASE__MAKE_TIMERS( atomic_exchange_shared_16t );
+
+    CASE__MAKE_TIMERS( atomic_exchange_padded_1t );
+    CASE__MAKE_TIMERS( atomic_exchange_padded_2t );
+    CASE__MAKE_TIMERS( atomic_exchange_padded_4t );
+    CASE__MAKE_TIMERS( atomic_exchange_padded_8t );
+    CASE__MAKE_TIMERS( atomic_exchange_padded_16t );
+
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_relaxed_1t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_relaxed_2t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_relaxed_4t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_relaxed_8t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_relaxed_16t );
+
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_acq_rel_1t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_acq_rel_2t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_acq_rel_4t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_acq_rel_8t );
+    CASE__MAKE_TIMERS( atomic_fetch_add_shared_acq_rel_16t );
+
+    CASE__MAKE_TIMERS( atomic_store_relaxed );
+    CASE__MAKE_TIMERS( atomic_store_release );
+    CASE__MAKE_TIMERS( atomic_store_seq_cst );
+
+    CASE__MAKE_TIMERS( atomic_fence_acquire );
+    CASE__MAKE_TIMERS( atomic_fence_release );
+    CASE__MAKE_TIMERS( atomic_fence_acq_rel );
+    CASE__MAKE_TIMERS( atomic_fence_seq_cst );
+
+    CASE__MAKE_TIMERS( stream_copy_1t );
+    CASE__MAKE_TIMERS( stream_copy_2t );
+    CASE__MAKE_TIMERS( stream_copy_4t );
+    CASE__MAKE_TIMERS( stream_copy_8t );
+    CASE__MAKE_TIMERS( stream_copy_16t );
+    CASE__MAKE_TIMERS( stream_copy_32t );
+    CASE__MAKE_TIMERS( stream_copy_64t );
+
+    CASE__MAKE_TIMERS( stream_scale_1t );
+    CASE__MAKE_TIMERS( stream_scale_2t );
+    CASE__MAKE_TIMERS( stream_scale_4t );
+    CASE__MAKE_TIMERS( stream_scale_8t );
+    CASE__MAKE_TIMERS( stream_scale_16t );
+    CASE__MAKE_TIMERS( stream_scale_32t );
+    CASE__MAKE_TIMERS( stream_scale_64t );
+
+    CASE__MAKE_TIMERS( stream_add_1t );
+    CASE__MAKE_TIMERS( stream_add_2t );
+    CASE__MAKE_TIMERS( stream_add_4t );
+    CASE__MAKE_TIMERS( stream_add_8t );
+    CASE__MAKE_TIMERS( stream_add_16t );
+    CASE__MAKE_TIMERS( stream_add_32t );
+    CASE__MAKE_TIMERS( stream_add_64t );
+
+    CASE__MAKE_TIMERS( stream_triad_1t );
+    CASE__MAKE_TIMERS( stream_triad_2t );
+    CASE__MAKE_TIMERS( stream_triad_4t );
+    CASE__MAKE_TIMERS( stream_triad_8t );
+    CASE__MAKE_TIMERS( stream_triad_16t );
+    CASE__MAKE_TIMERS( stream_triad_32t );
+    CASE__MAKE_TIMERS( stream_triad_64t );
+
+    CASE__MAKE_TIMERS( cache_chase_random_4k );
+    CASE__MAKE_TIMERS( cache_chase_random_8k );
+    CASE__MAKE_TIMERS( cache_chase_random_16k );
+    CASE__MAKE_TIMERS( cache_chase_random_32k );
+    CASE__MAKE_TIMERS( cache_chase_random_64k );
+    CASE__MAKE_TIMERS( cache_chase_random_128k );
+    CASE__MAKE_TIMERS( cache_chase_random_256k );
+    CASE__MAKE_TIMERS( cache_chase_random_512k );
+    CASE__MAKE_TIMERS( cache_chase_random_1M );
+    CASE__MAKE_TIMERS( cache_chase_random_2M );
+    CASE__MAKE_TIMERS( cache_chase_random_4M );
+    CASE__MAKE_TIMERS( cache_chase_random_8M );
+    CASE__MAKE_TIMERS( cache_chase_random_16M );
+    CASE__MAKE_TIMERS( cache_chase_random_32M );
+    CASE__MAKE_TIMERS( cache_chase_random_64M );
+    CASE__MAKE_TIMERS( cache_chase_random_128M );
+    CASE__MAKE_TIMERS( cache_chase_random_256M );
+    CASE__MAKE_TIMERS( cache_chase_random_512M );
+    CASE__MAKE_TIMERS( cache_chase_random_1G );
+    CASE__MAKE_TIMERS( cache_chase_seq_64k );
+    CASE__MAKE_TIMERS( cache_chase_seq_1M );
+    CASE__MAKE_TIMERS( cache_chase_seq_16M );
+    CASE__MAKE_TIMERS( cache_chase_seq_256M );
+    CASE__MAKE_TIMERS( cache_chase_stride_64k );
+    CASE__MAKE_TIMERS( cache_chase_stride_1M );
+    CASE__MAKE_TIMERS( cache_chase_stride_16M );
+    CASE__MAKE_TIMERS( cache_chase_stride_256M );
+    CASE__MAKE_TIMERS( cache_page_chase_4M_4k );
+    CASE__MAKE_TIMERS( cache_page_chase_4M_thp );
+    CASE__MAKE_TIMERS( cache_page_chase_4M_2M );
+    CASE__MAKE_TIMERS( cache_page_chase_64M_4k );
+    CASE__MAKE_TIMERS( cache_page_chase_64M_thp );
+    CASE__MAKE_TIMERS( cache_page_chase_64M_2M );
+    CASE__MAKE_TIMERS( cache_page_chase_1G_4k );
+    CASE__MAKE_TIMERS( cache_page_chase_1G_thp );
+    CASE__MAKE_TIMERS( cache_page_chase_1G_2M );
+    CASE__MAKE_TIMERS( cache_page_chase_1G_1G );
+
+    CASE__MAKE_TIMERS( cache_sharing_0b_write_2t );
+    CASE__MAKE_TIMERS( cache_sharing_0b_write_4t );
+    CASE__MAKE_TIMERS( cache_sharing_0b_write_8t );
+
+    CASE__MAKE_TIMERS( cache_sharing_0b_mixed_2t );
+    CASE__MAKE_TIMERS( cache_sharing_0b_mixed_4t );
+    CASE__MAKE_TIMERS( cache_sharing_0b_mixed_8t );
+
+    CASE__MAKE_TIMERS( cache_sharing_0b_readers_2t );
+    CASE__MAKE_TIMERS( cache_sharing_0b_readers_4t );
+    CASE__MAKE_TIMERS( cache_sharing_0b_readers_8t );
+
+    CASE__MAKE_TIMERS( cache_sharing_8b_write_2t );
+    CASE__MAKE_TIMERS( cache_sharing_8b_write_4t );
+    CASE__MAKE_TIMERS( cache_sharing_8b_write_8t );
+
+    CASE__MAKE_TIMERS( cache_sharing_8b_mixed_2t );
+    CASE__MAKE_TIMERS( cache_sharing_8b_mixed_4t );
+    CASE__MAKE_TIMERS( cache_sharing_8b_mixed_8t );
+
+    CASE__MAKE_TIMERS( cache_sharing_8b_readers_2t );
+    CASE__MAKE_TIMERS( cache_sharing_8b_readers_4t );
+    CASE__MAKE_TIMERS( cache_sharing_8b_readers_8t );
+
+    CASE__MAKE_TIMERS( cache_sharing_64b_write_2t );
+    CASE__MAKE_TIMERS( cache_sharing_64b_write_4t );
+    CASE__MAKE_TIMERS( cache_sharing_64b_write_8t );
+
+    CASE__MAKE_TIMERS( cache_sharing_64b_mixed_2t );
+    CASE__MAKE_TIMERS( cache_sharing_64b_mixed_4t );
+    CASE__MAKE_TIMERS( cache_sharing_64b_mixed_8t );
+
+    CASE__MAKE_TIMERS( cache_sharing_64b_readers_2t );
+    CASE__MAKE_TIMERS( cache_sharing_64b_readers_4t );
+    CASE__MAKE_TIMERS( cache_sharing_64b_readers_8t );
+
+    CASE__MAKE_TIMERS( cache_sharing_128b_write_2t );
+    CASE__MAKE_TIMERS( cache_sharing_128b_write_4t );
+    CASE__MAKE_TIMERS( cache_sharing_128b_write_8t );
+
+    CASE__MAKE_TIMERS( cache_sharing_128b_mixed_2t );
+    CASE__MAKE_TIMERS( cache_sharing_128b_mixed_4t );
+    CASE__MAKE_TIMERS( cache_sharing_128b_mixed_8t );
+
+    CASE__MAKE_TIMERS( cache_sharing_128b_readers_2t );
+    CASE__MAKE_TIMERS( cache_sharing_128b_readers_4t );
+    CASE__MAKE_TIMERS( cache_sharing_128b_readers_8t );
+
     CASE__MAKE_TIMERS( condvar_broadcast );
     CASE__MAKE_TIMERS( condvar_create_destroy );
     CASE__MAKE_TIMERS( condvar_signal );
     CASE__MAKE_TIMERS( condvar_signal_watched );
 
+    CASE__MAKE_TIMERS( copy_memcpy_libc_64 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_256 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_1k );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_16k );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_64k );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_256k );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_1M );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4M );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_16M );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_64M );
+
+    CASE__MAKE_TIMERS( copy_memcpy_rep_64 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_256 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_1k );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_16k );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_64k );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_256k );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_1M );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4M );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_16M );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_64M );
+
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_64 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_256 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_1k );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_16k );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_64k );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_256k );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_1M );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4M );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_16M );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_64M );
+
+    CASE__MAKE_TIMERS( copy_memcpy_nt_64 );
+    CASE__MAKE_TIMERS( copy_memcpy_nt_256 );
+    CASE__MAKE_TIMERS( copy_memcpy_nt_1k );
+    CASE__MAKE_TIMERS( copy_memcpy_nt_4k );
+    CASE__MAKE_TIMERS( copy_memcpy_nt_16k );
+    CASE__MAKE_TIMERS( copy_memcpy_nt_64k );
+    CASE__MAKE_TIMERS( copy_memcpy_nt_256k );
+    CASE__MAKE_TIMERS( copy_memcpy_nt_1M );
+    CASE__MAKE_TIMERS( copy_memcpy_nt_4M );
+    CASE__MAKE_TIMERS( copy_memcpy_nt_16M );
+    CASE__MAKE_TIMERS( copy_memcpy_nt_64M );
+
+    CASE__MAKE_TIMERS( copy_memset_libc_64 );
+    CASE__MAKE_TIMERS( copy_memset_libc_256 );
+    CASE__MAKE_TIMERS( copy_memset_libc_1k );
+    CASE__MAKE_TIMERS( copy_memset_libc_4k );
+    CASE__MAKE_TIMERS( copy_memset_libc_16k );
+    CASE__MAKE_TIMERS( copy_memset_libc_64k );
+    CASE__MAKE_TIMERS( copy_memset_libc_256k );
+    CASE__MAKE_TIMERS( copy_memset_libc_1M );
+    CASE__MAKE_TIMERS( copy_memset_libc_4M );
+    CASE__MAKE_TIMERS( copy_memset_libc_16M );
+    CASE__MAKE_TIMERS( copy_memset_libc_64M );
+
+    CASE__MAKE_TIMERS( copy_memset_rep_64 );
+    CASE__MAKE_TIMERS( copy_memset_rep_256 );
+    CASE__MAKE_TIMERS( copy_memset_rep_1k );
+    CASE__MAKE_TIMERS( copy_memset_rep_4k );
+    CASE__MAKE_TIMERS( copy_memset_rep_16k );
+    CASE__MAKE_TIMERS( copy_memset_rep_64k );
+    CASE__MAKE_TIMERS( copy_memset_rep_256k );
+    CASE__MAKE_TIMERS( copy_memset_rep_1M );
+    CASE__MAKE_TIMERS( copy_memset_rep_4M );
+    CASE__MAKE_TIMERS( copy_memset_rep_16M );
+    CASE__MAKE_TIMERS( copy_memset_rep_64M );
+
+    CASE__MAKE_TIMERS( copy_memset_avx2_64 );
+    CASE__MAKE_TIMERS( copy_memset_avx2_256 );
+    CASE__MAKE_TIMERS( copy_memset_avx2_1k );
+    CASE__MAKE_TIMERS( copy_memset_avx2_4k );
+    CASE__MAKE_TIMERS( copy_memset_avx2_16k );
+    CASE__MAKE_TIMERS( copy_memset_avx2_64k );
+    CASE__MAKE_TIMERS( copy_memset_avx2_256k );
+    CASE__MAKE_TIMERS( copy_memset_avx2_1M );
+    CASE__MAKE_TIMERS( copy_memset_avx2_4M );
+    CASE__MAKE_TIMERS( copy_memset_avx2_16M );
+    CASE__MAKE_TIMERS( copy_memset_avx2_64M );
+
+    CASE__MAKE_TIMERS( copy_memset_nt_64 );
+    CASE__MAKE_TIMERS( copy_memset_nt_256 );
+    CASE__MAKE_TIMERS( copy_memset_nt_1k );
+    CASE__MAKE_TIMERS( copy_memset_nt_4k );
+    CASE__MAKE_TIMERS( copy_memset_nt_16k );
+    CASE__MAKE_TIMERS( copy_memset_nt_64k );
+    CASE__MAKE_TIMERS( copy_memset_nt_256k );
+    CASE__MAKE_TIMERS( copy_memset_nt_1M );
+    CASE__MAKE_TIMERS( copy_memset_nt_4M );
+    CASE__MAKE_TIMERS( copy_memset_nt_16M );
+    CASE__MAKE_TIMERS( copy_memset_nt_64M );
+
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_src1 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_src4 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_src8 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_src16 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_src32 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_src63 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_dst1 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_dst4 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_dst8 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_dst16 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_dst32 );
+    CASE__MAKE_TIMERS( copy_memcpy_libc_4k_dst63 );
+
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_src1 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_src4 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_src8 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_src16 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_src32 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_src63 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_dst1 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_dst4 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_dst8 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_dst16 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_dst32 );
+    CASE__MAKE_TIMERS( copy_memcpy_rep_4k_dst63 );
+
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_src1 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_src4 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_src8 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_src16 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_src32 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_src63 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_dst1 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_dst4 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_dst8 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_dst16 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_dst32 );
+    CASE__MAKE_TIMERS( copy_memcpy_avx2_4k_dst63 );
+
+    CASE__MAKE_TIMERS( copy_memmove_up_256 );
+    CASE__MAKE_TIMERS( copy_memmove_up_4k );
+    CASE__MAKE_TIMERS( copy_memmove_up_64k );
+    CASE__MAKE_TIMERS( copy_memmove_up_1M );
+    CASE__MAKE_TIMERS( copy_memmove_down_256 );
+    CASE__MAKE_TIMERS( copy_memmove_down_4k );
+    CASE__MAKE_TIMERS( copy_memmove_down_64k );
+    CASE__MAKE_TIMERS( copy_memmove_down_1M );
+
     CASE__MAKE_TIMERS( chmod );
     CASE__MAKE_TIMERS( chown );
     CASE__MAKE_TIMERS( directory_iter_0 );
@@ -77,6 +402,53 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( exception_noexcept );
     CASE__MAKE_TIMERS( exception_try );
 
+    CASE__MAKE_TIMERS( eytzinger_int32_copy16 );
+    CASE__MAKE_TIMERS( eytzinger_int32_copy256 );
+    CASE__MAKE_TIMERS( eytzinger_int32_copy4k );
+    CASE__MAKE_TIMERS( eytzinger_int32_copy64k );
+    CASE__MAKE_TIMERS( eytzinger_int32_copy1M );
+    CASE__MAKE_TIMERS( eytzinger_int32_destroy16 );
+    CASE__MAKE_TIMERS( eytzinger_int32_destroy256 );
+    CASE__MAKE_TIMERS( eytzinger_int32_destroy4k );
+    CASE__MAKE_TIMERS( eytzinger_int32_destroy64k );
+    CASE__MAKE_TIMERS( eytzinger_int32_destroy1M );
+    CASE__MAKE_TIMERS( eytzinger_int32_find1 );
+    CASE__MAKE_TIMERS( eytzinger_int32_find16 );
+    CASE__MAKE_TIMERS( eytzinger_int32_find256 );
+    CASE__MAKE_TIMERS( eytzinger_int32_find4k );
+    CASE__MAKE_TIMERS( eytzinger_int32_find64k );
+    CASE__MAKE_TIMERS( eytzinger_int32_find1M );
+    CASE__MAKE_TIMERS( eytzinger_int32_insert16 );
+    CASE__MAKE_TIMERS( eytzinger_int32_insert256 );
+    CASE__MAKE_TIMERS( eytzinger_int32_insert4k );
+    CASE__MAKE_TIMERS( eytzinger_int32_insert64k );
+    CASE__MAKE_TIMERS( eytzinger_int32_insert1M );
+    CASE__MAKE_TIMERS( eytzinger_int32_iterate16 );
+    CASE__MAKE_TIMERS( eytzinger_int32_iterate256 );
+    CASE__MAKE_TIMERS( eytzinger_int32_iterate4k );
+    CASE__MAKE_TIMERS( eytzinger_int32_iterate64k );
+    CASE__MAKE_TIMERS( eytzinger_int32_iterate1M );
+    CASE__MAKE_TIMERS( eytzinger_int64_copy64k );
+    CASE__MAKE_TIMERS( eytzinger_int64_destroy64k );
+    CASE__MAKE_TIMERS( eytzinger_int64_find64k );
+    CASE__MAKE_TIMERS( eytzinger_int64_insert4k );
+    CASE__MAKE_TIMERS( eytzinger_int64_iterate64k );
+    CASE__MAKE_TIMERS( eytzinger_float_copy64k );
+    CASE__MAKE_TIMERS( eytzinger_float_destroy64k );
+    CASE__MAKE_TIMERS( eytzinger_float_find64k );
+    CASE__MAKE_TIMERS( eytzinger_float_insert4k );
+    CASE__MAKE_TIMERS( eytzinger_float_iterate64k );
+    CASE__MAKE_TIMERS( eytzinger_double_copy64k );
+    CASE__MAKE_TIMERS( eytzinger_double_destroy64k );
+    CASE__MAKE_TIMERS( eytzinger_double_find64k );
+    CASE__MAKE_TIMERS( eytzinger_double_insert4k );
+    CASE__MAKE_TIMERS( eytzinger_double_iterate64k );
+    CASE__MAKE_TIMERS( eytzinger_string_copy64k );
+    CASE__MAKE_TIMERS( eytzinger_string_destroy64k );
+    CASE__MAKE_TIMERS( eytzinger_string_find64k );
+    CASE__MAKE_TIMERS( eytzinger_string_insert4k );
+    CASE__MAKE_TIMERS( eytzinger_string_iterate64k );
+
     CASE__MAKE_TIMERS( file_append );
     CASE__MAKE_TIMERS( file_close );
     CASE__MAKE_TIMERS( file_create );
@@ -114,6 +486,193 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( file_write_direct_1M );
     CASE__MAKE_TIMERS( file_write_direct_16M );
 
+    CASE__MAKE_TIMERS( linearset_int32_copy16 );
+    CASE__MAKE_TIMERS( linearset_int32_copy256 );
+    CASE__MAKE_TIMERS( linearset_int32_copy4k );
+    CASE__MAKE_TIMERS( linearset_int32_copy64k );
+    CASE__MAKE_TIMERS( linearset_int32_copy1M );
+    CASE__MAKE_TIMERS( linearset_int32_destroy16 );
+    CASE__MAKE_TIMERS( linearset_int32_destroy256 );
+    CASE__MAKE_TIMERS( linearset_int32_destroy4k );
+    CASE__MAKE_TIMERS( linearset_int32_destroy64k );
+    CASE__MAKE_TIMERS( linearset_int32_destroy1M );
+    CASE__MAKE_TIMERS( linearset_int32_find1 );
+    CASE__MAKE_TIMERS( linearset_int32_find16 );
+    CASE__MAKE_TIMERS( linearset_int32_find256 );
+    CASE__MAKE_TIMERS( linearset_int32_find4k );
+    CASE__MAKE_TIMERS( linearset_int32_find64k );
+    CASE__MAKE_TIMERS( linearset_int32_find1M );
+    CASE__MAKE_TIMERS( linearset_int32_insert16 );
+    CASE__MAKE_TIMERS( linearset_int32_insert256 );
+    CASE__MAKE_TIMERS( linearset_int32_insert4k );
+    CASE__MAKE_TIMERS( linearset_int32_insert64k );
+    CASE__MAKE_TIMERS( linearset_int32_insert1M );
+    CASE__MAKE_TIMERS( linearset_int32_iterate16 );
+    CASE__MAKE_TIMERS( linearset_int32_iterate256 );
+    CASE__MAKE_TIMERS( linearset_int32_iterate4k );
+    CASE__MAKE_TIMERS( linearset_int32_iterate64k );
+    CASE__MAKE_TIMERS( linearset_int32_iterate1M );
+    CASE__MAKE_TIMERS( linearset_int64_copy64k );
+    CASE__MAKE_TIMERS( linearset_int64_destroy64k );
+    CASE__MAKE_TIMERS( linearset_int64_find64k );
+    CASE__MAKE_TIMERS( linearset_int64_insert4k );
+    CASE__MAKE_TIMERS( linearset_int64_iterate64k );
+    CASE__MAKE_TIMERS( linearset_float_copy64k );
+    CASE__MAKE_TIMERS( linearset_float_destroy64k );
+    CASE__MAKE_TIMERS( linearset_float_find64k );
+    CASE__MAKE_TIMERS( linearset_float_insert4k );
+    CASE__MAKE_TIMERS( linearset_float_iterate64k );
+    CASE__MAKE_TIMERS( linearset_double_copy64k );
+    CASE__MAKE_TIMERS( linearset_double_destroy64k );
+    CASE__MAKE_TIMERS( linearset_double_find64k );
+    CASE__MAKE_TIMERS( linearset_double_insert4k );
+    CASE__MAKE_TIMERS( linearset_double_iterate64k );
+    CASE__MAKE_TIMERS( linearset_string_copy64k );
+    CASE__MAKE_TIMERS( linearset_string_destroy64k );
+    CASE__MAKE_TIMERS( linearset_string_find64k );
+    CASE__MAKE_TIMERS( linearset_string_insert4k );
+    CASE__MAKE_TIMERS( linearset_string_iterate64k );
+    CASE__MAKE_TIMERS( swissset_int32_copy16 );
+    CASE__MAKE_TIMERS( swissset_int32_copy256 );
+    CASE__MAKE_TIMERS( swissset_int32_copy4k );
+    CASE__MAKE_TIMERS( swissset_int32_copy64k );
+    CASE__MAKE_TIMERS( swissset_int32_copy1M );
+    CASE__MAKE_TIMERS( swissset_int32_destroy16 );
+    CASE__MAKE_TIMERS( swissset_int32_destroy256 );
+    CASE__MAKE_TIMERS( swissset_int32_destroy4k );
+    CASE__MAKE_TIMERS( swissset_int32_destroy64k );
+    CASE__MAKE_TIMERS( swissset_int32_destroy1M );
+    CASE__MAKE_TIMERS( swissset_int32_find1 );
+    CASE__MAKE_TIMERS( swissset_int32_find16 );
+    CASE__MAKE_TIMERS( swissset_int32_find256 );
+    CASE__MAKE_TIMERS( swissset_int32_find4k );
+    CASE__MAKE_TIMERS( swissset_int32_find64k );
+    CASE__MAKE_TIMERS( swissset_int32_find1M );
+    CASE__MAKE_TIMERS( swissset_int32_insert16 );
+    CASE__MAKE_TIMERS( swissset_int32_insert256 );
+    CASE__MAKE_TIMERS( swissset_int32_insert4k );
+    CASE__MAKE_TIMERS( swissset_int32_insert64k );
+    CASE__MAKE_TIMERS( swissset_int32_insert1M );
+    CASE__MAKE_TIMERS( swissset_int32_iterate16 );
+    CASE__MAKE_TIMERS( swissset_int32_iterate256 );
+    CASE__MAKE_TIMERS( swissset_int32_iterate4k );
+    CASE__MAKE_TIMERS( swissset_int32_iterate64k );
+    CASE__MAKE_TIMERS( swissset_int32_iterate1M );
+    CASE__MAKE_TIMERS( swissset_int64_copy64k );
+    CASE__MAKE_TIMERS( swissset_int64_destroy64k );
+    CASE__MAKE_TIMERS( swissset_int64_find64k );
+    CASE__MAKE_TIMERS( swissset_int64_insert4k );
+    CASE__MAKE_TIMERS( swissset_int64_iterate64k );
+    CASE__MAKE_TIMERS( swissset_float_copy64k );
+    CASE__MAKE_TIMERS( swissset_float_destroy64k );
+    CASE__MAKE_TIMERS( swissset_float_find64k );
+    CASE__MAKE_TIMERS( swissset_float_insert4k );
+    CASE__MAKE_TIMERS( swissset_float_iterate64k );
+    CASE__MAKE_TIMERS( swissset_double_copy64k );
+    CASE__MAKE_TIMERS( swissset_double_destroy64k );
+    CASE__MAKE_TIMERS( swissset_double_find64k );
+    CASE__MAKE_TIMERS( swissset_double_insert4k );
+    CASE__MAKE_TIMERS( swissset_double_iterate64k );
+    CASE__MAKE_TIMERS( swissset_string_copy64k );
+    CASE__MAKE_TIMERS( swissset_string_destroy64k );
+    CASE__MAKE_TIMERS( swissset_string_find64k );
+    CASE__MAKE_TIMERS( swissset_string_insert4k );
+    CASE__MAKE_TIMERS( swissset_string_iterate64k );
+
+    CASE__MAKE_TIMERS( flatmap_int32_copy16 );
+    CASE__MAKE_TIMERS( flatmap_int32_copy256 );
+    CASE__MAKE_TIMERS( flatmap_int32_copy4k );
+    CASE__MAKE_TIMERS( flatmap_int32_copy64k );
+    CASE__MAKE_TIMERS( flatmap_int32_copy1M );
+    CASE__MAKE_TIMERS( flatmap_int32_destroy16 );
+    CASE__MAKE_TIMERS( flatmap_int32_destroy256 );
+    CASE__MAKE_TIMERS( flatmap_int32_destroy4k );
+    CASE__MAKE_TIMERS( flatmap_int32_destroy64k );
+    CASE__MAKE_TIMERS( flatmap_int32_destroy1M );
+    CASE__MAKE_TIMERS( flatmap_int32_find1 );
+    CASE__MAKE_TIMERS( flatmap_int32_find16 );
+    CASE__MAKE_TIMERS( flatmap_int32_find256 );
+    CASE__MAKE_TIMERS( flatmap_int32_find4k );
+    CASE__MAKE_TIMERS( flatmap_int32_find64k );
+    CASE__MAKE_TIMERS( flatmap_int32_find1M );
+    CASE__MAKE_TIMERS( flatmap_int32_insert16 );
+    CASE__MAKE_TIMERS( flatmap_int32_insert256 );
+    CASE__MAKE_TIMERS( flatmap_int32_insert4k );
+    CASE__MAKE_TIMERS( flatmap_int32_insert64k );
+    CASE__MAKE_TIMERS( flatmap_int32_insert1M );
+    CASE__MAKE_TIMERS( flatmap_int32_iterate16 );
+    CASE__MAKE_TIMERS( flatmap_int32_iterate256 );
+    CASE__MAKE_TIMERS( flatmap_int32_iterate4k );
+    CASE__MAKE_TIMERS( flatmap_int32_iterate64k );
+    CASE__MAKE_TIMERS( flatmap_int32_iterate1M );
+    CASE__MAKE_TIMERS( flatmap_int64_copy64k );
+    CASE__MAKE_TIMERS( flatmap_int64_destroy64k );
+    CASE__MAKE_TIMERS( flatmap_int64_find64k );
+    CASE__MAKE_TIMERS( flatmap_int64_insert4k );
+    CASE__MAKE_TIMERS( flatmap_int64_iterate64k );
+    CASE__MAKE_TIMERS( flatmap_float_copy64k );
+    CASE__MAKE_TIMERS( flatmap_float_destroy64k );
+    CASE__MAKE_TIMERS( flatmap_float_find64k );
+    CASE__MAKE_TIMERS( flatmap_float_insert4k );
+    CASE__MAKE_TIMERS( flatmap_float_iterate64k );
+    CASE__MAKE_TIMERS( flatmap_double_copy64k );
+    CASE__MAKE_TIMERS( flatmap_double_destroy64k );
+    CASE__MAKE_TIMERS( flatmap_double_find64k );
+    CASE__MAKE_TIMERS( flatmap_double_insert4k );
+    CASE__MAKE_TIMERS( flatmap_double_iterate64k );
+    CASE__MAKE_TIMERS( flatmap_string_copy64k );
+    CASE__MAKE_TIMERS( flatmap_string_destroy64k );
+    CASE__MAKE_TIMERS( flatmap_string_find64k );
+    CASE__MAKE_TIMERS( flatmap_string_insert4k );
+    CASE__MAKE_TIMERS( flatmap_string_iterate64k );
+
+    CASE__MAKE_TIMERS( flatset_int32_copy16 );
+    CASE__MAKE_TIMERS( flatset_int32_copy256 );
+    CASE__MAKE_TIMERS( flatset_int32_copy4k );
+    CASE__MAKE_TIMERS( flatset_int32_copy64k );
+    CASE__MAKE_TIMERS( flatset_int32_copy1M );
+    CASE__MAKE_TIMERS( flatset_int32_destroy16 );
+    CASE__MAKE_TIMERS( flatset_int32_destroy256 );
+    CASE__MAKE_TIMERS( flatset_int32_destroy4k );
+    CASE__MAKE_TIMERS( flatset_int32_destroy64k );
+    CASE__MAKE_TIMERS( flatset_int32_destroy1M );
+    CASE__MAKE_TIMERS( flatset_int32_find1 );
+    CASE__MAKE_TIMERS( flatset_int32_find16 );
+    CASE__MAKE_TIMERS( flatset_int32_find256 );
+    CASE__MAKE_TIMERS( flatset_int32_find4k );
+    CASE__MAKE_TIMERS( flatset_int32_find64k );
+    CASE__MAKE_TIMERS( flatset_int32_find1M );
+    CASE__MAKE_TIMERS( flatset_int32_insert16 );
+    CASE__MAKE_TIMERS( flatset_int32_insert256 );
+    CASE__MAKE_TIMERS( flatset_int32_insert4k );
+    CASE__MAKE_TIMERS( flatset_int32_insert64k );
+    CASE__MAKE_TIMERS( flatset_int32_insert1M );
+    CASE__MAKE_TIMERS( flatset_int32_iterate16 );
+    CASE__MAKE_TIMERS( flatset_int32_iterate256 );
+    CASE__MAKE_TIMERS( flatset_int32_iterate4k );
+    CASE__MAKE_TIMERS( flatset_int32_iterate64k );
+    CASE__MAKE_TIMERS( flatset_int32_iterate1M );
+    CASE__MAKE_TIMERS( flatset_int64_copy64k );
+    CASE__MAKE_TIMERS( flatset_int64_destroy64k );
+    CASE__MAKE_TIMERS( flatset_int64_find64k );
+    CASE__MAKE_TIMERS( flatset_int64_insert4k );
+    CASE__MAKE_TIMERS( flatset_int64_iterate64k );
+    CASE__MAKE_TIMERS( flatset_float_copy64k );
+    CASE__MAKE_TIMERS( flatset_float_destroy64k );
+    CASE__MAKE_TIMERS( flatset_float_find64k );
+    CASE__MAKE_TIMERS( flatset_float_insert4k );
+    CASE__MAKE_TIMERS( flatset_float_iterate64k );
+    CASE__MAKE_TIMERS( flatset_double_copy64k );
+    CASE__MAKE_TIMERS( flatset_double_destroy64k );
+    CASE__MAKE_TIMERS( flatset_double_find64k );
+    CASE__MAKE_TIMERS( flatset_double_insert4k );
+    CASE__MAKE_TIMERS( flatset_double_iterate64k );
+    CASE__MAKE_TIMERS( flatset_string_copy64k );
+    CASE__MAKE_TIMERS( flatset_string_destroy64k );
+    CASE__MAKE_TIMERS( flatset_string_find64k );
+    CASE__MAKE_TIMERS( flatset_string_insert4k );
+    CASE__MAKE_TIMERS( flatset_string_iterate64k );
+
     CASE__MAKE_TIMERS( function_args0 );
     CASE__MAKE_TIMERS( function_args1 );
     CASE__MAKE_TIMERS( function_args2 );
@@ -154,6 +713,10 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( memcpy_1M );
     CASE__MAKE_TIMERS( memcpy_16M );
     CASE__MAKE_TIMERS( memcpy_256M );
+    CASE__MAKE_TIMERS( memcpy_256M_4k );
+    CASE__MAKE_TIMERS( memcpy_256M_thp );
+    CASE__MAKE_TIMERS( memcpy_256M_2M );
+    CASE__MAKE_TIMERS( memcpy_256M_1G );
     CASE__MAKE_TIMERS( strcmp_16 );
     CASE__MAKE_TIMERS( strcmp_256 );
     CASE__MAKE_TIMERS( strcmp_4k );
@@ -186,12 +749,80 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( memread_1M );
     CASE__MAKE_TIMERS( memread_16M );
     CASE__MAKE_TIMERS( memread_256M );
-    CASE__MAKE_TIMERS( cache_false_sharing );
+    CASE__MAKE_TIMERS( memread_256M_4k );
+    CASE__MAKE_TIMERS( memread_256M_thp );
+    CASE__MAKE_TIMERS( memread_256M_2M );
+    CASE__MAKE_TIMERS( memread_256M_1G );
 
     CASE__MAKE_TIMERS( mutex_create_destroy );
     CASE__MAKE_TIMERS( mutex_lock_release );
     CASE__MAKE_TIMERS( mutex_trylock );
 
+    CASE__MAKE_TIMERS( mutex_contended_pthread_2t );
+    CASE__MAKE_TIMERS( mutex_contended_pthread_4t );
+    CASE__MAKE_TIMERS( mutex_contended_pthread_8t );
+    CASE__MAKE_TIMERS( mutex_contended_pthread_16t );
+
+    CASE__MAKE_TIMERS( mutex_contended_pthread_adaptive_2t );
+    CASE__MAKE_TIMERS( mutex_contended_pthread_adaptive_4t );
+    CASE__MAKE_TIMERS( mutex_contended_pthread_adaptive_8t );
+    CASE__MAKE_TIMERS( mutex_contended_pthread_adaptive_16t );
+
+    CASE__MAKE_TIMERS( mutex_contended_std_mutex_2t );
+    CASE__MAKE_TIMERS( mutex_contended_std_mutex_4t );
+    CASE__MAKE_TIMERS( mutex_contended_std_mutex_8t );
+    CASE__MAKE_TIMERS( mutex_contended_std_mutex_16t );
+
+    CASE__MAKE_TIMERS( mutex_contended_rwlock_read_2t );
+    CASE__MAKE_TIMERS( mutex_contended_rwlock_read_4t );
+    CASE__MAKE_TIMERS( mutex_contended_rwlock_read_8t );
+    CASE__MAKE_TIMERS( mutex_contended_rwlock_read_16t );
+
+    CASE__MAKE_TIMERS( mutex_contended_rwlock_write_2t );
+    CASE__MAKE_TIMERS( mutex_contended_rwlock_write_4t );
+    CASE__MAKE_TIMERS( mutex_contended_rwlock_write_8t );
+    CASE__MAKE_TIMERS( mutex_contended_rwlock_write_16t );
+
+    CASE__MAKE_TIMERS( mutex_contended_ttas_2t );
+    CASE__MAKE_TIMERS( mutex_contended_ttas_4t );
+    CASE__MAKE_TIMERS( mutex_contended_ttas_8t );
+    CASE__MAKE_TIMERS( mutex_contended_ttas_16t );
+
+    CASE__MAKE_TIMERS( mutex_contended_ticket_2t );
+    CASE__MAKE_TIMERS( mutex_contended_ticket_4t );
+    CASE__MAKE_TIMERS( mutex_contended_ticket_8t );
+    CASE__MAKE_TIMERS( mutex_contended_ticket_16t );
+
+    CASE__MAKE_TIMERS( mutex_contended_mcs_2t );
+    CASE__MAKE_TIMERS( mutex_contended_mcs_4t );
+    CASE__MAKE_TIMERS( mutex_contended_mcs_8t );
+    CASE__MAKE_TIMERS( mutex_contended_mcs_16t );
+
+    CASE__MAKE_TIMERS( mutex_contended_futex_2t );
+    CASE__MAKE_TIMERS( mutex_contended_futex_4t );
+    CASE__MAKE_TIMERS( mutex_contended_futex_8t );
+    CASE__MAKE_TIMERS( mutex_contended_futex_16t );
+
+    CASE__MAKE_TIMERS( network_accept );
+
+    CASE__MAKE_TIMERS( network_rps_1c );
+    CASE__MAKE_TIMERS( network_rps_2c );
+    CASE__MAKE_TIMERS( network_rps_4c );
+    CASE__MAKE_TIMERS( network_rps_8c );
+    CASE__MAKE_TIMERS( network_rps_16c );
+    CASE__MAKE_TIMERS( network_rps_32c );
+    CASE__MAKE_TIMERS( network_rps_64c );
+
+    CASE__MAKE_TIMERS( network_stream_256 );
+    CASE__MAKE_TIMERS( network_stream_4k );
+    CASE__MAKE_TIMERS( network_stream_64k );
+    CASE__MAKE_TIMERS( network_stream_1M );
+
+    CASE__MAKE_TIMERS( network_gather_1 );
+    CASE__MAKE_TIMERS( network_gather_4 );
+    CASE__MAKE_TIMERS( network_gather_16 );
+    CASE__MAKE_TIMERS( network_gather_64 );
+
     CASE__MAKE_TIMERS( ostream_string4 );
     CASE__MAKE_TIMERS( ostream_string64 );
     CASE__MAKE_TIMERS( ostream_cstr4 );
@@ -252,6 +883,65 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( fork_exec_waitpid );
     CASE__MAKE_TIMERS( system );
 
+    CASE__MAKE_TIMERS( queue_spsc_latency );
+    CASE__MAKE_TIMERS( queue_spsc_roundtrip );
+    CASE__MAKE_TIMERS( queue_spsc_throughput );
+    CASE__MAKE_TIMERS( queue_spsc_batch_throughput );
+
+    CASE__MAKE_TIMERS( queue_spsc_cached_latency );
+    CASE__MAKE_TIMERS( queue_spsc_cached_roundtrip );
+    CASE__MAKE_TIMERS( queue_spsc_cached_throughput );
+    CASE__MAKE_TIMERS( queue_spsc_cached_batch_throughput );
+
+    CASE__MAKE_TIMERS( queue_mpmc_latency );
+    CASE__MAKE_TIMERS( queue_mpmc_roundtrip );
+    CASE__MAKE_TIMERS( queue_mpmc_throughput_1p1c );
+    CASE__MAKE_TIMERS( queue_mpmc_throughput_2p2c );
+    CASE__MAKE_TIMERS( queue_mpmc_throughput_4p4c );
+    CASE__MAKE_TIMERS( queue_mpmc_throughput_1p4c );
+    CASE__MAKE_TIMERS( queue_mpmc_throughput_4p1c );
+    CASE__MAKE_TIMERS( queue_mpmc_batch_throughput_1p1c );
+    CASE__MAKE_TIMERS( queue_mpmc_batch_throughput_2p2c );
+    CASE__MAKE_TIMERS( queue_mpmc_batch_throughput_4p4c );
+
+    CASE__MAKE_TIMERS( queue_mpsc_latency );
+    CASE__MAKE_TIMERS( queue_mpsc_roundtrip );
+    CASE__MAKE_TIMERS( queue_mpsc_throughput_1p );
+    CASE__MAKE_TIMERS( queue_mpsc_throughput_2p );
+    CASE__MAKE_TIMERS( queue_mpsc_throughput_4p );
+    CASE__MAKE_TIMERS( queue_mpsc_throughput_8p );
+    CASE__MAKE_TIMERS( queue_mpsc_batch_throughput_1p );
+    CASE__MAKE_TIMERS( queue_mpsc_batch_throughput_4p );
+
+    CASE__MAKE_TIMERS( simd_sum_scalar );
+    CASE__MAKE_TIMERS( simd_sum_sse42 );
+    CASE__MAKE_TIMERS( simd_sum_avx2 );
+    CASE__MAKE_TIMERS( simd_sum_avx512 );
+
+    CASE__MAKE_TIMERS( simd_dot_scalar );
+    CASE__MAKE_TIMERS( simd_dot_sse42 );
+    CASE__MAKE_TIMERS( simd_dot_avx2 );
+    CASE__MAKE_TIMERS( simd_dot_avx512 );
+
+    CASE__MAKE_TIMERS( simd_find_scalar );
+    CASE__MAKE_TIMERS( simd_find_sse42 );
+    CASE__MAKE_TIMERS( simd_find_avx2 );
+    CASE__MAKE_TIMERS( simd_find_avx512 );
+
+    CASE__MAKE_TIMERS( simd_prefix_sum_scalar );
+    CASE__MAKE_TIMERS( simd_prefix_sum_sse42 );
+    CASE__MAKE_TIMERS( simd_prefix_sum_avx2 );
+    CASE__MAKE_TIMERS( simd_prefix_sum_avx512 );
+
+    CASE__MAKE_TIMERS( simd_mandelbrot_scalar );
+    CASE__MAKE_TIMERS( simd_mandelbrot_sse42 );
+    CASE__MAKE_TIMERS( simd_mandelbrot_avx2 );
+    CASE__MAKE_TIMERS( simd_mandelbrot_avx512 );
+
+    CASE__MAKE_TIMERS( simd_fma_scalar );
+    CASE__MAKE_TIMERS( simd_fma_avx2 );
+    CASE__MAKE_TIMERS( simd_fma_avx512 );
+
     CASE__MAKE_TIMERS( deque_int32_copy16 );
     CASE__MAKE_TIMERS( deque_int32_copy256 );
     CASE__MAKE_TIMERS( deque_int32_copy4k );
@@ -298,6 +988,22 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( deque_string_find64k );
     CASE__MAKE_TIMERS( deque_string_insert4k );
     CASE__MAKE_TIMERS( deque_string_iterate64k );
+    CASE__MAKE_TIMERS( deque_arena_int32_destroy64k );
+    CASE__MAKE_TIMERS( deque_arena_int32_find64k );
+    CASE__MAKE_TIMERS( deque_arena_int32_insert64k );
+    CASE__MAKE_TIMERS( deque_arena_int32_iterate1M );
+    CASE__MAKE_TIMERS( deque_mono_int32_destroy64k );
+    CASE__MAKE_TIMERS( deque_mono_int32_find64k );
+    CASE__MAKE_TIMERS( deque_mono_int32_insert64k );
+    CASE__MAKE_TIMERS( deque_mono_int32_iterate1M );
+    CASE__MAKE_TIMERS( deque_spool_int32_destroy64k );
+    CASE__MAKE_TIMERS( deque_spool_int32_find64k );
+    CASE__MAKE_TIMERS( deque_spool_int32_insert64k );
+    CASE__MAKE_TIMERS( deque_spool_int32_iterate1M );
+    CASE__MAKE_TIMERS( deque_upool_int32_destroy64k );
+    CASE__MAKE_TIMERS( deque_upool_int32_find64k );
+    CASE__MAKE_TIMERS( deque_upool_int32_insert64k );
+    CASE__MAKE_TIMERS( deque_upool_int32_iterate1M );
 
     CASE__MAKE_TIMERS( hash_int8 );
     CASE__MAKE_TIMERS( hash_int16 );
@@ -311,6 +1017,59 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( hash_string_4k );
     CASE__MAKE_TIMERS( hash_string_64k );
 
+    CASE__MAKE_TIMERS( hashmap_int32_p8_copy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p8_destroy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p8_erase64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p8_find64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p8_findmiss64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p8_insert64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p8_insertreserved64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p8_iterate64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p8_rehash64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p16_copy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p16_destroy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p16_find64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p16_insert64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p16_iterate64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p32_copy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p32_destroy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p32_find64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p32_insert64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p32_iterate64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p64_copy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p64_destroy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p64_erase64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p64_find64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p64_findmiss64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p64_insert64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p64_insertreserved64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p64_iterate64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p64_rehash64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p128_copy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p128_destroy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p128_find64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p128_insert64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p128_iterate64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p256_copy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p256_destroy64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p256_erase64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p256_find64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p256_findmiss64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p256_insert64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p256_insertreserved64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p256_iterate64k );
+    CASE__MAKE_TIMERS( hashmap_int32_p256_rehash64k );
+    CASE__MAKE_TIMERS( hashmap_int64_p64_copy64k );
+    CASE__MAKE_TIMERS( hashmap_int64_p64_destroy64k );
+    CASE__MAKE_TIMERS( hashmap_int64_p64_find64k );
+    CASE__MAKE_TIMERS( hashmap_int64_p64_insert4k );
+    CASE__MAKE_TIMERS( hashmap_int64_p64_iterate64k );
+    CASE__MAKE_TIMERS( hashmap_string_p64_copy64k );
+    CASE__MAKE_TIMERS( hashmap_string_p64_destroy64k );
+    CASE__MAKE_TIMERS( hashmap_string_p64_find64k );
+    CASE__MAKE_TIMERS( hashmap_string_p64_insert4k );
+    CASE__MAKE_TIMERS( hashmap_string_p64_iterate64k );
+
     CASE__MAKE_TIMERS( hashset_int32_copy16 );
     CASE__MAKE_TIMERS( hashset_int32_copy256 );
     CASE__MAKE_TIMERS( hashset_int32_copy4k );
@@ -357,6 +1116,22 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( hashset_string_find64k );
     CASE__MAKE_TIMERS( hashset_string_insert4k );
     CASE__MAKE_TIMERS( hashset_string_iterate64k );
+    CASE__MAKE_TIMERS( hashset_arena_int32_destroy64k );
+    CASE__MAKE_TIMERS( hashset_arena_int32_find64k );
+    CASE__MAKE_TIMERS( hashset_arena_int32_insert64k );
+    CASE__MAKE_TIMERS( hashset_arena_int32_iterate1M );
+    CASE__MAKE_TIMERS( hashset_mono_int32_destroy64k );
+    CASE__MAKE_TIMERS( hashset_mono_int32_find64k );
+    CASE__MAKE_TIMERS( hashset_mono_int32_insert64k );
+    CASE__MAKE_TIMERS( hashset_mono_int32_iterate1M );
+    CASE__MAKE_TIMERS( hashset_spool_int32_destroy64k );
+    CASE__MAKE_TIMERS( hashset_spool_int32_find64k );
+    CASE__MAKE_TIMERS( hashset_spool_int32_insert64k );
+    CASE__MAKE_TIMERS( hashset_spool_int32_iterate1M );
+    CASE__MAKE_TIMERS( hashset_upool_int32_destroy64k );
+    CASE__MAKE_TIMERS( hashset_upool_int32_find64k );
+    CASE__MAKE_TIMERS( hashset_upool_int32_insert64k );
+    CASE__MAKE_TIMERS( hashset_upool_int32_iterate1M );
 
     CASE__MAKE_TIMERS( list_int32_copy16 );
     CASE__MAKE_TIMERS( list_int32_copy256 );
@@ -404,6 +1179,69 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( list_string_find64k );
     CASE__MAKE_TIMERS( list_string_insert4k );
     CASE__MAKE_TIMERS( list_string_iterate64k );
+    CASE__MAKE_TIMERS( list_arena_int32_destroy64k );
+    CASE__MAKE_TIMERS( list_arena_int32_find64k );
+    CASE__MAKE_TIMERS( list_arena_int32_insert64k );
+    CASE__MAKE_TIMERS( list_arena_int32_iterate1M );
+    CASE__MAKE_TIMERS( list_mono_int32_destroy64k );
+    CASE__MAKE_TIMERS( list_mono_int32_find64k );
+    CASE__MAKE_TIMERS( list_mono_int32_insert64k );
+    CASE__MAKE_TIMERS( list_mono_int32_iterate1M );
+    CASE__MAKE_TIMERS( list_spool_int32_destroy64k );
+    CASE__MAKE_TIMERS( list_spool_int32_find64k );
+    CASE__MAKE_TIMERS( list_spool_int32_insert64k );
+    CASE__MAKE_TIMERS( list_spool_int32_iterate1M );
+    CASE__MAKE_TIMERS( list_upool_int32_destroy64k );
+    CASE__MAKE_TIMERS( list_upool_int32_find64k );
+    CASE__MAKE_TIMERS( list_upool_int32_insert64k );
+    CASE__MAKE_TIMERS( list_upool_int32_iterate1M );
+
+    CASE__MAKE_TIMERS( map_int32_p8_copy64k );
+    CASE__MAKE_TIMERS( map_int32_p8_destroy64k );
+    CASE__MAKE_TIMERS( map_int32_p8_erase64k );
+    CASE__MAKE_TIMERS( map_int32_p8_find64k );
+    CASE__MAKE_TIMERS( map_int32_p8_findmiss64k );
+    CASE__MAKE_TIMERS( map_int32_p8_insert64k );
+    CASE__MAKE_TIMERS( map_int32_p8_iterate64k );
+    CASE__MAKE_TIMERS( map_int32_p16_copy64k );
+    CASE__MAKE_TIMERS( map_int32_p16_destroy64k );
+    CASE__MAKE_TIMERS( map_int32_p16_find64k );
+    CASE__MAKE_TIMERS( map_int32_p16_insert64k );
+    CASE__MAKE_TIMERS( map_int32_p16_iterate64k );
+    CASE__MAKE_TIMERS( map_int32_p32_copy64k );
+    CASE__MAKE_TIMERS( map_int32_p32_destroy64k );
+    CASE__MAKE_TIMERS( map_int32_p32_find64k );
+    CASE__MAKE_TIMERS( map_int32_p32_insert64k );
+    CASE__MAKE_TIMERS( map_int32_p32_iterate64k );
+    CASE__MAKE_TIMERS( map_int32_p64_copy64k );
+    CASE__MAKE_TIMERS( map_int32_p64_destroy64k );
+    CASE__MAKE_TIMERS( map_int32_p64_erase64k );
+    CASE__MAKE_TIMERS( map_int32_p64_find64k );
+    CASE__MAKE_TIMERS( map_int32_p64_findmiss64k );
+    CASE__MAKE_TIMERS( map_int32_p64_insert64k );
+    CASE__MAKE_TIMERS( map_int32_p64_iterate64k );
+    CASE__MAKE_TIMERS( map_int32_p128_copy64k );
+    CASE__MAKE_TIMERS( map_int32_p128_destroy64k );
+    CASE__MAKE_TIMERS( map_int32_p128_find64k );
+    CASE__MAKE_TIMERS( map_int32_p128_insert64k );
+    CASE__MAKE_TIMERS( map_int32_p128_iterate64k );
+    CASE__MAKE_TIMERS( map_int32_p256_copy64k );
+    CASE__MAKE_TIMERS( map_int32_p256_destroy64k );
+    CASE__MAKE_TIMERS( map_int32_p256_erase64k );
+    CASE__MAKE_TIMERS( map_int32_p256_find64k );
+    CASE__MAKE_TIMERS( map_int32_p256_findmiss64k );
+    CASE__MAKE_TIMERS( map_int32_p256_insert64k );
+    CASE__MAKE_TIMERS( map_int32_p256_iterate64k );
+    CASE__MAKE_TIMERS( map_int64_p64_copy64k );
+    CASE__MAKE_TIMERS( map_int64_p64_destroy64k );
+    CASE__MAKE_TIMERS( map_int64_p64_find64k );
+    CASE__MAKE_TIMERS( map_int64_p64_insert4k );
+    CASE__MAKE_TIMERS( map_int64_p64_iterate64k );
+    CASE__MAKE_TIMERS( map_string_p64_copy64k );
+    CASE__MAKE_TIMERS( map_string_p64_destroy64k );
+    CASE__MAKE_TIMERS( map_string_p64_find64k );
+    CASE__MAKE_TIMERS( map_string_p64_insert4k );
+    CASE__MAKE_TIMERS( map_string_p64_iterate64k );
 
     CASE__MAKE_TIMERS( set_int32_copy16 );
     CASE__MAKE_TIMERS( set_int32_copy256 );
@@ -451,6 +1289,22 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( set_string_find64k );
     CASE__MAKE_TIMERS( set_string_insert4k );
     CASE__MAKE_TIMERS( set_string_iterate64k );
+    CASE__MAKE_TIMERS( set_arena_int32_destroy64k );
+    CASE__MAKE_TIMERS( set_arena_int32_find64k );
+    CASE__MAKE_TIMERS( set_arena_int32_insert64k );
+    CASE__MAKE_TIMERS( set_arena_int32_iterate1M );
+    CASE__MAKE_TIMERS( set_mono_int32_destroy64k );
+    CASE__MAKE_TIMERS( set_mono_int32_find64k );
+    CASE__MAKE_TIMERS( set_mono_int32_insert64k );
+    CASE__MAKE_TIMERS( set_mono_int32_iterate1M );
+    CASE__MAKE_TIMERS( set_spool_int32_destroy64k );
+    CASE__MAKE_TIMERS( set_spool_int32_find64k );
+    CASE__MAKE_TIMERS( set_spool_int32_insert64k );
+    CASE__MAKE_TIMERS( set_spool_int32_iterate1M );
+    CASE__MAKE_TIMERS( set_upool_int32_destroy64k );
+    CASE__MAKE_TIMERS( set_upool_int32_find64k );
+    CASE__MAKE_TIMERS( set_upool_int32_insert64k );
+    CASE__MAKE_TIMERS( set_upool_int32_iterate1M );
 
     CASE__MAKE_TIMERS( vec_int32_copy4k );
     CASE__MAKE_TIMERS( vec_int32_copy64k );
@@ -493,6 +1347,67 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( vec_string_find64k );
     CASE__MAKE_TIMERS( vec_string_insert4k );
     CASE__MAKE_TIMERS( vec_string_iterate64k );
+    CASE__MAKE_TIMERS( vec_arena_int32_destroy64k );
+    CASE__MAKE_TIMERS( vec_arena_int32_find64k );
+    CASE__MAKE_TIMERS( vec_arena_int32_insert64k );
+    CASE__MAKE_TIMERS( vec_arena_int32_iterate1M );
+    CASE__MAKE_TIMERS( vec_mono_int32_destroy64k );
+    CASE__MAKE_TIMERS( vec_mono_int32_find64k );
+    CASE__MAKE_TIMERS( vec_mono_int32_insert64k );
+    CASE__MAKE_TIMERS( vec_mono_int32_iterate1M );
+    CASE__MAKE_TIMERS( vec_spool_int32_destroy64k );
+    CASE__MAKE_TIMERS( vec_spool_int32_find64k );
+    CASE__MAKE_TIMERS( vec_spool_int32_insert64k );
+    CASE__MAKE_TIMERS( vec_spool_int32_iterate1M );
+    CASE__MAKE_TIMERS( vec_upool_int32_destroy64k );
+    CASE__MAKE_TIMERS( vec_upool_int32_find64k );
+    CASE__MAKE_TIMERS( vec_upool_int32_insert64k );
+    CASE__MAKE_TIMERS( vec_upool_int32_iterate1M );
+
+    CASE__MAKE_TIMERS( socket_open_close_tcp );
+    CASE__MAKE_TIMERS( socket_open_close_udp );
+    CASE__MAKE_TIMERS( socket_open_close_unix );
+
+    CASE__MAKE_TIMERS( socket_connect_accept_tcp );
+    CASE__MAKE_TIMERS( socket_connect_accept_unix );
+
+    CASE__MAKE_TIMERS( socket_send_recv_tcp_64 );
+    CASE__MAKE_TIMERS( socket_send_recv_tcp_256 );
+    CASE__MAKE_TIMERS( socket_send_recv_tcp_1k );
+    CASE__MAKE_TIMERS( socket_send_recv_tcp_4k );
+    CASE__MAKE_TIMERS( socket_send_recv_tcp_16k );
+    CASE__MAKE_TIMERS( socket_send_recv_tcp_64k );
+
+    CASE__MAKE_TIMERS( socket_send_recv_unix_64 );
+    CASE__MAKE_TIMERS( socket_send_recv_unix_256 );
+    CASE__MAKE_TIMERS( socket_send_recv_unix_1k );
+    CASE__MAKE_TIMERS( socket_send_recv_unix_4k );
+    CASE__MAKE_TIMERS( socket_send_recv_unix_16k );
+    CASE__MAKE_TIMERS( socket_send_recv_unix_64k );
+
+    CASE__MAKE_TIMERS( socket_send_recv_udp_64 );
+    CASE__MAKE_TIMERS( socket_send_recv_udp_1k );
+    CASE__MAKE_TIMERS( socket_send_recv_udp_16k );
+    CASE__MAKE_TIMERS( socket_send_recv_unix_dgram_64 );
+    CASE__MAKE_TIMERS( socket_send_recv_unix_dgram_1k );
+    CASE__MAKE_TIMERS( socket_send_recv_unix_dgram_16k );
+
+    CASE__MAKE_TIMERS( socket_pingpong_tcp_256 );
+    CASE__MAKE_TIMERS( socket_pingpong_tcp_1k );
+    CASE__MAKE_TIMERS( socket_pingpong_tcp_4k );
+    CASE__MAKE_TIMERS( socket_pingpong_tcp_16k );
+    CASE__MAKE_TIMERS( socket_pingpong_tcp_64k );
+    CASE__MAKE_TIMERS( socket_pingpong_tcp_256_busy_poll );
+
+    CASE__MAKE_TIMERS( socket_pingpong_unix_256 );
+    CASE__MAKE_TIMERS( socket_pingpong_unix_1k );
+    CASE__MAKE_TIMERS( socket_pingpong_unix_4k );
+    CASE__MAKE_TIMERS( socket_pingpong_unix_16k );
+    CASE__MAKE_TIMERS( socket_pingpong_unix_64k );
+
+    CASE__MAKE_TIMERS( socket_mmsg_udp_1 );
+    CASE__MAKE_TIMERS( socket_mmsg_udp_8 );
+    CASE__MAKE_TIMERS( socket_mmsg_udp_32 );
 
     CASE__MAKE_TIMERS( string_from_smallint );
     CASE__MAKE_TIMERS( string_from_maxint );
@@ -514,9 +1429,248 @@ autotime::BenchTimers MakeTimers( Benchmark benchmark )
     CASE__MAKE_TIMERS( string_to_bigdouble_os );
     CASE__MAKE_TIMERS( string_to_bigdouble_ts );
 
+    CASE__MAKE_TIMERS( syscall_getpid );
+    CASE__MAKE_TIMERS( syscall_getpid_seccomp );
+    CASE__MAKE_TIMERS( syscall_getpid_seccomp_args );
+    CASE__MAKE_TIMERS( syscall_gettid );
+
+    CASE__MAKE_TIMERS( syscall_clock_gettime_realtime_vdso );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_realtime_syscall );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_realtime_coarse_vdso );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_realtime_coarse_syscall );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_monotonic_vdso );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_monotonic_syscall );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_monotonic_coarse_vdso );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_monotonic_coarse_syscall );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_monotonic_raw_vdso );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_monotonic_raw_syscall );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_boottime_vdso );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_boottime_syscall );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_process_cputime_vdso );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_process_cputime_syscall );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_thread_cputime_vdso );
+    CASE__MAKE_TIMERS( syscall_clock_gettime_thread_cputime_syscall );
+
+    CASE__MAKE_TIMERS( syscall_getcpu_vdso );
+    CASE__MAKE_TIMERS( syscall_getcpu_syscall );
+    CASE__MAKE_TIMERS( syscall_getrusage );
+    CASE__MAKE_TIMERS( syscall_sched_yield );
+    CASE__MAKE_TIMERS( syscall_ioctl_badfd );
+
     CASE__MAKE_TIMERS( thread_create_destroy );
     CASE__MAKE_TIMERS( thread_pingpong );
 
+    CASE__MAKE_TIMERS( thread_task_spawn_steal );
+    CASE__MAKE_TIMERS( thread_task_spawn_shared );
+    CASE__MAKE_TIMERS( thread_task_spawn_async );
+
+    CASE__MAKE_TIMERS( thread_task_tree_steal_4w );
+    CASE__MAKE_TIMERS( thread_task_tree_shared_4w );
+    CASE__MAKE_TIMERS( thread_task_tree_async );
+
+    CASE__MAKE_TIMERS( thread_task_handoff_steal );
+    CASE__MAKE_TIMERS( thread_task_handoff_shared );
+
+    CASE__MAKE_TIMERS( thread_task_tiny_steal_1w );
+    CASE__MAKE_TIMERS( thread_task_tiny_steal_2w );
+    CASE__MAKE_TIMERS( thread_task_tiny_steal_4w );
+    CASE__MAKE_TIMERS( thread_task_tiny_steal_8w );
+
+    CASE__MAKE_TIMERS( thread_task_tiny_shared_1w );
+    CASE__MAKE_TIMERS( thread_task_tiny_shared_2w );
+    CASE__MAKE_TIMERS( thread_task_tiny_shared_4w );
+    CASE__MAKE_TIMERS( thread_task_tiny_shared_8w );
+
+    CASE__MAKE_TIMERS( thread_task_tiny_async );
+
+    CASE__MAKE_TIMERS( thread_task_medium_steal_1w );
+    CASE__MAKE_TIMERS( thread_task_medium_steal_2w );
+    CASE__MAKE_TIMERS( thread_task_medium_steal_4w );
+    CASE__MAKE_TIMERS( thread_task_medium_steal_8w );
+
+    CASE__MAKE_TIMERS( thread_task_medium_shared_1w );
+    CASE__MAKE_TIMERS( thread_task_medium_shared_2w );
+    CASE__MAKE_TIMERS( thread_task_medium_shared_4w );
+    CASE__MAKE_TIMERS( thread_task_medium_shared_8w );
+
+    CASE__MAKE_TIMERS( thread_task_medium_async );
+
+    CASE__MAKE_TIMERS( timing_nanosleep_1us );
+    CASE__MAKE_TIMERS( timing_nanosleep_10us );
+    CASE__MAKE_TIMERS( timing_nanosleep_100us );
+    CASE__MAKE_TIMERS( timing_nanosleep_1ms );
+    CASE__MAKE_TIMERS( timing_nanosleep_10ms );
+
+    CASE__MAKE_TIMERS( timing_nanosleep_1us_fifo );
+    CASE__MAKE_TIMERS( timing_nanosleep_10us_fifo );
+    CASE__MAKE_TIMERS( timing_nanosleep_100us_fifo );
+    CASE__MAKE_TIMERS( timing_nanosleep_1ms_fifo );
+    CASE__MAKE_TIMERS( timing_nanosleep_10ms_fifo );
+
+    CASE__MAKE_TIMERS( timing_abstime_1us );
+    CASE__MAKE_TIMERS( timing_abstime_10us );
+    CASE__MAKE_TIMERS( timing_abstime_100us );
+    CASE__MAKE_TIMERS( timing_abstime_1ms );
+    CASE__MAKE_TIMERS( timing_abstime_10ms );
+
+    CASE__MAKE_TIMERS( timing_abstime_1us_fifo );
+    CASE__MAKE_TIMERS( timing_abstime_10us_fifo );
+    CASE__MAKE_TIMERS( timing_abstime_100us_fifo );
+    CASE__MAKE_TIMERS( timing_abstime_1ms_fifo );
+    CASE__MAKE_TIMERS( timing_abstime_10ms_fifo );
+
+    CASE__MAKE_TIMERS( timing_timerfd_1us );
+    CASE__MAKE_TIMERS( timing_timerfd_10us );
+    CASE__MAKE_TIMERS( timing_timerfd_100us );
+    CASE__MAKE_TIMERS( timing_timerfd_1ms );
+    CASE__MAKE_TIMERS( timing_timerfd_10ms );
+
+    CASE__MAKE_TIMERS( timing_timerfd_1us_fifo );
+    CASE__MAKE_TIMERS( timing_timerfd_10us_fifo );
+    CASE__MAKE_TIMERS( timing_timerfd_100us_fifo );
+    CASE__MAKE_TIMERS( timing_timerfd_1ms_fifo );
+    CASE__MAKE_TIMERS( timing_timerfd_10ms_fifo );
+
+    CASE__MAKE_TIMERS( timing_epoll_1us );
+    CASE__MAKE_TIMERS( timing_epoll_10us );
+    CASE__MAKE_TIMERS( timing_epoll_100us );
+    CASE__MAKE_TIMERS( timing_epoll_1ms );
+    CASE__MAKE_TIMERS( timing_epoll_10ms );
+
+    CASE__MAKE_TIMERS( timing_epoll_1us_fifo );
+    CASE__MAKE_TIMERS( timing_epoll_10us_fifo );
+    CASE__MAKE_TIMERS( timing_epoll_100us_fifo );
+    CASE__MAKE_TIMERS( timing_epoll_1ms_fifo );
+    CASE__MAKE_TIMERS( timing_epoll_10ms_fifo );
+
+    CASE__MAKE_TIMERS( timing_asio_1us );
+    CASE__MAKE_TIMERS( timing_asio_10us );
+    CASE__MAKE_TIMERS( timing_asio_100us );
+    CASE__MAKE_TIMERS( timing_asio_1ms );
+    CASE__MAKE_TIMERS( timing_asio_10ms );
+
+    CASE__MAKE_TIMERS( timing_asio_1us_fifo );
+    CASE__MAKE_TIMERS( timing_asio_10us_fifo );
+    CASE__MAKE_TIMERS( timing_asio_100us_fifo );
+    CASE__MAKE_TIMERS( timing_asio_1ms_fifo );
+    CASE__MAKE_TIMERS( timing_asio_10ms_fifo );
+
+    CASE__MAKE_TIMERS( uring_buffered_randread_qd1 );
+    CASE__MAKE_TIMERS( uring_buffered_randread_qd4 );
+    CASE__MAKE_TIMERS( uring_buffered_randread_qd16 );
+    CASE__MAKE_TIMERS( uring_buffered_randread_qd64 );
+    CASE__MAKE_TIMERS( uring_buffered_randread_qd256 );
+
+    CASE__MAKE_TIMERS( uring_buffered_seqread_qd1 );
+    CASE__MAKE_TIMERS( uring_buffered_seqread_qd4 );
+    CASE__MAKE_TIMERS( uring_buffered_seqread_qd16 );
+    CASE__MAKE_TIMERS( uring_buffered_seqread_qd64 );
+    CASE__MAKE_TIMERS( uring_buffered_seqread_qd256 );
+
+    CASE__MAKE_TIMERS( uring_buffered_randwrite_qd1 );
+    CASE__MAKE_TIMERS( uring_buffered_randwrite_qd4 );
+    CASE__MAKE_TIMERS( uring_buffered_randwrite_qd16 );
+    CASE__MAKE_TIMERS( uring_buffered_randwrite_qd64 );
+    CASE__MAKE_TIMERS( uring_buffered_randwrite_qd256 );
+
+    CASE__MAKE_TIMERS( uring_buffered_seqwrite_qd1 );
+    CASE__MAKE_TIMERS( uring_buffered_seqwrite_qd4 );
+    CASE__MAKE_TIMERS( uring_buffered_seqwrite_qd16 );
+    CASE__MAKE_TIMERS( uring_buffered_seqwrite_qd64 );
+    CASE__MAKE_TIMERS( uring_buffered_seqwrite_qd256 );
+
+    CASE__MAKE_TIMERS( uring_buffered_randread_fixed_qd16 );
+    CASE__MAKE_TIMERS( uring_buffered_randwrite_fixed_qd16 );
+    CASE__MAKE_TIMERS( uring_buffered_randread_sqpoll_qd16 );
+    CASE__MAKE_TIMERS( uring_buffered_randwrite_sqpoll_qd16 );
+
+    CASE__MAKE_TIMERS( uring_buffered_seqwrite_fsync_qd1 );
+    CASE__MAKE_TIMERS( uring_buffered_seqwrite_fsync_qd16 );
+
+    CASE__MAKE_TIMERS( uring_direct_randread_qd1 );
+    CASE__MAKE_TIMERS( uring_direct_randread_qd4 );
+    CASE__MAKE_TIMERS( uring_direct_randread_qd16 );
+    CASE__MAKE_TIMERS( uring_direct_randread_qd64 );
+    CASE__MAKE_TIMERS( uring_direct_randread_qd256 );
+
+    CASE__MAKE_TIMERS( uring_direct_seqread_qd1 );
+    CASE__MAKE_TIMERS( uring_direct_seqread_qd4 );
+    CASE__MAKE_TIMERS( uring_direct_seqread_qd16 );
+    CASE__MAKE_TIMERS( uring_direct_seqread_qd64 );
+    CASE__MAKE_TIMERS( uring_direct_seqread_qd256 );
+
+    CASE__MAKE_TIMERS( uring_direct_randwrite_qd1 );
+    CASE__MAKE_TIMERS( uring_direct_randwrite_qd4 );
+    CASE__MAKE_TIMERS( uring_direct_randwrite_qd16 );
+    CASE__MAKE_TIMERS( uring_direct_randwrite_qd64 );
+    CASE__MAKE_TIMERS( uring_direct_randwrite_qd256 );
+
+    CASE__MAKE_TIMERS( uring_direct_seqwrite_qd1 );
+    CASE__MAKE_TIMERS( uring_direct_seqwrite_qd4 );
+    CASE__MAKE_TIMERS( uring_direct_seqwrite_qd16 );
+    CASE__MAKE_TIMERS( uring_direct_seqwrite_qd64 );
+    CASE__MAKE_TIMERS( uring_direct_seqwrite_qd256 );
+
+    CASE__MAKE_TIMERS( uring_direct_randread_fixed_qd16 );
+    CASE__MAKE_TIMERS( uring_direct_randwrite_fixed_qd16 );
+    CASE__MAKE_TIMERS( uring_direct_randread_sqpoll_qd16 );
+    CASE__MAKE_TIMERS( uring_direct_randwrite_sqpoll_qd16 );
+
+    CASE__MAKE_TIMERS( uring_direct_seqwrite_fsync_qd1 );
+    CASE__MAKE_TIMERS( uring_direct_seqwrite_fsync_qd16 );
+
+    CASE__MAKE_TIMERS( vm_fault_anon_4k );
+    CASE__MAKE_TIMERS( vm_fault_anon_thp );
+    CASE__MAKE_TIMERS( vm_fault_file_4k );
+
+    CASE__MAKE_TIMERS( vm_mmap_populate_1M );
+    CASE__MAKE_TIMERS( vm_mmap_populate_16M );
+    CASE__MAKE_TIMERS( vm_mmap_touch_1M );
+    CASE__MAKE_TIMERS( vm_mmap_touch_16M );
+
+    CASE__MAKE_TIMERS( vm_munmap_1t );
+    CASE__MAKE_TIMERS( vm_munmap_2t );
+    CASE__MAKE_TIMERS( vm_munmap_4t );
+    CASE__MAKE_TIMERS( vm_munmap_8t );
+    CASE__MAKE_TIMERS( vm_munmap_16t );
+
+    CASE__MAKE_TIMERS( vm_madvise_dontneed_1M );
+    CASE__MAKE_TIMERS( vm_madvise_free_1M );
+    CASE__MAKE_TIMERS( vm_mprotect_4k );
+    CASE__MAKE_TIMERS( vm_mprotect_1M );
+
+    CASE__MAKE_TIMERS( vm_mremap_grow_1M );
+    CASE__MAKE_TIMERS( vm_mremap_grow_64M );
+    CASE__MAKE_TIMERS( vm_realloc_grow_1M );
+    CASE__MAKE_TIMERS( vm_realloc_grow_64M );
+    CASE__MAKE_TIMERS( vm_copy_grow_1M );
+    CASE__MAKE_TIMERS( vm_copy_grow_64M );
+
+    CASE__MAKE_TIMERS( wakeup_futex_wake_no_waiters );
+    CASE__MAKE_TIMERS( wakeup_futex_wait_mismatch );
+
+    CASE__MAKE_TIMERS( wakeup_futex_pingpong );
+    CASE__MAKE_TIMERS( wakeup_eventfd_pingpong );
+
+    CASE__MAKE_TIMERS( wakeup_futex_latency );
+    CASE__MAKE_TIMERS( wakeup_eventfd_latency );
+
+    CASE__MAKE_TIMERS( wakeup_park_spin0 );
+    CASE__MAKE_TIMERS( wakeup_park_spin100 );
+    CASE__MAKE_TIMERS( wakeup_park_spin1k );
+    CASE__MAKE_TIMERS( wakeup_park_spin10k );
+
+    CASE__MAKE_TIMERS( wakeup_park_spin0_reply10us );
+    CASE__MAKE_TIMERS( wakeup_park_spin100_reply10us );
+    CASE__MAKE_TIMERS( wakeup_park_spin1k_reply10us );
+    CASE__MAKE_TIMERS( wakeup_park_spin10k_reply10us );
+
+    CASE__MAKE_TIMERS( wakeup_futex_herd_1 );
+    CASE__MAKE_TIMERS( wakeup_futex_herd_2 );
+    CASE__MAKE_TIMERS( wakeup_futex_herd_4 );
+    CASE__MAKE_TIMERS( wakeup_futex_herd_8 );
+    CASE__MAKE_TIMERS( wakeup_futex_herd_16 );
+
     CASE__MAKE_TIMERS( fibonacci_u64 );
     CASE__MAKE_TIMERS( mandelbrot_256 );
     CASE__MAKE_TIMERS( trigonometry );
@@ -15,6 +15,7 @@
 #define BENCH_ERROR_UTILS_HPP
 
 
+#include <stdexcept>
 #include <system_error>
 
 
@@ -35,6 +36,18 @@ void throw_system_error(
 }
 
 
+    //! Thrown by MakeTimers(), when a benchmark can't run on this system.
+    /*!
+        For instance, if it needs a kernel feature that's disabled or not
+        configured.  The benchmark is reported as skipped, rather than failing.
+    */
+class unavailable_error: public std::runtime_error
+{
+public:
+    using std::runtime_error::runtime_error;
+};
+
+
 } // namespace bench
 
 
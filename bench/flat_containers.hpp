@@ -0,0 +1,461 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Cache-friendly alternatives to the node-based standard containers.
+/*! @file
+
+    These are minimal implementations, providing only what's needed to
+    benchmark them against std::set<> and std::unordered_set<> (i.e. insert,
+    find, iteration, copy, and destruction).  Notably, none supports erase.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_FLAT_CONTAINERS_HPP
+#define BENCH_FLAT_CONTAINERS_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+
+namespace bench
+{
+
+
+    //! Set stored as a sorted vector, and searched via std::lower_bound().
+template<
+    typename T
+>
+class FlatSet
+{
+public:
+    using value_type = T;
+    using const_iterator = typename std::vector< T >::const_iterator;
+    using iterator = const_iterator;
+
+    const_iterator begin() const { return elements_.begin(); }
+    const_iterator end() const { return elements_.end(); }
+    bool empty() const { return elements_.empty(); }
+    size_t size() const { return elements_.size(); }
+    void clear() { elements_.clear(); }
+    void swap( FlatSet &other ) { elements_.swap( other.elements_ ); }
+
+        //! Inserts value in sorted order, which is O(n).
+    bool insert( const T &value )
+    {
+        const auto iter = std::lower_bound( elements_.begin(), elements_.end(), value );
+        if (iter != elements_.end() && !(value < *iter)) return false;
+
+        elements_.insert( iter, value );
+        return true;
+    }
+
+    const_iterator find( const T &value ) const
+    {
+        const auto iter = std::lower_bound( elements_.begin(), elements_.end(), value );
+        return (iter != elements_.end() && !(value < *iter)) ? iter : elements_.end();
+    }
+
+private:
+    std::vector< T > elements_;
+};
+
+
+    //! Map stored as a vector of key/value pairs, sorted by key.
+template<
+    typename key_t,
+    typename mapped_t
+>
+class FlatMap
+{
+public:
+    using key_type = key_t;
+    using mapped_type = mapped_t;
+    using value_type = std::pair< key_t, mapped_t >;
+    using const_iterator = typename std::vector< value_type >::const_iterator;
+    using iterator = const_iterator;
+
+    const_iterator begin() const { return elements_.begin(); }
+    const_iterator end() const { return elements_.end(); }
+    bool empty() const { return elements_.empty(); }
+    size_t size() const { return elements_.size(); }
+    void clear() { elements_.clear(); }
+    void swap( FlatMap &other ) { elements_.swap( other.elements_ ); }
+
+        //! Inserts value in sorted order, which is O(n).
+    bool insert( const value_type &value )
+    {
+        const auto iter = this->lower_bound( value.first );
+        if (iter != elements_.end() && !(value.first < iter->first)) return false;
+
+        elements_.insert( iter, value );
+        return true;
+    }
+
+    const_iterator find( const key_t &key ) const
+    {
+        const auto iter = this->lower_bound( key );
+        return (iter != elements_.end() && !(key < iter->first)) ? iter : elements_.end();
+    }
+
+private:
+    const_iterator lower_bound( const key_t &key ) const
+    {
+        return std::lower_bound(
+            elements_.begin(), elements_.end(), key,
+            []( const value_type &elem, const key_t &k ){ return elem.first < k; } );
+    }
+
+    std::vector< value_type > elements_;
+};
+
+
+    //! Sorted array in Eytzinger (i.e. breadth-first binary tree) order.
+    /*!
+        Searching visits the same elements as a binary search, but the first
+        few levels of the tree share cache lines and the rest are prefetched
+        well by hardware.
+
+        Since the layout can't be updated incrementally, insert() merely appends
+        and build() must be called before find().
+    */
+template<
+    typename T
+>
+class EytzingerSet
+{
+public:
+    using value_type = T;
+    using const_iterator = typename std::vector< T >::const_iterator;
+    using iterator = const_iterator;
+
+        // Element 0 is unused, so the children of element k are 2k and 2k + 1.
+    EytzingerSet() : elements_( 1 ) {}
+
+    const_iterator begin() const { return elements_.begin() + 1; }
+    const_iterator end() const { return elements_.end(); }
+    bool empty() const { return elements_.size() == 1; }
+    size_t size() const { return elements_.size() - 1; }
+    void clear() { elements_.resize( 1 ); }
+    void swap( EytzingerSet &other ) { elements_.swap( other.elements_ ); }
+
+    void insert( const T &value ) { elements_.push_back( value ); }
+
+        //! Sorts & deduplicates all elements, then lays them out in Eytzinger order.
+    void build()
+    {
+        std::vector< T > sorted( std::make_move_iterator( elements_.begin() + 1 ),
+            std::make_move_iterator( elements_.end() ) );
+        std::sort( sorted.begin(), sorted.end() );
+        sorted.erase( std::unique( sorted.begin(), sorted.end() ), sorted.end() );
+
+        elements_.resize( sorted.size() + 1 );
+        size_t i = 0;
+        Fill( sorted, i, 1 );
+    }
+
+    const_iterator find( const T &value ) const
+    {
+        const size_t n = elements_.size();
+        size_t k = 1;
+        while (k < n) k = 2 * k + (elements_[k] < value);
+
+        // Undo the right-turns since the last left-turn, which was at the lower bound.
+        k >>= __builtin_ffsll( static_cast< long long >( ~k ) );
+        return (k != 0 && !(value < elements_[k])) ? elements_.begin() + k : elements_.end();
+    }
+
+private:
+    void Fill( std::vector< T > &sorted, size_t &i, size_t k )
+    {
+        if (k >= elements_.size()) return;
+
+        Fill( sorted, i, 2 * k );
+        elements_[k] = std::move( sorted[i++] );
+        Fill( sorted, i, 2 * k + 1 );
+    }
+
+    std::vector< T > elements_;
+};
+
+
+    //! Finalizes a std::hash<> value, since it's the identity function for integers.
+inline size_t MixHash( size_t h )
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+
+    //! Iterates over the occupied slots of an open-addressing hash set.
+template<
+    typename set_t
+>
+class OpenHashIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename set_t::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    OpenHashIterator( const set_t *set, size_t i )
+    :
+        set_( set ), i_( i )
+    {
+        while (i_ < set_->capacity() && !set_->is_full( i_ )) ++i_;
+    }
+
+    reference operator*() const { return set_->slot( i_ ); }
+    pointer operator->() const { return &set_->slot( i_ ); }
+
+    OpenHashIterator &operator++()
+    {
+        do ++i_; while (i_ < set_->capacity() && !set_->is_full( i_ ));
+        return *this;
+    }
+
+    bool operator==( const OpenHashIterator &other ) const { return i_ == other.i_; }
+    bool operator!=( const OpenHashIterator &other ) const { return i_ != other.i_; }
+
+private:
+    const set_t *set_;
+    size_t i_;
+};
+
+
+    //! Open-addressing hash set, using linear probing and a max load factor of 1/2.
+template<
+    typename T,
+    typename hash_t = std::hash< T >
+>
+class LinearHashSet
+{
+public:
+    using value_type = T;
+    using const_iterator = OpenHashIterator< LinearHashSet >;
+    using iterator = const_iterator;
+
+    const_iterator begin() const { return const_iterator( this, 0 ); }
+    const_iterator end() const { return const_iterator( this, this->capacity() ); }
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+    size_t capacity() const { return full_.size(); }
+    bool is_full( size_t i ) const { return full_[i] != 0; }
+    const T &slot( size_t i ) const { return slots_[i]; }
+
+    void clear()
+    {
+        std::fill( full_.begin(), full_.end(), 0 );
+        size_ = 0;
+    }
+
+    void swap( LinearHashSet &other )
+    {
+        full_.swap( other.full_ );
+        slots_.swap( other.slots_ );
+        std::swap( size_, other.size_ );
+    }
+
+    bool insert( const T &value )
+    {
+        if (2 * (size_ + 1) > this->capacity()) this->grow();
+
+        const size_t mask = this->capacity() - 1;
+        size_t i = MixHash( hash_t()( value ) ) & mask;
+        for (; full_[i]; i = (i + 1) & mask) if (slots_[i] == value) return false;
+
+        full_[i] = 1;
+        slots_[i] = value;
+        ++size_;
+        return true;
+    }
+
+    const_iterator find( const T &value ) const
+    {
+        if (size_ == 0) return this->end();
+
+        const size_t mask = this->capacity() - 1;
+        size_t i = MixHash( hash_t()( value ) ) & mask;
+        for (; full_[i]; i = (i + 1) & mask)
+        {
+            if (slots_[i] == value) return const_iterator( this, i );
+        }
+
+        return this->end();
+    }
+
+private:
+    void grow()
+    {
+        LinearHashSet bigger;
+        const size_t new_capacity = std::max< size_t >( 2 * this->capacity(), 16 );
+        bigger.full_.resize( new_capacity );
+        bigger.slots_.resize( new_capacity );
+        for (size_t i = 0; i < this->capacity(); ++i) if (full_[i]) bigger.insert( slots_[i] );
+
+        this->swap( bigger );
+    }
+
+    std::vector< uint8_t > full_;
+    std::vector< T > slots_;
+    size_t size_ = 0;
+};
+
+
+    //! Returns a bitmask of which of the 16 bytes at p equal b.
+inline unsigned MatchGroup( const uint8_t *p, uint8_t b )
+{
+#if defined( __SSE2__ )
+    const __m128i group = _mm_loadu_si128( reinterpret_cast< const __m128i * >( p ) );
+    const __m128i match = _mm_cmpeq_epi8( group, _mm_set1_epi8( static_cast< char >( b ) ) );
+    return static_cast< unsigned >( _mm_movemask_epi8( match ) );
+#else
+    unsigned mask = 0;
+    for (unsigned i = 0; i < 16; ++i) mask |= static_cast< unsigned >( p[i] == b ) << i;
+    return mask;
+#endif
+}
+
+
+    //! Open-addressing hash set, probing groups of 16 slots at a time (i.e. Swiss table style).
+    /*!
+        Each slot has a control byte, holding either Empty or 7 bits of the
+        element's hash.  So, a group's candidates are found by one SIMD compare
+        and the probe sequence ends at the first group with an empty slot.  The
+        max load factor is 7/8.
+    */
+template<
+    typename T,
+    typename hash_t = std::hash< T >
+>
+class SwissHashSet
+{
+public:
+    using value_type = T;
+    using const_iterator = OpenHashIterator< SwissHashSet >;
+    using iterator = const_iterator;
+
+    static constexpr size_t Group_size = 16;
+    static constexpr uint8_t Empty = 0x80;
+
+    const_iterator begin() const { return const_iterator( this, 0 ); }
+    const_iterator end() const { return const_iterator( this, this->capacity() ); }
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+    size_t capacity() const { return control_.size(); }
+    bool is_full( size_t i ) const { return control_[i] != Empty; }
+    const T &slot( size_t i ) const { return slots_[i]; }
+
+    void clear()
+    {
+        std::fill( control_.begin(), control_.end(), Empty );
+        size_ = 0;
+    }
+
+    void swap( SwissHashSet &other )
+    {
+        control_.swap( other.control_ );
+        slots_.swap( other.slots_ );
+        std::swap( size_, other.size_ );
+    }
+
+    bool insert( const T &value )
+    {
+        if (8 * (size_ + 1) > 7 * this->capacity()) this->grow();
+
+        const size_t hash = MixHash( hash_t()( value ) );
+        const uint8_t h2 = static_cast< uint8_t >( hash >> 57 );
+        const size_t group_mask = this->capacity() / Group_size - 1;
+        for (size_t g = hash & group_mask; ; g = (g + 1) & group_mask)
+        {
+            const size_t base = g * Group_size;
+            for (unsigned m = MatchGroup( &control_[base], h2 ); m; m &= m - 1)
+            {
+                if (slots_[base + __builtin_ctz( m )] == value) return false;
+            }
+
+            // Since nothing is ever erased, the value can't be in any later group.
+            const unsigned empties = MatchGroup( &control_[base], Empty );
+            if (empties)
+            {
+                const size_t i = base + __builtin_ctz( empties );
+                control_[i] = h2;
+                slots_[i] = value;
+                ++size_;
+                return true;
+            }
+        }
+    }
+
+    const_iterator find( const T &value ) const
+    {
+        if (size_ == 0) return this->end();
+
+        const size_t hash = MixHash( hash_t()( value ) );
+        const uint8_t h2 = static_cast< uint8_t >( hash >> 57 );
+        const size_t group_mask = this->capacity() / Group_size - 1;
+        for (size_t g = hash & group_mask; ; g = (g + 1) & group_mask)
+        {
+            const size_t base = g * Group_size;
+            for (unsigned m = MatchGroup( &control_[base], h2 ); m; m &= m - 1)
+            {
+                const size_t i = base + __builtin_ctz( m );
+                if (slots_[i] == value) return const_iterator( this, i );
+            }
+
+            if (MatchGroup( &control_[base], Empty )) return this->end();
+        }
+    }
+
+private:
+    void grow()
+    {
+        SwissHashSet bigger;
+        const size_t new_capacity = std::max< size_t >( 2 * this->capacity(), Group_size );
+        bigger.control_.resize( new_capacity, Empty );
+        bigger.slots_.resize( new_capacity );
+        for (size_t i = 0; i < this->capacity(); ++i)
+        {
+            if (control_[i] != Empty) bigger.insert( slots_[i] );
+        }
+
+        this->swap( bigger );
+    }
+
+    std::vector< uint8_t > control_;
+    std::vector< T > slots_;
+    size_t size_ = 0;
+};
+
+
+template< typename T, typename hash_t >
+    constexpr size_t SwissHashSet< T, hash_t >::Group_size;
+
+
+template< typename T, typename hash_t >
+    constexpr uint8_t SwissHashSet< T, hash_t >::Empty;
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_FLAT_CONTAINERS_HPP
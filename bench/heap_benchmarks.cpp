@@ -93,34 +93,49 @@ static void reclaim_heap()
 template<
     size_t size
 >
-static void new_delete_cold()
+static void new_delete_cold( TimingState &state )
 {
+    state.pause();
     reclaim_heap();
+    state.resume();
+
     new_delete< size >();
 }
 
 
 template<> autotime::BenchTimers MakeTimers< Benchmark::new_delete_cold_16 >()
 {
-    return { MakeTimer( &new_delete_cold< 1 << 4 > ), MakeTimer( &reclaim_heap ) };
+    return {
+            MakeTimer( &new_delete_cold< 1 << 4 > ),
+            MakeTimer( &Overhead_void< TimingState & > )
+        };
 }
 
 
 template<> autotime::BenchTimers MakeTimers< Benchmark::new_delete_cold_4k >()
 {
-    return { MakeTimer( &new_delete_cold< 1 << 12 > ), MakeTimer( &reclaim_heap ) };
+    return {
+            MakeTimer( &new_delete_cold< 1 << 12 > ),
+            MakeTimer( &Overhead_void< TimingState & > )
+        };
 }
 
 
 template<> autotime::BenchTimers MakeTimers< Benchmark::new_delete_cold_1M >()
 {
-    return { MakeTimer( &new_delete_cold< 1 << 20 > ), MakeTimer( &reclaim_heap ) };
+    return {
+            MakeTimer( &new_delete_cold< 1 << 20 > ),
+            MakeTimer( &Overhead_void< TimingState & > )
+        };
 }
 
 
 template<> autotime::BenchTimers MakeTimers< Benchmark::new_delete_cold_256M >()
 {
-    return { MakeTimer( &new_delete_cold< 1 << 28 > ), MakeTimer( &reclaim_heap ) };
+    return {
+            MakeTimer( &new_delete_cold< 1 << 28 > ),
+            MakeTimer( &Overhead_void< TimingState & > )
+        };
 }
 
 
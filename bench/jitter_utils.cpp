@@ -0,0 +1,544 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Detection of the interruptions a core suffers (OS jitter, or hiccups).
+/*! @file
+
+    See jitter_utils.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "jitter_utils.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <thread>
+
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "autotime/os.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+    // Events each probe can hold, between calls to drain() (a power of 2).
+static constexpr size_t Ring_capacity = size_t{ 1 } << 16;
+
+    // Rows of the histogram, after which the last one includes all longer gaps.
+static constexpr int Max_buckets = 24;
+
+
+    // Probes one core, and queues its events for the thread calling drain().
+class JitterProbe::Recorder
+{
+public:
+    Recorder( int core, std::chrono::nanoseconds threshold, bool idle,
+        const std::atomic< bool > &stop )
+    :
+        ring_( Ring_capacity )
+    {
+        thread_ = std::thread{
+            &Recorder::threadfunc, this, core, threshold, idle, std::cref( stop ) };
+
+        // Wait for the thread's ID, so it's never mistaken for a benchmark's.
+        while (!tid_.load( std::memory_order_acquire )) std::this_thread::yield();
+    }
+
+    int tid() const { return tid_.load( std::memory_order_relaxed ); }
+
+    void join()
+    {
+        if (thread_.joinable()) thread_.join();
+    }
+
+    void drain( std::vector< JitterEvent > &events )
+    {
+        const uint64_t head = head_.load( std::memory_order_acquire );
+        uint64_t tail = tail_.load( std::memory_order_relaxed );
+        for (; tail != head; ++tail) events.push_back( ring_[tail & (Ring_capacity - 1)] );
+        tail_.store( tail, std::memory_order_release );
+    }
+
+    uint64_t dropped() const { return dropped_.load( std::memory_order_relaxed ); }
+
+        // The probe's latest read, after which it hasn't recorded anything (yet).
+    std::chrono::steady_clock::time_point lastSeen() const
+    {
+        using std::chrono::steady_clock;
+
+        const steady_clock::rep ticks = last_seen_.load( std::memory_order_acquire );
+        return steady_clock::time_point{ steady_clock::duration{ ticks } };
+    }
+
+private:
+    void threadfunc( int core, std::chrono::nanoseconds threshold, bool idle,
+        const std::atomic< bool > &stop )
+    {
+        tid_.store( static_cast< int >( syscall( SYS_gettid ) ), std::memory_order_release );
+        SetCoreAffinity( core );
+
+        // Any thread may lower its own policy to SCHED_IDLE, so this can't fail for lack of
+        // permission.
+        if (idle)
+        {
+            const sched_param param{};
+            pthread_setschedparam( pthread_self(), SCHED_IDLE, &param );
+        }
+
+        // Publishing each read lets drain() see a gap that hasn't ended, because the probe is
+        // still starved.  It's released after any event it ends, so drain() can't miss both.
+        std::chrono::steady_clock::time_point prev = std::chrono::steady_clock::now();
+        last_seen_.store( prev.time_since_epoch().count(), std::memory_order_release );
+        while (!stop.load( std::memory_order_relaxed ))
+        {
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            if (now - prev > threshold) record( { prev, now - prev, core } );
+            last_seen_.store( now.time_since_epoch().count(), std::memory_order_release );
+            prev = now;
+        }
+    }
+
+    void record( const JitterEvent &event )
+    {
+        const uint64_t head = head_.load( std::memory_order_relaxed );
+        if (head - tail_.load( std::memory_order_acquire ) >= Ring_capacity)
+        {
+            dropped_.fetch_add( 1, std::memory_order_relaxed );
+            return;
+        }
+
+        ring_[head & (Ring_capacity - 1)] = event;
+        head_.store( head + 1, std::memory_order_release );
+    }
+
+    std::vector< JitterEvent > ring_;
+    std::thread thread_;
+    std::atomic< int > tid_{ 0 };
+
+    // Padding keeps the probe's index and the drainer's on separate cache lines.
+    char pad0_[64];
+    std::atomic< uint64_t > head_{ 0 };
+    std::atomic< uint64_t > dropped_{ 0 };
+    std::atomic< std::chrono::steady_clock::rep > last_seen_{ 0 };
+    char pad1_[64 - 2 * sizeof( std::atomic< uint64_t > )
+        - sizeof( std::atomic< std::chrono::steady_clock::rep > )];
+    std::atomic< uint64_t > tail_{ 0 };
+    char pad2_[64 - sizeof( std::atomic< uint64_t > )];
+};
+
+
+JitterProbe::JitterProbe(
+    const std::vector< int > &cores, std::chrono::nanoseconds threshold, bool idle )
+:
+    cores_( cores ),
+    threshold_( threshold ),
+    last_seen_( cores.size(), std::chrono::steady_clock::now() )
+{
+    for (int core: cores_)
+    {
+        recorders_.emplace_back( new Recorder( core, threshold_, idle, stop_ ) );
+    }
+}
+
+
+JitterProbe::~JitterProbe()
+{
+    stop();
+}
+
+
+void JitterProbe::stop()
+{
+    stop_.store( true, std::memory_order_relaxed );
+    for (std::unique_ptr< Recorder > &recorder: recorders_) recorder->join();
+}
+
+
+void JitterProbe::drain( std::vector< JitterEvent > &events )
+{
+    // Each probe's latest read comes first, so any event it had ended by then is drained.
+    const size_t first = events.size();
+    for (size_t i = 0; i < recorders_.size(); ++i)
+    {
+        last_seen_[i] = recorders_[i]->lastSeen();
+        recorders_[i]->drain( events );
+    }
+
+    // One core's event can end after another's that started later, so merge with the rest.
+    const auto earlier = []( const JitterEvent &a, const JitterEvent &b )
+        {
+            return a.start < b.start;
+        };
+    std::sort( events.begin() + first, events.end(), earlier );
+    std::inplace_merge( events.begin(), events.begin() + first, events.end(), earlier );
+}
+
+
+uint64_t JitterProbe::dropped() const
+{
+    uint64_t dropped = 0;
+    for (const std::unique_ptr< Recorder > &recorder: recorders_)
+    {
+        dropped += recorder->dropped();
+    }
+    return dropped;
+}
+
+
+    // Reads a thread's counters, returning false if it has exited.
+static bool ReadThreadSchedCounts( const std::string &task_path, ThreadSchedCounts &counts )
+{
+    // The second field of schedstat is the time spent on a runqueue, in ns.
+    std::ifstream schedstat{ task_path + "/schedstat" };
+    uint64_t run_ns = 0;
+    uint64_t run_delay_ns = 0;
+    if (!(schedstat >> run_ns >> run_delay_ns)) return false;
+    counts.run_delay = std::chrono::nanoseconds{ run_delay_ns };
+
+    std::ifstream status{ task_path + "/status" };
+    const std::string key = "nonvoluntary_ctxt_switches:";
+    std::string line;
+    while (std::getline( status, line ))
+    {
+        if (line.compare( 0, key.size(), key ) == 0)
+        {
+            counts.involuntary_switches = strtoull( line.c_str() + key.size(), nullptr, 10 );
+            return true;
+        }
+    }
+    return false;
+}
+
+
+    // Reads the total interrupts of each core, or nothing if /proc/interrupts can't be read.
+static std::map< int, uint64_t > ReadInterruptCounts()
+{
+    std::map< int, uint64_t > result;
+
+    // The header names a column per online core, e.g. "CPU0 CPU2".
+    std::ifstream file{ "/proc/interrupts" };
+    std::string line;
+    if (!std::getline( file, line )) return result;
+
+    std::vector< int > cores;
+    std::istringstream header{ line };
+    std::string name;
+    while (header >> name)
+    {
+        if (name.compare( 0, 3, "CPU" ) == 0) cores.push_back( atoi( name.c_str() + 3 ) );
+    }
+
+    // Each row has a count per core after its label, except ERR & MIS, which are totals.
+    while (std::getline( file, line ))
+    {
+        std::istringstream row{ line };
+        std::string label;
+        row >> label;
+        if (label == "ERR:" || label == "MIS:") continue;
+
+        for (int core: cores)
+        {
+            uint64_t count = 0;
+            if (!(row >> count)) break;
+            result[core] += count;
+        }
+    }
+
+    return result;
+}
+
+
+SchedSample JitterProbe::sample() const
+{
+    SchedSample result;
+
+    std::vector< int > probe_tids;
+    for (const std::unique_ptr< Recorder > &recorder: recorders_)
+    {
+        probe_tids.push_back( recorder->tid() );
+    }
+
+    const std::string task_dir = "/proc/self/task/";
+    if (DIR *dir = opendir( task_dir.c_str() ))
+    {
+        while (dirent *entry = readdir( dir ))
+        {
+            if (entry->d_name[0] < '0' || entry->d_name[0] > '9') continue;
+
+            const int tid = atoi( entry->d_name );
+            if (std::find( probe_tids.begin(), probe_tids.end(), tid ) != probe_tids.end())
+            {
+                continue;
+            }
+
+            ThreadSchedCounts counts;
+            if (ReadThreadSchedCounts( task_dir + entry->d_name, counts ))
+            {
+                result.threads[tid] = counts;
+            }
+        }
+        closedir( dir );
+    }
+
+    result.interrupts = ReadInterruptCounts();
+    return result;
+}
+
+
+    // Range of the events starting in [from, to), which are sorted by start.
+static std::pair<
+    std::vector< JitterEvent >::const_iterator,
+    std::vector< JitterEvent >::const_iterator >
+EventsBetween(
+    const std::vector< JitterEvent > &events,
+    std::chrono::steady_clock::time_point from,
+    std::chrono::steady_clock::time_point to )
+{
+    auto before = []( const JitterEvent &event, std::chrono::steady_clock::time_point time )
+        {
+            return event.start < time;
+        };
+
+    return {
+        std::lower_bound( events.begin(), events.end(), from, before ),
+        std::lower_bound( events.begin(), events.end(), to, before ) };
+}
+
+
+std::string DescribeInterference(
+    const JitterProbe &probe,
+    const std::vector< JitterEvent > &events,
+    std::chrono::steady_clock::time_point from,
+    std::chrono::steady_clock::time_point to )
+{
+    const int num_cores = static_cast< int >( probe.cores().size() );
+    const auto range = EventsBetween( events, from, to );
+
+    size_t count = 0;
+    std::chrono::nanoseconds total{ 0 };
+    std::chrono::nanoseconds longest{ 0 };
+    const auto add = [&]( const JitterEvent &event )
+        {
+            // Only the part of the gap within the window.
+            const std::chrono::nanoseconds gap =
+                std::min( event.start + event.gap, to ) - std::max( event.start, from );
+            if (gap.count() <= 0) return;
+
+            ++count;
+            total += gap;
+            longest = std::max( longest, gap );
+        };
+
+    for (auto it = range.first; it != range.second; ++it) add( *it );
+
+    // A core's last gap before the window might extend into it (e.g. if the probe was
+    // preempted by the benchmark), while its earlier ones can't.
+    std::vector< int > seen;
+    for (auto it = range.first; it != events.begin() && seen.size() < size_t( num_cores );)
+    {
+        --it;
+        if (std::find( seen.begin(), seen.end(), it->core ) != seen.end()) continue;
+
+        seen.push_back( it->core );
+        add( *it );
+    }
+
+    // A probe which hasn't run since before the window ended is in a gap that hasn't been
+    // recorded, such as when it shares a core with a busy benchmark thread.
+    for (size_t i = 0; i < probe.cores().size(); ++i)
+    {
+        const std::chrono::steady_clock::time_point last_seen = probe.lastSeen()[i];
+        if (to - last_seen > probe.threshold())
+        {
+            add( { last_seen, to - last_seen, probe.cores()[i] } );
+        }
+    }
+
+    const double window_ns = std::chrono::duration< double, std::nano >( to - from ).count();
+
+    std::ostringstream sstream;
+    sstream << std::fixed << std::setprecision( 1 )
+        << "jitter: " << count << " interruptions, "
+        << total.count() * 1e-3 << " us total ("
+        << std::setprecision( 3 ) << 100.0 * total.count() / (window_ns * num_cores)
+        << "% of " << std::setprecision( 1 ) << window_ns * 1e-6 << " ms x " << num_cores
+        << " cores), max " << longest.count() * 1e-3 << " us";
+    return sstream.str();
+}
+
+
+std::string DescribeSchedActivity(
+    const SchedSample &before,
+    const SchedSample &after,
+    const std::vector< int > &cores )
+{
+    // A thread which started in between accumulated all of its counts since.
+    uint64_t involuntary_switches = 0;
+    std::chrono::nanoseconds run_delay{ 0 };
+    for (const auto &entry: after.threads)
+    {
+        ThreadSchedCounts prev;
+        const auto it = before.threads.find( entry.first );
+        if (it != before.threads.end()) prev = it->second;
+
+        involuntary_switches += entry.second.involuntary_switches - prev.involuntary_switches;
+        run_delay += entry.second.run_delay - prev.run_delay;
+    }
+
+    std::ostringstream sstream;
+    sstream << std::fixed << std::setprecision( 1 )
+        << "sched: " << involuntary_switches << " preemptions, "
+        << run_delay.count() * 1e-3 << " us run delay, over " << after.threads.size()
+        << " threads";
+
+    const char *separator = "; interrupts: ";
+    for (int core: cores)
+    {
+        const auto it_after = after.interrupts.find( core );
+        const auto it_before = before.interrupts.find( core );
+        if (it_after == after.interrupts.end() || it_before == before.interrupts.end())
+        {
+            continue;
+        }
+
+        sstream << separator << "core " << core << " " << it_after->second - it_before->second;
+        separator = ", ";
+    }
+
+    return sstream.str();
+}
+
+
+std::ostream &PrintJitterReport(
+    std::ostream &ostream,
+    const JitterProbe &probe,
+    const std::vector< JitterEvent > &events,
+    std::chrono::steady_clock::time_point from,
+    std::chrono::steady_clock::time_point to,
+    int num_slices )
+{
+    const std::vector< int > &cores = probe.cores();
+    const auto range = EventsBetween( events, from, to );
+    const int64_t threshold_ns = probe.threshold().count();
+
+    const auto column = [&cores]( int core )
+        {
+            return std::find( cores.begin(), cores.end(), core ) - cores.begin();
+        };
+
+    // Tally the histogram, with a row per doubling of the gap.
+    std::vector< std::vector< size_t > > histogram(
+        Max_buckets, std::vector< size_t >( cores.size(), 0 ) );
+    int num_buckets = 0;
+    std::chrono::nanoseconds total{ 0 };
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        int bucket = 0;
+        int64_t edge = 2 * threshold_ns;
+        while (it->gap.count() >= edge && bucket < Max_buckets - 1)
+        {
+            ++bucket;
+            edge *= 2;
+        }
+
+        ++histogram[bucket][column( it->core )];
+        num_buckets = std::max( num_buckets, bucket + 1 );
+        total += it->gap;
+    }
+
+    const double window_ns = std::chrono::duration< double, std::nano >( to - from ).count();
+
+    const auto flags_prev = ostream.flags();
+    const auto precision_prev = ostream.precision( 1 );
+    ostream << std::fixed;
+
+    ostream << "Interruptions above " << threshold_ns * 1e-3 << " us, over "
+        << window_ns * 1e-6 << " ms on core(s)";
+    for (int core: cores) ostream << " " << core;
+    ostream << ": " << (range.second - range.first) << ", totalling " << total.count() * 1e-3
+        << " us (" << std::setprecision( 3 )
+        << 100.0 * total.count() / (window_ns * cores.size()) << "%)\n";
+    ostream.precision( 1 );
+
+    if (probe.dropped())
+    {
+        ostream << "  (" << probe.dropped() << " more were dropped, since they weren't drained"
+            " in time.)\n";
+    }
+
+    if (range.first == range.second)
+    {
+        ostream.precision( precision_prev );
+        ostream.flags( flags_prev );
+        return ostream;
+    }
+
+    ostream << "\n  " << std::setw( 12 ) << "gap >= (us)";
+    for (int core: cores) ostream << std::setw( 9 ) << "core " + std::to_string( core );
+    ostream << "\n";
+
+    for (int bucket = 0; bucket < num_buckets; ++bucket)
+    {
+        ostream << "  " << std::setw( 12 ) << (threshold_ns << bucket) * 1e-3;
+        for (size_t count: histogram[bucket]) ostream << std::setw( 9 ) << count;
+        ostream << "\n";
+    }
+
+    // Divide the window into slices, with the count & longest gap of each, per core.
+    std::vector< std::vector< size_t > > counts(
+        num_slices, std::vector< size_t >( cores.size(), 0 ) );
+    std::vector< std::vector< int64_t > > longest(
+        num_slices, std::vector< int64_t >( cores.size(), 0 ) );
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const double offset =
+            std::chrono::duration< double, std::nano >( it->start - from ).count();
+        const int slice = std::min( static_cast< int >( offset / window_ns * num_slices ),
+            num_slices - 1 );
+        const size_t col = column( it->core );
+        ++counts[slice][col];
+        longest[slice][col] =
+            std::max( longest[slice][col], static_cast< int64_t >( it->gap.count() ) );
+    }
+
+    ostream << "\n  " << std::setw( 12 ) << "from (ms)";
+    for (int core: cores)
+    {
+        ostream << std::setw( 18 ) << "core " + std::to_string( core ) + " n/max us";
+    }
+    ostream << "\n";
+
+    for (int slice = 0; slice < num_slices; ++slice)
+    {
+        ostream << "  " << std::setw( 12 ) << window_ns * 1e-6 * slice / num_slices;
+        for (size_t col = 0; col < cores.size(); ++col)
+        {
+            ostream << std::setw( 9 ) << counts[slice][col]
+                << std::setw( 9 ) << longest[slice][col] * 1e-3;
+        }
+        ostream << "\n";
+    }
+
+    ostream.precision( precision_prev );
+    ostream.flags( flags_prev );
+
+    return ostream;
+}
+
+
+} // namespace bench
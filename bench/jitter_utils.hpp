@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Detection of the interruptions a core suffers (OS jitter, or hiccups).
+/*! @file
+
+    A probe thread spins on each chosen core, reading steady_clock, and
+    records every gap between consecutive reads that exceeds a threshold.
+    Such a gap is time the thread didn't run: an interrupt, a preemption,
+    an SMI, or a vCPU being descheduled by its hypervisor.
+
+    The probe can run on its own (see --jitter), or in the background while
+    the benchmarks run (see --jitter-monitor), so each result can be
+    annotated with the interference seen while it was measured.  This
+    separates "the code got slower" from "the host got noisier".
+
+    A probe can't spin on the benchmark's own cores without competing with
+    it, so the benchmark's threads & cores are also described by the
+    kernel's counters: each thread's involuntary context switches and run
+    delay (time spent runnable, but waiting for a core), and each core's
+    interrupts.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_JITTER_UTILS_HPP
+#define BENCH_JITTER_UTILS_HPP
+
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace bench
+{
+
+
+    //! A gap in a probe's reads of steady_clock, above the threshold.
+struct JitterEvent
+{
+    std::chrono::steady_clock::time_point start;    //!< The last read before the gap.
+    std::chrono::nanoseconds gap;
+    int core;
+};
+
+
+    //! A thread's scheduler counters, from /proc.
+struct ThreadSchedCounts
+{
+    uint64_t involuntary_switches = 0;          //!< Preemptions, from its status.
+    std::chrono::nanoseconds run_delay{ 0 };    //!< Time spent runnable, from its schedstat.
+};
+
+
+    //! The scheduler counters of a process's threads and the interrupts of each core.
+struct SchedSample
+{
+    std::map< int, ThreadSchedCounts > threads;     //!< By thread ID.
+    std::map< int, uint64_t > interrupts;           //!< By core ID, from /proc/interrupts.
+};
+
+
+    //! Runs a probe thread on each of a set of cores, until destroyed or stopped.
+    /*!
+        With idle, the probes run at SCHED_IDLE, so they only take time that
+        no other thread on their cores wants (e.g. the benchmarks').
+    */
+class JitterProbe
+{
+public:
+    JitterProbe( const std::vector< int > &cores, std::chrono::nanoseconds threshold,
+        bool idle = false );
+    ~JitterProbe();
+
+    JitterProbe( const JitterProbe & ) = delete;
+    JitterProbe &operator=( const JitterProbe & ) = delete;
+
+    const std::vector< int > &cores() const { return cores_; }
+    std::chrono::nanoseconds threshold() const { return threshold_; }
+
+        //! Stops & joins the probe threads.  Their events remain to be drained.
+    void stop();
+
+        //! Adds the events recorded since the last call, keeping events in order of start time.
+    void drain( std::vector< JitterEvent > &events );
+
+        //! Each core's latest read by its probe, as of the last call to drain().
+        /*!
+            A gap from then isn't among the events until the probe runs again.
+        */
+    const std::vector< std::chrono::steady_clock::time_point > &lastSeen() const
+    {
+        return last_seen_;
+    }
+
+        //! Events discarded because drain() wasn't called soon enough.
+    uint64_t dropped() const;
+
+        //! Samples the counters of this process's threads, except the probes, and the cores.
+    SchedSample sample() const;
+
+private:
+    class Recorder;
+
+    const std::vector< int > cores_;
+    const std::chrono::nanoseconds threshold_;
+    std::atomic< bool > stop_{ false };
+    std::vector< std::unique_ptr< Recorder > > recorders_;
+    std::vector< std::chrono::steady_clock::time_point > last_seen_;
+};
+
+
+    //! Summarizes the events overlapping [from, to) in a line, for annotating a result.
+    /*!
+        Only the part of each gap within the window counts.  The events must be
+        in order of start time, as drain() appends them.  A probe not seen since
+        before the end of the window (see JitterProbe::lastSeen()) counts as
+        an open gap, from then.
+    */
+std::string DescribeInterference(
+    const JitterProbe &probe,
+    const std::vector< JitterEvent > &events,
+    std::chrono::steady_clock::time_point from,
+    std::chrono::steady_clock::time_point to );
+
+
+    //! Summarizes the counters' change between samples in a line, for annotating a result.
+    /*!
+        The counters of the threads in the later sample are totalled, so any
+        which exited in between aren't.  The interrupts are listed for each
+        of the specified cores (e.g. the primary & secondary).
+    */
+std::string DescribeSchedActivity(
+    const SchedSample &before,
+    const SchedSample &after,
+    const std::vector< int > &cores );
+
+
+    //! Prints the totals, histogram & timeline of the events starting in [from, to).
+    /*!
+        The histogram has a column per core and a row per doubling of the gap,
+        from the threshold.  The timeline divides [from, to) into num_slices
+        and shows the number of events and the largest gap in each, per core.
+    */
+std::ostream &PrintJitterReport(
+    std::ostream &ostream,
+    const JitterProbe &probe,
+    const std::vector< JitterEvent > &events,
+    std::chrono::steady_clock::time_point from,
+    std::chrono::steady_clock::time_point to,
+    int num_slices = 20 );
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_JITTER_UTILS_HPP
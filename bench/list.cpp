@@ -49,11 +49,17 @@ const char *ToCStr( Category c )
 
     CASE( asio );
     CASE( atomic );
+    CASE( bandwidth );
     CASE( cache );
     CASE( condvar );
+    CASE( copy );
     CASE( exception );
+    CASE( eytzinger );
     CASE( directory );
     CASE( file );
+    CASE( flat_hashset );
+    CASE( flat_map );
+    CASE( flat_set );
     CASE( function );
     CASE( heap );
     CASE( istream );
@@ -65,11 +71,15 @@ const char *ToCStr( Category c )
     CASE( pipe );
     CASE( poll );
     CASE( process );
+    CASE( queue );
+    CASE( simd );
     CASE( socket );
     CASE( std_deque );
     CASE( std_hash );
+    CASE( std_hashmap );
     CASE( std_hashset );
     CASE( std_list );
+    CASE( std_map );
     CASE( std_set );
     CASE( std_string );
     CASE( std_vector );
@@ -77,6 +87,10 @@ const char *ToCStr( Category c )
     CASE( string_to );
     CASE( syscall );
     CASE( thread );
+    CASE( timing );
+    CASE( uring );
+    CASE( vm );
+    CASE( wakeup );
     CASE( work );
 
 #undef CASE
@@ -159,11 +173,336 @@ const char *ToCStr( Benchmark b )
     CASE( atomic_cmp_exchg_strong_other );
     CASE( atomic_pingpong );
 
+    CASE( atomic_fetch_add_shared_1t );
+    CASE( atomic_fetch_add_shared_2t );
+    CASE( atomic_fetch_add_shared_4t );
+    CASE( atomic_fetch_add_shared_8t );
+    CASE( atomic_fetch_add_shared_16t );
+
+    CASE( atomic_fetch_add_padded_1t );
+    CASE( atomic_fetch_add_padded_2t );
+    CASE( atomic_fetch_add_padded_4t );
+    CASE( atomic_fetch_add_padded_8t );
+    CASE( atomic_fetch_add_padded_16t );
+
+    CASE( atomic_fetch_add_sharded_1t );
+    CASE( atomic_fetch_add_sharded_2t );
+    CASE( atomic_fetch_add_sharded_4t );
+    CASE( atomic_fetch_add_sharded_8t );
+    CASE( atomic_fetch_add_sharded_16t );
+
+    CASE( atomic_cas_shared_1t );
+    CASE( atomic_cas_shared_2t );
+    CASE( atomic_cas_shared_4t );
+    CASE( atomic_cas_shared_8t );
+    CASE( atomic_cas_shared_16t );
+
+    CASE( atomic_cas_padded_1t );
+    CASE( atomic_cas_padded_2t );
+    CASE( atomic_cas_padded_4t );
+    CASE( atomic_cas_padded_8t );
+    CASE( atomic_cas_padded_16t );
+
+    CASE( atomic_exchange_shared_1t );
+    CASE( atomic_exchange_shared_2t );
+    CASE( atomic_exchange_shared_4t );
+    CASE( atomic_exchange_shared_8t );
+    CASE( atomic_exchange_shared_16t );
+
+    CASE( atomic_exchange_padded_1t );
+    CASE( atomic_exchange_padded_2t );
+    CASE( atomic_exchange_padded_4t );
+    CASE( atomic_exchange_padded_8t );
+    CASE( atomic_exchange_padded_16t );
+
+    CASE( atomic_fetch_add_shared_relaxed_1t );
+    CASE( atomic_fetch_add_shared_relaxed_2t );
+    CASE( atomic_fetch_add_shared_relaxed_4t );
+    CASE( atomic_fetch_add_shared_relaxed_8t );
+    CASE( atomic_fetch_add_shared_relaxed_16t );
+
+    CASE( atomic_fetch_add_shared_acq_rel_1t );
+    CASE( atomic_fetch_add_shared_acq_rel_2t );
+    CASE( atomic_fetch_add_shared_acq_rel_4t );
+    CASE( atomic_fetch_add_shared_acq_rel_8t );
+    CASE( atomic_fetch_add_shared_acq_rel_16t );
+
+    CASE( atomic_store_relaxed );
+    CASE( atomic_store_release );
+    CASE( atomic_store_seq_cst );
+
+    CASE( atomic_fence_acquire );
+    CASE( atomic_fence_release );
+    CASE( atomic_fence_acq_rel );
+    CASE( atomic_fence_seq_cst );
+
+    CASE( stream_copy_1t );
+    CASE( stream_copy_2t );
+    CASE( stream_copy_4t );
+    CASE( stream_copy_8t );
+    CASE( stream_copy_16t );
+    CASE( stream_copy_32t );
+    CASE( stream_copy_64t );
+
+    CASE( stream_scale_1t );
+    CASE( stream_scale_2t );
+    CASE( stream_scale_4t );
+    CASE( stream_scale_8t );
+    CASE( stream_scale_16t );
+    CASE( stream_scale_32t );
+    CASE( stream_scale_64t );
+
+    CASE( stream_add_1t );
+    CASE( stream_add_2t );
+    CASE( stream_add_4t );
+    CASE( stream_add_8t );
+    CASE( stream_add_16t );
+    CASE( stream_add_32t );
+    CASE( stream_add_64t );
+
+    CASE( stream_triad_1t );
+    CASE( stream_triad_2t );
+    CASE( stream_triad_4t );
+    CASE( stream_triad_8t );
+    CASE( stream_triad_16t );
+    CASE( stream_triad_32t );
+    CASE( stream_triad_64t );
+
+    CASE( cache_chase_random_4k );
+    CASE( cache_chase_random_8k );
+    CASE( cache_chase_random_16k );
+    CASE( cache_chase_random_32k );
+    CASE( cache_chase_random_64k );
+    CASE( cache_chase_random_128k );
+    CASE( cache_chase_random_256k );
+    CASE( cache_chase_random_512k );
+    CASE( cache_chase_random_1M );
+    CASE( cache_chase_random_2M );
+    CASE( cache_chase_random_4M );
+    CASE( cache_chase_random_8M );
+    CASE( cache_chase_random_16M );
+    CASE( cache_chase_random_32M );
+    CASE( cache_chase_random_64M );
+    CASE( cache_chase_random_128M );
+    CASE( cache_chase_random_256M );
+    CASE( cache_chase_random_512M );
+    CASE( cache_chase_random_1G );
+    CASE( cache_chase_seq_64k );
+    CASE( cache_chase_seq_1M );
+    CASE( cache_chase_seq_16M );
+    CASE( cache_chase_seq_256M );
+    CASE( cache_chase_stride_64k );
+    CASE( cache_chase_stride_1M );
+    CASE( cache_chase_stride_16M );
+    CASE( cache_chase_stride_256M );
+    CASE( cache_page_chase_4M_4k );
+    CASE( cache_page_chase_4M_thp );
+    CASE( cache_page_chase_4M_2M );
+    CASE( cache_page_chase_64M_4k );
+    CASE( cache_page_chase_64M_thp );
+    CASE( cache_page_chase_64M_2M );
+    CASE( cache_page_chase_1G_4k );
+    CASE( cache_page_chase_1G_thp );
+    CASE( cache_page_chase_1G_2M );
+    CASE( cache_page_chase_1G_1G );
+
+    CASE( cache_sharing_0b_write_2t );
+    CASE( cache_sharing_0b_write_4t );
+    CASE( cache_sharing_0b_write_8t );
+
+    CASE( cache_sharing_0b_mixed_2t );
+    CASE( cache_sharing_0b_mixed_4t );
+    CASE( cache_sharing_0b_mixed_8t );
+
+    CASE( cache_sharing_0b_readers_2t );
+    CASE( cache_sharing_0b_readers_4t );
+    CASE( cache_sharing_0b_readers_8t );
+
+    CASE( cache_sharing_8b_write_2t );
+    CASE( cache_sharing_8b_write_4t );
+    CASE( cache_sharing_8b_write_8t );
+
+    CASE( cache_sharing_8b_mixed_2t );
+    CASE( cache_sharing_8b_mixed_4t );
+    CASE( cache_sharing_8b_mixed_8t );
+
+    CASE( cache_sharing_8b_readers_2t );
+    CASE( cache_sharing_8b_readers_4t );
+    CASE( cache_sharing_8b_readers_8t );
+
+    CASE( cache_sharing_64b_write_2t );
+    CASE( cache_sharing_64b_write_4t );
+    CASE( cache_sharing_64b_write_8t );
+
+    CASE( cache_sharing_64b_mixed_2t );
+    CASE( cache_sharing_64b_mixed_4t );
+    CASE( cache_sharing_64b_mixed_8t );
+
+    CASE( cache_sharing_64b_readers_2t );
+    CASE( cache_sharing_64b_readers_4t );
+    CASE( cache_sharing_64b_readers_8t );
+
+    CASE( cache_sharing_128b_write_2t );
+    CASE( cache_sharing_128b_write_4t );
+    CASE( cache_sharing_128b_write_8t );
+
+    CASE( cache_sharing_128b_mixed_2t );
+    CASE( cache_sharing_128b_mixed_4t );
+    CASE( cache_sharing_128b_mixed_8t );
+
+    CASE( cache_sharing_128b_readers_2t );
+    CASE( cache_sharing_128b_readers_4t );
+    CASE( cache_sharing_128b_readers_8t );
+
     CASE( condvar_broadcast );
     CASE( condvar_create_destroy );
     CASE( condvar_signal );
     CASE( condvar_signal_watched );
 
+    CASE( copy_memcpy_libc_64 );
+    CASE( copy_memcpy_libc_256 );
+    CASE( copy_memcpy_libc_1k );
+    CASE( copy_memcpy_libc_4k );
+    CASE( copy_memcpy_libc_16k );
+    CASE( copy_memcpy_libc_64k );
+    CASE( copy_memcpy_libc_256k );
+    CASE( copy_memcpy_libc_1M );
+    CASE( copy_memcpy_libc_4M );
+    CASE( copy_memcpy_libc_16M );
+    CASE( copy_memcpy_libc_64M );
+
+    CASE( copy_memcpy_rep_64 );
+    CASE( copy_memcpy_rep_256 );
+    CASE( copy_memcpy_rep_1k );
+    CASE( copy_memcpy_rep_4k );
+    CASE( copy_memcpy_rep_16k );
+    CASE( copy_memcpy_rep_64k );
+    CASE( copy_memcpy_rep_256k );
+    CASE( copy_memcpy_rep_1M );
+    CASE( copy_memcpy_rep_4M );
+    CASE( copy_memcpy_rep_16M );
+    CASE( copy_memcpy_rep_64M );
+
+    CASE( copy_memcpy_avx2_64 );
+    CASE( copy_memcpy_avx2_256 );
+    CASE( copy_memcpy_avx2_1k );
+    CASE( copy_memcpy_avx2_4k );
+    CASE( copy_memcpy_avx2_16k );
+    CASE( copy_memcpy_avx2_64k );
+    CASE( copy_memcpy_avx2_256k );
+    CASE( copy_memcpy_avx2_1M );
+    CASE( copy_memcpy_avx2_4M );
+    CASE( copy_memcpy_avx2_16M );
+    CASE( copy_memcpy_avx2_64M );
+
+    CASE( copy_memcpy_nt_64 );
+    CASE( copy_memcpy_nt_256 );
+    CASE( copy_memcpy_nt_1k );
+    CASE( copy_memcpy_nt_4k );
+    CASE( copy_memcpy_nt_16k );
+    CASE( copy_memcpy_nt_64k );
+    CASE( copy_memcpy_nt_256k );
+    CASE( copy_memcpy_nt_1M );
+    CASE( copy_memcpy_nt_4M );
+    CASE( copy_memcpy_nt_16M );
+    CASE( copy_memcpy_nt_64M );
+
+    CASE( copy_memset_libc_64 );
+    CASE( copy_memset_libc_256 );
+    CASE( copy_memset_libc_1k );
+    CASE( copy_memset_libc_4k );
+    CASE( copy_memset_libc_16k );
+    CASE( copy_memset_libc_64k );
+    CASE( copy_memset_libc_256k );
+    CASE( copy_memset_libc_1M );
+    CASE( copy_memset_libc_4M );
+    CASE( copy_memset_libc_16M );
+    CASE( copy_memset_libc_64M );
+
+    CASE( copy_memset_rep_64 );
+    CASE( copy_memset_rep_256 );
+    CASE( copy_memset_rep_1k );
+    CASE( copy_memset_rep_4k );
+    CASE( copy_memset_rep_16k );
+    CASE( copy_memset_rep_64k );
+    CASE( copy_memset_rep_256k );
+    CASE( copy_memset_rep_1M );
+    CASE( copy_memset_rep_4M );
+    CASE( copy_memset_rep_16M );
+    CASE( copy_memset_rep_64M );
+
+    CASE( copy_memset_avx2_64 );
+    CASE( copy_memset_avx2_256 );
+    CASE( copy_memset_avx2_1k );
+    CASE( copy_memset_avx2_4k );
+    CASE( copy_memset_avx2_16k );
+    CASE( copy_memset_avx2_64k );
+    CASE( copy_memset_avx2_256k );
+    CASE( copy_memset_avx2_1M );
+    CASE( copy_memset_avx2_4M );
+    CASE( copy_memset_avx2_16M );
+    CASE( copy_memset_avx2_64M );
+
+    CASE( copy_memset_nt_64 );
+    CASE( copy_memset_nt_256 );
+    CASE( copy_memset_nt_1k );
+    CASE( copy_memset_nt_4k );
+    CASE( copy_memset_nt_16k );
+    CASE( copy_memset_nt_64k );
+    CASE( copy_memset_nt_256k );
+    CASE( copy_memset_nt_1M );
+    CASE( copy_memset_nt_4M );
+    CASE( copy_memset_nt_16M );
+    CASE( copy_memset_nt_64M );
+
+    CASE( copy_memcpy_libc_4k_src1 );
+    CASE( copy_memcpy_libc_4k_src4 );
+    CASE( copy_memcpy_libc_4k_src8 );
+    CASE( copy_memcpy_libc_4k_src16 );
+    CASE( copy_memcpy_libc_4k_src32 );
+    CASE( copy_memcpy_libc_4k_src63 );
+    CASE( copy_memcpy_libc_4k_dst1 );
+    CASE( copy_memcpy_libc_4k_dst4 );
+    CASE( copy_memcpy_libc_4k_dst8 );
+    CASE( copy_memcpy_libc_4k_dst16 );
+    CASE( copy_memcpy_libc_4k_dst32 );
+    CASE( copy_memcpy_libc_4k_dst63 );
+
+    CASE( copy_memcpy_rep_4k_src1 );
+    CASE( copy_memcpy_rep_4k_src4 );
+    CASE( copy_memcpy_rep_4k_src8 );
+    CASE( copy_memcpy_rep_4k_src16 );
+    CASE( copy_memcpy_rep_4k_src32 );
+    CASE( copy_memcpy_rep_4k_src63 );
+    CASE( copy_memcpy_rep_4k_dst1 );
+    CASE( copy_memcpy_rep_4k_dst4 );
+    CASE( copy_memcpy_rep_4k_dst8 );
+    CASE( copy_memcpy_rep_4k_dst16 );
+    CASE( copy_memcpy_rep_4k_dst32 );
+    CASE( copy_memcpy_rep_4k_dst63 );
+
+    CASE( copy_memcpy_avx2_4k_src1 );
+    CASE( copy_memcpy_avx2_4k_src4 );
+    CASE( copy_memcpy_avx2_4k_src8 );
+    CASE( copy_memcpy_avx2_4k_src16 );
+    CASE( copy_memcpy_avx2_4k_src32 );
+    CASE( copy_memcpy_avx2_4k_src63 );
+    CASE( copy_memcpy_avx2_4k_dst1 );
+    CASE( copy_memcpy_avx2_4k_dst4 );
+    CASE( copy_memcpy_avx2_4k_dst8 );
+    CASE( copy_memcpy_avx2_4k_dst16 );
+    CASE( copy_memcpy_avx2_4k_dst32 );
+    CASE( copy_memcpy_avx2_4k_dst63 );
+
+    CASE( copy_memmove_up_256 );
+    CASE( copy_memmove_up_4k );
+    CASE( copy_memmove_up_64k );
+    CASE( copy_memmove_up_1M );
+    CASE( copy_memmove_down_256 );
+    CASE( copy_memmove_down_4k );
+    CASE( copy_memmove_down_64k );
+    CASE( copy_memmove_down_1M );
+
     CASE( chmod );
     CASE( chown );
     CASE( directory_iter_0 );
@@ -184,6 +523,53 @@ const char *ToCStr( Benchmark b )
     CASE( exception_noexcept );
     CASE( exception_try );
 
+    CASE( eytzinger_int32_copy16 );
+    CASE( eytzinger_int32_copy256 );
+    CASE( eytzinger_int32_copy4k );
+    CASE( eytzinger_int32_copy64k );
+    CASE( eytzinger_int32_copy1M );
+    CASE( eytzinger_int32_destroy16 );
+    CASE( eytzinger_int32_destroy256 );
+    CASE( eytzinger_int32_destroy4k );
+    CASE( eytzinger_int32_destroy64k );
+    CASE( eytzinger_int32_destroy1M );
+    CASE( eytzinger_int32_find1 );
+    CASE( eytzinger_int32_find16 );
+    CASE( eytzinger_int32_find256 );
+    CASE( eytzinger_int32_find4k );
+    CASE( eytzinger_int32_find64k );
+    CASE( eytzinger_int32_find1M );
+    CASE( eytzinger_int32_insert16 );
+    CASE( eytzinger_int32_insert256 );
+    CASE( eytzinger_int32_insert4k );
+    CASE( eytzinger_int32_insert64k );
+    CASE( eytzinger_int32_insert1M );
+    CASE( eytzinger_int32_iterate16 );
+    CASE( eytzinger_int32_iterate256 );
+    CASE( eytzinger_int32_iterate4k );
+    CASE( eytzinger_int32_iterate64k );
+    CASE( eytzinger_int32_iterate1M );
+    CASE( eytzinger_int64_copy64k );
+    CASE( eytzinger_int64_destroy64k );
+    CASE( eytzinger_int64_find64k );
+    CASE( eytzinger_int64_insert4k );
+    CASE( eytzinger_int64_iterate64k );
+    CASE( eytzinger_float_copy64k );
+    CASE( eytzinger_float_destroy64k );
+    CASE( eytzinger_float_find64k );
+    CASE( eytzinger_float_insert4k );
+    CASE( eytzinger_float_iterate64k );
+    CASE( eytzinger_double_copy64k );
+    CASE( eytzinger_double_destroy64k );
+    CASE( eytzinger_double_find64k );
+    CASE( eytzinger_double_insert4k );
+    CASE( eytzinger_double_iterate64k );
+    CASE( eytzinger_string_copy64k );
+    CASE( eytzinger_string_destroy64k );
+    CASE( eytzinger_string_find64k );
+    CASE( eytzinger_string_insert4k );
+    CASE( eytzinger_string_iterate64k );
+
     CASE( file_append );
     CASE( file_close );
     CASE( file_create );
@@ -221,6 +607,193 @@ const char *ToCStr( Benchmark b )
     CASE( file_write_direct_1M );
     CASE( file_write_direct_16M );
 
+    CASE( linearset_int32_copy16 );
+    CASE( linearset_int32_copy256 );
+    CASE( linearset_int32_copy4k );
+    CASE( linearset_int32_copy64k );
+    CASE( linearset_int32_copy1M );
+    CASE( linearset_int32_destroy16 );
+    CASE( linearset_int32_destroy256 );
+    CASE( linearset_int32_destroy4k );
+    CASE( linearset_int32_destroy64k );
+    CASE( linearset_int32_destroy1M );
+    CASE( linearset_int32_find1 );
+    CASE( linearset_int32_find16 );
+    CASE( linearset_int32_find256 );
+    CASE( linearset_int32_find4k );
+    CASE( linearset_int32_find64k );
+    CASE( linearset_int32_find1M );
+    CASE( linearset_int32_insert16 );
+    CASE( linearset_int32_insert256 );
+    CASE( linearset_int32_insert4k );
+    CASE( linearset_int32_insert64k );
+    CASE( linearset_int32_insert1M );
+    CASE( linearset_int32_iterate16 );
+    CASE( linearset_int32_iterate256 );
+    CASE( linearset_int32_iterate4k );
+    CASE( linearset_int32_iterate64k );
+    CASE( linearset_int32_iterate1M );
+    CASE( linearset_int64_copy64k );
+    CASE( linearset_int64_destroy64k );
+    CASE( linearset_int64_find64k );
+    CASE( linearset_int64_insert4k );
+    CASE( linearset_int64_iterate64k );
+    CASE( linearset_float_copy64k );
+    CASE( linearset_float_destroy64k );
+    CASE( linearset_float_find64k );
+    CASE( linearset_float_insert4k );
+    CASE( linearset_float_iterate64k );
+    CASE( linearset_double_copy64k );
+    CASE( linearset_double_destroy64k );
+    CASE( linearset_double_find64k );
+    CASE( linearset_double_insert4k );
+    CASE( linearset_double_iterate64k );
+    CASE( linearset_string_copy64k );
+    CASE( linearset_string_destroy64k );
+    CASE( linearset_string_find64k );
+    CASE( linearset_string_insert4k );
+    CASE( linearset_string_iterate64k );
+    CASE( swissset_int32_copy16 );
+    CASE( swissset_int32_copy256 );
+    CASE( swissset_int32_copy4k );
+    CASE( swissset_int32_copy64k );
+    CASE( swissset_int32_copy1M );
+    CASE( swissset_int32_destroy16 );
+    CASE( swissset_int32_destroy256 );
+    CASE( swissset_int32_destroy4k );
+    CASE( swissset_int32_destroy64k );
+    CASE( swissset_int32_destroy1M );
+    CASE( swissset_int32_find1 );
+    CASE( swissset_int32_find16 );
+    CASE( swissset_int32_find256 );
+    CASE( swissset_int32_find4k );
+    CASE( swissset_int32_find64k );
+    CASE( swissset_int32_find1M );
+    CASE( swissset_int32_insert16 );
+    CASE( swissset_int32_insert256 );
+    CASE( swissset_int32_insert4k );
+    CASE( swissset_int32_insert64k );
+    CASE( swissset_int32_insert1M );
+    CASE( swissset_int32_iterate16 );
+    CASE( swissset_int32_iterate256 );
+    CASE( swissset_int32_iterate4k );
+    CASE( swissset_int32_iterate64k );
+    CASE( swissset_int32_iterate1M );
+    CASE( swissset_int64_copy64k );
+    CASE( swissset_int64_destroy64k );
+    CASE( swissset_int64_find64k );
+    CASE( swissset_int64_insert4k );
+    CASE( swissset_int64_iterate64k );
+    CASE( swissset_float_copy64k );
+    CASE( swissset_float_destroy64k );
+    CASE( swissset_float_find64k );
+    CASE( swissset_float_insert4k );
+    CASE( swissset_float_iterate64k );
+    CASE( swissset_double_copy64k );
+    CASE( swissset_double_destroy64k );
+    CASE( swissset_double_find64k );
+    CASE( swissset_double_insert4k );
+    CASE( swissset_double_iterate64k );
+    CASE( swissset_string_copy64k );
+    CASE( swissset_string_destroy64k );
+    CASE( swissset_string_find64k );
+    CASE( swissset_string_insert4k );
+    CASE( swissset_string_iterate64k );
+
+    CASE( flatmap_int32_copy16 );
+    CASE( flatmap_int32_copy256 );
+    CASE( flatmap_int32_copy4k );
+    CASE( flatmap_int32_copy64k );
+    CASE( flatmap_int32_copy1M );
+    CASE( flatmap_int32_destroy16 );
+    CASE( flatmap_int32_destroy256 );
+    CASE( flatmap_int32_destroy4k );
+    CASE( flatmap_int32_destroy64k );
+    CASE( flatmap_int32_destroy1M );
+    CASE( flatmap_int32_find1 );
+    CASE( flatmap_int32_find16 );
+    CASE( flatmap_int32_find256 );
+    CASE( flatmap_int32_find4k );
+    CASE( flatmap_int32_find64k );
+    CASE( flatmap_int32_find1M );
+    CASE( flatmap_int32_insert16 );
+    CASE( flatmap_int32_insert256 );
+    CASE( flatmap_int32_insert4k );
+    CASE( flatmap_int32_insert64k );
+    CASE( flatmap_int32_insert1M );
+    CASE( flatmap_int32_iterate16 );
+    CASE( flatmap_int32_iterate256 );
+    CASE( flatmap_int32_iterate4k );
+    CASE( flatmap_int32_iterate64k );
+    CASE( flatmap_int32_iterate1M );
+    CASE( flatmap_int64_copy64k );
+    CASE( flatmap_int64_destroy64k );
+    CASE( flatmap_int64_find64k );
+    CASE( flatmap_int64_insert4k );
+    CASE( flatmap_int64_iterate64k );
+    CASE( flatmap_float_copy64k );
+    CASE( flatmap_float_destroy64k );
+    CASE( flatmap_float_find64k );
+    CASE( flatmap_float_insert4k );
+    CASE( flatmap_float_iterate64k );
+    CASE( flatmap_double_copy64k );
+    CASE( flatmap_double_destroy64k );
+    CASE( flatmap_double_find64k );
+    CASE( flatmap_double_insert4k );
+    CASE( flatmap_double_iterate64k );
+    CASE( flatmap_string_copy64k );
+    CASE( flatmap_string_destroy64k );
+    CASE( flatmap_string_find64k );
+    CASE( flatmap_string_insert4k );
+    CASE( flatmap_string_iterate64k );
+
+    CASE( flatset_int32_copy16 );
+    CASE( flatset_int32_copy256 );
+    CASE( flatset_int32_copy4k );
+    CASE( flatset_int32_copy64k );
+    CASE( flatset_int32_copy1M );
+    CASE( flatset_int32_destroy16 );
+    CASE( flatset_int32_destroy256 );
+    CASE( flatset_int32_destroy4k );
+    CASE( flatset_int32_destroy64k );
+    CASE( flatset_int32_destroy1M );
+    CASE( flatset_int32_find1 );
+    CASE( flatset_int32_find16 );
+    CASE( flatset_int32_find256 );
+    CASE( flatset_int32_find4k );
+    CASE( flatset_int32_find64k );
+    CASE( flatset_int32_find1M );
+    CASE( flatset_int32_insert16 );
+    CASE( flatset_int32_insert256 );
+    CASE( flatset_int32_insert4k );
+    CASE( flatset_int32_insert64k );
+    CASE( flatset_int32_insert1M );
+    CASE( flatset_int32_iterate16 );
+    CASE( flatset_int32_iterate256 );
+    CASE( flatset_int32_iterate4k );
+    CASE( flatset_int32_iterate64k );
+    CASE( flatset_int32_iterate1M );
+    CASE( flatset_int64_copy64k );
+    CASE( flatset_int64_destroy64k );
+    CASE( flatset_int64_find64k );
+    CASE( flatset_int64_insert4k );
+    CASE( flatset_int64_iterate64k );
+    CASE( flatset_float_copy64k );
+    CASE( flatset_float_destroy64k );
+    CASE( flatset_float_find64k );
+    CASE( flatset_float_insert4k );
+    CASE( flatset_float_iterate64k );
+    CASE( flatset_double_copy64k );
+    CASE( flatset_double_destroy64k );
+    CASE( flatset_double_find64k );
+    CASE( flatset_double_insert4k );
+    CASE( flatset_double_iterate64k );
+    CASE( flatset_string_copy64k );
+    CASE( flatset_string_destroy64k );
+    CASE( flatset_string_find64k );
+    CASE( flatset_string_insert4k );
+    CASE( flatset_string_iterate64k );
+
     CASE( function_args0 );
     CASE( function_args1 );
     CASE( function_args2 );
@@ -261,6 +834,10 @@ const char *ToCStr( Benchmark b )
     CASE( memcpy_1M   );
     CASE( memcpy_16M  );
     CASE( memcpy_256M );
+    CASE( memcpy_256M_4k );
+    CASE( memcpy_256M_thp );
+    CASE( memcpy_256M_2M );
+    CASE( memcpy_256M_1G );
     CASE( strcmp_16   );
     CASE( strcmp_256  );
     CASE( strcmp_4k   );
@@ -293,12 +870,80 @@ const char *ToCStr( Benchmark b )
     CASE( memread_1M   );
     CASE( memread_16M  );
     CASE( memread_256M );
-    CASE( cache_false_sharing );
+    CASE( memread_256M_4k );
+    CASE( memread_256M_thp );
+    CASE( memread_256M_2M );
+    CASE( memread_256M_1G );
 
     CASE( mutex_create_destroy );
     CASE( mutex_lock_release );
     CASE( mutex_trylock );
 
+    CASE( mutex_contended_pthread_2t );
+    CASE( mutex_contended_pthread_4t );
+    CASE( mutex_contended_pthread_8t );
+    CASE( mutex_contended_pthread_16t );
+
+    CASE( mutex_contended_pthread_adaptive_2t );
+    CASE( mutex_contended_pthread_adaptive_4t );
+    CASE( mutex_contended_pthread_adaptive_8t );
+    CASE( mutex_contended_pthread_adaptive_16t );
+
+    CASE( mutex_contended_std_mutex_2t );
+    CASE( mutex_contended_std_mutex_4t );
+    CASE( mutex_contended_std_mutex_8t );
+    CASE( mutex_contended_std_mutex_16t );
+
+    CASE( mutex_contended_rwlock_read_2t );
+    CASE( mutex_contended_rwlock_read_4t );
+    CASE( mutex_contended_rwlock_read_8t );
+    CASE( mutex_contended_rwlock_read_16t );
+
+    CASE( mutex_contended_rwlock_write_2t );
+    CASE( mutex_contended_rwlock_write_4t );
+    CASE( mutex_contended_rwlock_write_8t );
+    CASE( mutex_contended_rwlock_write_16t );
+
+    CASE( mutex_contended_ttas_2t );
+    CASE( mutex_contended_ttas_4t );
+    CASE( mutex_contended_ttas_8t );
+    CASE( mutex_contended_ttas_16t );
+
+    CASE( mutex_contended_ticket_2t );
+    CASE( mutex_contended_ticket_4t );
+    CASE( mutex_contended_ticket_8t );
+    CASE( mutex_contended_ticket_16t );
+
+    CASE( mutex_contended_mcs_2t );
+    CASE( mutex_contended_mcs_4t );
+    CASE( mutex_contended_mcs_8t );
+    CASE( mutex_contended_mcs_16t );
+
+    CASE( mutex_contended_futex_2t );
+    CASE( mutex_contended_futex_4t );
+    CASE( mutex_contended_futex_8t );
+    CASE( mutex_contended_futex_16t );
+
+    CASE( network_accept );
+
+    CASE( network_rps_1c );
+    CASE( network_rps_2c );
+    CASE( network_rps_4c );
+    CASE( network_rps_8c );
+    CASE( network_rps_16c );
+    CASE( network_rps_32c );
+    CASE( network_rps_64c );
+
+    CASE( network_stream_256 );
+    CASE( network_stream_4k );
+    CASE( network_stream_64k );
+    CASE( network_stream_1M );
+
+    CASE( network_gather_1 );
+    CASE( network_gather_4 );
+    CASE( network_gather_16 );
+    CASE( network_gather_64 );
+
     CASE( ostream_string4 );
     CASE( ostream_string64 );
     CASE( ostream_cstr4 );
@@ -359,6 +1004,65 @@ const char *ToCStr( Benchmark b )
     CASE( fork_exec_waitpid );
     CASE( system );
 
+    CASE( queue_spsc_latency );
+    CASE( queue_spsc_roundtrip );
+    CASE( queue_spsc_throughput );
+    CASE( queue_spsc_batch_throughput );
+
+    CASE( queue_spsc_cached_latency );
+    CASE( queue_spsc_cached_roundtrip );
+    CASE( queue_spsc_cached_throughput );
+    CASE( queue_spsc_cached_batch_throughput );
+
+    CASE( queue_mpmc_latency );
+    CASE( queue_mpmc_roundtrip );
+    CASE( queue_mpmc_throughput_1p1c );
+    CASE( queue_mpmc_throughput_2p2c );
+    CASE( queue_mpmc_throughput_4p4c );
+    CASE( queue_mpmc_throughput_1p4c );
+    CASE( queue_mpmc_throughput_4p1c );
+    CASE( queue_mpmc_batch_throughput_1p1c );
+    CASE( queue_mpmc_batch_throughput_2p2c );
+    CASE( queue_mpmc_batch_throughput_4p4c );
+
+    CASE( queue_mpsc_latency );
+    CASE( queue_mpsc_roundtrip );
+    CASE( queue_mpsc_throughput_1p );
+    CASE( queue_mpsc_throughput_2p );
+    CASE( queue_mpsc_throughput_4p );
+    CASE( queue_mpsc_throughput_8p );
+    CASE( queue_mpsc_batch_throughput_1p );
+    CASE( queue_mpsc_batch_throughput_4p );
+
+    CASE( simd_sum_scalar );
+    CASE( simd_sum_sse42 );
+    CASE( simd_sum_avx2 );
+    CASE( simd_sum_avx512 );
+
+    CASE( simd_dot_scalar );
+    CASE( simd_dot_sse42 );
+    CASE( simd_dot_avx2 );
+    CASE( simd_dot_avx512 );
+
+    CASE( simd_find_scalar );
+    CASE( simd_find_sse42 );
+    CASE( simd_find_avx2 );
+    CASE( simd_find_avx512 );
+
+    CASE( simd_prefix_sum_scalar );
+    CASE( simd_prefix_sum_sse42 );
+    CASE( simd_prefix_sum_avx2 );
+    CASE( simd_prefix_sum_avx512 );
+
+    CASE( simd_mandelbrot_scalar );
+    CASE( simd_mandelbrot_sse42 );
+    CASE( simd_mandelbrot_avx2 );
+    CASE( simd_mandelbrot_avx512 );
+
+    CASE( simd_fma_scalar );
+    CASE( simd_fma_avx2 );
+    CASE( simd_fma_avx512 );
+
     CASE( deque_int32_copy16 );
     CASE( deque_int32_copy256 );
     CASE( deque_int32_copy4k );
@@ -405,6 +1109,22 @@ const char *ToCStr( Benchmark b )
     CASE( deque_string_find64k );
     CASE( deque_string_insert4k );
     CASE( deque_string_iterate64k );
+    CASE( deque_arena_int32_destroy64k );
+    CASE( deque_arena_int32_find64k );
+    CASE( deque_arena_int32_insert64k );
+    CASE( deque_arena_int32_iterate1M );
+    CASE( deque_mono_int32_destroy64k );
+    CASE( deque_mono_int32_find64k );
+    CASE( deque_mono_int32_insert64k );
+    CASE( deque_mono_int32_iterate1M );
+    CASE( deque_spool_int32_destroy64k );
+    CASE( deque_spool_int32_find64k );
+    CASE( deque_spool_int32_insert64k );
+    CASE( deque_spool_int32_iterate1M );
+    CASE( deque_upool_int32_destroy64k );
+    CASE( deque_upool_int32_find64k );
+    CASE( deque_upool_int32_insert64k );
+    CASE( deque_upool_int32_iterate1M );
 
     CASE( hash_int8 );
     CASE( hash_int16 );
@@ -418,6 +1138,59 @@ const char *ToCStr( Benchmark b )
     CASE( hash_string_4k );
     CASE( hash_string_64k );
 
+    CASE( hashmap_int32_p8_copy64k );
+    CASE( hashmap_int32_p8_destroy64k );
+    CASE( hashmap_int32_p8_erase64k );
+    CASE( hashmap_int32_p8_find64k );
+    CASE( hashmap_int32_p8_findmiss64k );
+    CASE( hashmap_int32_p8_insert64k );
+    CASE( hashmap_int32_p8_insertreserved64k );
+    CASE( hashmap_int32_p8_iterate64k );
+    CASE( hashmap_int32_p8_rehash64k );
+    CASE( hashmap_int32_p16_copy64k );
+    CASE( hashmap_int32_p16_destroy64k );
+    CASE( hashmap_int32_p16_find64k );
+    CASE( hashmap_int32_p16_insert64k );
+    CASE( hashmap_int32_p16_iterate64k );
+    CASE( hashmap_int32_p32_copy64k );
+    CASE( hashmap_int32_p32_destroy64k );
+    CASE( hashmap_int32_p32_find64k );
+    CASE( hashmap_int32_p32_insert64k );
+    CASE( hashmap_int32_p32_iterate64k );
+    CASE( hashmap_int32_p64_copy64k );
+    CASE( hashmap_int32_p64_destroy64k );
+    CASE( hashmap_int32_p64_erase64k );
+    CASE( hashmap_int32_p64_find64k );
+    CASE( hashmap_int32_p64_findmiss64k );
+    CASE( hashmap_int32_p64_insert64k );
+    CASE( hashmap_int32_p64_insertreserved64k );
+    CASE( hashmap_int32_p64_iterate64k );
+    CASE( hashmap_int32_p64_rehash64k );
+    CASE( hashmap_int32_p128_copy64k );
+    CASE( hashmap_int32_p128_destroy64k );
+    CASE( hashmap_int32_p128_find64k );
+    CASE( hashmap_int32_p128_insert64k );
+    CASE( hashmap_int32_p128_iterate64k );
+    CASE( hashmap_int32_p256_copy64k );
+    CASE( hashmap_int32_p256_destroy64k );
+    CASE( hashmap_int32_p256_erase64k );
+    CASE( hashmap_int32_p256_find64k );
+    CASE( hashmap_int32_p256_findmiss64k );
+    CASE( hashmap_int32_p256_insert64k );
+    CASE( hashmap_int32_p256_insertreserved64k );
+    CASE( hashmap_int32_p256_iterate64k );
+    CASE( hashmap_int32_p256_rehash64k );
+    CASE( hashmap_int64_p64_copy64k );
+    CASE( hashmap_int64_p64_destroy64k );
+    CASE( hashmap_int64_p64_find64k );
+    CASE( hashmap_int64_p64_insert4k );
+    CASE( hashmap_int64_p64_iterate64k );
+    CASE( hashmap_string_p64_copy64k );
+    CASE( hashmap_string_p64_destroy64k );
+    CASE( hashmap_string_p64_find64k );
+    CASE( hashmap_string_p64_insert4k );
+    CASE( hashmap_string_p64_iterate64k );
+
     CASE( hashset_int32_copy16 );
     CASE( hashset_int32_copy256 );
     CASE( hashset_int32_copy4k );
@@ -464,6 +1237,22 @@ const char *ToCStr( Benchmark b )
     CASE( hashset_string_find64k );
     CASE( hashset_string_insert4k );
     CASE( hashset_string_iterate64k );
+    CASE( hashset_arena_int32_destroy64k );
+    CASE( hashset_arena_int32_find64k );
+    CASE( hashset_arena_int32_insert64k );
+    CASE( hashset_arena_int32_iterate1M );
+    CASE( hashset_mono_int32_destroy64k );
+    CASE( hashset_mono_int32_find64k );
+    CASE( hashset_mono_int32_insert64k );
+    CASE( hashset_mono_int32_iterate1M );
+    CASE( hashset_spool_int32_destroy64k );
+    CASE( hashset_spool_int32_find64k );
+    CASE( hashset_spool_int32_insert64k );
+    CASE( hashset_spool_int32_iterate1M );
+    CASE( hashset_upool_int32_destroy64k );
+    CASE( hashset_upool_int32_find64k );
+    CASE( hashset_upool_int32_insert64k );
+    CASE( hashset_upool_int32_iterate1M );
 
     CASE( list_int32_copy16 );
     CASE( list_int32_copy256 );
@@ -511,6 +1300,69 @@ const char *ToCStr( Benchmark b )
     CASE( list_string_find64k );
     CASE( list_string_insert4k );
     CASE( list_string_iterate64k );
+    CASE( list_arena_int32_destroy64k );
+    CASE( list_arena_int32_find64k );
+    CASE( list_arena_int32_insert64k );
+    CASE( list_arena_int32_iterate1M );
+    CASE( list_mono_int32_destroy64k );
+    CASE( list_mono_int32_find64k );
+    CASE( list_mono_int32_insert64k );
+    CASE( list_mono_int32_iterate1M );
+    CASE( list_spool_int32_destroy64k );
+    CASE( list_spool_int32_find64k );
+    CASE( list_spool_int32_insert64k );
+    CASE( list_spool_int32_iterate1M );
+    CASE( list_upool_int32_destroy64k );
+    CASE( list_upool_int32_find64k );
+    CASE( list_upool_int32_insert64k );
+    CASE( list_upool_int32_iterate1M );
+
+    CASE( map_int32_p8_copy64k );
+    CASE( map_int32_p8_destroy64k );
+    CASE( map_int32_p8_erase64k );
+    CASE( map_int32_p8_find64k );
+    CASE( map_int32_p8_findmiss64k );
+    CASE( map_int32_p8_insert64k );
+    CASE( map_int32_p8_iterate64k );
+    CASE( map_int32_p16_copy64k );
+    CASE( map_int32_p16_destroy64k );
+    CASE( map_int32_p16_find64k );
+    CASE( map_int32_p16_insert64k );
+    CASE( map_int32_p16_iterate64k );
+    CASE( map_int32_p32_copy64k );
+    CASE( map_int32_p32_destroy64k );
+    CASE( map_int32_p32_find64k );
+    CASE( map_int32_p32_insert64k );
+    CASE( map_int32_p32_iterate64k );
+    CASE( map_int32_p64_copy64k );
+    CASE( map_int32_p64_destroy64k );
+    CASE( map_int32_p64_erase64k );
+    CASE( map_int32_p64_find64k );
+    CASE( map_int32_p64_findmiss64k );
+    CASE( map_int32_p64_insert64k );
+    CASE( map_int32_p64_iterate64k );
+    CASE( map_int32_p128_copy64k );
+    CASE( map_int32_p128_destroy64k );
+    CASE( map_int32_p128_find64k );
+    CASE( map_int32_p128_insert64k );
+    CASE( map_int32_p128_iterate64k );
+    CASE( map_int32_p256_copy64k );
+    CASE( map_int32_p256_destroy64k );
+    CASE( map_int32_p256_erase64k );
+    CASE( map_int32_p256_find64k );
+    CASE( map_int32_p256_findmiss64k );
+    CASE( map_int32_p256_insert64k );
+    CASE( map_int32_p256_iterate64k );
+    CASE( map_int64_p64_copy64k );
+    CASE( map_int64_p64_destroy64k );
+    CASE( map_int64_p64_find64k );
+    CASE( map_int64_p64_insert4k );
+    CASE( map_int64_p64_iterate64k );
+    CASE( map_string_p64_copy64k );
+    CASE( map_string_p64_destroy64k );
+    CASE( map_string_p64_find64k );
+    CASE( map_string_p64_insert4k );
+    CASE( map_string_p64_iterate64k );
 
     CASE( set_int32_copy16 );
     CASE( set_int32_copy256 );
@@ -558,6 +1410,22 @@ const char *ToCStr( Benchmark b )
     CASE( set_string_find64k );
     CASE( set_string_insert4k );
     CASE( set_string_iterate64k );
+    CASE( set_arena_int32_destroy64k );
+    CASE( set_arena_int32_find64k );
+    CASE( set_arena_int32_insert64k );
+    CASE( set_arena_int32_iterate1M );
+    CASE( set_mono_int32_destroy64k );
+    CASE( set_mono_int32_find64k );
+    CASE( set_mono_int32_insert64k );
+    CASE( set_mono_int32_iterate1M );
+    CASE( set_spool_int32_destroy64k );
+    CASE( set_spool_int32_find64k );
+    CASE( set_spool_int32_insert64k );
+    CASE( set_spool_int32_iterate1M );
+    CASE( set_upool_int32_destroy64k );
+    CASE( set_upool_int32_find64k );
+    CASE( set_upool_int32_insert64k );
+    CASE( set_upool_int32_iterate1M );
 
     CASE( vec_int32_copy4k );
     CASE( vec_int32_copy64k );
@@ -600,6 +1468,67 @@ const char *ToCStr( Benchmark b )
     CASE( vec_string_find64k );
     CASE( vec_string_insert4k );
     CASE( vec_string_iterate64k );
+    CASE( vec_arena_int32_destroy64k );
+    CASE( vec_arena_int32_find64k );
+    CASE( vec_arena_int32_insert64k );
+    CASE( vec_arena_int32_iterate1M );
+    CASE( vec_mono_int32_destroy64k );
+    CASE( vec_mono_int32_find64k );
+    CASE( vec_mono_int32_insert64k );
+    CASE( vec_mono_int32_iterate1M );
+    CASE( vec_spool_int32_destroy64k );
+    CASE( vec_spool_int32_find64k );
+    CASE( vec_spool_int32_insert64k );
+    CASE( vec_spool_int32_iterate1M );
+    CASE( vec_upool_int32_destroy64k );
+    CASE( vec_upool_int32_find64k );
+    CASE( vec_upool_int32_insert64k );
+    CASE( vec_upool_int32_iterate1M );
+
+    CASE( socket_open_close_tcp );
+    CASE( socket_open_close_udp );
+    CASE( socket_open_close_unix );
+
+    CASE( socket_connect_accept_tcp );
+    CASE( socket_connect_accept_unix );
+
+    CASE( socket_send_recv_tcp_64 );
+    CASE( socket_send_recv_tcp_256 );
+    CASE( socket_send_recv_tcp_1k );
+    CASE( socket_send_recv_tcp_4k );
+    CASE( socket_send_recv_tcp_16k );
+    CASE( socket_send_recv_tcp_64k );
+
+    CASE( socket_send_recv_unix_64 );
+    CASE( socket_send_recv_unix_256 );
+    CASE( socket_send_recv_unix_1k );
+    CASE( socket_send_recv_unix_4k );
+    CASE( socket_send_recv_unix_16k );
+    CASE( socket_send_recv_unix_64k );
+
+    CASE( socket_send_recv_udp_64 );
+    CASE( socket_send_recv_udp_1k );
+    CASE( socket_send_recv_udp_16k );
+    CASE( socket_send_recv_unix_dgram_64 );
+    CASE( socket_send_recv_unix_dgram_1k );
+    CASE( socket_send_recv_unix_dgram_16k );
+
+    CASE( socket_pingpong_tcp_256 );
+    CASE( socket_pingpong_tcp_1k );
+    CASE( socket_pingpong_tcp_4k );
+    CASE( socket_pingpong_tcp_16k );
+    CASE( socket_pingpong_tcp_64k );
+    CASE( socket_pingpong_tcp_256_busy_poll );
+
+    CASE( socket_pingpong_unix_256 );
+    CASE( socket_pingpong_unix_1k );
+    CASE( socket_pingpong_unix_4k );
+    CASE( socket_pingpong_unix_16k );
+    CASE( socket_pingpong_unix_64k );
+
+    CASE( socket_mmsg_udp_1 );
+    CASE( socket_mmsg_udp_8 );
+    CASE( socket_mmsg_udp_32 );
 
     CASE( string_from_smallint );
     CASE( string_from_maxint );
@@ -621,9 +1550,248 @@ const char *ToCStr( Benchmark b )
     CASE( string_to_bigdouble_os );
     CASE( string_to_bigdouble_ts );
 
+    CASE( syscall_getpid );
+    CASE( syscall_getpid_seccomp );
+    CASE( syscall_getpid_seccomp_args );
+    CASE( syscall_gettid );
+
+    CASE( syscall_clock_gettime_realtime_vdso );
+    CASE( syscall_clock_gettime_realtime_syscall );
+    CASE( syscall_clock_gettime_realtime_coarse_vdso );
+    CASE( syscall_clock_gettime_realtime_coarse_syscall );
+    CASE( syscall_clock_gettime_monotonic_vdso );
+    CASE( syscall_clock_gettime_monotonic_syscall );
+    CASE( syscall_clock_gettime_monotonic_coarse_vdso );
+    CASE( syscall_clock_gettime_monotonic_coarse_syscall );
+    CASE( syscall_clock_gettime_monotonic_raw_vdso );
+    CASE( syscall_clock_gettime_monotonic_raw_syscall );
+    CASE( syscall_clock_gettime_boottime_vdso );
+    CASE( syscall_clock_gettime_boottime_syscall );
+    CASE( syscall_clock_gettime_process_cputime_vdso );
+    CASE( syscall_clock_gettime_process_cputime_syscall );
+    CASE( syscall_clock_gettime_thread_cputime_vdso );
+    CASE( syscall_clock_gettime_thread_cputime_syscall );
+
+    CASE( syscall_getcpu_vdso );
+    CASE( syscall_getcpu_syscall );
+    CASE( syscall_getrusage );
+    CASE( syscall_sched_yield );
+    CASE( syscall_ioctl_badfd );
+
     CASE( thread_create_destroy );
     CASE( thread_pingpong );
 
+    CASE( thread_task_spawn_steal );
+    CASE( thread_task_spawn_shared );
+    CASE( thread_task_spawn_async );
+
+    CASE( thread_task_tree_steal_4w );
+    CASE( thread_task_tree_shared_4w );
+    CASE( thread_task_tree_async );
+
+    CASE( thread_task_handoff_steal );
+    CASE( thread_task_handoff_shared );
+
+    CASE( thread_task_tiny_steal_1w );
+    CASE( thread_task_tiny_steal_2w );
+    CASE( thread_task_tiny_steal_4w );
+    CASE( thread_task_tiny_steal_8w );
+
+    CASE( thread_task_tiny_shared_1w );
+    CASE( thread_task_tiny_shared_2w );
+    CASE( thread_task_tiny_shared_4w );
+    CASE( thread_task_tiny_shared_8w );
+
+    CASE( thread_task_tiny_async );
+
+    CASE( thread_task_medium_steal_1w );
+    CASE( thread_task_medium_steal_2w );
+    CASE( thread_task_medium_steal_4w );
+    CASE( thread_task_medium_steal_8w );
+
+    CASE( thread_task_medium_shared_1w );
+    CASE( thread_task_medium_shared_2w );
+    CASE( thread_task_medium_shared_4w );
+    CASE( thread_task_medium_shared_8w );
+
+    CASE( thread_task_medium_async );
+
+    CASE( timing_nanosleep_1us );
+    CASE( timing_nanosleep_10us );
+    CASE( timing_nanosleep_100us );
+    CASE( timing_nanosleep_1ms );
+    CASE( timing_nanosleep_10ms );
+
+    CASE( timing_nanosleep_1us_fifo );
+    CASE( timing_nanosleep_10us_fifo );
+    CASE( timing_nanosleep_100us_fifo );
+    CASE( timing_nanosleep_1ms_fifo );
+    CASE( timing_nanosleep_10ms_fifo );
+
+    CASE( timing_abstime_1us );
+    CASE( timing_abstime_10us );
+    CASE( timing_abstime_100us );
+    CASE( timing_abstime_1ms );
+    CASE( timing_abstime_10ms );
+
+    CASE( timing_abstime_1us_fifo );
+    CASE( timing_abstime_10us_fifo );
+    CASE( timing_abstime_100us_fifo );
+    CASE( timing_abstime_1ms_fifo );
+    CASE( timing_abstime_10ms_fifo );
+
+    CASE( timing_timerfd_1us );
+    CASE( timing_timerfd_10us );
+    CASE( timing_timerfd_100us );
+    CASE( timing_timerfd_1ms );
+    CASE( timing_timerfd_10ms );
+
+    CASE( timing_timerfd_1us_fifo );
+    CASE( timing_timerfd_10us_fifo );
+    CASE( timing_timerfd_100us_fifo );
+    CASE( timing_timerfd_1ms_fifo );
+    CASE( timing_timerfd_10ms_fifo );
+
+    CASE( timing_epoll_1us );
+    CASE( timing_epoll_10us );
+    CASE( timing_epoll_100us );
+    CASE( timing_epoll_1ms );
+    CASE( timing_epoll_10ms );
+
+    CASE( timing_epoll_1us_fifo );
+    CASE( timing_epoll_10us_fifo );
+    CASE( timing_epoll_100us_fifo );
+    CASE( timing_epoll_1ms_fifo );
+    CASE( timing_epoll_10ms_fifo );
+
+    CASE( timing_asio_1us );
+    CASE( timing_asio_10us );
+    CASE( timing_asio_100us );
+    CASE( timing_asio_1ms );
+    CASE( timing_asio_10ms );
+
+    CASE( timing_asio_1us_fifo );
+    CASE( timing_asio_10us_fifo );
+    CASE( timing_asio_100us_fifo );
+    CASE( timing_asio_1ms_fifo );
+    CASE( timing_asio_10ms_fifo );
+
+    CASE( uring_buffered_randread_qd1 );
+    CASE( uring_buffered_randread_qd4 );
+    CASE( uring_buffered_randread_qd16 );
+    CASE( uring_buffered_randread_qd64 );
+    CASE( uring_buffered_randread_qd256 );
+
+    CASE( uring_buffered_seqread_qd1 );
+    CASE( uring_buffered_seqread_qd4 );
+    CASE( uring_buffered_seqread_qd16 );
+    CASE( uring_buffered_seqread_qd64 );
+    CASE( uring_buffered_seqread_qd256 );
+
+    CASE( uring_buffered_randwrite_qd1 );
+    CASE( uring_buffered_randwrite_qd4 );
+    CASE( uring_buffered_randwrite_qd16 );
+    CASE( uring_buffered_randwrite_qd64 );
+    CASE( uring_buffered_randwrite_qd256 );
+
+    CASE( uring_buffered_seqwrite_qd1 );
+    CASE( uring_buffered_seqwrite_qd4 );
+    CASE( uring_buffered_seqwrite_qd16 );
+    CASE( uring_buffered_seqwrite_qd64 );
+    CASE( uring_buffered_seqwrite_qd256 );
+
+    CASE( uring_buffered_randread_fixed_qd16 );
+    CASE( uring_buffered_randwrite_fixed_qd16 );
+    CASE( uring_buffered_randread_sqpoll_qd16 );
+    CASE( uring_buffered_randwrite_sqpoll_qd16 );
+
+    CASE( uring_buffered_seqwrite_fsync_qd1 );
+    CASE( uring_buffered_seqwrite_fsync_qd16 );
+
+    CASE( uring_direct_randread_qd1 );
+    CASE( uring_direct_randread_qd4 );
+    CASE( uring_direct_randread_qd16 );
+    CASE( uring_direct_randread_qd64 );
+    CASE( uring_direct_randread_qd256 );
+
+    CASE( uring_direct_seqread_qd1 );
+    CASE( uring_direct_seqread_qd4 );
+    CASE( uring_direct_seqread_qd16 );
+    CASE( uring_direct_seqread_qd64 );
+    CASE( uring_direct_seqread_qd256 );
+
+    CASE( uring_direct_randwrite_qd1 );
+    CASE( uring_direct_randwrite_qd4 );
+    CASE( uring_direct_randwrite_qd16 );
+    CASE( uring_direct_randwrite_qd64 );
+    CASE( uring_direct_randwrite_qd256 );
+
+    CASE( uring_direct_seqwrite_qd1 );
+    CASE( uring_direct_seqwrite_qd4 );
+    CASE( uring_direct_seqwrite_qd16 );
+    CASE( uring_direct_seqwrite_qd64 );
+    CASE( uring_direct_seqwrite_qd256 );
+
+    CASE( uring_direct_randread_fixed_qd16 );
+    CASE( uring_direct_randwrite_fixed_qd16 );
+    CASE( uring_direct_randread_sqpoll_qd16 );
+    CASE( uring_direct_randwrite_sqpoll_qd16 );
+
+    CASE( uring_direct_seqwrite_fsync_qd1 );
+    CASE( uring_direct_seqwrite_fsync_qd16 );
+
+    CASE( vm_fault_anon_4k );
+    CASE( vm_fault_anon_thp );
+    CASE( vm_fault_file_4k );
+
+    CASE( vm_mmap_populate_1M );
+    CASE( vm_mmap_populate_16M );
+    CASE( vm_mmap_touch_1M );
+    CASE( vm_mmap_touch_16M );
+
+    CASE( vm_munmap_1t );
+    CASE( vm_munmap_2t );
+    CASE( vm_munmap_4t );
+    CASE( vm_munmap_8t );
+    CASE( vm_munmap_16t );
+
+    CASE( vm_madvise_dontneed_1M );
+    CASE( vm_madvise_free_1M );
+    CASE( vm_mprotect_4k );
+    CASE( vm_mprotect_1M );
+
+    CASE( vm_mremap_grow_1M );
+    CASE( vm_mremap_grow_64M );
+    CASE( vm_realloc_grow_1M );
+    CASE( vm_realloc_grow_64M );
+    CASE( vm_copy_grow_1M );
+    CASE( vm_copy_grow_64M );
+
+    CASE( wakeup_futex_wake_no_waiters );
+    CASE( wakeup_futex_wait_mismatch );
+
+    CASE( wakeup_futex_pingpong );
+    CASE( wakeup_eventfd_pingpong );
+
+    CASE( wakeup_futex_latency );
+    CASE( wakeup_eventfd_latency );
+
+    CASE( wakeup_park_spin0 );
+    CASE( wakeup_park_spin100 );
+    CASE( wakeup_park_spin1k );
+    CASE( wakeup_park_spin10k );
+
+    CASE( wakeup_park_spin0_reply10us );
+    CASE( wakeup_park_spin100_reply10us );
+    CASE( wakeup_park_spin1k_reply10us );
+    CASE( wakeup_park_spin10k_reply10us );
+
+    CASE( wakeup_futex_herd_1 );
+    CASE( wakeup_futex_herd_2 );
+    CASE( wakeup_futex_herd_4 );
+    CASE( wakeup_futex_herd_8 );
+    CASE( wakeup_futex_herd_16 );
+
     CASE( fibonacci_u64 );
     CASE( mandelbrot_256 );
     CASE( trigonometry );
@@ -697,6 +1865,169 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::atomic_cmp_exchg_strong_xpctd,
                     Benchmark::atomic_cmp_exchg_strong_other,
                     Benchmark::atomic_pingpong,
+                    Benchmark::atomic_fetch_add_shared_1t,
+                    Benchmark::atomic_fetch_add_shared_2t,
+                    Benchmark::atomic_fetch_add_shared_4t,
+                    Benchmark::atomic_fetch_add_shared_8t,
+                    Benchmark::atomic_fetch_add_shared_16t,
+                    Benchmark::atomic_fetch_add_padded_1t,
+                    Benchmark::atomic_fetch_add_padded_2t,
+                    Benchmark::atomic_fetch_add_padded_4t,
+                    Benchmark::atomic_fetch_add_padded_8t,
+                    Benchmark::atomic_fetch_add_padded_16t,
+                    Benchmark::atomic_fetch_add_sharded_1t,
+                    Benchmark::atomic_fetch_add_sharded_2t,
+                    Benchmark::atomic_fetch_add_sharded_4t,
+                    Benchmark::atomic_fetch_add_sharded_8t,
+                    Benchmark::atomic_fetch_add_sharded_16t,
+                    Benchmark::atomic_cas_shared_1t,
+                    Benchmark::atomic_cas_shared_2t,
+                    Benchmark::atomic_cas_shared_4t,
+                    Benchmark::atomic_cas_shared_8t,
+                    Benchmark::atomic_cas_shared_16t,
+                    Benchmark::atomic_cas_padded_1t,
+                    Benchmark::atomic_cas_padded_2t,
+                    Benchmark::atomic_cas_padded_4t,
+                    Benchmark::atomic_cas_padded_8t,
+                    Benchmark::atomic_cas_padded_16t,
+                    Benchmark::atomic_exchange_shared_1t,
+                    Benchmark::atomic_exchange_shared_2t,
+                    Benchmark::atomic_exchange_shared_4t,
+                    Benchmark::atomic_exchange_shared_8t,
+                    Benchmark::atomic_exchange_shared_16t,
+                    Benchmark::atomic_exchange_padded_1t,
+                    Benchmark::atomic_exchange_padded_2t,
+                    Benchmark::atomic_exchange_padded_4t,
+                    Benchmark::atomic_exchange_padded_8t,
+                    Benchmark::atomic_exchange_padded_16t,
+                    Benchmark::atomic_fetch_add_shared_relaxed_1t,
+                    Benchmark::atomic_fetch_add_shared_relaxed_2t,
+                    Benchmark::atomic_fetch_add_shared_relaxed_4t,
+                    Benchmark::atomic_fetch_add_shared_relaxed_8t,
+                    Benchmark::atomic_fetch_add_shared_relaxed_16t,
+                    Benchmark::atomic_fetch_add_shared_acq_rel_1t,
+                    Benchmark::atomic_fetch_add_shared_acq_rel_2t,
+                    Benchmark::atomic_fetch_add_shared_acq_rel_4t,
+                    Benchmark::atomic_fetch_add_shared_acq_rel_8t,
+                    Benchmark::atomic_fetch_add_shared_acq_rel_16t,
+                    Benchmark::atomic_store_relaxed,
+                    Benchmark::atomic_store_release,
+                    Benchmark::atomic_store_seq_cst,
+                    Benchmark::atomic_fence_acquire,
+                    Benchmark::atomic_fence_release,
+                    Benchmark::atomic_fence_acq_rel,
+                    Benchmark::atomic_fence_seq_cst,
+                },
+            },
+            {
+                Category::bandwidth,
+                {
+                    Benchmark::stream_copy_1t,
+                    Benchmark::stream_copy_2t,
+                    Benchmark::stream_copy_4t,
+                    Benchmark::stream_copy_8t,
+                    Benchmark::stream_copy_16t,
+                    Benchmark::stream_copy_32t,
+                    Benchmark::stream_copy_64t,
+                    Benchmark::stream_scale_1t,
+                    Benchmark::stream_scale_2t,
+                    Benchmark::stream_scale_4t,
+                    Benchmark::stream_scale_8t,
+                    Benchmark::stream_scale_16t,
+                    Benchmark::stream_scale_32t,
+                    Benchmark::stream_scale_64t,
+                    Benchmark::stream_add_1t,
+                    Benchmark::stream_add_2t,
+                    Benchmark::stream_add_4t,
+                    Benchmark::stream_add_8t,
+                    Benchmark::stream_add_16t,
+                    Benchmark::stream_add_32t,
+                    Benchmark::stream_add_64t,
+                    Benchmark::stream_triad_1t,
+                    Benchmark::stream_triad_2t,
+                    Benchmark::stream_triad_4t,
+                    Benchmark::stream_triad_8t,
+                    Benchmark::stream_triad_16t,
+                    Benchmark::stream_triad_32t,
+                    Benchmark::stream_triad_64t,
+                },
+            },
+            {
+                Category::cache,
+                {
+                    Benchmark::cache_chase_random_4k,
+                    Benchmark::cache_chase_random_8k,
+                    Benchmark::cache_chase_random_16k,
+                    Benchmark::cache_chase_random_32k,
+                    Benchmark::cache_chase_random_64k,
+                    Benchmark::cache_chase_random_128k,
+                    Benchmark::cache_chase_random_256k,
+                    Benchmark::cache_chase_random_512k,
+                    Benchmark::cache_chase_random_1M,
+                    Benchmark::cache_chase_random_2M,
+                    Benchmark::cache_chase_random_4M,
+                    Benchmark::cache_chase_random_8M,
+                    Benchmark::cache_chase_random_16M,
+                    Benchmark::cache_chase_random_32M,
+                    Benchmark::cache_chase_random_64M,
+                    Benchmark::cache_chase_random_128M,
+                    Benchmark::cache_chase_random_256M,
+                    Benchmark::cache_chase_random_512M,
+                    Benchmark::cache_chase_random_1G,
+                    Benchmark::cache_chase_seq_64k,
+                    Benchmark::cache_chase_seq_1M,
+                    Benchmark::cache_chase_seq_16M,
+                    Benchmark::cache_chase_seq_256M,
+                    Benchmark::cache_chase_stride_64k,
+                    Benchmark::cache_chase_stride_1M,
+                    Benchmark::cache_chase_stride_16M,
+                    Benchmark::cache_chase_stride_256M,
+                    Benchmark::cache_page_chase_4M_4k,
+                    Benchmark::cache_page_chase_4M_thp,
+                    Benchmark::cache_page_chase_4M_2M,
+                    Benchmark::cache_page_chase_64M_4k,
+                    Benchmark::cache_page_chase_64M_thp,
+                    Benchmark::cache_page_chase_64M_2M,
+                    Benchmark::cache_page_chase_1G_4k,
+                    Benchmark::cache_page_chase_1G_thp,
+                    Benchmark::cache_page_chase_1G_2M,
+                    Benchmark::cache_page_chase_1G_1G,
+                    Benchmark::cache_sharing_0b_write_2t,
+                    Benchmark::cache_sharing_0b_write_4t,
+                    Benchmark::cache_sharing_0b_write_8t,
+                    Benchmark::cache_sharing_0b_mixed_2t,
+                    Benchmark::cache_sharing_0b_mixed_4t,
+                    Benchmark::cache_sharing_0b_mixed_8t,
+                    Benchmark::cache_sharing_0b_readers_2t,
+                    Benchmark::cache_sharing_0b_readers_4t,
+                    Benchmark::cache_sharing_0b_readers_8t,
+                    Benchmark::cache_sharing_8b_write_2t,
+                    Benchmark::cache_sharing_8b_write_4t,
+                    Benchmark::cache_sharing_8b_write_8t,
+                    Benchmark::cache_sharing_8b_mixed_2t,
+                    Benchmark::cache_sharing_8b_mixed_4t,
+                    Benchmark::cache_sharing_8b_mixed_8t,
+                    Benchmark::cache_sharing_8b_readers_2t,
+                    Benchmark::cache_sharing_8b_readers_4t,
+                    Benchmark::cache_sharing_8b_readers_8t,
+                    Benchmark::cache_sharing_64b_write_2t,
+                    Benchmark::cache_sharing_64b_write_4t,
+                    Benchmark::cache_sharing_64b_write_8t,
+                    Benchmark::cache_sharing_64b_mixed_2t,
+                    Benchmark::cache_sharing_64b_mixed_4t,
+                    Benchmark::cache_sharing_64b_mixed_8t,
+                    Benchmark::cache_sharing_64b_readers_2t,
+                    Benchmark::cache_sharing_64b_readers_4t,
+                    Benchmark::cache_sharing_64b_readers_8t,
+                    Benchmark::cache_sharing_128b_write_2t,
+                    Benchmark::cache_sharing_128b_write_4t,
+                    Benchmark::cache_sharing_128b_write_8t,
+                    Benchmark::cache_sharing_128b_mixed_2t,
+                    Benchmark::cache_sharing_128b_mixed_4t,
+                    Benchmark::cache_sharing_128b_mixed_8t,
+                    Benchmark::cache_sharing_128b_readers_2t,
+                    Benchmark::cache_sharing_128b_readers_4t,
+                    Benchmark::cache_sharing_128b_readers_8t,
                 },
             },
             {
@@ -708,6 +2039,143 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::condvar_signal_watched,
                 },
             },
+            {
+                Category::copy,
+                {
+                    Benchmark::copy_memcpy_libc_64,
+                    Benchmark::copy_memcpy_libc_256,
+                    Benchmark::copy_memcpy_libc_1k,
+                    Benchmark::copy_memcpy_libc_4k,
+                    Benchmark::copy_memcpy_libc_16k,
+                    Benchmark::copy_memcpy_libc_64k,
+                    Benchmark::copy_memcpy_libc_256k,
+                    Benchmark::copy_memcpy_libc_1M,
+                    Benchmark::copy_memcpy_libc_4M,
+                    Benchmark::copy_memcpy_libc_16M,
+                    Benchmark::copy_memcpy_libc_64M,
+                    Benchmark::copy_memcpy_rep_64,
+                    Benchmark::copy_memcpy_rep_256,
+                    Benchmark::copy_memcpy_rep_1k,
+                    Benchmark::copy_memcpy_rep_4k,
+                    Benchmark::copy_memcpy_rep_16k,
+                    Benchmark::copy_memcpy_rep_64k,
+                    Benchmark::copy_memcpy_rep_256k,
+                    Benchmark::copy_memcpy_rep_1M,
+                    Benchmark::copy_memcpy_rep_4M,
+                    Benchmark::copy_memcpy_rep_16M,
+                    Benchmark::copy_memcpy_rep_64M,
+                    Benchmark::copy_memcpy_avx2_64,
+                    Benchmark::copy_memcpy_avx2_256,
+                    Benchmark::copy_memcpy_avx2_1k,
+                    Benchmark::copy_memcpy_avx2_4k,
+                    Benchmark::copy_memcpy_avx2_16k,
+                    Benchmark::copy_memcpy_avx2_64k,
+                    Benchmark::copy_memcpy_avx2_256k,
+                    Benchmark::copy_memcpy_avx2_1M,
+                    Benchmark::copy_memcpy_avx2_4M,
+                    Benchmark::copy_memcpy_avx2_16M,
+                    Benchmark::copy_memcpy_avx2_64M,
+                    Benchmark::copy_memcpy_nt_64,
+                    Benchmark::copy_memcpy_nt_256,
+                    Benchmark::copy_memcpy_nt_1k,
+                    Benchmark::copy_memcpy_nt_4k,
+                    Benchmark::copy_memcpy_nt_16k,
+                    Benchmark::copy_memcpy_nt_64k,
+                    Benchmark::copy_memcpy_nt_256k,
+                    Benchmark::copy_memcpy_nt_1M,
+                    Benchmark::copy_memcpy_nt_4M,
+                    Benchmark::copy_memcpy_nt_16M,
+                    Benchmark::copy_memcpy_nt_64M,
+                    Benchmark::copy_memset_libc_64,
+                    Benchmark::copy_memset_libc_256,
+                    Benchmark::copy_memset_libc_1k,
+                    Benchmark::copy_memset_libc_4k,
+                    Benchmark::copy_memset_libc_16k,
+                    Benchmark::copy_memset_libc_64k,
+                    Benchmark::copy_memset_libc_256k,
+                    Benchmark::copy_memset_libc_1M,
+                    Benchmark::copy_memset_libc_4M,
+                    Benchmark::copy_memset_libc_16M,
+                    Benchmark::copy_memset_libc_64M,
+                    Benchmark::copy_memset_rep_64,
+                    Benchmark::copy_memset_rep_256,
+                    Benchmark::copy_memset_rep_1k,
+                    Benchmark::copy_memset_rep_4k,
+                    Benchmark::copy_memset_rep_16k,
+                    Benchmark::copy_memset_rep_64k,
+                    Benchmark::copy_memset_rep_256k,
+                    Benchmark::copy_memset_rep_1M,
+                    Benchmark::copy_memset_rep_4M,
+                    Benchmark::copy_memset_rep_16M,
+                    Benchmark::copy_memset_rep_64M,
+                    Benchmark::copy_memset_avx2_64,
+                    Benchmark::copy_memset_avx2_256,
+                    Benchmark::copy_memset_avx2_1k,
+                    Benchmark::copy_memset_avx2_4k,
+                    Benchmark::copy_memset_avx2_16k,
+                    Benchmark::copy_memset_avx2_64k,
+                    Benchmark::copy_memset_avx2_256k,
+                    Benchmark::copy_memset_avx2_1M,
+                    Benchmark::copy_memset_avx2_4M,
+                    Benchmark::copy_memset_avx2_16M,
+                    Benchmark::copy_memset_avx2_64M,
+                    Benchmark::copy_memset_nt_64,
+                    Benchmark::copy_memset_nt_256,
+                    Benchmark::copy_memset_nt_1k,
+                    Benchmark::copy_memset_nt_4k,
+                    Benchmark::copy_memset_nt_16k,
+                    Benchmark::copy_memset_nt_64k,
+                    Benchmark::copy_memset_nt_256k,
+                    Benchmark::copy_memset_nt_1M,
+                    Benchmark::copy_memset_nt_4M,
+                    Benchmark::copy_memset_nt_16M,
+                    Benchmark::copy_memset_nt_64M,
+                    Benchmark::copy_memcpy_libc_4k_src1,
+                    Benchmark::copy_memcpy_libc_4k_src4,
+                    Benchmark::copy_memcpy_libc_4k_src8,
+                    Benchmark::copy_memcpy_libc_4k_src16,
+                    Benchmark::copy_memcpy_libc_4k_src32,
+                    Benchmark::copy_memcpy_libc_4k_src63,
+                    Benchmark::copy_memcpy_libc_4k_dst1,
+                    Benchmark::copy_memcpy_libc_4k_dst4,
+                    Benchmark::copy_memcpy_libc_4k_dst8,
+                    Benchmark::copy_memcpy_libc_4k_dst16,
+                    Benchmark::copy_memcpy_libc_4k_dst32,
+                    Benchmark::copy_memcpy_libc_4k_dst63,
+                    Benchmark::copy_memcpy_rep_4k_src1,
+                    Benchmark::copy_memcpy_rep_4k_src4,
+                    Benchmark::copy_memcpy_rep_4k_src8,
+                    Benchmark::copy_memcpy_rep_4k_src16,
+                    Benchmark::copy_memcpy_rep_4k_src32,
+                    Benchmark::copy_memcpy_rep_4k_src63,
+                    Benchmark::copy_memcpy_rep_4k_dst1,
+                    Benchmark::copy_memcpy_rep_4k_dst4,
+                    Benchmark::copy_memcpy_rep_4k_dst8,
+                    Benchmark::copy_memcpy_rep_4k_dst16,
+                    Benchmark::copy_memcpy_rep_4k_dst32,
+                    Benchmark::copy_memcpy_rep_4k_dst63,
+                    Benchmark::copy_memcpy_avx2_4k_src1,
+                    Benchmark::copy_memcpy_avx2_4k_src4,
+                    Benchmark::copy_memcpy_avx2_4k_src8,
+                    Benchmark::copy_memcpy_avx2_4k_src16,
+                    Benchmark::copy_memcpy_avx2_4k_src32,
+                    Benchmark::copy_memcpy_avx2_4k_src63,
+                    Benchmark::copy_memcpy_avx2_4k_dst1,
+                    Benchmark::copy_memcpy_avx2_4k_dst4,
+                    Benchmark::copy_memcpy_avx2_4k_dst8,
+                    Benchmark::copy_memcpy_avx2_4k_dst16,
+                    Benchmark::copy_memcpy_avx2_4k_dst32,
+                    Benchmark::copy_memcpy_avx2_4k_dst63,
+                    Benchmark::copy_memmove_up_256,
+                    Benchmark::copy_memmove_up_4k,
+                    Benchmark::copy_memmove_up_64k,
+                    Benchmark::copy_memmove_up_1M,
+                    Benchmark::copy_memmove_down_256,
+                    Benchmark::copy_memmove_down_4k,
+                    Benchmark::copy_memmove_down_64k,
+                    Benchmark::copy_memmove_down_1M,
+                },
+            },
             {
                 Category::directory,
                 {
@@ -736,6 +2204,57 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::exception_try,
                 },
             },
+            {
+                Category::eytzinger,
+                {
+                    Benchmark::eytzinger_int32_copy16,
+                    Benchmark::eytzinger_int32_copy256,
+                    Benchmark::eytzinger_int32_copy4k,
+                    Benchmark::eytzinger_int32_copy64k,
+//                    Benchmark::eytzinger_int32_copy1M,      <- Test setup takes too long.
+                    Benchmark::eytzinger_int32_destroy16,
+                    Benchmark::eytzinger_int32_destroy256,
+                    Benchmark::eytzinger_int32_destroy4k,
+                    Benchmark::eytzinger_int32_destroy64k,
+//                    Benchmark::eytzinger_int32_destroy1M,   <- Test setup takes too long.
+                    Benchmark::eytzinger_int32_find1,
+                    Benchmark::eytzinger_int32_find16,
+                    Benchmark::eytzinger_int32_find256,
+                    Benchmark::eytzinger_int32_find4k,
+                    Benchmark::eytzinger_int32_find64k,
+//                    Benchmark::eytzinger_int32_find1M,      <- Test setup takes too long.
+                    Benchmark::eytzinger_int32_insert16,
+                    Benchmark::eytzinger_int32_insert256,
+                    Benchmark::eytzinger_int32_insert4k,
+                    Benchmark::eytzinger_int32_insert64k,
+//                    Benchmark::eytzinger_int32_insert1M,    <- Test takes too long.
+                    Benchmark::eytzinger_int32_iterate16,
+                    Benchmark::eytzinger_int32_iterate256,
+                    Benchmark::eytzinger_int32_iterate4k,
+                    Benchmark::eytzinger_int32_iterate64k,
+//                    Benchmark::eytzinger_int32_iterate1M,   <- Test setup takes too long.
+                    Benchmark::eytzinger_int64_copy64k,
+                    Benchmark::eytzinger_int64_destroy64k,
+                    Benchmark::eytzinger_int64_find64k,
+                    Benchmark::eytzinger_int64_insert4k,
+                    Benchmark::eytzinger_int64_iterate64k,
+                    Benchmark::eytzinger_float_copy64k,
+                    Benchmark::eytzinger_float_destroy64k,
+                    Benchmark::eytzinger_float_find64k,
+                    Benchmark::eytzinger_float_insert4k,
+                    Benchmark::eytzinger_float_iterate64k,
+                    Benchmark::eytzinger_double_copy64k,
+                    Benchmark::eytzinger_double_destroy64k,
+                    Benchmark::eytzinger_double_find64k,
+                    Benchmark::eytzinger_double_insert4k,
+                    Benchmark::eytzinger_double_iterate64k,
+                    Benchmark::eytzinger_string_copy64k,
+                    Benchmark::eytzinger_string_destroy64k,
+                    Benchmark::eytzinger_string_find64k,
+                    Benchmark::eytzinger_string_insert4k,
+                    Benchmark::eytzinger_string_iterate64k,
+                },
+            },
             {
                 Category::file,
                 {
@@ -777,6 +2296,205 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::file_write_direct_16M,
                 },
             },
+            {
+                Category::flat_hashset,
+                {
+                    Benchmark::linearset_int32_copy16,
+                    Benchmark::linearset_int32_copy256,
+                    Benchmark::linearset_int32_copy4k,
+                    Benchmark::linearset_int32_copy64k,
+//                    Benchmark::linearset_int32_copy1M,      <- Test setup takes too long.
+                    Benchmark::linearset_int32_destroy16,
+                    Benchmark::linearset_int32_destroy256,
+                    Benchmark::linearset_int32_destroy4k,
+                    Benchmark::linearset_int32_destroy64k,
+//                    Benchmark::linearset_int32_destroy1M,   <- Test setup takes too long.
+                    Benchmark::linearset_int32_find1,
+                    Benchmark::linearset_int32_find16,
+                    Benchmark::linearset_int32_find256,
+                    Benchmark::linearset_int32_find4k,
+                    Benchmark::linearset_int32_find64k,
+//                    Benchmark::linearset_int32_find1M,      <- Test setup takes too long.
+                    Benchmark::linearset_int32_insert16,
+                    Benchmark::linearset_int32_insert256,
+                    Benchmark::linearset_int32_insert4k,
+                    Benchmark::linearset_int32_insert64k,
+//                    Benchmark::linearset_int32_insert1M,    <- Test takes too long.
+                    Benchmark::linearset_int32_iterate16,
+                    Benchmark::linearset_int32_iterate256,
+                    Benchmark::linearset_int32_iterate4k,
+                    Benchmark::linearset_int32_iterate64k,
+//                    Benchmark::linearset_int32_iterate1M,   <- Test setup takes too long.
+                    Benchmark::linearset_int64_copy64k,
+                    Benchmark::linearset_int64_destroy64k,
+                    Benchmark::linearset_int64_find64k,
+                    Benchmark::linearset_int64_insert4k,
+                    Benchmark::linearset_int64_iterate64k,
+                    Benchmark::linearset_float_copy64k,
+                    Benchmark::linearset_float_destroy64k,
+                    Benchmark::linearset_float_find64k,
+                    Benchmark::linearset_float_insert4k,
+                    Benchmark::linearset_float_iterate64k,
+                    Benchmark::linearset_double_copy64k,
+                    Benchmark::linearset_double_destroy64k,
+                    Benchmark::linearset_double_find64k,
+                    Benchmark::linearset_double_insert4k,
+                    Benchmark::linearset_double_iterate64k,
+                    Benchmark::linearset_string_copy64k,
+                    Benchmark::linearset_string_destroy64k,
+                    Benchmark::linearset_string_find64k,
+                    Benchmark::linearset_string_insert4k,
+                    Benchmark::linearset_string_iterate64k,
+                    Benchmark::swissset_int32_copy16,
+                    Benchmark::swissset_int32_copy256,
+                    Benchmark::swissset_int32_copy4k,
+                    Benchmark::swissset_int32_copy64k,
+//                    Benchmark::swissset_int32_copy1M,       <- Test setup takes too long.
+                    Benchmark::swissset_int32_destroy16,
+                    Benchmark::swissset_int32_destroy256,
+                    Benchmark::swissset_int32_destroy4k,
+                    Benchmark::swissset_int32_destroy64k,
+//                    Benchmark::swissset_int32_destroy1M,    <- Test setup takes too long.
+                    Benchmark::swissset_int32_find1,
+                    Benchmark::swissset_int32_find16,
+                    Benchmark::swissset_int32_find256,
+                    Benchmark::swissset_int32_find4k,
+                    Benchmark::swissset_int32_find64k,
+//                    Benchmark::swissset_int32_find1M,       <- Test setup takes too long.
+                    Benchmark::swissset_int32_insert16,
+                    Benchmark::swissset_int32_insert256,
+                    Benchmark::swissset_int32_insert4k,
+                    Benchmark::swissset_int32_insert64k,
+//                    Benchmark::swissset_int32_insert1M,     <- Test takes too long.
+                    Benchmark::swissset_int32_iterate16,
+                    Benchmark::swissset_int32_iterate256,
+                    Benchmark::swissset_int32_iterate4k,
+                    Benchmark::swissset_int32_iterate64k,
+//                    Benchmark::swissset_int32_iterate1M,    <- Test setup takes too long.
+                    Benchmark::swissset_int64_copy64k,
+                    Benchmark::swissset_int64_destroy64k,
+                    Benchmark::swissset_int64_find64k,
+                    Benchmark::swissset_int64_insert4k,
+                    Benchmark::swissset_int64_iterate64k,
+                    Benchmark::swissset_float_copy64k,
+                    Benchmark::swissset_float_destroy64k,
+                    Benchmark::swissset_float_find64k,
+                    Benchmark::swissset_float_insert4k,
+                    Benchmark::swissset_float_iterate64k,
+                    Benchmark::swissset_double_copy64k,
+                    Benchmark::swissset_double_destroy64k,
+                    Benchmark::swissset_double_find64k,
+                    Benchmark::swissset_double_insert4k,
+                    Benchmark::swissset_double_iterate64k,
+                    Benchmark::swissset_string_copy64k,
+                    Benchmark::swissset_string_destroy64k,
+                    Benchmark::swissset_string_find64k,
+                    Benchmark::swissset_string_insert4k,
+                    Benchmark::swissset_string_iterate64k,
+                },
+            },
+            {
+                Category::flat_map,
+                {
+                    Benchmark::flatmap_int32_copy16,
+                    Benchmark::flatmap_int32_copy256,
+                    Benchmark::flatmap_int32_copy4k,
+                    Benchmark::flatmap_int32_copy64k,
+//                    Benchmark::flatmap_int32_copy1M,      <- Test setup takes too long.
+                    Benchmark::flatmap_int32_destroy16,
+                    Benchmark::flatmap_int32_destroy256,
+                    Benchmark::flatmap_int32_destroy4k,
+                    Benchmark::flatmap_int32_destroy64k,
+//                    Benchmark::flatmap_int32_destroy1M,   <- Test setup takes too long.
+                    Benchmark::flatmap_int32_find1,
+                    Benchmark::flatmap_int32_find16,
+                    Benchmark::flatmap_int32_find256,
+                    Benchmark::flatmap_int32_find4k,
+                    Benchmark::flatmap_int32_find64k,
+//                    Benchmark::flatmap_int32_find1M,      <- Test setup takes too long.
+                    Benchmark::flatmap_int32_insert16,
+                    Benchmark::flatmap_int32_insert256,
+                    Benchmark::flatmap_int32_insert4k,
+//                    Benchmark::flatmap_int32_insert64k,   <- Test takes too long.
+//                    Benchmark::flatmap_int32_insert1M,    <- Test takes too long.
+                    Benchmark::flatmap_int32_iterate16,
+                    Benchmark::flatmap_int32_iterate256,
+                    Benchmark::flatmap_int32_iterate4k,
+                    Benchmark::flatmap_int32_iterate64k,
+//                    Benchmark::flatmap_int32_iterate1M,   <- Test setup takes too long.
+                    Benchmark::flatmap_int64_copy64k,
+                    Benchmark::flatmap_int64_destroy64k,
+                    Benchmark::flatmap_int64_find64k,
+                    Benchmark::flatmap_int64_insert4k,
+                    Benchmark::flatmap_int64_iterate64k,
+                    Benchmark::flatmap_float_copy64k,
+                    Benchmark::flatmap_float_destroy64k,
+                    Benchmark::flatmap_float_find64k,
+                    Benchmark::flatmap_float_insert4k,
+                    Benchmark::flatmap_float_iterate64k,
+                    Benchmark::flatmap_double_copy64k,
+                    Benchmark::flatmap_double_destroy64k,
+                    Benchmark::flatmap_double_find64k,
+                    Benchmark::flatmap_double_insert4k,
+                    Benchmark::flatmap_double_iterate64k,
+                    Benchmark::flatmap_string_copy64k,
+                    Benchmark::flatmap_string_destroy64k,
+                    Benchmark::flatmap_string_find64k,
+                    Benchmark::flatmap_string_insert4k,
+                    Benchmark::flatmap_string_iterate64k,
+                },
+            },
+            {
+                Category::flat_set,
+                {
+                    Benchmark::flatset_int32_copy16,
+                    Benchmark::flatset_int32_copy256,
+                    Benchmark::flatset_int32_copy4k,
+                    Benchmark::flatset_int32_copy64k,
+//                    Benchmark::flatset_int32_copy1M,      <- Test setup takes too long.
+                    Benchmark::flatset_int32_destroy16,
+                    Benchmark::flatset_int32_destroy256,
+                    Benchmark::flatset_int32_destroy4k,
+                    Benchmark::flatset_int32_destroy64k,
+//                    Benchmark::flatset_int32_destroy1M,   <- Test setup takes too long.
+                    Benchmark::flatset_int32_find1,
+                    Benchmark::flatset_int32_find16,
+                    Benchmark::flatset_int32_find256,
+                    Benchmark::flatset_int32_find4k,
+                    Benchmark::flatset_int32_find64k,
+//                    Benchmark::flatset_int32_find1M,      <- Test setup takes too long.
+                    Benchmark::flatset_int32_insert16,
+                    Benchmark::flatset_int32_insert256,
+                    Benchmark::flatset_int32_insert4k,
+//                    Benchmark::flatset_int32_insert64k,   <- Test takes too long.
+//                    Benchmark::flatset_int32_insert1M,    <- Test takes too long.
+                    Benchmark::flatset_int32_iterate16,
+                    Benchmark::flatset_int32_iterate256,
+                    Benchmark::flatset_int32_iterate4k,
+                    Benchmark::flatset_int32_iterate64k,
+//                    Benchmark::flatset_int32_iterate1M,   <- Test setup takes too long.
+                    Benchmark::flatset_int64_copy64k,
+                    Benchmark::flatset_int64_destroy64k,
+                    Benchmark::flatset_int64_find64k,
+                    Benchmark::flatset_int64_insert4k,
+                    Benchmark::flatset_int64_iterate64k,
+                    Benchmark::flatset_float_copy64k,
+                    Benchmark::flatset_float_destroy64k,
+                    Benchmark::flatset_float_find64k,
+                    Benchmark::flatset_float_insert4k,
+                    Benchmark::flatset_float_iterate64k,
+                    Benchmark::flatset_double_copy64k,
+                    Benchmark::flatset_double_destroy64k,
+                    Benchmark::flatset_double_find64k,
+                    Benchmark::flatset_double_insert4k,
+                    Benchmark::flatset_double_iterate64k,
+                    Benchmark::flatset_string_copy64k,
+                    Benchmark::flatset_string_destroy64k,
+                    Benchmark::flatset_string_find64k,
+                    Benchmark::flatset_string_insert4k,
+                    Benchmark::flatset_string_iterate64k,
+                },
+            },
             {
                 Category::function,
                 {
@@ -832,6 +2550,10 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::memcpy_1M,
                     Benchmark::memcpy_16M,
                     Benchmark::memcpy_256M,
+                    Benchmark::memcpy_256M_4k,
+                    Benchmark::memcpy_256M_thp,
+                    Benchmark::memcpy_256M_2M,
+                    Benchmark::memcpy_256M_1G,
                     Benchmark::strcmp_16,
                     Benchmark::strcmp_256,
                     Benchmark::strcmp_4k,
@@ -864,7 +2586,10 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::memread_1M,
                     Benchmark::memread_16M,
                     Benchmark::memread_256M,
-                    Benchmark::cache_false_sharing,
+                    Benchmark::memread_256M_4k,
+                    Benchmark::memread_256M_thp,
+                    Benchmark::memread_256M_2M,
+                    Benchmark::memread_256M_1G,
                 },
             },
             {
@@ -873,6 +2598,63 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::mutex_create_destroy,
                     Benchmark::mutex_lock_release,
                     Benchmark::mutex_trylock,
+                    Benchmark::mutex_contended_pthread_2t,
+                    Benchmark::mutex_contended_pthread_4t,
+                    Benchmark::mutex_contended_pthread_8t,
+                    Benchmark::mutex_contended_pthread_16t,
+                    Benchmark::mutex_contended_pthread_adaptive_2t,
+                    Benchmark::mutex_contended_pthread_adaptive_4t,
+                    Benchmark::mutex_contended_pthread_adaptive_8t,
+                    Benchmark::mutex_contended_pthread_adaptive_16t,
+                    Benchmark::mutex_contended_std_mutex_2t,
+                    Benchmark::mutex_contended_std_mutex_4t,
+                    Benchmark::mutex_contended_std_mutex_8t,
+                    Benchmark::mutex_contended_std_mutex_16t,
+                    Benchmark::mutex_contended_rwlock_read_2t,
+                    Benchmark::mutex_contended_rwlock_read_4t,
+                    Benchmark::mutex_contended_rwlock_read_8t,
+                    Benchmark::mutex_contended_rwlock_read_16t,
+                    Benchmark::mutex_contended_rwlock_write_2t,
+                    Benchmark::mutex_contended_rwlock_write_4t,
+                    Benchmark::mutex_contended_rwlock_write_8t,
+                    Benchmark::mutex_contended_rwlock_write_16t,
+                    Benchmark::mutex_contended_ttas_2t,
+                    Benchmark::mutex_contended_ttas_4t,
+                    Benchmark::mutex_contended_ttas_8t,
+                    Benchmark::mutex_contended_ttas_16t,
+                    Benchmark::mutex_contended_ticket_2t,
+                    Benchmark::mutex_contended_ticket_4t,
+                    Benchmark::mutex_contended_ticket_8t,
+                    Benchmark::mutex_contended_ticket_16t,
+                    Benchmark::mutex_contended_mcs_2t,
+                    Benchmark::mutex_contended_mcs_4t,
+                    Benchmark::mutex_contended_mcs_8t,
+                    Benchmark::mutex_contended_mcs_16t,
+                    Benchmark::mutex_contended_futex_2t,
+                    Benchmark::mutex_contended_futex_4t,
+                    Benchmark::mutex_contended_futex_8t,
+                    Benchmark::mutex_contended_futex_16t,
+                },
+            },
+            {
+                Category::network,
+                {
+                    Benchmark::network_accept,
+                    Benchmark::network_rps_1c,
+                    Benchmark::network_rps_2c,
+                    Benchmark::network_rps_4c,
+                    Benchmark::network_rps_8c,
+                    Benchmark::network_rps_16c,
+                    Benchmark::network_rps_32c,
+                    Benchmark::network_rps_64c,
+                    Benchmark::network_stream_256,
+                    Benchmark::network_stream_4k,
+                    Benchmark::network_stream_64k,
+                    Benchmark::network_stream_1M,
+                    Benchmark::network_gather_1,
+                    Benchmark::network_gather_4,
+                    Benchmark::network_gather_16,
+                    Benchmark::network_gather_64,
                 },
             },
             {
@@ -955,6 +2737,65 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::system,
                 },
             },
+            {
+                Category::queue,
+                {
+                    Benchmark::queue_spsc_latency,
+                    Benchmark::queue_spsc_roundtrip,
+                    Benchmark::queue_spsc_throughput,
+                    Benchmark::queue_spsc_batch_throughput,
+                    Benchmark::queue_spsc_cached_latency,
+                    Benchmark::queue_spsc_cached_roundtrip,
+                    Benchmark::queue_spsc_cached_throughput,
+                    Benchmark::queue_spsc_cached_batch_throughput,
+                    Benchmark::queue_mpmc_latency,
+                    Benchmark::queue_mpmc_roundtrip,
+                    Benchmark::queue_mpmc_throughput_1p1c,
+                    Benchmark::queue_mpmc_throughput_2p2c,
+                    Benchmark::queue_mpmc_throughput_4p4c,
+                    Benchmark::queue_mpmc_throughput_1p4c,
+                    Benchmark::queue_mpmc_throughput_4p1c,
+                    Benchmark::queue_mpmc_batch_throughput_1p1c,
+                    Benchmark::queue_mpmc_batch_throughput_2p2c,
+                    Benchmark::queue_mpmc_batch_throughput_4p4c,
+                    Benchmark::queue_mpsc_latency,
+                    Benchmark::queue_mpsc_roundtrip,
+                    Benchmark::queue_mpsc_throughput_1p,
+                    Benchmark::queue_mpsc_throughput_2p,
+                    Benchmark::queue_mpsc_throughput_4p,
+                    Benchmark::queue_mpsc_throughput_8p,
+                    Benchmark::queue_mpsc_batch_throughput_1p,
+                    Benchmark::queue_mpsc_batch_throughput_4p,
+                },
+            },
+            {
+                Category::simd,
+                {
+                    Benchmark::simd_sum_scalar,
+                    Benchmark::simd_sum_sse42,
+                    Benchmark::simd_sum_avx2,
+                    Benchmark::simd_sum_avx512,
+                    Benchmark::simd_dot_scalar,
+                    Benchmark::simd_dot_sse42,
+                    Benchmark::simd_dot_avx2,
+                    Benchmark::simd_dot_avx512,
+                    Benchmark::simd_find_scalar,
+                    Benchmark::simd_find_sse42,
+                    Benchmark::simd_find_avx2,
+                    Benchmark::simd_find_avx512,
+                    Benchmark::simd_prefix_sum_scalar,
+                    Benchmark::simd_prefix_sum_sse42,
+                    Benchmark::simd_prefix_sum_avx2,
+                    Benchmark::simd_prefix_sum_avx512,
+                    Benchmark::simd_mandelbrot_scalar,
+                    Benchmark::simd_mandelbrot_sse42,
+                    Benchmark::simd_mandelbrot_avx2,
+                    Benchmark::simd_mandelbrot_avx512,
+                    Benchmark::simd_fma_scalar,
+                    Benchmark::simd_fma_avx2,
+                    Benchmark::simd_fma_avx512,
+                },
+            },
             {
                 Category::std_deque,
                 {
@@ -1004,6 +2845,22 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::deque_string_find64k,
                     Benchmark::deque_string_insert4k,
                     Benchmark::deque_string_iterate64k,
+                    Benchmark::deque_arena_int32_destroy64k,
+                    Benchmark::deque_arena_int32_find64k,
+                    Benchmark::deque_arena_int32_insert64k,
+                    Benchmark::deque_arena_int32_iterate1M,
+                    Benchmark::deque_mono_int32_destroy64k,
+                    Benchmark::deque_mono_int32_find64k,
+                    Benchmark::deque_mono_int32_insert64k,
+                    Benchmark::deque_mono_int32_iterate1M,
+                    Benchmark::deque_spool_int32_destroy64k,
+                    Benchmark::deque_spool_int32_find64k,
+                    Benchmark::deque_spool_int32_insert64k,
+                    Benchmark::deque_spool_int32_iterate1M,
+                    Benchmark::deque_upool_int32_destroy64k,
+                    Benchmark::deque_upool_int32_find64k,
+                    Benchmark::deque_upool_int32_insert64k,
+                    Benchmark::deque_upool_int32_iterate1M,
                 },
             },
             {
@@ -1022,6 +2879,63 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::hash_string_64k,
                 },
             },
+            {
+                Category::std_hashmap,
+                {
+                    Benchmark::hashmap_int32_p8_copy64k,
+                    Benchmark::hashmap_int32_p8_destroy64k,
+                    Benchmark::hashmap_int32_p8_erase64k,
+                    Benchmark::hashmap_int32_p8_find64k,
+                    Benchmark::hashmap_int32_p8_findmiss64k,
+                    Benchmark::hashmap_int32_p8_insert64k,
+                    Benchmark::hashmap_int32_p8_insertreserved64k,
+                    Benchmark::hashmap_int32_p8_iterate64k,
+                    Benchmark::hashmap_int32_p8_rehash64k,
+                    Benchmark::hashmap_int32_p16_copy64k,
+                    Benchmark::hashmap_int32_p16_destroy64k,
+                    Benchmark::hashmap_int32_p16_find64k,
+                    Benchmark::hashmap_int32_p16_insert64k,
+                    Benchmark::hashmap_int32_p16_iterate64k,
+                    Benchmark::hashmap_int32_p32_copy64k,
+                    Benchmark::hashmap_int32_p32_destroy64k,
+                    Benchmark::hashmap_int32_p32_find64k,
+                    Benchmark::hashmap_int32_p32_insert64k,
+                    Benchmark::hashmap_int32_p32_iterate64k,
+                    Benchmark::hashmap_int32_p64_copy64k,
+                    Benchmark::hashmap_int32_p64_destroy64k,
+                    Benchmark::hashmap_int32_p64_erase64k,
+                    Benchmark::hashmap_int32_p64_find64k,
+                    Benchmark::hashmap_int32_p64_findmiss64k,
+                    Benchmark::hashmap_int32_p64_insert64k,
+                    Benchmark::hashmap_int32_p64_insertreserved64k,
+                    Benchmark::hashmap_int32_p64_iterate64k,
+                    Benchmark::hashmap_int32_p64_rehash64k,
+                    Benchmark::hashmap_int32_p128_copy64k,
+                    Benchmark::hashmap_int32_p128_destroy64k,
+                    Benchmark::hashmap_int32_p128_find64k,
+                    Benchmark::hashmap_int32_p128_insert64k,
+                    Benchmark::hashmap_int32_p128_iterate64k,
+                    Benchmark::hashmap_int32_p256_copy64k,
+                    Benchmark::hashmap_int32_p256_destroy64k,
+                    Benchmark::hashmap_int32_p256_erase64k,
+                    Benchmark::hashmap_int32_p256_find64k,
+                    Benchmark::hashmap_int32_p256_findmiss64k,
+                    Benchmark::hashmap_int32_p256_insert64k,
+                    Benchmark::hashmap_int32_p256_insertreserved64k,
+                    Benchmark::hashmap_int32_p256_iterate64k,
+                    Benchmark::hashmap_int32_p256_rehash64k,
+                    Benchmark::hashmap_int64_p64_copy64k,
+                    Benchmark::hashmap_int64_p64_destroy64k,
+                    Benchmark::hashmap_int64_p64_find64k,
+                    Benchmark::hashmap_int64_p64_insert4k,
+                    Benchmark::hashmap_int64_p64_iterate64k,
+                    Benchmark::hashmap_string_p64_copy64k,
+                    Benchmark::hashmap_string_p64_destroy64k,
+                    Benchmark::hashmap_string_p64_find64k,
+                    Benchmark::hashmap_string_p64_insert4k,
+                    Benchmark::hashmap_string_p64_iterate64k,
+                },
+            },
             {
                 Category::std_hashset,
                 {
@@ -1071,6 +2985,22 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::hashset_string_find64k,
                     Benchmark::hashset_string_insert4k,
                     Benchmark::hashset_string_iterate64k,
+                    Benchmark::hashset_arena_int32_destroy64k,
+                    Benchmark::hashset_arena_int32_find64k,
+                    Benchmark::hashset_arena_int32_insert64k,
+                    Benchmark::hashset_arena_int32_iterate1M,
+                    Benchmark::hashset_mono_int32_destroy64k,
+                    Benchmark::hashset_mono_int32_find64k,
+                    Benchmark::hashset_mono_int32_insert64k,
+                    Benchmark::hashset_mono_int32_iterate1M,
+                    Benchmark::hashset_spool_int32_destroy64k,
+                    Benchmark::hashset_spool_int32_find64k,
+                    Benchmark::hashset_spool_int32_insert64k,
+                    Benchmark::hashset_spool_int32_iterate1M,
+                    Benchmark::hashset_upool_int32_destroy64k,
+                    Benchmark::hashset_upool_int32_find64k,
+                    Benchmark::hashset_upool_int32_insert64k,
+                    Benchmark::hashset_upool_int32_iterate1M,
                 },
             },
             {
@@ -1122,6 +3052,73 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::list_string_find64k,
                     Benchmark::list_string_insert4k,
                     Benchmark::list_string_iterate64k,
+                    Benchmark::list_arena_int32_destroy64k,
+                    Benchmark::list_arena_int32_find64k,
+                    Benchmark::list_arena_int32_insert64k,
+                    Benchmark::list_arena_int32_iterate1M,
+                    Benchmark::list_mono_int32_destroy64k,
+                    Benchmark::list_mono_int32_find64k,
+                    Benchmark::list_mono_int32_insert64k,
+                    Benchmark::list_mono_int32_iterate1M,
+                    Benchmark::list_spool_int32_destroy64k,
+                    Benchmark::list_spool_int32_find64k,
+                    Benchmark::list_spool_int32_insert64k,
+                    Benchmark::list_spool_int32_iterate1M,
+                    Benchmark::list_upool_int32_destroy64k,
+                    Benchmark::list_upool_int32_find64k,
+                    Benchmark::list_upool_int32_insert64k,
+                    Benchmark::list_upool_int32_iterate1M,
+                },
+            },
+            {
+                Category::std_map,
+                {
+                    Benchmark::map_int32_p8_copy64k,
+                    Benchmark::map_int32_p8_destroy64k,
+                    Benchmark::map_int32_p8_erase64k,
+                    Benchmark::map_int32_p8_find64k,
+                    Benchmark::map_int32_p8_findmiss64k,
+                    Benchmark::map_int32_p8_insert64k,
+                    Benchmark::map_int32_p8_iterate64k,
+                    Benchmark::map_int32_p16_copy64k,
+                    Benchmark::map_int32_p16_destroy64k,
+                    Benchmark::map_int32_p16_find64k,
+                    Benchmark::map_int32_p16_insert64k,
+                    Benchmark::map_int32_p16_iterate64k,
+                    Benchmark::map_int32_p32_copy64k,
+                    Benchmark::map_int32_p32_destroy64k,
+                    Benchmark::map_int32_p32_find64k,
+                    Benchmark::map_int32_p32_insert64k,
+                    Benchmark::map_int32_p32_iterate64k,
+                    Benchmark::map_int32_p64_copy64k,
+                    Benchmark::map_int32_p64_destroy64k,
+                    Benchmark::map_int32_p64_erase64k,
+                    Benchmark::map_int32_p64_find64k,
+                    Benchmark::map_int32_p64_findmiss64k,
+                    Benchmark::map_int32_p64_insert64k,
+                    Benchmark::map_int32_p64_iterate64k,
+                    Benchmark::map_int32_p128_copy64k,
+                    Benchmark::map_int32_p128_destroy64k,
+                    Benchmark::map_int32_p128_find64k,
+                    Benchmark::map_int32_p128_insert64k,
+                    Benchmark::map_int32_p128_iterate64k,
+                    Benchmark::map_int32_p256_copy64k,
+                    Benchmark::map_int32_p256_destroy64k,
+                    Benchmark::map_int32_p256_erase64k,
+                    Benchmark::map_int32_p256_find64k,
+                    Benchmark::map_int32_p256_findmiss64k,
+                    Benchmark::map_int32_p256_insert64k,
+                    Benchmark::map_int32_p256_iterate64k,
+                    Benchmark::map_int64_p64_copy64k,
+                    Benchmark::map_int64_p64_destroy64k,
+                    Benchmark::map_int64_p64_find64k,
+                    Benchmark::map_int64_p64_insert4k,
+                    Benchmark::map_int64_p64_iterate64k,
+                    Benchmark::map_string_p64_copy64k,
+                    Benchmark::map_string_p64_destroy64k,
+                    Benchmark::map_string_p64_find64k,
+                    Benchmark::map_string_p64_insert4k,
+                    Benchmark::map_string_p64_iterate64k,
                 },
             },
             {
@@ -1173,6 +3170,22 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::set_string_find64k,
                     Benchmark::set_string_insert4k,
                     Benchmark::set_string_iterate64k,
+                    Benchmark::set_arena_int32_destroy64k,
+                    Benchmark::set_arena_int32_find64k,
+                    Benchmark::set_arena_int32_insert64k,
+                    Benchmark::set_arena_int32_iterate1M,
+                    Benchmark::set_mono_int32_destroy64k,
+                    Benchmark::set_mono_int32_find64k,
+                    Benchmark::set_mono_int32_insert64k,
+                    Benchmark::set_mono_int32_iterate1M,
+                    Benchmark::set_spool_int32_destroy64k,
+                    Benchmark::set_spool_int32_find64k,
+                    Benchmark::set_spool_int32_insert64k,
+                    Benchmark::set_spool_int32_iterate1M,
+                    Benchmark::set_upool_int32_destroy64k,
+                    Benchmark::set_upool_int32_find64k,
+                    Benchmark::set_upool_int32_insert64k,
+                    Benchmark::set_upool_int32_iterate1M,
                 },
             },
             {
@@ -1219,6 +3232,64 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::vec_string_find64k,
                     Benchmark::vec_string_insert4k,
                     Benchmark::vec_string_iterate64k,
+                    Benchmark::vec_arena_int32_destroy64k,
+                    Benchmark::vec_arena_int32_find64k,
+                    Benchmark::vec_arena_int32_insert64k,
+                    Benchmark::vec_arena_int32_iterate1M,
+                    Benchmark::vec_mono_int32_destroy64k,
+                    Benchmark::vec_mono_int32_find64k,
+                    Benchmark::vec_mono_int32_insert64k,
+                    Benchmark::vec_mono_int32_iterate1M,
+                    Benchmark::vec_spool_int32_destroy64k,
+                    Benchmark::vec_spool_int32_find64k,
+                    Benchmark::vec_spool_int32_insert64k,
+                    Benchmark::vec_spool_int32_iterate1M,
+                    Benchmark::vec_upool_int32_destroy64k,
+                    Benchmark::vec_upool_int32_find64k,
+                    Benchmark::vec_upool_int32_insert64k,
+                    Benchmark::vec_upool_int32_iterate1M,
+                },
+            },
+            {
+                Category::socket,
+                {
+                    Benchmark::socket_open_close_tcp,
+                    Benchmark::socket_open_close_udp,
+                    Benchmark::socket_open_close_unix,
+                    Benchmark::socket_connect_accept_tcp,
+                    Benchmark::socket_connect_accept_unix,
+                    Benchmark::socket_send_recv_tcp_64,
+                    Benchmark::socket_send_recv_tcp_256,
+                    Benchmark::socket_send_recv_tcp_1k,
+                    Benchmark::socket_send_recv_tcp_4k,
+                    Benchmark::socket_send_recv_tcp_16k,
+                    Benchmark::socket_send_recv_tcp_64k,
+                    Benchmark::socket_send_recv_unix_64,
+                    Benchmark::socket_send_recv_unix_256,
+                    Benchmark::socket_send_recv_unix_1k,
+                    Benchmark::socket_send_recv_unix_4k,
+                    Benchmark::socket_send_recv_unix_16k,
+                    Benchmark::socket_send_recv_unix_64k,
+                    Benchmark::socket_send_recv_udp_64,
+                    Benchmark::socket_send_recv_udp_1k,
+                    Benchmark::socket_send_recv_udp_16k,
+                    Benchmark::socket_send_recv_unix_dgram_64,
+                    Benchmark::socket_send_recv_unix_dgram_1k,
+                    Benchmark::socket_send_recv_unix_dgram_16k,
+                    Benchmark::socket_pingpong_tcp_256,
+                    Benchmark::socket_pingpong_tcp_1k,
+                    Benchmark::socket_pingpong_tcp_4k,
+                    Benchmark::socket_pingpong_tcp_16k,
+                    Benchmark::socket_pingpong_tcp_64k,
+                    Benchmark::socket_pingpong_tcp_256_busy_poll,
+                    Benchmark::socket_pingpong_unix_256,
+                    Benchmark::socket_pingpong_unix_1k,
+                    Benchmark::socket_pingpong_unix_4k,
+                    Benchmark::socket_pingpong_unix_16k,
+                    Benchmark::socket_pingpong_unix_64k,
+                    Benchmark::socket_mmsg_udp_1,
+                    Benchmark::socket_mmsg_udp_8,
+                    Benchmark::socket_mmsg_udp_32,
                 },
             },
             {
@@ -1249,11 +3320,230 @@ const std::map< Category, std::set< Benchmark > > &CategoryBenchmarkMap()
                     Benchmark::string_to_bigdouble_ts,
                 },
             },
+            {
+                Category::syscall,
+                {
+                    Benchmark::syscall_getpid,
+                    Benchmark::syscall_getpid_seccomp,
+                    Benchmark::syscall_getpid_seccomp_args,
+                    Benchmark::syscall_gettid,
+                    Benchmark::syscall_clock_gettime_realtime_vdso,
+                    Benchmark::syscall_clock_gettime_realtime_syscall,
+                    Benchmark::syscall_clock_gettime_realtime_coarse_vdso,
+                    Benchmark::syscall_clock_gettime_realtime_coarse_syscall,
+                    Benchmark::syscall_clock_gettime_monotonic_vdso,
+                    Benchmark::syscall_clock_gettime_monotonic_syscall,
+                    Benchmark::syscall_clock_gettime_monotonic_coarse_vdso,
+                    Benchmark::syscall_clock_gettime_monotonic_coarse_syscall,
+                    Benchmark::syscall_clock_gettime_monotonic_raw_vdso,
+                    Benchmark::syscall_clock_gettime_monotonic_raw_syscall,
+                    Benchmark::syscall_clock_gettime_boottime_vdso,
+                    Benchmark::syscall_clock_gettime_boottime_syscall,
+                    Benchmark::syscall_clock_gettime_process_cputime_vdso,
+                    Benchmark::syscall_clock_gettime_process_cputime_syscall,
+                    Benchmark::syscall_clock_gettime_thread_cputime_vdso,
+                    Benchmark::syscall_clock_gettime_thread_cputime_syscall,
+                    Benchmark::syscall_getcpu_vdso,
+                    Benchmark::syscall_getcpu_syscall,
+                    Benchmark::syscall_getrusage,
+                    Benchmark::syscall_sched_yield,
+                    Benchmark::syscall_ioctl_badfd,
+                },
+            },
             {
                 Category::thread,
                 {
                     Benchmark::thread_create_destroy,
                     Benchmark::thread_pingpong,
+                    Benchmark::thread_task_spawn_steal,
+                    Benchmark::thread_task_spawn_shared,
+                    Benchmark::thread_task_spawn_async,
+                    Benchmark::thread_task_tree_steal_4w,
+                    Benchmark::thread_task_tree_shared_4w,
+                    Benchmark::thread_task_tree_async,
+                    Benchmark::thread_task_handoff_steal,
+                    Benchmark::thread_task_handoff_shared,
+                    Benchmark::thread_task_tiny_steal_1w,
+                    Benchmark::thread_task_tiny_steal_2w,
+                    Benchmark::thread_task_tiny_steal_4w,
+                    Benchmark::thread_task_tiny_steal_8w,
+                    Benchmark::thread_task_tiny_shared_1w,
+                    Benchmark::thread_task_tiny_shared_2w,
+                    Benchmark::thread_task_tiny_shared_4w,
+                    Benchmark::thread_task_tiny_shared_8w,
+                    Benchmark::thread_task_tiny_async,
+                    Benchmark::thread_task_medium_steal_1w,
+                    Benchmark::thread_task_medium_steal_2w,
+                    Benchmark::thread_task_medium_steal_4w,
+                    Benchmark::thread_task_medium_steal_8w,
+                    Benchmark::thread_task_medium_shared_1w,
+                    Benchmark::thread_task_medium_shared_2w,
+                    Benchmark::thread_task_medium_shared_4w,
+                    Benchmark::thread_task_medium_shared_8w,
+                    Benchmark::thread_task_medium_async,
+                },
+            },
+            {
+                Category::timing,
+                {
+                    Benchmark::timing_nanosleep_1us,
+                    Benchmark::timing_nanosleep_10us,
+                    Benchmark::timing_nanosleep_100us,
+                    Benchmark::timing_nanosleep_1ms,
+                    Benchmark::timing_nanosleep_10ms,
+                    Benchmark::timing_nanosleep_1us_fifo,
+                    Benchmark::timing_nanosleep_10us_fifo,
+                    Benchmark::timing_nanosleep_100us_fifo,
+                    Benchmark::timing_nanosleep_1ms_fifo,
+                    Benchmark::timing_nanosleep_10ms_fifo,
+                    Benchmark::timing_abstime_1us,
+                    Benchmark::timing_abstime_10us,
+                    Benchmark::timing_abstime_100us,
+                    Benchmark::timing_abstime_1ms,
+                    Benchmark::timing_abstime_10ms,
+                    Benchmark::timing_abstime_1us_fifo,
+                    Benchmark::timing_abstime_10us_fifo,
+                    Benchmark::timing_abstime_100us_fifo,
+                    Benchmark::timing_abstime_1ms_fifo,
+                    Benchmark::timing_abstime_10ms_fifo,
+                    Benchmark::timing_timerfd_1us,
+                    Benchmark::timing_timerfd_10us,
+                    Benchmark::timing_timerfd_100us,
+                    Benchmark::timing_timerfd_1ms,
+                    Benchmark::timing_timerfd_10ms,
+                    Benchmark::timing_timerfd_1us_fifo,
+                    Benchmark::timing_timerfd_10us_fifo,
+                    Benchmark::timing_timerfd_100us_fifo,
+                    Benchmark::timing_timerfd_1ms_fifo,
+                    Benchmark::timing_timerfd_10ms_fifo,
+                    Benchmark::timing_epoll_1us,
+                    Benchmark::timing_epoll_10us,
+                    Benchmark::timing_epoll_100us,
+                    Benchmark::timing_epoll_1ms,
+                    Benchmark::timing_epoll_10ms,
+                    Benchmark::timing_epoll_1us_fifo,
+                    Benchmark::timing_epoll_10us_fifo,
+                    Benchmark::timing_epoll_100us_fifo,
+                    Benchmark::timing_epoll_1ms_fifo,
+                    Benchmark::timing_epoll_10ms_fifo,
+                    Benchmark::timing_asio_1us,
+                    Benchmark::timing_asio_10us,
+                    Benchmark::timing_asio_100us,
+                    Benchmark::timing_asio_1ms,
+                    Benchmark::timing_asio_10ms,
+                    Benchmark::timing_asio_1us_fifo,
+                    Benchmark::timing_asio_10us_fifo,
+                    Benchmark::timing_asio_100us_fifo,
+                    Benchmark::timing_asio_1ms_fifo,
+                    Benchmark::timing_asio_10ms_fifo,
+                },
+            },
+            {
+                Category::uring,
+                {
+                    Benchmark::uring_buffered_randread_qd1,
+                    Benchmark::uring_buffered_randread_qd4,
+                    Benchmark::uring_buffered_randread_qd16,
+                    Benchmark::uring_buffered_randread_qd64,
+                    Benchmark::uring_buffered_randread_qd256,
+                    Benchmark::uring_buffered_seqread_qd1,
+                    Benchmark::uring_buffered_seqread_qd4,
+                    Benchmark::uring_buffered_seqread_qd16,
+                    Benchmark::uring_buffered_seqread_qd64,
+                    Benchmark::uring_buffered_seqread_qd256,
+                    Benchmark::uring_buffered_randwrite_qd1,
+                    Benchmark::uring_buffered_randwrite_qd4,
+                    Benchmark::uring_buffered_randwrite_qd16,
+                    Benchmark::uring_buffered_randwrite_qd64,
+                    Benchmark::uring_buffered_randwrite_qd256,
+                    Benchmark::uring_buffered_seqwrite_qd1,
+                    Benchmark::uring_buffered_seqwrite_qd4,
+                    Benchmark::uring_buffered_seqwrite_qd16,
+                    Benchmark::uring_buffered_seqwrite_qd64,
+                    Benchmark::uring_buffered_seqwrite_qd256,
+                    Benchmark::uring_buffered_randread_fixed_qd16,
+                    Benchmark::uring_buffered_randwrite_fixed_qd16,
+                    Benchmark::uring_buffered_randread_sqpoll_qd16,
+                    Benchmark::uring_buffered_randwrite_sqpoll_qd16,
+                    Benchmark::uring_buffered_seqwrite_fsync_qd1,
+                    Benchmark::uring_buffered_seqwrite_fsync_qd16,
+                    Benchmark::uring_direct_randread_qd1,
+                    Benchmark::uring_direct_randread_qd4,
+                    Benchmark::uring_direct_randread_qd16,
+                    Benchmark::uring_direct_randread_qd64,
+                    Benchmark::uring_direct_randread_qd256,
+                    Benchmark::uring_direct_seqread_qd1,
+                    Benchmark::uring_direct_seqread_qd4,
+                    Benchmark::uring_direct_seqread_qd16,
+                    Benchmark::uring_direct_seqread_qd64,
+                    Benchmark::uring_direct_seqread_qd256,
+                    Benchmark::uring_direct_randwrite_qd1,
+                    Benchmark::uring_direct_randwrite_qd4,
+                    Benchmark::uring_direct_randwrite_qd16,
+                    Benchmark::uring_direct_randwrite_qd64,
+                    Benchmark::uring_direct_randwrite_qd256,
+                    Benchmark::uring_direct_seqwrite_qd1,
+                    Benchmark::uring_direct_seqwrite_qd4,
+                    Benchmark::uring_direct_seqwrite_qd16,
+                    Benchmark::uring_direct_seqwrite_qd64,
+                    Benchmark::uring_direct_seqwrite_qd256,
+                    Benchmark::uring_direct_randread_fixed_qd16,
+                    Benchmark::uring_direct_randwrite_fixed_qd16,
+                    Benchmark::uring_direct_randread_sqpoll_qd16,
+                    Benchmark::uring_direct_randwrite_sqpoll_qd16,
+                    Benchmark::uring_direct_seqwrite_fsync_qd1,
+                    Benchmark::uring_direct_seqwrite_fsync_qd16,
+                },
+            },
+            {
+                Category::vm,
+                {
+                    Benchmark::vm_fault_anon_4k,
+                    Benchmark::vm_fault_anon_thp,
+                    Benchmark::vm_fault_file_4k,
+                    Benchmark::vm_mmap_populate_1M,
+                    Benchmark::vm_mmap_populate_16M,
+                    Benchmark::vm_mmap_touch_1M,
+                    Benchmark::vm_mmap_touch_16M,
+                    Benchmark::vm_munmap_1t,
+                    Benchmark::vm_munmap_2t,
+                    Benchmark::vm_munmap_4t,
+                    Benchmark::vm_munmap_8t,
+                    Benchmark::vm_munmap_16t,
+                    Benchmark::vm_madvise_dontneed_1M,
+                    Benchmark::vm_madvise_free_1M,
+                    Benchmark::vm_mprotect_4k,
+                    Benchmark::vm_mprotect_1M,
+                    Benchmark::vm_mremap_grow_1M,
+                    Benchmark::vm_mremap_grow_64M,
+                    Benchmark::vm_realloc_grow_1M,
+                    Benchmark::vm_realloc_grow_64M,
+                    Benchmark::vm_copy_grow_1M,
+                    Benchmark::vm_copy_grow_64M,
+                },
+            },
+            {
+                Category::wakeup,
+                {
+                    Benchmark::wakeup_futex_wake_no_waiters,
+                    Benchmark::wakeup_futex_wait_mismatch,
+                    Benchmark::wakeup_futex_pingpong,
+                    Benchmark::wakeup_eventfd_pingpong,
+                    Benchmark::wakeup_futex_latency,
+                    Benchmark::wakeup_eventfd_latency,
+                    Benchmark::wakeup_park_spin0,
+                    Benchmark::wakeup_park_spin100,
+                    Benchmark::wakeup_park_spin1k,
+                    Benchmark::wakeup_park_spin10k,
+                    Benchmark::wakeup_park_spin0_reply10us,
+                    Benchmark::wakeup_park_spin100_reply10us,
+                    Benchmark::wakeup_park_spin1k_reply10us,
+                    Benchmark::wakeup_park_spin10k_reply10us,
+                    Benchmark::wakeup_futex_herd_1,
+                    Benchmark::wakeup_futex_herd_2,
+                    Benchmark::wakeup_futex_herd_4,
+                    Benchmark::wakeup_futex_herd_8,
+                    Benchmark::wakeup_futex_herd_16,
                 },
             },
             {
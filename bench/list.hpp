@@ -31,11 +31,17 @@ enum class Category
 {
     asio, first = asio,
     atomic,
+    bandwidth,
     cache,
     condvar,
+    copy,
     directory,
     exception,
+    eytzinger,
     file,
+    flat_hashset,
+    flat_map,
+    flat_set,
     function,
     heap,
     istream,
@@ -47,18 +53,26 @@ enum class Category
     pipe,
     poll,
     process,
+    queue,
+    simd,
     socket,
     string_from,
     string_to,
     std_deque,
     std_hash,
+    std_hashmap,
     std_hashset,
     std_list,
+    std_map,
     std_set,
     std_string,
     std_vector,
     syscall,
     thread,
+    timing,
+    uring,
+    vm,
+    wakeup,
     work, last = work
 };
 
@@ -99,6 +113,163 @@ enum class Benchmark
     atomic_cmp_exchg_strong_xpctd,
     atomic_cmp_exchg_strong_other,
     atomic_pingpong,
+    atomic_fetch_add_shared_1t,
+    atomic_fetch_add_shared_2t,
+    atomic_fetch_add_shared_4t,
+    atomic_fetch_add_shared_8t,
+    atomic_fetch_add_shared_16t,
+    atomic_fetch_add_padded_1t,
+    atomic_fetch_add_padded_2t,
+    atomic_fetch_add_padded_4t,
+    atomic_fetch_add_padded_8t,
+    atomic_fetch_add_padded_16t,
+    atomic_fetch_add_sharded_1t,
+    atomic_fetch_add_sharded_2t,
+    atomic_fetch_add_sharded_4t,
+    atomic_fetch_add_sharded_8t,
+    atomic_fetch_add_sharded_16t,
+    atomic_cas_shared_1t,
+    atomic_cas_shared_2t,
+    atomic_cas_shared_4t,
+    atomic_cas_shared_8t,
+    atomic_cas_shared_16t,
+    atomic_cas_padded_1t,
+    atomic_cas_padded_2t,
+    atomic_cas_padded_4t,
+    atomic_cas_padded_8t,
+    atomic_cas_padded_16t,
+    atomic_exchange_shared_1t,
+    atomic_exchange_shared_2t,
+    atomic_exchange_shared_4t,
+    atomic_exchange_shared_8t,
+    atomic_exchange_shared_16t,
+    atomic_exchange_padded_1t,
+    atomic_exchange_padded_2t,
+    atomic_exchange_padded_4t,
+    atomic_exchange_padded_8t,
+    atomic_exchange_padded_16t,
+    atomic_fetch_add_shared_relaxed_1t,
+    atomic_fetch_add_shared_relaxed_2t,
+    atomic_fetch_add_shared_relaxed_4t,
+    atomic_fetch_add_shared_relaxed_8t,
+    atomic_fetch_add_shared_relaxed_16t,
+    atomic_fetch_add_shared_acq_rel_1t,
+    atomic_fetch_add_shared_acq_rel_2t,
+    atomic_fetch_add_shared_acq_rel_4t,
+    atomic_fetch_add_shared_acq_rel_8t,
+    atomic_fetch_add_shared_acq_rel_16t,
+    atomic_store_relaxed,
+    atomic_store_release,
+    atomic_store_seq_cst,
+    atomic_fence_acquire,
+    atomic_fence_release,
+    atomic_fence_acq_rel,
+    atomic_fence_seq_cst,
+
+    // bandwidth:
+    stream_copy_1t,
+    stream_copy_2t,
+    stream_copy_4t,
+    stream_copy_8t,
+    stream_copy_16t,
+    stream_copy_32t,
+    stream_copy_64t,
+    stream_scale_1t,
+    stream_scale_2t,
+    stream_scale_4t,
+    stream_scale_8t,
+    stream_scale_16t,
+    stream_scale_32t,
+    stream_scale_64t,
+    stream_add_1t,
+    stream_add_2t,
+    stream_add_4t,
+    stream_add_8t,
+    stream_add_16t,
+    stream_add_32t,
+    stream_add_64t,
+    stream_triad_1t,
+    stream_triad_2t,
+    stream_triad_4t,
+    stream_triad_8t,
+    stream_triad_16t,
+    stream_triad_32t,
+    stream_triad_64t,
+
+    // cache:
+    cache_chase_random_4k,
+    cache_chase_random_8k,
+    cache_chase_random_16k,
+    cache_chase_random_32k,
+    cache_chase_random_64k,
+    cache_chase_random_128k,
+    cache_chase_random_256k,
+    cache_chase_random_512k,
+    cache_chase_random_1M,
+    cache_chase_random_2M,
+    cache_chase_random_4M,
+    cache_chase_random_8M,
+    cache_chase_random_16M,
+    cache_chase_random_32M,
+    cache_chase_random_64M,
+    cache_chase_random_128M,
+    cache_chase_random_256M,
+    cache_chase_random_512M,
+    cache_chase_random_1G,
+    cache_chase_seq_64k,
+    cache_chase_seq_1M,
+    cache_chase_seq_16M,
+    cache_chase_seq_256M,
+    cache_chase_stride_64k,
+    cache_chase_stride_1M,
+    cache_chase_stride_16M,
+    cache_chase_stride_256M,
+    cache_page_chase_4M_4k,
+    cache_page_chase_4M_thp,
+    cache_page_chase_4M_2M,
+    cache_page_chase_64M_4k,
+    cache_page_chase_64M_thp,
+    cache_page_chase_64M_2M,
+    cache_page_chase_1G_4k,
+    cache_page_chase_1G_thp,
+    cache_page_chase_1G_2M,
+    cache_page_chase_1G_1G,
+    cache_sharing_0b_write_2t,
+    cache_sharing_0b_write_4t,
+    cache_sharing_0b_write_8t,
+    cache_sharing_0b_mixed_2t,
+    cache_sharing_0b_mixed_4t,
+    cache_sharing_0b_mixed_8t,
+    cache_sharing_0b_readers_2t,
+    cache_sharing_0b_readers_4t,
+    cache_sharing_0b_readers_8t,
+    cache_sharing_8b_write_2t,
+    cache_sharing_8b_write_4t,
+    cache_sharing_8b_write_8t,
+    cache_sharing_8b_mixed_2t,
+    cache_sharing_8b_mixed_4t,
+    cache_sharing_8b_mixed_8t,
+    cache_sharing_8b_readers_2t,
+    cache_sharing_8b_readers_4t,
+    cache_sharing_8b_readers_8t,
+    cache_sharing_64b_write_2t,
+    cache_sharing_64b_write_4t,
+    cache_sharing_64b_write_8t,
+    cache_sharing_64b_mixed_2t,
+    cache_sharing_64b_mixed_4t,
+    cache_sharing_64b_mixed_8t,
+    cache_sharing_64b_readers_2t,
+    cache_sharing_64b_readers_4t,
+    cache_sharing_64b_readers_8t,
+    cache_sharing_128b_write_2t,
+    cache_sharing_128b_write_4t,
+    cache_sharing_128b_write_8t,
+    cache_sharing_128b_mixed_2t,
+    cache_sharing_128b_mixed_4t,
+    cache_sharing_128b_mixed_8t,
+    cache_sharing_128b_readers_2t,
+    cache_sharing_128b_readers_4t,
+    cache_sharing_128b_readers_8t,
 
     // condvar:
     condvar_broadcast,
@@ -106,6 +277,140 @@ enum class Benchmark
     condvar_signal,
     condvar_signal_watched,
 
+    // copy:
+    copy_memcpy_libc_64,
+    copy_memcpy_libc_256,
+    copy_memcpy_libc_1k,
+    copy_memcpy_libc_4k,
+    copy_memcpy_libc_16k,
+    copy_memcpy_libc_64k,
+    copy_memcpy_libc_256k,
+    copy_memcpy_libc_1M,
+    copy_memcpy_libc_4M,
+    copy_memcpy_libc_16M,
+    copy_memcpy_libc_64M,
+    copy_memcpy_rep_64,
+    copy_memcpy_rep_256,
+    copy_memcpy_rep_1k,
+    copy_memcpy_rep_4k,
+    copy_memcpy_rep_16k,
+    copy_memcpy_rep_64k,
+    copy_memcpy_rep_256k,
+    copy_memcpy_rep_1M,
+    copy_memcpy_rep_4M,
+    copy_memcpy_rep_16M,
+    copy_memcpy_rep_64M,
+    copy_memcpy_avx2_64,
+    copy_memcpy_avx2_256,
+    copy_memcpy_avx2_1k,
+    copy_memcpy_avx2_4k,
+    copy_memcpy_avx2_16k,
+    copy_memcpy_avx2_64k,
+    copy_memcpy_avx2_256k,
+    copy_memcpy_avx2_1M,
+    copy_memcpy_avx2_4M,
+    copy_memcpy_avx2_16M,
+    copy_memcpy_avx2_64M,
+    copy_memcpy_nt_64,
+    copy_memcpy_nt_256,
+    copy_memcpy_nt_1k,
+    copy_memcpy_nt_4k,
+    copy_memcpy_nt_16k,
+    copy_memcpy_nt_64k,
+    copy_memcpy_nt_256k,
+    copy_memcpy_nt_1M,
+    copy_memcpy_nt_4M,
+    copy_memcpy_nt_16M,
+    copy_memcpy_nt_64M,
+    copy_memset_libc_64,
+    copy_memset_libc_256,
+    copy_memset_libc_1k,
+    copy_memset_libc_4k,
+    copy_memset_libc_16k,
+    copy_memset_libc_64k,
+    copy_memset_libc_256k,
+    copy_memset_libc_1M,
+    copy_memset_libc_4M,
+    copy_memset_libc_16M,
+    copy_memset_libc_64M,
+    copy_memset_rep_64,
+    copy_memset_rep_256,
+    copy_memset_rep_1k,
+    copy_memset_rep_4k,
+    copy_memset_rep_16k,
+    copy_memset_rep_64k,
+    copy_memset_rep_256k,
+    copy_memset_rep_1M,
+    copy_memset_rep_4M,
+    copy_memset_rep_16M,
+    copy_memset_rep_64M,
+    copy_memset_avx2_64,
+    copy_memset_avx2_256,
+    copy_memset_avx2_1k,
+    copy_memset_avx2_4k,
+    copy_memset_avx2_16k,
+    copy_memset_avx2_64k,
+    copy_memset_avx2_256k,
+    copy_memset_avx2_1M,
+    copy_memset_avx2_4M,
+    copy_memset_avx2_16M,
+    copy_memset_avx2_64M,
+    copy_memset_nt_64,
+    copy_memset_nt_256,
+    copy_memset_nt_1k,
+    copy_memset_nt_4k,
+    copy_memset_nt_16k,
+    copy_memset_nt_64k,
+    copy_memset_nt_256k,
+    copy_memset_nt_1M,
+    copy_memset_nt_4M,
+    copy_memset_nt_16M,
+    copy_memset_nt_64M,
+    copy_memcpy_libc_4k_src1,
+    copy_memcpy_libc_4k_src4,
+    copy_memcpy_libc_4k_src8,
+    copy_memcpy_libc_4k_src16,
+    copy_memcpy_libc_4k_src32,
+    copy_memcpy_libc_4k_src63,
+    copy_memcpy_libc_4k_dst1,
+    copy_memcpy_libc_4k_dst4,
+    copy_memcpy_libc_4k_dst8,
+    copy_memcpy_libc_4k_dst16,
+    copy_memcpy_libc_4k_dst32,
+    copy_memcpy_libc_4k_dst63,
+    copy_memcpy_rep_4k_src1,
+    copy_memcpy_rep_4k_src4,
+    copy_memcpy_rep_4k_src8,
+    copy_memcpy_rep_4k_src16,
+    copy_memcpy_rep_4k_src32,
+    copy_memcpy_rep_4k_src63,
+    copy_memcpy_rep_4k_dst1,
+    copy_memcpy_rep_4k_dst4,
+    copy_memcpy_rep_4k_dst8,
+    copy_memcpy_rep_4k_dst16,
+    copy_memcpy_rep_4k_dst32,
+    copy_memcpy_rep_4k_dst63,
+    copy_memcpy_avx2_4k_src1,
+    copy_memcpy_avx2_4k_src4,
+    copy_memcpy_avx2_4k_src8,
+    copy_memcpy_avx2_4k_src16,
+    copy_memcpy_avx2_4k_src32,
+    copy_memcpy_avx2_4k_src63,
+    copy_memcpy_avx2_4k_dst1,
+    copy_memcpy_avx2_4k_dst4,
+    copy_memcpy_avx2_4k_dst8,
+    copy_memcpy_avx2_4k_dst16,
+    copy_memcpy_avx2_4k_dst32,
+    copy_memcpy_avx2_4k_dst63,
+    copy_memmove_up_256,
+    copy_memmove_up_4k,
+    copy_memmove_up_64k,
+    copy_memmove_up_1M,
+    copy_memmove_down_256,
+    copy_memmove_down_4k,
+    copy_memmove_down_64k,
+    copy_memmove_down_1M,
+
     // directory:
     chmod,
     chown,
@@ -128,6 +433,54 @@ enum class Benchmark
     exception_noexcept,
     exception_try,
 
+    // eytzinger:
+    eytzinger_int32_copy16,
+    eytzinger_int32_copy256,
+    eytzinger_int32_copy4k,
+    eytzinger_int32_copy64k,
+    eytzinger_int32_copy1M,
+    eytzinger_int32_destroy16,
+    eytzinger_int32_destroy256,
+    eytzinger_int32_destroy4k,
+    eytzinger_int32_destroy64k,
+    eytzinger_int32_destroy1M,
+    eytzinger_int32_find1,
+    eytzinger_int32_find16,
+    eytzinger_int32_find256,
+    eytzinger_int32_find4k,
+    eytzinger_int32_find64k,
+    eytzinger_int32_find1M,
+    eytzinger_int32_insert16,
+    eytzinger_int32_insert256,
+    eytzinger_int32_insert4k,
+    eytzinger_int32_insert64k,
+    eytzinger_int32_insert1M,
+    eytzinger_int32_iterate16,
+    eytzinger_int32_iterate256,
+    eytzinger_int32_iterate4k,
+    eytzinger_int32_iterate64k,
+    eytzinger_int32_iterate1M,
+    eytzinger_int64_copy64k,
+    eytzinger_int64_destroy64k,
+    eytzinger_int64_find64k,
+    eytzinger_int64_insert4k,
+    eytzinger_int64_iterate64k,
+    eytzinger_float_copy64k,
+    eytzinger_float_destroy64k,
+    eytzinger_float_find64k,
+    eytzinger_float_insert4k,
+    eytzinger_float_iterate64k,
+    eytzinger_double_copy64k,
+    eytzinger_double_destroy64k,
+    eytzinger_double_find64k,
+    eytzinger_double_insert4k,
+    eytzinger_double_iterate64k,
+    eytzinger_string_copy64k,
+    eytzinger_string_destroy64k,
+    eytzinger_string_find64k,
+    eytzinger_string_insert4k,
+    eytzinger_string_iterate64k,
+
     // file:
     file_append,
     file_close,
@@ -166,6 +519,196 @@ enum class Benchmark
     file_write_direct_1M,
     file_write_direct_16M,
 
+    // flat_hashset:
+    linearset_int32_copy16,
+    linearset_int32_copy256,
+    linearset_int32_copy4k,
+    linearset_int32_copy64k,
+    linearset_int32_copy1M,
+    linearset_int32_destroy16,
+    linearset_int32_destroy256,
+    linearset_int32_destroy4k,
+    linearset_int32_destroy64k,
+    linearset_int32_destroy1M,
+    linearset_int32_find1,
+    linearset_int32_find16,
+    linearset_int32_find256,
+    linearset_int32_find4k,
+    linearset_int32_find64k,
+    linearset_int32_find1M,
+    linearset_int32_insert16,
+    linearset_int32_insert256,
+    linearset_int32_insert4k,
+    linearset_int32_insert64k,
+    linearset_int32_insert1M,
+    linearset_int32_iterate16,
+    linearset_int32_iterate256,
+    linearset_int32_iterate4k,
+    linearset_int32_iterate64k,
+    linearset_int32_iterate1M,
+    linearset_int64_copy64k,
+    linearset_int64_destroy64k,
+    linearset_int64_find64k,
+    linearset_int64_insert4k,
+    linearset_int64_iterate64k,
+    linearset_float_copy64k,
+    linearset_float_destroy64k,
+    linearset_float_find64k,
+    linearset_float_insert4k,
+    linearset_float_iterate64k,
+    linearset_double_copy64k,
+    linearset_double_destroy64k,
+    linearset_double_find64k,
+    linearset_double_insert4k,
+    linearset_double_iterate64k,
+    linearset_string_copy64k,
+    linearset_string_destroy64k,
+    linearset_string_find64k,
+    linearset_string_insert4k,
+    linearset_string_iterate64k,
+    swissset_int32_copy16,
+    swissset_int32_copy256,
+    swissset_int32_copy4k,
+    swissset_int32_copy64k,
+    swissset_int32_copy1M,
+    swissset_int32_destroy16,
+    swissset_int32_destroy256,
+    swissset_int32_destroy4k,
+    swissset_int32_destroy64k,
+    swissset_int32_destroy1M,
+    swissset_int32_find1,
+    swissset_int32_find16,
+    swissset_int32_find256,
+    swissset_int32_find4k,
+    swissset_int32_find64k,
+    swissset_int32_find1M,
+    swissset_int32_insert16,
+    swissset_int32_insert256,
+    swissset_int32_insert4k,
+    swissset_int32_insert64k,
+    swissset_int32_insert1M,
+    swissset_int32_iterate16,
+    swissset_int32_iterate256,
+    swissset_int32_iterate4k,
+    swissset_int32_iterate64k,
+    swissset_int32_iterate1M,
+    swissset_int64_copy64k,
+    swissset_int64_destroy64k,
+    swissset_int64_find64k,
+    swissset_int64_insert4k,
+    swissset_int64_iterate64k,
+    swissset_float_copy64k,
+    swissset_float_destroy64k,
+    swissset_float_find64k,
+    swissset_float_insert4k,
+    swissset_float_iterate64k,
+    swissset_double_copy64k,
+    swissset_double_destroy64k,
+    swissset_double_find64k,
+    swissset_double_insert4k,
+    swissset_double_iterate64k,
+    swissset_string_copy64k,
+    swissset_string_destroy64k,
+    swissset_string_find64k,
+    swissset_string_insert4k,
+    swissset_string_iterate64k,
+
+    // flat_map:
+    flatmap_int32_copy16,
+    flatmap_int32_copy256,
+    flatmap_int32_copy4k,
+    flatmap_int32_copy64k,
+    flatmap_int32_copy1M,
+    flatmap_int32_destroy16,
+    flatmap_int32_destroy256,
+    flatmap_int32_destroy4k,
+    flatmap_int32_destroy64k,
+    flatmap_int32_destroy1M,
+    flatmap_int32_find1,
+    flatmap_int32_find16,
+    flatmap_int32_find256,
+    flatmap_int32_find4k,
+    flatmap_int32_find64k,
+    flatmap_int32_find1M,
+    flatmap_int32_insert16,
+    flatmap_int32_insert256,
+    flatmap_int32_insert4k,
+    flatmap_int32_insert64k,
+    flatmap_int32_insert1M,
+    flatmap_int32_iterate16,
+    flatmap_int32_iterate256,
+    flatmap_int32_iterate4k,
+    flatmap_int32_iterate64k,
+    flatmap_int32_iterate1M,
+    flatmap_int64_copy64k,
+    flatmap_int64_destroy64k,
+    flatmap_int64_find64k,
+    flatmap_int64_insert4k,
+    flatmap_int64_iterate64k,
+    flatmap_float_copy64k,
+    flatmap_float_destroy64k,
+    flatmap_float_find64k,
+    flatmap_float_insert4k,
+    flatmap_float_iterate64k,
+    flatmap_double_copy64k,
+    flatmap_double_destroy64k,
+    flatmap_double_find64k,
+    flatmap_double_insert4k,
+    flatmap_double_iterate64k,
+    flatmap_string_copy64k,
+    flatmap_string_destroy64k,
+    flatmap_string_find64k,
+    flatmap_string_insert4k,
+    flatmap_string_iterate64k,
+
+    // flat_set:
+    flatset_int32_copy16,
+    flatset_int32_copy256,
+    flatset_int32_copy4k,
+    flatset_int32_copy64k,
+    flatset_int32_copy1M,
+    flatset_int32_destroy16,
+    flatset_int32_destroy256,
+    flatset_int32_destroy4k,
+    flatset_int32_destroy64k,
+    flatset_int32_destroy1M,
+    flatset_int32_find1,
+    flatset_int32_find16,
+    flatset_int32_find256,
+    flatset_int32_find4k,
+    flatset_int32_find64k,
+    flatset_int32_find1M,
+    flatset_int32_insert16,
+    flatset_int32_insert256,
+    flatset_int32_insert4k,
+    flatset_int32_insert64k,
+    flatset_int32_insert1M,
+    flatset_int32_iterate16,
+    flatset_int32_iterate256,
+    flatset_int32_iterate4k,
+    flatset_int32_iterate64k,
+    flatset_int32_iterate1M,
+    flatset_int64_copy64k,
+    flatset_int64_destroy64k,
+    flatset_int64_find64k,
+    flatset_int64_insert4k,
+    flatset_int64_iterate64k,
+    flatset_float_copy64k,
+    flatset_float_destroy64k,
+    flatset_float_find64k,
+    flatset_float_insert4k,
+    flatset_float_iterate64k,
+    flatset_double_copy64k,
+    flatset_double_destroy64k,
+    flatset_double_find64k,
+    flatset_double_insert4k,
+    flatset_double_iterate64k,
+    flatset_string_copy64k,
+    flatset_string_destroy64k,
+    flatset_string_find64k,
+    flatset_string_insert4k,
+    flatset_string_iterate64k,
+
     // function:
     function_args0,
     function_args1,
@@ -210,6 +753,10 @@ enum class Benchmark
     memcpy_1M,
     memcpy_16M,
     memcpy_256M,
+    memcpy_256M_4k,
+    memcpy_256M_thp,
+    memcpy_256M_2M,
+    memcpy_256M_1G,
     strcmp_16,
     strcmp_256,
     strcmp_4k,
@@ -242,12 +789,69 @@ enum class Benchmark
     memread_1M,
     memread_16M,
     memread_256M,
-    cache_false_sharing,
+    memread_256M_4k,
+    memread_256M_thp,
+    memread_256M_2M,
+    memread_256M_1G,
 
     // mutex:
     mutex_create_destroy,
     mutex_lock_release,
     mutex_trylock,
+    mutex_contended_pthread_2t,
+    mutex_contended_pthread_4t,
+    mutex_contended_pthread_8t,
+    mutex_contended_pthread_16t,
+    mutex_contended_pthread_adaptive_2t,
+    mutex_contended_pthread_adaptive_4t,
+    mutex_contended_pthread_adaptive_8t,
+    mutex_contended_pthread_adaptive_16t,
+    mutex_contended_std_mutex_2t,
+    mutex_contended_std_mutex_4t,
+    mutex_contended_std_mutex_8t,
+    mutex_contended_std_mutex_16t,
+    mutex_contended_rwlock_read_2t,
+    mutex_contended_rwlock_read_4t,
+    mutex_contended_rwlock_read_8t,
+    mutex_contended_rwlock_read_16t,
+    mutex_contended_rwlock_write_2t,
+    mutex_contended_rwlock_write_4t,
+    mutex_contended_rwlock_write_8t,
+    mutex_contended_rwlock_write_16t,
+    mutex_contended_ttas_2t,
+    mutex_contended_ttas_4t,
+    mutex_contended_ttas_8t,
+    mutex_contended_ttas_16t,
+    mutex_contended_ticket_2t,
+    mutex_contended_ticket_4t,
+    mutex_contended_ticket_8t,
+    mutex_contended_ticket_16t,
+    mutex_contended_mcs_2t,
+    mutex_contended_mcs_4t,
+    mutex_contended_mcs_8t,
+    mutex_contended_mcs_16t,
+    mutex_contended_futex_2t,
+    mutex_contended_futex_4t,
+    mutex_contended_futex_8t,
+    mutex_contended_futex_16t,
+
+    // network:
+    network_accept,
+    network_rps_1c,
+    network_rps_2c,
+    network_rps_4c,
+    network_rps_8c,
+    network_rps_16c,
+    network_rps_32c,
+    network_rps_64c,
+    network_stream_256,
+    network_stream_4k,
+    network_stream_64k,
+    network_stream_1M,
+    network_gather_1,
+    network_gather_4,
+    network_gather_16,
+    network_gather_64,
 
     // ostream:
     ostream_string4,
@@ -315,6 +919,59 @@ enum class Benchmark
     fork_exec_waitpid,
     system,
 
+    // queue:
+    queue_spsc_latency,
+    queue_spsc_roundtrip,
+    queue_spsc_throughput,
+    queue_spsc_batch_throughput,
+    queue_spsc_cached_latency,
+    queue_spsc_cached_roundtrip,
+    queue_spsc_cached_throughput,
+    queue_spsc_cached_batch_throughput,
+    queue_mpmc_latency,
+    queue_mpmc_roundtrip,
+    queue_mpmc_throughput_1p1c,
+    queue_mpmc_throughput_2p2c,
+    queue_mpmc_throughput_4p4c,
+    queue_mpmc_throughput_1p4c,
+    queue_mpmc_throughput_4p1c,
+    queue_mpmc_batch_throughput_1p1c,
+    queue_mpmc_batch_throughput_2p2c,
+    queue_mpmc_batch_throughput_4p4c,
+    queue_mpsc_latency,
+    queue_mpsc_roundtrip,
+    queue_mpsc_throughput_1p,
+    queue_mpsc_throughput_2p,
+    queue_mpsc_throughput_4p,
+    queue_mpsc_throughput_8p,
+    queue_mpsc_batch_throughput_1p,
+    queue_mpsc_batch_throughput_4p,
+
+    // simd:
+    simd_sum_scalar,
+    simd_sum_sse42,
+    simd_sum_avx2,
+    simd_sum_avx512,
+    simd_dot_scalar,
+    simd_dot_sse42,
+    simd_dot_avx2,
+    simd_dot_avx512,
+    simd_find_scalar,
+    simd_find_sse42,
+    simd_find_avx2,
+    simd_find_avx512,
+    simd_prefix_sum_scalar,
+    simd_prefix_sum_sse42,
+    simd_prefix_sum_avx2,
+    simd_prefix_sum_avx512,
+    simd_mandelbrot_scalar,
+    simd_mandelbrot_sse42,
+    simd_mandelbrot_avx2,
+    simd_mandelbrot_avx512,
+    simd_fma_scalar,
+    simd_fma_avx2,
+    simd_fma_avx512,
+
     // std_deque
     deque_int32_copy16,
     deque_int32_copy256,
@@ -362,6 +1019,22 @@ enum class Benchmark
     deque_string_find64k,
     deque_string_insert4k,
     deque_string_iterate64k,
+    deque_arena_int32_destroy64k,
+    deque_arena_int32_find64k,
+    deque_arena_int32_insert64k,
+    deque_arena_int32_iterate1M,
+    deque_mono_int32_destroy64k,
+    deque_mono_int32_find64k,
+    deque_mono_int32_insert64k,
+    deque_mono_int32_iterate1M,
+    deque_spool_int32_destroy64k,
+    deque_spool_int32_find64k,
+    deque_spool_int32_insert64k,
+    deque_spool_int32_iterate1M,
+    deque_upool_int32_destroy64k,
+    deque_upool_int32_find64k,
+    deque_upool_int32_insert64k,
+    deque_upool_int32_iterate1M,
 
     // std_hash
     hash_int8,
@@ -376,6 +1049,60 @@ enum class Benchmark
     hash_string_4k,
     hash_string_64k,
 
+    // std_hashmap
+    hashmap_int32_p8_copy64k,
+    hashmap_int32_p8_destroy64k,
+    hashmap_int32_p8_erase64k,
+    hashmap_int32_p8_find64k,
+    hashmap_int32_p8_findmiss64k,
+    hashmap_int32_p8_insert64k,
+    hashmap_int32_p8_insertreserved64k,
+    hashmap_int32_p8_iterate64k,
+    hashmap_int32_p8_rehash64k,
+    hashmap_int32_p16_copy64k,
+    hashmap_int32_p16_destroy64k,
+    hashmap_int32_p16_find64k,
+    hashmap_int32_p16_insert64k,
+    hashmap_int32_p16_iterate64k,
+    hashmap_int32_p32_copy64k,
+    hashmap_int32_p32_destroy64k,
+    hashmap_int32_p32_find64k,
+    hashmap_int32_p32_insert64k,
+    hashmap_int32_p32_iterate64k,
+    hashmap_int32_p64_copy64k,
+    hashmap_int32_p64_destroy64k,
+    hashmap_int32_p64_erase64k,
+    hashmap_int32_p64_find64k,
+    hashmap_int32_p64_findmiss64k,
+    hashmap_int32_p64_insert64k,
+    hashmap_int32_p64_insertreserved64k,
+    hashmap_int32_p64_iterate64k,
+    hashmap_int32_p64_rehash64k,
+    hashmap_int32_p128_copy64k,
+    hashmap_int32_p128_destroy64k,
+    hashmap_int32_p128_find64k,
+    hashmap_int32_p128_insert64k,
+    hashmap_int32_p128_iterate64k,
+    hashmap_int32_p256_copy64k,
+    hashmap_int32_p256_destroy64k,
+    hashmap_int32_p256_erase64k,
+    hashmap_int32_p256_find64k,
+    hashmap_int32_p256_findmiss64k,
+    hashmap_int32_p256_insert64k,
+    hashmap_int32_p256_insertreserved64k,
+    hashmap_int32_p256_iterate64k,
+    hashmap_int32_p256_rehash64k,
+    hashmap_int64_p64_copy64k,
+    hashmap_int64_p64_destroy64k,
+    hashmap_int64_p64_find64k,
+    hashmap_int64_p64_insert4k,
+    hashmap_int64_p64_iterate64k,
+    hashmap_string_p64_copy64k,
+    hashmap_string_p64_destroy64k,
+    hashmap_string_p64_find64k,
+    hashmap_string_p64_insert4k,
+    hashmap_string_p64_iterate64k,
+
     // std_hashset
     hashset_int32_copy16,
     hashset_int32_copy256,
@@ -423,6 +1150,22 @@ enum class Benchmark
     hashset_string_find64k,
     hashset_string_insert4k,
     hashset_string_iterate64k,
+    hashset_arena_int32_destroy64k,
+    hashset_arena_int32_find64k,
+    hashset_arena_int32_insert64k,
+    hashset_arena_int32_iterate1M,
+    hashset_mono_int32_destroy64k,
+    hashset_mono_int32_find64k,
+    hashset_mono_int32_insert64k,
+    hashset_mono_int32_iterate1M,
+    hashset_spool_int32_destroy64k,
+    hashset_spool_int32_find64k,
+    hashset_spool_int32_insert64k,
+    hashset_spool_int32_iterate1M,
+    hashset_upool_int32_destroy64k,
+    hashset_upool_int32_find64k,
+    hashset_upool_int32_insert64k,
+    hashset_upool_int32_iterate1M,
 
     // std_list
     list_int32_copy16,
@@ -471,6 +1214,70 @@ enum class Benchmark
     list_string_find64k,
     list_string_insert4k,
     list_string_iterate64k,
+    list_arena_int32_destroy64k,
+    list_arena_int32_find64k,
+    list_arena_int32_insert64k,
+    list_arena_int32_iterate1M,
+    list_mono_int32_destroy64k,
+    list_mono_int32_find64k,
+    list_mono_int32_insert64k,
+    list_mono_int32_iterate1M,
+    list_spool_int32_destroy64k,
+    list_spool_int32_find64k,
+    list_spool_int32_insert64k,
+    list_spool_int32_iterate1M,
+    list_upool_int32_destroy64k,
+    list_upool_int32_find64k,
+    list_upool_int32_insert64k,
+    list_upool_int32_iterate1M,
+
+    // std_map
+    map_int32_p8_copy64k,
+    map_int32_p8_destroy64k,
+    map_int32_p8_erase64k,
+    map_int32_p8_find64k,
+    map_int32_p8_findmiss64k,
+    map_int32_p8_insert64k,
+    map_int32_p8_iterate64k,
+    map_int32_p16_copy64k,
+    map_int32_p16_destroy64k,
+    map_int32_p16_find64k,
+    map_int32_p16_insert64k,
+    map_int32_p16_iterate64k,
+    map_int32_p32_copy64k,
+    map_int32_p32_destroy64k,
+    map_int32_p32_find64k,
+    map_int32_p32_insert64k,
+    map_int32_p32_iterate64k,
+    map_int32_p64_copy64k,
+    map_int32_p64_destroy64k,
+    map_int32_p64_erase64k,
+    map_int32_p64_find64k,
+    map_int32_p64_findmiss64k,
+    map_int32_p64_insert64k,
+    map_int32_p64_iterate64k,
+    map_int32_p128_copy64k,
+    map_int32_p128_destroy64k,
+    map_int32_p128_find64k,
+    map_int32_p128_insert64k,
+    map_int32_p128_iterate64k,
+    map_int32_p256_copy64k,
+    map_int32_p256_destroy64k,
+    map_int32_p256_erase64k,
+    map_int32_p256_find64k,
+    map_int32_p256_findmiss64k,
+    map_int32_p256_insert64k,
+    map_int32_p256_iterate64k,
+    map_int64_p64_copy64k,
+    map_int64_p64_destroy64k,
+    map_int64_p64_find64k,
+    map_int64_p64_insert4k,
+    map_int64_p64_iterate64k,
+    map_string_p64_copy64k,
+    map_string_p64_destroy64k,
+    map_string_p64_find64k,
+    map_string_p64_insert4k,
+    map_string_p64_iterate64k,
 
     // std_set
     set_int32_copy16,
@@ -519,6 +1326,22 @@ enum class Benchmark
     set_string_find64k,
     set_string_insert4k,
     set_string_iterate64k,
+    set_arena_int32_destroy64k,
+    set_arena_int32_find64k,
+    set_arena_int32_insert64k,
+    set_arena_int32_iterate1M,
+    set_mono_int32_destroy64k,
+    set_mono_int32_find64k,
+    set_mono_int32_insert64k,
+    set_mono_int32_iterate1M,
+    set_spool_int32_destroy64k,
+    set_spool_int32_find64k,
+    set_spool_int32_insert64k,
+    set_spool_int32_iterate1M,
+    set_upool_int32_destroy64k,
+    set_upool_int32_find64k,
+    set_upool_int32_insert64k,
+    set_upool_int32_iterate1M,
 
     // std_vector
     vec_int32_copy4k,
@@ -562,6 +1385,61 @@ enum class Benchmark
     vec_string_find64k,
     vec_string_insert4k,
     vec_string_iterate64k,
+    vec_arena_int32_destroy64k,
+    vec_arena_int32_find64k,
+    vec_arena_int32_insert64k,
+    vec_arena_int32_iterate1M,
+    vec_mono_int32_destroy64k,
+    vec_mono_int32_find64k,
+    vec_mono_int32_insert64k,
+    vec_mono_int32_iterate1M,
+    vec_spool_int32_destroy64k,
+    vec_spool_int32_find64k,
+    vec_spool_int32_insert64k,
+    vec_spool_int32_iterate1M,
+    vec_upool_int32_destroy64k,
+    vec_upool_int32_find64k,
+    vec_upool_int32_insert64k,
+    vec_upool_int32_iterate1M,
+
+    // socket:
+    socket_open_close_tcp,
+    socket_open_close_udp,
+    socket_open_close_unix,
+    socket_connect_accept_tcp,
+    socket_connect_accept_unix,
+    socket_send_recv_tcp_64,
+    socket_send_recv_tcp_256,
+    socket_send_recv_tcp_1k,
+    socket_send_recv_tcp_4k,
+    socket_send_recv_tcp_16k,
+    socket_send_recv_tcp_64k,
+    socket_send_recv_unix_64,
+    socket_send_recv_unix_256,
+    socket_send_recv_unix_1k,
+    socket_send_recv_unix_4k,
+    socket_send_recv_unix_16k,
+    socket_send_recv_unix_64k,
+    socket_send_recv_udp_64,
+    socket_send_recv_udp_1k,
+    socket_send_recv_udp_16k,
+    socket_send_recv_unix_dgram_64,
+    socket_send_recv_unix_dgram_1k,
+    socket_send_recv_unix_dgram_16k,
+    socket_pingpong_tcp_256,
+    socket_pingpong_tcp_1k,
+    socket_pingpong_tcp_4k,
+    socket_pingpong_tcp_16k,
+    socket_pingpong_tcp_64k,
+    socket_pingpong_tcp_256_busy_poll,
+    socket_pingpong_unix_256,
+    socket_pingpong_unix_1k,
+    socket_pingpong_unix_4k,
+    socket_pingpong_unix_16k,
+    socket_pingpong_unix_64k,
+    socket_mmsg_udp_1,
+    socket_mmsg_udp_8,
+    socket_mmsg_udp_32,
 
     // string_from:
     string_from_smallint,
@@ -585,9 +1463,213 @@ enum class Benchmark
     string_to_bigdouble_os,
     string_to_bigdouble_ts,
 
+    // syscall:
+    syscall_getpid,
+    syscall_getpid_seccomp,
+    syscall_getpid_seccomp_args,
+    syscall_gettid,
+    syscall_clock_gettime_realtime_vdso,
+    syscall_clock_gettime_realtime_syscall,
+    syscall_clock_gettime_realtime_coarse_vdso,
+    syscall_clock_gettime_realtime_coarse_syscall,
+    syscall_clock_gettime_monotonic_vdso,
+    syscall_clock_gettime_monotonic_syscall,
+    syscall_clock_gettime_monotonic_coarse_vdso,
+    syscall_clock_gettime_monotonic_coarse_syscall,
+    syscall_clock_gettime_monotonic_raw_vdso,
+    syscall_clock_gettime_monotonic_raw_syscall,
+    syscall_clock_gettime_boottime_vdso,
+    syscall_clock_gettime_boottime_syscall,
+    syscall_clock_gettime_process_cputime_vdso,
+    syscall_clock_gettime_process_cputime_syscall,
+    syscall_clock_gettime_thread_cputime_vdso,
+    syscall_clock_gettime_thread_cputime_syscall,
+    syscall_getcpu_vdso,
+    syscall_getcpu_syscall,
+    syscall_getrusage,
+    syscall_sched_yield,
+    syscall_ioctl_badfd,
+
     // thread:
     thread_create_destroy,
     thread_pingpong,
+    thread_task_spawn_steal,
+    thread_task_spawn_shared,
+    thread_task_spawn_async,
+    thread_task_tree_steal_4w,
+    thread_task_tree_shared_4w,
+    thread_task_tree_async,
+    thread_task_handoff_steal,
+    thread_task_handoff_shared,
+    thread_task_tiny_steal_1w,
+    thread_task_tiny_steal_2w,
+    thread_task_tiny_steal_4w,
+    thread_task_tiny_steal_8w,
+    thread_task_tiny_shared_1w,
+    thread_task_tiny_shared_2w,
+    thread_task_tiny_shared_4w,
+    thread_task_tiny_shared_8w,
+    thread_task_tiny_async,
+    thread_task_medium_steal_1w,
+    thread_task_medium_steal_2w,
+    thread_task_medium_steal_4w,
+    thread_task_medium_steal_8w,
+    thread_task_medium_shared_1w,
+    thread_task_medium_shared_2w,
+    thread_task_medium_shared_4w,
+    thread_task_medium_shared_8w,
+    thread_task_medium_async,
+
+    // timing:
+    timing_nanosleep_1us,
+    timing_nanosleep_10us,
+    timing_nanosleep_100us,
+    timing_nanosleep_1ms,
+    timing_nanosleep_10ms,
+    timing_nanosleep_1us_fifo,
+    timing_nanosleep_10us_fifo,
+    timing_nanosleep_100us_fifo,
+    timing_nanosleep_1ms_fifo,
+    timing_nanosleep_10ms_fifo,
+    timing_abstime_1us,
+    timing_abstime_10us,
+    timing_abstime_100us,
+    timing_abstime_1ms,
+    timing_abstime_10ms,
+    timing_abstime_1us_fifo,
+    timing_abstime_10us_fifo,
+    timing_abstime_100us_fifo,
+    timing_abstime_1ms_fifo,
+    timing_abstime_10ms_fifo,
+    timing_timerfd_1us,
+    timing_timerfd_10us,
+    timing_timerfd_100us,
+    timing_timerfd_1ms,
+    timing_timerfd_10ms,
+    timing_timerfd_1us_fifo,
+    timing_timerfd_10us_fifo,
+    timing_timerfd_100us_fifo,
+    timing_timerfd_1ms_fifo,
+    timing_timerfd_10ms_fifo,
+    timing_epoll_1us,
+    timing_epoll_10us,
+    timing_epoll_100us,
+    timing_epoll_1ms,
+    timing_epoll_10ms,
+    timing_epoll_1us_fifo,
+    timing_epoll_10us_fifo,
+    timing_epoll_100us_fifo,
+    timing_epoll_1ms_fifo,
+    timing_epoll_10ms_fifo,
+    timing_asio_1us,
+    timing_asio_10us,
+    timing_asio_100us,
+    timing_asio_1ms,
+    timing_asio_10ms,
+    timing_asio_1us_fifo,
+    timing_asio_10us_fifo,
+    timing_asio_100us_fifo,
+    timing_asio_1ms_fifo,
+    timing_asio_10ms_fifo,
+
+    // uring:
+    uring_buffered_randread_qd1,
+    uring_buffered_randread_qd4,
+    uring_buffered_randread_qd16,
+    uring_buffered_randread_qd64,
+    uring_buffered_randread_qd256,
+    uring_buffered_seqread_qd1,
+    uring_buffered_seqread_qd4,
+    uring_buffered_seqread_qd16,
+    uring_buffered_seqread_qd64,
+    uring_buffered_seqread_qd256,
+    uring_buffered_randwrite_qd1,
+    uring_buffered_randwrite_qd4,
+    uring_buffered_randwrite_qd16,
+    uring_buffered_randwrite_qd64,
+    uring_buffered_randwrite_qd256,
+    uring_buffered_seqwrite_qd1,
+    uring_buffered_seqwrite_qd4,
+    uring_buffered_seqwrite_qd16,
+    uring_buffered_seqwrite_qd64,
+    uring_buffered_seqwrite_qd256,
+    uring_buffered_randread_fixed_qd16,
+    uring_buffered_randwrite_fixed_qd16,
+    uring_buffered_randread_sqpoll_qd16,
+    uring_buffered_randwrite_sqpoll_qd16,
+    uring_buffered_seqwrite_fsync_qd1,
+    uring_buffered_seqwrite_fsync_qd16,
+    uring_direct_randread_qd1,
+    uring_direct_randread_qd4,
+    uring_direct_randread_qd16,
+    uring_direct_randread_qd64,
+    uring_direct_randread_qd256,
+    uring_direct_seqread_qd1,
+    uring_direct_seqread_qd4,
+    uring_direct_seqread_qd16,
+    uring_direct_seqread_qd64,
+    uring_direct_seqread_qd256,
+    uring_direct_randwrite_qd1,
+    uring_direct_randwrite_qd4,
+    uring_direct_randwrite_qd16,
+    uring_direct_randwrite_qd64,
+    uring_direct_randwrite_qd256,
+    uring_direct_seqwrite_qd1,
+    uring_direct_seqwrite_qd4,
+    uring_direct_seqwrite_qd16,
+    uring_direct_seqwrite_qd64,
+    uring_direct_seqwrite_qd256,
+    uring_direct_randread_fixed_qd16,
+    uring_direct_randwrite_fixed_qd16,
+    uring_direct_randread_sqpoll_qd16,
+    uring_direct_randwrite_sqpoll_qd16,
+    uring_direct_seqwrite_fsync_qd1,
+    uring_direct_seqwrite_fsync_qd16,
+
+    // vm:
+    vm_fault_anon_4k,
+    vm_fault_anon_thp,
+    vm_fault_file_4k,
+    vm_mmap_populate_1M,
+    vm_mmap_populate_16M,
+    vm_mmap_touch_1M,
+    vm_mmap_touch_16M,
+    vm_munmap_1t,
+    vm_munmap_2t,
+    vm_munmap_4t,
+    vm_munmap_8t,
+    vm_munmap_16t,
+    vm_madvise_dontneed_1M,
+    vm_madvise_free_1M,
+    vm_mprotect_4k,
+    vm_mprotect_1M,
+    vm_mremap_grow_1M,
+    vm_mremap_grow_64M,
+    vm_realloc_grow_1M,
+    vm_realloc_grow_64M,
+    vm_copy_grow_1M,
+    vm_copy_grow_64M,
+
+    // wakeup:
+    wakeup_futex_wake_no_waiters,
+    wakeup_futex_wait_mismatch,
+    wakeup_futex_pingpong,
+    wakeup_eventfd_pingpong,
+    wakeup_futex_latency,
+    wakeup_eventfd_latency,
+    wakeup_park_spin0,
+    wakeup_park_spin100,
+    wakeup_park_spin1k,
+    wakeup_park_spin10k,
+    wakeup_park_spin0_reply10us,
+    wakeup_park_spin100_reply10us,
+    wakeup_park_spin1k_reply10us,
+    wakeup_park_spin10k_reply10us,
+    wakeup_futex_herd_1,
+    wakeup_futex_herd_2,
+    wakeup_futex_herd_4,
+    wakeup_futex_herd_8,
+    wakeup_futex_herd_16,
 
     // work:
     fibonacci_u64,
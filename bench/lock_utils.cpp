@@ -0,0 +1,263 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Lock implementations and support for the contended mutex benchmarks.
+/*! @file
+
+    See lock_utils.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "lock_utils.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <ostream>
+
+#include "thread_utils.hpp"
+
+
+namespace bench
+{
+
+
+const char *ToCStr( LockKind kind )
+{
+    switch (kind)
+    {
+#define CASE( n ) \
+    case LockKind::n: \
+        return #n
+
+    CASE( pthread );
+    CASE( pthread_adaptive );
+    CASE( std_mutex );
+    CASE( rwlock_read );
+    CASE( rwlock_write );
+    CASE( ttas );
+    CASE( ticket );
+    CASE( mcs );
+    CASE( futex );
+
+#undef CASE
+    }
+
+    return nullptr;
+}
+
+
+    // Upper limit on the PAUSEs between attempts to acquire a TtasLock.
+static constexpr int Max_backoff = 1024;
+
+
+void TtasLock::lock()
+{
+    SpinWait wait;
+    int backoff = 1;
+    for (;;)
+    {
+        // Spin on a shared copy of the cache line, until the lock looks free.
+        while (locked_.load( std::memory_order_relaxed )) wait();
+
+        if (!locked_.exchange( true, std::memory_order_acquire )) return;
+
+        // Lost the race, so stay off the line for a while.
+        for (int i = 0; i < backoff; ++i) CpuRelax();
+        backoff = std::min( backoff * 2, Max_backoff );
+    }
+}
+
+
+void TicketLock::lock()
+{
+    const uint32_t ticket = next_.fetch_add( 1, std::memory_order_relaxed );
+
+    SpinWait wait;
+    while (serving_.load( std::memory_order_acquire ) != ticket) wait();
+}
+
+
+void TicketLock::unlock()
+{
+    // Only the holder writes serving_, so this needn't be atomic RMW.
+    const uint32_t ticket = serving_.load( std::memory_order_relaxed );
+    serving_.store( ticket + 1, std::memory_order_release );
+}
+
+
+void McsLock::lock( Node &node )
+{
+    node.next.store( nullptr, std::memory_order_relaxed );
+    node.locked.store( true, std::memory_order_relaxed );
+
+    Node *const prev = tail_.exchange( &node, std::memory_order_acq_rel );
+    if (!prev) return;
+
+    prev->next.store( &node, std::memory_order_release );
+
+    SpinWait wait;
+    while (node.locked.load( std::memory_order_acquire )) wait();
+}
+
+
+void McsLock::unlock( Node &node )
+{
+    Node *next = node.next.load( std::memory_order_acquire );
+    if (!next)
+    {
+        // No known successor, so try to mark the queue empty.
+        Node *expected = &node;
+        if (tail_.compare_exchange_strong(
+                expected, nullptr, std::memory_order_release, std::memory_order_relaxed ))
+        {
+            return;
+        }
+
+        // A successor has enqueued itself, but not yet linked itself to this node.
+        SpinWait wait;
+        while (!(next = node.next.load( std::memory_order_acquire ))) wait();
+    }
+
+    next->locked.store( false, std::memory_order_release );
+}
+
+
+void FutexLock::lock()
+{
+    int c = 0;
+    if (state_.compare_exchange_strong( c, 1, std::memory_order_acquire )) return;
+
+    // Mark the lock contended, so the holder will wake a waiter upon unlocking.
+    if (c != 2) c = state_.exchange( 2, std::memory_order_acquire );
+    while (c != 0)
+    {
+        FutexWait( state_, 2 );
+        c = state_.exchange( 2, std::memory_order_acquire );
+    }
+}
+
+
+void FutexLock::unlock()
+{
+    if (state_.fetch_sub( 1, std::memory_order_release ) != 1)
+    {
+        state_.store( 0, std::memory_order_release );
+        FutexWake( state_, 1 );
+    }
+}
+
+
+static LockWork Work;
+
+
+LockWork GetLockWork()
+{
+    return Work;
+}
+
+
+void SetLockWork( const LockWork &work )
+{
+    Work = work;
+}
+
+
+void BusyWork( int n )
+{
+    for (int i = 0; i < n; ++i) asm volatile( "" );
+}
+
+
+bool GetLockParams( Benchmark benchmark, LockParams &params )
+{
+    switch (benchmark)
+    {
+#define CASE( k, n ) \
+    case Benchmark::mutex_contended_##k##_##n##t: \
+        params = { LockKind::k, n }; \
+        return true
+
+#define CASES( k ) \
+    CASE( k, 2 ); \
+    CASE( k, 4 ); \
+    CASE( k, 8 ); \
+    CASE( k, 16 )
+
+    CASES( pthread );
+    CASES( pthread_adaptive );
+    CASES( std_mutex );
+    CASES( rwlock_read );
+    CASES( rwlock_write );
+    CASES( ttas );
+    CASES( ticket );
+    CASES( mcs );
+    CASES( futex );
+
+#undef CASES
+#undef CASE
+
+    default:
+        return false;
+    }
+}
+
+
+static LockStats LastStats;
+
+
+LockStats GetLastLockStats()
+{
+    return LastStats;
+}
+
+
+void SetLastLockStats( const LockStats &stats )
+{
+    LastStats = stats;
+}
+
+
+std::ostream &PrintLockSummary( std::ostream &ostream, const std::vector< LockResult > &results )
+{
+    std::map< LockKind, std::map< int, const LockResult * > > by_kind;
+    for (const LockResult &result: results)
+    {
+        by_kind[result.params.kind][result.params.num_threads] = &result;
+    }
+
+    ostream << "Contended locks (spread of per-thread acquisitions, handoff to another thread):\n";
+    ostream << "  " << std::setw( 17 ) << "lock" << std::setw( 8 ) << "threads"
+        << std::setw( 10 ) << "Macq/s" << std::setw( 10 ) << "spread %"
+        << std::setw( 13 ) << "handoff ns" << "\n";
+
+    const auto flags_prev = ostream.flags();
+    const auto precision_prev = ostream.precision( 1 );
+    ostream << std::fixed;
+    for (const auto &kind_threads: by_kind)
+    {
+        for (const auto &threads_result: kind_threads.second)
+        {
+            const LockResult &result = *threads_result.second;
+            ostream << "  " << std::setw( 17 ) << ToCStr( kind_threads.first )
+                << std::setw( 8 ) << threads_result.first
+                << std::setw( 10 ) << 1e3 / result.ns_per_acquisition
+                << std::setw( 10 ) << result.stats.spread * 100.0 << std::setw( 13 );
+
+            // Without any handoffs, there's no mean (e.g. if one thread kept the lock).
+            if (result.stats.handoffs) ostream << result.stats.handoff_ns << "\n";
+            else ostream << "-\n";
+        }
+    }
+
+    ostream.precision( precision_prev );
+    ostream.flags( flags_prev );
+
+    return ostream;
+}
+
+
+} // namespace bench
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Lock implementations and support for the contended mutex benchmarks.
+/*! @file
+
+    Besides the locks provided by pthreads & the standard library, this has
+    the classic userspace locks: test-and-test-and-set with backoff, ticket,
+    MCS queue, and a futex-based lock.  Each mutex_contended_* benchmark also
+    records statistics which AutoTime doesn't (see LockStats), for printing
+    with the throughput after the results.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_LOCK_UTILS_HPP
+#define BENCH_LOCK_UTILS_HPP
+
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+#include "list.hpp"
+
+
+namespace bench
+{
+
+
+enum class LockKind
+{
+    pthread,            //!< pthread_mutex_t of type PTHREAD_MUTEX_NORMAL.
+    pthread_adaptive,   //!< pthread_mutex_t of type PTHREAD_MUTEX_ADAPTIVE_NP (spins, then sleeps).
+    std_mutex,          //!< std::mutex.
+    rwlock_read,        //!< pthread_rwlock_t, with 9 in 10 acquisitions shared.
+    rwlock_write,       //!< pthread_rwlock_t, with 1 in 10 acquisitions shared.
+    ttas,               //!< Test-and-test-and-set spinlock, with exponential backoff.
+    ticket,             //!< Ticket spinlock (FIFO).
+    mcs,                //!< MCS queue lock, where each waiter spins on its own cache line.
+    futex               //!< Three-state futex lock (unlocked, locked, contended).
+};
+
+
+const char *ToCStr( LockKind kind );
+
+
+    //! Test-and-test-and-set spinlock, with exponential backoff.
+class TtasLock
+{
+public:
+    void lock();
+    void unlock() { locked_.store( false, std::memory_order_release ); }
+
+private:
+    std::atomic< bool > locked_{ false };
+};
+
+
+    //! FIFO spinlock, where each acquirer takes a ticket and waits for it to be served.
+class TicketLock
+{
+public:
+    void lock();
+    void unlock();
+
+private:
+    std::atomic< uint32_t > next_{ 0 };
+    std::atomic< uint32_t > serving_{ 0 };
+};
+
+
+    //! Mellor-Crummey & Scott queue lock.
+class McsLock
+{
+public:
+        //! A waiter's place in the queue, which it must keep until unlocking.
+    struct alignas( 64 ) Node
+    {
+        std::atomic< Node * > next{ nullptr };
+        std::atomic< bool > locked{ false };
+    };
+
+    void lock( Node &node );
+    void unlock( Node &node );
+
+private:
+    std::atomic< Node * > tail_{ nullptr };
+};
+
+
+    //! Futex-based lock, which only makes syscalls when contended.
+    /*!
+        This is the third mutex from Ulrich Drepper's "Futexes Are Tricky".
+    */
+class FutexLock
+{
+public:
+    void lock();
+    void unlock();
+
+private:
+    std::atomic< int > state_{ 0 };    // 0: unlocked, 1: locked, 2: locked with waiters.
+};
+
+
+    //! Lengths of the work done with and without the lock held, by each contending thread.
+    /*!
+        These are in iterations of an empty loop, which take about a clock
+        cycle each.
+    */
+struct LockWork
+{
+    int critical = 50;
+    int noncritical = 200;
+};
+
+LockWork GetLockWork();
+void SetLockWork( const LockWork &work );
+
+
+    //! Spins for n iterations of an empty loop.
+void BusyWork( int n );
+
+
+    //! Parameters of a mutex_contended_* benchmark.
+struct LockParams
+{
+    LockKind kind;
+    int num_threads;
+};
+
+
+    //! Returns true and sets params, if benchmark is one of the mutex_contended_* benchmarks.
+bool GetLockParams( Benchmark benchmark, LockParams &params );
+
+
+    //! Statistics of the most recent run of a mutex_contended_* benchmark.
+struct LockStats
+{
+        //! Spread of per-thread acquisitions, as (max - min) / mean (0 -> perfectly fair).
+    double spread = 0.0;
+
+        //! Mean time (ns) from a release to the lock's acquisition by a different thread.
+    double handoff_ns = 0.0;
+
+        //! Acquisitions by a different thread than the last release (handoff_ns is their mean).
+    int64_t handoffs = 0;
+};
+
+LockStats GetLastLockStats();
+void SetLastLockStats( const LockStats &stats );
+
+
+struct LockResult
+{
+    LockParams params;
+    double ns_per_acquisition;
+    LockStats stats;
+};
+
+
+    //! Prints throughput, fairness, and handoff latency by lock and thread count.
+std::ostream &PrintLockSummary( std::ostream &ostream, const std::vector< LockResult > &results );
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_LOCK_UTILS_HPP
@@ -16,26 +16,38 @@
 #include "autotime/log.hpp"
 #include "autotime/os.hpp"
 #include "autotime/time.hpp"
+#include "autotime/topology.hpp"
 #include "autotime/warmup.hpp"
 #include "autotime/work.hpp"
 
 #include <cstdio>
 #include <functional>
-#include <future>
 #include <iostream>
+#include <map>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <sys/ioctl.h>
 
 #include <boost/optional.hpp>
 #include <boost/program_options.hpp>
 
+#include "bandwidth_utils.hpp"
+#include "cache_utils.hpp"
+#include "copy_kernels.hpp"
+#include "core_matrix.hpp"
 #include "description.hpp"
 #include "dispatch.hpp"
+#include "error_utils.hpp"
+#include "jitter_utils.hpp"
 #include "list.hpp"
+#include "lock_utils.hpp"
 #include "output.hpp"
+#include "simd_kernels.hpp"
 #include "thread_utils.hpp"
+#include "timing_utils.hpp"
+#include "uring_utils.hpp"
 
 
 using namespace autotime;
@@ -49,44 +61,27 @@ static int GetTermWidth()
 }
 
 
-static int AutoselectSecondaryCoreId( int core0 )
+static int AutoselectSecondaryCoreId(
+    const std::vector< CpuTopology > &topology, int core0, PairPolicy policy )
 {
-    int core1 = -1;
-    int choose_core1_attempt = 0;
-    while (core1 == -1)
+    int core1 = SelectPairedCoreId( topology, core0, policy );
+    if (core1 == -1 && policy != PairPolicy::automatic)
     {
-        if (choose_core1_attempt++ >= 3)
-        {
-            core1 = core0;
-            std::cerr
-                << "Warning:\n"
-                << "  Core autoselection picked core " << core1
-                << " for the secondary thread that the\n"
-                << "  primary will also use.  Multithreaded benchmarks might be impaired.\n\n";
-            break;
-        }
-
-        // Let the scheduler pick which core to use for the secondary,
-        //  as long as it differs from the primary.
-        std::promise< void > done_promise;
-        std::future< void > done_future = done_promise.get_future();
-        std::thread thread{ [core0, &core1, &done_promise]()
-            {
-                int c = GetCurrentCoreId();
-
-                // Perhaps a better way to do this would be to set a full affinity mask,
-                //  but exclude core0 and any of its SMT siblings.
-                if (c != core0) core1 = c;
-
-                done_promise.set_value();
-            } };
-
-        // Keep the current thread busy, while waiting for the child thread,
-        //  to minimize the chance of it getting run on the same core.
-        constexpr auto d = std::chrono::seconds::zero();
-        while (std::future_status::ready != done_future.wait_for( d )) Mandelbrot( 0.1f, 256 );
+        std::cerr
+            << "Warning:\n"
+            << "  No online core has placement " << policy << " relative to core " << core0
+            << ".\n  Using the " << PairPolicy::automatic << " policy, instead.\n\n";
+        core1 = SelectPairedCoreId( topology, core0, PairPolicy::automatic );
+    }
 
-        thread.join();
+    if (core1 == -1)
+    {
+        core1 = core0;
+        std::cerr
+            << "Warning:\n"
+            << "  Core autoselection picked core " << core1
+            << " for the secondary thread that the\n"
+            << "  primary will also use.  Multithreaded benchmarks might be impaired.\n\n";
     }
 
     return core1;
@@ -100,21 +95,38 @@ struct WarmupParams
     double slop = 0.125;
     int limit_ms = 125;
     bool secondary = false;
+    Isa isa = Isa::scalar;  // Of the initial warmup workload.
+    int stage_ms = 25;      // Limit of the warmup before each change in license ISA (0 -> none).
 };
 
 
-static std::chrono::microseconds WarmupCore( int coreId, const WarmupParams &warmup )
+    // Consecutive 1 ms samples, within Settle_tolerance, after which a vector warmup is done.
+static constexpr int Settle_samples = 5;
+static constexpr double Settle_tolerance = 0.02;
+
+
+static std::chrono::microseconds WarmupCore(
+    int coreId, const WarmupParams &warmup, Isa isa, int limit_ms )
 {
-    // Try to warmup the core to near-peak clock speed.
     std::unique_ptr< ICoreWarmupMonitor > warmupMonitor = ICoreWarmupMonitor::create( coreId );
-    warmupMonitor->minClockSpeed( warmup.min );
-    warmupMonitor->maxClockSpeedDecrease( warmup.slop );
+    if (isa != Isa::avx2 && isa != Isa::avx512)
+    {
+        // Try to warmup the core to near-peak clock speed.
+        warmupMonitor->minClockSpeed( warmup.min );
+        warmupMonitor->maxClockSpeedDecrease( warmup.slop );
+    }
+    else
+    {
+        // Vector licenses can hold the clock below peak, so wait for it to stabilize, instead.
+        warmupMonitor->maxClockSpeedDecrease( Settle_tolerance );
+        warmupMonitor->settleSamples( Settle_samples );
+    }
 
     steady_clock::time_point start = steady_clock::now();
     steady_clock::time_point finish =
         IterateUntil(
-            [](){ Mandelbrot( 0.1f, 256 ); },
-            start + std::chrono::milliseconds{ warmup.limit_ms },
+            [isa](){ RunWarmupWorkload( isa ); },
+            start + std::chrono::milliseconds{ limit_ms },
             std::chrono::milliseconds{ 1 },
             std::bind( &ICoreWarmupMonitor::operator(), warmupMonitor.get() ) );
 
@@ -128,50 +140,101 @@ static std::thread ThreadedWarmupCore( int coreId, const WarmupParams &warmup )
         [coreId, warmup]()
         {
             SetCoreAffinity( coreId );
-            WarmupCore( coreId, warmup );
+            WarmupCore( coreId, warmup, warmup.isa, warmup.limit_ms );
         } };
 }
 
 
-static void SetupCores( bool verbose, int &core0, int &core1, const WarmupParams &warmup )
+static void SetupCores(
+    bool verbose, int &core0, int &core1, PairPolicy policy, const WarmupParams &warmup )
 {
     // Find out what core the main thread will be using, to ensure the secondary is different.
     if (core0 == -1) core0 = GetCurrentCoreId();
 
-    // Pick a core for the secondary thread - must precede setting affinity of primary thread.
-    if (core1 == -1) core1 = AutoselectSecondaryCoreId( core0 );
+    // Pick a core for the secondary thread, by its placement relative to the primary.
+    const std::vector< CpuTopology > topology = GetCpuTopology();
+    if (core1 == -1) core1 = AutoselectSecondaryCoreId( topology, core0, policy );
 
-    // Try to stay on a specific core - must follow picking a core1 to avoid that thread
-    //  inheriting the affinity we're setting for this one.
+    // Try to stay on a specific core.
     SetCoreAffinity( core0 );
     if (verbose) std::cerr << "Running on core " << core0 << "\n";
 
     SetSecondaryCoreId( core1 );
-    if (verbose) std::cerr << "Secondary on core " << core1 << "\n";
+    if (verbose)
+    {
+        std::cerr << "Secondary on core " << core1
+            << " (" << ToCStr( ClassifyCorePair( topology, core0, core1 ) ) << ")\n";
+    }
 
     // Perform warmup to get the core(s) running in the target frequency range.
     std::thread warmup2_thread;
     if (warmup.secondary) warmup2_thread = ThreadedWarmupCore( core1, warmup );
 
-    double warmup_dur_ms = WarmupCore( core0, warmup ).count() / 1000.0;
+    std::chrono::microseconds warmup_dur = WarmupCore( core0, warmup, warmup.isa, warmup.limit_ms );
+    double warmup_dur_ms = warmup_dur.count() / 1000.0;
     if (verbose) std::cerr << "\nWarmup completed after " << warmup_dur_ms << " ms.\n";
 
     if (warmup.secondary) warmup2_thread.join();
 }
 
 
+    // Cores for the jitter probe, if none were specified.  Standalone, it probes each core in
+    // use.  In the background, it probes a core which the benchmarks are least likely to use,
+    // since a busy probe would compete with them, as a host-wide signal.  The benchmarks' own
+    // cores are described by their threads' scheduler counters, instead.
+static std::vector< int > SelectJitterCores(
+    const std::vector< int > &specified, int core0, int core1, bool background )
+{
+    if (!specified.empty()) return specified;
+
+    if (!background)
+    {
+        if (core1 == core0) return { core0 };
+        return { core0, core1 };
+    }
+
+    // Teams take the secondary core and then those following the primary, so the core
+    // preceding the primary is the last one they'd take.
+    std::vector< int > online;
+    for (const CpuTopology &cpu: GetCpuTopology()) online.push_back( cpu.cpu_id );
+    for (auto it = online.rbegin(); it != online.rend(); ++it)
+    {
+        if (*it < core0 && *it != core1) return { *it };
+    }
+    for (auto it = online.rbegin(); it != online.rend(); ++it)
+    {
+        if (*it > core0 && *it != core1) return { *it };
+    }
+
+    std::cerr
+        << "Warning:\n"
+        << "  No core is free of the benchmarks, so the jitter probe shares core " << core1
+        << "\n  with the " << ((core1 == core0) ? "primary" : "secondary")
+        << " thread.  It runs at SCHED_IDLE, so it won't slow\n"
+        << "  them, but counts their time on that core as interruptions.\n\n";
+    return { core1 };
+}
+
+
 int main( int argc, char *argv[] )
 {
     // Defaults
     bool verbose = false;
     int core0 = -1;
     int core1 = -1;
+    PairPolicy pair_policy = PairPolicy::automatic;
     WarmupParams warmup;
     std::string spec = "all";
     boost::optional< ListMode > list_mode;
     boost::optional< ListMode > describe_mode;
+    boost::optional< int > core_matrix;
+    boost::optional< int > jitter_ms;
+    bool jitter_monitor = false;
+    int jitter_threshold_ns = 1000;
+    std::vector< int > jitter_cores;
     bool run = false;
     Format format = Format::pretty;
+    LockWork lock_work;
 
     // Parse commandline options.
     namespace prog_opts = boost::program_options;
@@ -182,6 +245,11 @@ int main( int argc, char *argv[] )
     std::string describe_help =
         "Print detailed info about benchmarks, categories.  (options: " + list_modes + ").";
     std::string format_help = "Output format (options: " + List< Format >( ", " ) + ").";
+    std::string pair_help =
+        "Placement of the secondary core, if not specified (options: "
+        + List< PairPolicy >( ", " ) + ").";
+    std::string warmup_isa_help =
+        "Core warmup workload's instruction set (options: " + List< Isa >( ", " ) + ").";
     desc.add_options()
         ( "help", "Show help message and exit." )
         ( "verbose",
@@ -198,6 +266,9 @@ int main( int argc, char *argv[] )
         ( "coreB",
           prog_opts::value( &core1 )->value_name( "N" ),
           "Which core to use for secondary thread (-1 -> auto)." )
+        ( "pair",
+          prog_opts::value( &pair_policy )->value_name( "policy" )->default_value( pair_policy ),
+          pair_help.c_str() )
         ( "warmup-limit",
           prog_opts::value( &warmup.limit_ms )->value_name( "ms" )->default_value( warmup.limit_ms ),
           "Core warmup time limit." )
@@ -210,6 +281,20 @@ int main( int argc, char *argv[] )
         ( "warmup-coreB",
           prog_opts::bool_switch( &warmup.secondary ),
           "Also perform warmup on secondary thread's core." )
+        ( "warmup-isa",
+          prog_opts::value( &warmup.isa )->value_name( "isa" )->default_value( warmup.isa ),
+          warmup_isa_help.c_str() )
+        ( "warmup-stage-limit",
+          prog_opts::value( &warmup.stage_ms )->value_name( "ms" )->default_value( warmup.stage_ms ),
+          "Warmup time limit, upon each change in vector license between benchmarks (0 -> none)." )
+        ( "lock-cs-work",
+          prog_opts::value( &lock_work.critical )->value_name( "N" )->
+            default_value( lock_work.critical ),
+          "Iterations of work inside the critical section, in mutex_contended_* benchmarks." )
+        ( "lock-ncs-work",
+          prog_opts::value( &lock_work.noncritical )->value_name( "N" )->
+            default_value( lock_work.noncritical ),
+          "Iterations of work outside the critical section, in mutex_contended_* benchmarks." )
         ( "select",
           prog_opts::value( &spec )->value_name( "spec" )->default_value( spec ),
           "Specifies the set of benchmarks (see below)." )
@@ -221,6 +306,25 @@ int main( int argc, char *argv[] )
           prog_opts::value< ListMode >()->value_name( "mode" )->implicit_value( ListMode::joint )->
             notifier( [&describe_mode]( const ListMode &mode ){ describe_mode = mode; } ),
           describe_help.c_str() )
+        ( "core-matrix",
+          prog_opts::value< int >()->value_name( "N" )->implicit_value( 32 )->
+            notifier( [&core_matrix]( const int &n ){ core_matrix = n; } ),
+          "Measure core-to-core latency between up to N sampled cores." )
+        ( "jitter",
+          prog_opts::value< int >()->value_name( "ms" )->implicit_value( 1000 )->
+            notifier( [&jitter_ms]( const int &ms ){ jitter_ms = ms; } ),
+          "Record the interruptions of a thread spinning on each core in use, for a time." )
+        ( "jitter-monitor",
+          prog_opts::bool_switch( &jitter_monitor ),
+          "Record interruptions during the benchmarks, and note those in each one's timing."
+          "  The probe runs at SCHED_IDLE, on a core the benchmarks don't use, if any." )
+        ( "jitter-threshold",
+          prog_opts::value( &jitter_threshold_ns )->value_name( "ns" )->
+            default_value( jitter_threshold_ns ),
+          "Shortest gap between reads of the clock, which counts as an interruption." )
+        ( "jitter-core",
+          prog_opts::value( &jitter_cores )->value_name( "N" ),
+          "Core to probe for interruptions, instead of those in use (repeatable)." )
         ( "run",
           prog_opts::bool_switch( &run ),
           "Perform the benchmarks." )
@@ -254,7 +358,7 @@ int main( int argc, char *argv[] )
         PrintList( std::cout, benchmarks, *list_mode ) << "\n";
 
         // --run is implied only if --list is absent.
-        if (!run && !describe_mode) return 0;
+        if (!run && !describe_mode && !core_matrix && !jitter_ms) return 0;
     }
 
     if (describe_mode)
@@ -262,32 +366,237 @@ int main( int argc, char *argv[] )
         PrintDescriptions( std::cout, benchmarks, *describe_mode ) << "\n";
 
         // Unless otherwise specified, this overrides --run.
-        if (!run) return 0;
+        if (!run && !core_matrix && !jitter_ms) return 0;
     }
 
     // If a core was specified for the secondary thread, assume it needs warmup.
     if (core1 >= 0 && core1 != core0) warmup.secondary = true;
 
+    if (!IsSupported( warmup.isa ))
+    {
+        std::cerr << "Warning: " << warmup.isa << " isn't supported; using scalar warmup.\n";
+        warmup.isa = Isa::scalar;
+    }
+
+    SetLockWork( lock_work );
+
     // Nail down core selections, perform core warmup, and set main thread affinity.
-    SetupCores( verbose, core0, core1, warmup );
+    SetupCores( verbose, core0, core1, pair_policy, warmup );
+
+    // Unless otherwise specified, the core-to-core matrix replaces the benchmarks.
+    if (core_matrix)
+    {
+        CoreLatencyMatrix matrix = MeasureCoreLatencies( *core_matrix );
+        PrintCoreLatencies( std::cout, matrix, GetCpuTopology() );
+        if (!run && !jitter_ms) return 0;
+
+        std::cout << "\n";
+    }
+
+    // Likewise, the jitter report.
+    const std::chrono::nanoseconds jitter_threshold{ jitter_threshold_ns };
+    if (jitter_ms)
+    {
+        JitterProbe probe(
+            SelectJitterCores( jitter_cores, core0, core1, false ), jitter_threshold );
+        const std::chrono::steady_clock::time_point from =
+            std::chrono::steady_clock::now();
+        std::this_thread::sleep_for( std::chrono::milliseconds{ *jitter_ms } );
+        const std::chrono::steady_clock::time_point to =
+            std::chrono::steady_clock::now();
+        probe.stop();
+
+        std::vector< JitterEvent > events;
+        probe.drain( events );
+        PrintJitterReport( std::cout, probe, events, from, to );
+        if (!run) return 0;
+
+        std::cout << "\n";
+    }
 
     // Setup output handler.
     std::unique_ptr< IOutputFormatter > output = IOutputFormatter::create( std::cout, format );
 
+    // Latencies of any cache_chase_random_* benchmarks, by working set size.
+    std::map< size_t, double > chase_latencies;
+
+    // Bandwidth (GB/s) of any stream_* benchmarks, by kernel & thread count.
+    std::map< StreamKernel, std::map< int, double > > stream_bandwidths;
+
+    // Time per FMA (ns) and OS-reported clock (MHz) of any simd_fma_* benchmarks, by ISA.
+    std::map< Isa, double > fma_latencies;
+    std::map< Isa, double > fma_clocks;
+
+    // License of the most recent warmup workload (SSE has none of its own).
+    Isa warmed_isa = (warmup.isa == Isa::sse42) ? Isa::scalar : warmup.isa;
+
+    // Bandwidth (GB/s) of any copy_memcpy_* & copy_memset_* benchmarks.
+    std::vector< CopyResult > copy_results;
+
+    // Throughput and statistics of any mutex_contended_* benchmarks.
+    std::vector< LockResult > lock_results;
+
+    // Per-thread time per access of any cache_sharing_* benchmarks.
+    std::vector< SharingResult > sharing_results;
+
+    // Overshoot distributions of any timing_* benchmarks.
+    std::vector< TimingResult > timing_results;
+
+    // Throughput and completion latencies of any uring_* benchmarks.
+    std::vector< UringResult > uring_results;
+
+    // Interruptions recorded in the background, if monitoring jitter.
+    std::unique_ptr< JitterProbe > jitter_probe;
+    std::vector< JitterEvent > jitter_events;
+    const std::vector< int > benchmark_cores =
+        (core1 == core0) ? std::vector< int >{ core0 } : std::vector< int >{ core0, core1 };
+    if (jitter_monitor)
+    {
+        jitter_probe.reset( new JitterProbe(
+            SelectJitterCores( jitter_cores, core0, core1, true ), jitter_threshold, true ) );
+    }
+    const std::chrono::steady_clock::time_point run_start =
+        std::chrono::steady_clock::now();
+
     // Run the specified benchmarks.
     for (Benchmark benchmark: benchmarks)
     {
-        BenchTimers timers = MakeTimers( benchmark );
+        BenchTimers timers;
+        try
+        {
+            timers = MakeTimers( benchmark );
+        }
+        catch (const unavailable_error &e)
+        {
+            output->skip( benchmark, e.what() );
+            continue;
+        }
+
+        // Settle the core's clock under the license the benchmark will actually run with.
+        const Isa license_isa = GetLicenseIsa( benchmark );
+        if (warmup.stage_ms > 0 && license_isa != warmed_isa)
+        {
+            std::chrono::microseconds dur =
+                WarmupCore( core0, warmup, license_isa, warmup.stage_ms );
+            if (verbose)
+            {
+                std::cerr << "Warmup (" << license_isa << ") completed after "
+                    << dur.count() / 1000.0 << " ms.\n";
+            }
+            warmed_isa = license_isa;
+        }
 
         // Time the function & its overhead.
+        SchedSample sched_start;
+        if (jitter_probe) sched_start = jitter_probe->sample();
+        const std::chrono::steady_clock::time_point window_start =
+            std::chrono::steady_clock::now();
         DurationsForIters exp_dfi = AutoTime( timers.primary );
         DurationsForIters ovh_dfi{};
         if (timers.overhead) ovh_dfi = AutoTime( timers.overhead );
+        const std::chrono::steady_clock::time_point window_end =
+            std::chrono::steady_clock::now();
+        SchedSample sched_end;
+        if (jitter_probe) sched_end = jitter_probe->sample();
 
         // Postprocess and display the results.
         CpuClockPeriod core_speed = GetCoreClockTick( core0 );
         NormDurations norm = exp_dfi.normalize() - ovh_dfi.normalize();
         output->write( benchmark, norm, exp_dfi.num_iters, core_speed /*, warnings */ );
+
+        if (jitter_probe)
+        {
+            jitter_probe->drain( jitter_events );
+            output->annotate( benchmark, DescribeInterference(
+                *jitter_probe, jitter_events, window_start, window_end ) );
+            output->annotate( benchmark,
+                DescribeSchedActivity( sched_start, sched_end, benchmark_cores ) );
+        }
+
+        const size_t working_set = ChaseWorkingSet( benchmark );
+        if (working_set) chase_latencies[working_set] = norm.real.count() * 1e-3;     // ps -> ns
+
+        StreamParams stream;
+        if (GetStreamParams( benchmark, stream ))
+        {
+            const double ns = norm.real.count() * 1e-3;
+            stream_bandwidths[stream.kernel][stream.num_threads] = StreamBytes( stream.kernel ) / ns;
+        }
+
+        CopyParams copy;
+        if (GetCopyParams( benchmark, copy ))
+        {
+            copy_results.push_back( { copy, copy.size / (norm.real.count() * 1e-3) } );
+        }
+
+        LockParams lock;
+        if (GetLockParams( benchmark, lock ))
+        {
+            lock_results.push_back( { lock, norm.real.count() * 1e-3, GetLastLockStats() } );
+        }
+
+        SharingParams sharing;
+        if (GetSharingParams( benchmark, sharing ))
+        {
+            sharing_results.push_back( { sharing, norm.real.count() * 1e-3 } );
+        }
+
+        TimingParams timing;
+        if (GetTimingParams( benchmark, timing ))
+        {
+            timing_results.push_back( { timing, GetOvershootStats() } );
+        }
+
+        UringParams uring;
+        if (GetUringParams( benchmark, uring ))
+        {
+            uring_results.push_back(
+                { benchmark, uring, norm.real.count() * 1e-3, GetCompletionLatencyStats() } );
+        }
+
+        Isa isa;
+        if (GetFmaIsa( benchmark, isa ))
+        {
+            fma_latencies[isa] = norm.real.count() * 1e-3 / (Fma_chains * Fma_steps);
+            if (core_speed.count() > 0) fma_clocks[isa] = 1e9 / core_speed.count();    // fs -> MHz
+        }
+    }
+
+    if (chase_latencies.size() > 1)
+    {
+        PrintCacheLevels( std::cout << "\n", DetectCacheLevels( chase_latencies ) );
+    }
+
+    if (!stream_bandwidths.empty()) PrintStreamBandwidth( std::cout << "\n", stream_bandwidths );
+
+    if (!fma_latencies.empty()) PrintSimdClocks( std::cout << "\n", fma_latencies, fma_clocks );
+
+    if (!copy_results.empty()) PrintCopySummary( std::cout << "\n", copy_results );
+
+    if (!lock_results.empty()) PrintLockSummary( std::cout << "\n", lock_results );
+
+    if (!sharing_results.empty()) PrintSharingSummary( std::cout << "\n", sharing_results );
+
+    if (!timing_results.empty()) PrintTimingSummary( std::cout << "\n", timing_results );
+
+    if (!uring_results.empty()) PrintUringSummary( std::cout << "\n", uring_results );
+
+    if (jitter_probe)
+    {
+        const std::chrono::steady_clock::time_point run_end =
+            std::chrono::steady_clock::now();
+        jitter_probe->stop();
+        jitter_probe->drain( jitter_events );
+        PrintJitterReport(
+            std::cout << "\n", *jitter_probe, jitter_events, run_start, run_end );
+    }
+
+    // Label the results of two-thread benchmarks with where their threads ran.
+    if (!benchmarks.empty())
+    {
+        const CorePlacement placement = ClassifyCorePair( GetCpuTopology(), core0, core1 );
+        std::cout << "\nCore pair: " << core0 << " & " << core1
+            << " (" << ToCStr( placement ) << ")\n";
     }
 
     return 0;
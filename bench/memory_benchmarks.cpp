@@ -13,7 +13,6 @@
 
 #include "dispatch.hpp"
 
-#include "autotime/os.hpp"
 #include "autotime/overhead.hpp"
 #include "autotime/time.hpp"
 #include "autotime/work.hpp"
@@ -22,12 +21,12 @@
 #include <array>
 #include <cmath>
 #include <cstring>
-#include <future>
-#include <type_traits>
+#include <functional>
+#include <memory>
 #include <vector>
 
 #include "description.hpp"
-#include "thread_utils.hpp"
+#include "page_utils.hpp"
 
 
 using namespace autotime;
@@ -152,6 +151,49 @@ template<> autotime::BenchTimers MakeTimers< Benchmark::memcpy_256M >()
 }
 
 
+    // Like MakeMemCopy(), but with both buffers backed by the specified kind of page.
+static autotime::BenchTimers MakePagedMemCopy( size_t size, PageKind kind )
+{
+    std::shared_ptr< PageMapping > src = MapPages( size, kind );
+    std::shared_ptr< PageMapping > dst = MapPages( size, kind );
+
+    const RandomBlock< uint8_t > &rand_block = GetRandomBlock< uint8_t >();
+    uint8_t *src_data = static_cast< uint8_t * >( src->data() );
+    for (size_t i = 0; i < size; ++i) src_data[i] = rand_block[i & RandomBlockMask];
+
+    std::function< void() > f = [src, dst, size]()
+        {
+            memcpy( dst->data(), src->data(), size );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::memcpy_256M_4k >()
+{
+    return MakePagedMemCopy( size_t{ 1 } << 28, PageKind::small );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::memcpy_256M_thp >()
+{
+    return MakePagedMemCopy( size_t{ 1 } << 28, PageKind::thp );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::memcpy_256M_2M >()
+{
+    return MakePagedMemCopy( size_t{ 1 } << 28, PageKind::huge_2M );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::memcpy_256M_1G >()
+{
+    return MakePagedMemCopy( size_t{ 1 } << 28, PageKind::huge_1G );
+}
+
+
 template<
     size_t size
 >
@@ -481,89 +523,45 @@ template<> autotime::BenchTimers MakeTimers< Benchmark::memread_256M >()
 }
 
 
-template<> Description Describe< Benchmark::cache_false_sharing >()
-{
-    Description desc;
-    desc.measures = "Performance impact of two threads touching the same cache line.";
-    return desc;
-}
-
-
-struct FalselyShared
+    // Like MakeMemRead(), but with the buffer backed by the specified kind of page.
+static autotime::BenchTimers MakePagedMemRead( size_t size, PageKind kind )
 {
-    uint64_t a = 0;
-    uint64_t b = 0;
-};
+    using element_type = std::array< uint64_t, 2 >;
 
+    std::shared_ptr< PageMapping > src = MapPages( size, kind );
+    volatile element_type *data = static_cast< element_type * >( src->data() );
+    const size_t n = size / sizeof( element_type );
 
-union AlignedFalselyShared
-{
-    FalselyShared fs;
-    std::aligned_storage< 64, 64 >::type aligned;
-};
-
-
-autotime::Timer MakeFalseSharing()
-{
-    return []( int num_iters )
+    std::function< void() > f = [src, data, n]()
         {
-            constexpr int n = 2;    // The more elements, the less impact is observed?
-            AlignedFalselyShared array[n] = {};
-            std::promise< void > started_promise;
-            std::future< void > started_future = started_promise.get_future();
-            volatile bool stop = false;
-
-#if 0   // On Sandybridge, it doesn't seem to make much difference which is used (at n=128).
-
-            // Shuffle the entries, in case it helps fool the core's prefetcher.
-            std::vector< AlignedFalselyShared * > ptrs( n );
-            for (size_t i = 0; i < n; ++i) ptrs[i] = &array[i];
-            std::random_shuffle( ptrs.begin(), ptrs.end() );
-
-            auto thread = std::thread( [&ptrs, num_iters, &started_promise, &stop]()
-                    {
-                        SetCoreAffinity( GetSecondaryCoreId() );
-                        started_promise.set_value();
-                        while (!stop) for (const auto p: ptrs) ++p->fs.b;
-                    } );
-
-            started_future.get();
-
-            std::function< void() > f = [&ptrs]()
-                {
-                    for (const auto p: ptrs) ++p->fs.a;
-                };
+            for (size_t i = 0; i < n; ++i) data[i];
+        };
 
-#else
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
 
-            auto thread = std::thread( [&array, num_iters, &started_promise, &stop]()
-                    {
-                        SetCoreAffinity( GetSecondaryCoreId() );
-                        started_promise.set_value();
-                        while (!stop) for (AlignedFalselyShared &aligned: array) ++aligned.fs.b;
-                    } );
 
-            started_future.get();
+template<> autotime::BenchTimers MakeTimers< Benchmark::memread_256M_4k >()
+{
+    return MakePagedMemRead( size_t{ 1 } << 28, PageKind::small );
+}
 
-            std::function< void() > f = [&array]()
-                {
-                    for (AlignedFalselyShared &aligned: array) ++aligned.fs.a;
-                };
 
-#endif
+template<> autotime::BenchTimers MakeTimers< Benchmark::memread_256M_thp >()
+{
+    return MakePagedMemRead( size_t{ 1 } << 28, PageKind::thp );
+}
 
-            Durations durs = Time( f, num_iters ) / n;
-            stop = true;
-            thread.join();
 
-            return durs;
-        };
+template<> autotime::BenchTimers MakeTimers< Benchmark::memread_256M_2M >()
+{
+    return MakePagedMemRead( size_t{ 1 } << 28, PageKind::huge_2M );
 }
 
 
-template<> autotime::BenchTimers MakeTimers< Benchmark::cache_false_sharing >()
+template<> autotime::BenchTimers MakeTimers< Benchmark::memread_256M_1G >()
 {
-    return { MakeFalseSharing(), MakeTimer( MakeOverheadFn< void >() ) };
+    return MakePagedMemRead( size_t{ 1 } << 28, PageKind::huge_1G );
 }
 
 
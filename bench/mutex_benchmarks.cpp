@@ -12,8 +12,15 @@
 */
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include <pthread.h>
 
@@ -21,8 +28,11 @@
 #include "autotime/overhead.hpp"
 #include "autotime/time.hpp"
 
+#include "description.hpp"
 #include "dispatch.hpp"
+#include "error_utils.hpp"
 #include "list.hpp"
+#include "lock_utils.hpp"
 #include "thread_utils.hpp"
 
 
@@ -32,6 +42,40 @@ namespace bench
 {
 
 
+template<> Description Describe< Category::mutex >()
+{
+    Description desc;
+    desc.measures = "Cost of mutex operations, uncontended and contended by 2 to 16 threads.";
+    desc.detail =
+        "In the mutex_contended_* benchmarks, each thread repeatedly acquires the lock, does the"
+        " critical-section work, releases it, and then does the non-critical work.  Both are"
+        " iterations of an empty loop (see --lock-cs-work and --lock-ncs-work).  The threads run"
+        " until they've jointly acquired the lock 1000 times per iteration, and the time is"
+        " divided by that, so it's the inverse of the lock's throughput.";
+    desc.notes =
+        {
+            "The main thread runs on the primary core, while the other threads are pinned to the"
+                " secondary core and then round-robin to the other online cores.  Waking them and"
+                " waiting for them to finish is amortized over the 1000 acquisitions.",
+            "Throughput, the spread of per-thread acquisitions (i.e. fairness), and the mean time"
+                " from a release to the next acquisition by another thread (i.e. handoff latency)"
+                " are printed after the results.",
+            "rwlock_read takes the lock shared in 9 of 10 acquisitions, and rwlock_write in 1 of"
+                " 10.  Handoffs are only measured between exclusive acquisitions.",
+            "The spinlocks (ttas, ticket & mcs) yield the core after spinning for a while, so"
+                " they can make progress when threads outnumber cores.",
+        };
+    desc.limits =
+        {
+            "Thread counts exceeding the number of online cores oversubscribe them, which"
+                " measures scheduling more than the lock.",
+            "Timing a handoff reads the clock twice per exclusive acquisition, which is added to"
+                " the critical section.",
+        };
+    return desc;
+}
+
+
 static void CreateDestroy()
 {
     pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
@@ -140,5 +184,494 @@ template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_trylock >()
 }
 
 
+    // Adapts each kind of lock to a common interface, in which each thread has a Node.
+    //  lock() returns false if the lock was acquired shared, which must be passed to unlock().
+struct PthreadLock
+{
+    struct Node {};
+
+    pthread_mutex_t mutex_;
+
+    explicit PthreadLock( int type )
+    {
+        InitLibpthread();
+
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init( &attr );
+        pthread_mutexattr_settype( &attr, type );
+        const int err = pthread_mutex_init( &mutex_, &attr );
+        pthread_mutexattr_destroy( &attr );
+        if (err) throw_system_error( err, "pthread_mutex_init()" );
+    }
+
+    ~PthreadLock() { pthread_mutex_destroy( &mutex_ ); }
+
+    bool lock( Node & ) { pthread_mutex_lock( &mutex_ ); return true; }
+    void unlock( Node &, bool ) { pthread_mutex_unlock( &mutex_ ); }
+};
+
+
+struct StdLock
+{
+    struct Node {};
+
+    std::mutex mutex_;
+
+    bool lock( Node & ) { mutex_.lock(); return true; }
+    void unlock( Node &, bool ) { mutex_.unlock(); }
+};
+
+
+struct RwLock
+{
+    struct Node
+    {
+        int count = 0;
+    };
+
+    pthread_rwlock_t rwlock_;
+    const bool read_heavy_;
+
+    explicit RwLock( bool read_heavy )
+    :
+        read_heavy_( read_heavy )
+    {
+        InitLibpthread();
+        if (int err = pthread_rwlock_init( &rwlock_, nullptr ))
+        {
+            throw_system_error( err, "pthread_rwlock_init()" );
+        }
+    }
+
+    ~RwLock() { pthread_rwlock_destroy( &rwlock_ ); }
+
+    bool lock( Node &node )
+    {
+        // One acquisition in ten is the minority mode.
+        const bool exclusive = ((node.count++ % 10 == 0) == read_heavy_);
+        if (exclusive) pthread_rwlock_wrlock( &rwlock_ );
+        else pthread_rwlock_rdlock( &rwlock_ );
+
+        return exclusive;
+    }
+
+    void unlock( Node &, bool ) { pthread_rwlock_unlock( &rwlock_ ); }
+};
+
+
+template<
+    typename Lock
+>
+struct SimpleLock
+{
+    struct Node {};
+
+    Lock lock_;
+
+    bool lock( Node & ) { lock_.lock(); return true; }
+    void unlock( Node &, bool ) { lock_.unlock(); }
+};
+
+
+struct QueueLock
+{
+    using Node = McsLock::Node;
+
+    McsLock lock_;
+
+    bool lock( Node &node ) { lock_.lock( node ); return true; }
+    void unlock( Node &node, bool ) { lock_.unlock( node ); }
+};
+
+
+    // Acquisitions per iteration, which amortize the cost of waking the team.
+static constexpr int Acquisitions_per_iter = 1000;
+
+
+    // A team of threads, contending for a lock.
+template<
+    typename Lock
+>
+class LockContention
+{
+public:
+    template<
+        typename... Args
+    >
+    LockContention( int num_threads, Args... args )
+    :
+        lock_( args... ),
+        work_( GetLockWork() ),
+        acquisitions_( num_threads ),
+        handoff_ns_( num_threads ),
+        handoffs_( num_threads ),
+        team_( num_threads, std::bind( &LockContention::run, this, std::placeholders::_1,
+            std::placeholders::_2 ) )
+    {
+    }
+
+    Durations time( int num_iters )
+    {
+        acquired_ = 0;
+        last_owner_ = -1;
+
+        const int num_acquisitions = num_iters * Acquisitions_per_iter;
+        Durations durs = team_.time( num_acquisitions ) / Acquisitions_per_iter;
+
+        // Summarize the per-thread statistics.
+        const auto minmax = std::minmax_element( acquisitions_.begin(), acquisitions_.end() );
+        double total_ns = 0.0;
+        int64_t total_handoffs = 0;
+        for (int i = 0; i < team_.size(); ++i)
+        {
+            total_ns += handoff_ns_[i];
+            total_handoffs += handoffs_[i];
+        }
+
+        LockStats stats;
+        const double mean = static_cast< double >( num_acquisitions ) / team_.size();
+        stats.spread = (*minmax.second - *minmax.first) / mean;
+        stats.handoffs = total_handoffs;
+        if (total_handoffs) stats.handoff_ns = total_ns / total_handoffs;
+        SetLastLockStats( stats );
+
+        return durs;
+    }
+
+private:
+    void run( int idx, int num_iters )
+    {
+        using clock = std::chrono::steady_clock;
+
+        typename Lock::Node node;
+        int64_t acquisitions = 0;
+        double handoff_ns = 0.0;
+        int64_t handoffs = 0;
+        for (;;)
+        {
+            const bool exclusive = lock_.lock( node );
+
+            // The count is protected by the lock, except from other shared holders.
+            int count = 0;
+            if (exclusive)
+            {
+                count = acquired_.load( std::memory_order_relaxed );
+                acquired_.store( count + 1, std::memory_order_relaxed );
+            }
+            else count = acquired_.fetch_add( 1, std::memory_order_relaxed );
+
+            if (count >= num_iters)
+            {
+                lock_.unlock( node, exclusive );
+                break;
+            }
+
+            if (exclusive)
+            {
+                if (last_owner_ >= 0 && last_owner_ != idx)
+                {
+                    handoff_ns += std::chrono::duration< double, std::nano >(
+                        clock::now() - last_release_ ).count();
+                    ++handoffs;
+                }
+            }
+
+            BusyWork( work_.critical );
+            ++acquisitions;
+
+            if (exclusive)
+            {
+                last_owner_ = idx;
+                last_release_ = clock::now();
+            }
+            lock_.unlock( node, exclusive );
+
+            BusyWork( work_.noncritical );
+        }
+
+        acquisitions_[idx] = acquisitions;
+        handoff_ns_[idx] = handoff_ns;
+        handoffs_[idx] = handoffs;
+    }
+
+    Lock lock_;
+    const LockWork work_;
+
+    std::atomic< int > acquired_{ 0 };
+    int last_owner_ = -1;
+    std::chrono::steady_clock::time_point last_release_;
+
+    std::vector< int64_t > acquisitions_;
+    std::vector< double > handoff_ns_;
+    std::vector< int64_t > handoffs_;
+
+    ThreadTeam team_;   // Last, since it starts the threads which use the other members.
+};
+
+
+template<
+    typename Lock,
+    typename... Args
+>
+static autotime::BenchTimers MakeContentionTimers( int num_threads, Args... args )
+{
+    using namespace std::placeholders;
+    auto contention = std::make_shared< LockContention< Lock > >( num_threads, args... );
+    return { std::bind( &LockContention< Lock >::time, contention, _1 ), nullptr };
+}
+
+
+static autotime::BenchTimers MakeLockTimers( LockKind kind, int num_threads )
+{
+    switch (kind)
+    {
+    case LockKind::pthread:
+        return MakeContentionTimers< PthreadLock >( num_threads, int{ PTHREAD_MUTEX_NORMAL } );
+
+    case LockKind::pthread_adaptive:
+        return MakeContentionTimers< PthreadLock >( num_threads, int{ PTHREAD_MUTEX_ADAPTIVE_NP } );
+
+    case LockKind::std_mutex:
+        return MakeContentionTimers< StdLock >( num_threads );
+
+    case LockKind::rwlock_read:
+        return MakeContentionTimers< RwLock >( num_threads, true );
+
+    case LockKind::rwlock_write:
+        return MakeContentionTimers< RwLock >( num_threads, false );
+
+    case LockKind::ttas:
+        return MakeContentionTimers< SimpleLock< TtasLock > >( num_threads );
+
+    case LockKind::ticket:
+        return MakeContentionTimers< SimpleLock< TicketLock > >( num_threads );
+
+    case LockKind::mcs:
+        return MakeContentionTimers< QueueLock >( num_threads );
+
+    case LockKind::futex:
+        return MakeContentionTimers< SimpleLock< FutexLock > >( num_threads );
+    }
+
+    return {};
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_pthread_2t >()
+{
+    return MakeLockTimers( LockKind::pthread, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_pthread_4t >()
+{
+    return MakeLockTimers( LockKind::pthread, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_pthread_8t >()
+{
+    return MakeLockTimers( LockKind::pthread, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_pthread_16t >()
+{
+    return MakeLockTimers( LockKind::pthread, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_pthread_adaptive_2t >()
+{
+    return MakeLockTimers( LockKind::pthread_adaptive, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_pthread_adaptive_4t >()
+{
+    return MakeLockTimers( LockKind::pthread_adaptive, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_pthread_adaptive_8t >()
+{
+    return MakeLockTimers( LockKind::pthread_adaptive, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_pthread_adaptive_16t >()
+{
+    return MakeLockTimers( LockKind::pthread_adaptive, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_std_mutex_2t >()
+{
+    return MakeLockTimers( LockKind::std_mutex, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_std_mutex_4t >()
+{
+    return MakeLockTimers( LockKind::std_mutex, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_std_mutex_8t >()
+{
+    return MakeLockTimers( LockKind::std_mutex, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_std_mutex_16t >()
+{
+    return MakeLockTimers( LockKind::std_mutex, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_rwlock_read_2t >()
+{
+    return MakeLockTimers( LockKind::rwlock_read, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_rwlock_read_4t >()
+{
+    return MakeLockTimers( LockKind::rwlock_read, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_rwlock_read_8t >()
+{
+    return MakeLockTimers( LockKind::rwlock_read, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_rwlock_read_16t >()
+{
+    return MakeLockTimers( LockKind::rwlock_read, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_rwlock_write_2t >()
+{
+    return MakeLockTimers( LockKind::rwlock_write, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_rwlock_write_4t >()
+{
+    return MakeLockTimers( LockKind::rwlock_write, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_rwlock_write_8t >()
+{
+    return MakeLockTimers( LockKind::rwlock_write, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_rwlock_write_16t >()
+{
+    return MakeLockTimers( LockKind::rwlock_write, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_ttas_2t >()
+{
+    return MakeLockTimers( LockKind::ttas, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_ttas_4t >()
+{
+    return MakeLockTimers( LockKind::ttas, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_ttas_8t >()
+{
+    return MakeLockTimers( LockKind::ttas, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_ttas_16t >()
+{
+    return MakeLockTimers( LockKind::ttas, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_ticket_2t >()
+{
+    return MakeLockTimers( LockKind::ticket, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_ticket_4t >()
+{
+    return MakeLockTimers( LockKind::ticket, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_ticket_8t >()
+{
+    return MakeLockTimers( LockKind::ticket, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_ticket_16t >()
+{
+    return MakeLockTimers( LockKind::ticket, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_mcs_2t >()
+{
+    return MakeLockTimers( LockKind::mcs, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_mcs_4t >()
+{
+    return MakeLockTimers( LockKind::mcs, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_mcs_8t >()
+{
+    return MakeLockTimers( LockKind::mcs, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_mcs_16t >()
+{
+    return MakeLockTimers( LockKind::mcs, 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_futex_2t >()
+{
+    return MakeLockTimers( LockKind::futex, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_futex_4t >()
+{
+    return MakeLockTimers( LockKind::futex, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_futex_8t >()
+{
+    return MakeLockTimers( LockKind::futex, 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::mutex_contended_futex_16t >()
+{
+    return MakeLockTimers( LockKind::futex, 16 );
+}
+
+
 } // namespace bench
 
@@ -0,0 +1,464 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements network-category benchmarks.
+/*! @file
+
+    These use a Boost.ASIO TCP server on the loopback interface, whose io_service runs on the
+    secondary core, and an ASIO client on the primary core.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/optional.hpp>
+
+#include "autotime/os.hpp"
+#include "autotime/overhead.hpp"
+#include "autotime/time.hpp"
+
+#include "description.hpp"
+#include "dispatch.hpp"
+#include "list.hpp"
+#include "thread_utils.hpp"
+
+
+namespace asio = boost::asio;
+
+using asio::ip::tcp;
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::network >()
+{
+    Description desc;
+    desc.measures = "Boost.ASIO TCP connection setup, request rate, and throughput, over loopback.";
+    desc.detail =
+        "The server's io_service runs on a thread pinned to the secondary core, while the client"
+        " runs on the primary core.  Sockets have TCP_NODELAY set on both ends.";
+    desc.notes =
+        {
+            "network_accept is a synchronous connect() by the client, and an async_accept() by the"
+                " server, which then resets the connection.  It includes the client waiting to"
+                " see the reset.",
+            "network_rps_<n>c is the time per 64-byte request & 64-byte response, with one"
+                " request outstanding on each of n connections.  Its reciprocal is the request"
+                " rate.  Each iteration is n requests, so all n connections are kept busy,"
+                " however few iterations are run.",
+            "network_stream_<size> is the time per block of the given size, written back-to-back"
+                " with async_write().  The server reads each block and owes a 1-byte"
+                " acknowledgement, which it writes asynchronously (batched with any others owed"
+                " meanwhile), so the client waits for the last block to be consumed.",
+            "network_gather_<n> is like network_stream_4k, but each block is written as a"
+                " gather list of n equal buffers.",
+        };
+    desc.limits =
+        {
+            "Loopback skips the NIC, driver, and interrupt costs of a real network.",
+            "Concurrency exceeding the server's single thread measures queueing, not"
+                " parallelism.",
+        };
+    return desc;
+}
+
+
+    // Size of each request & response, in the network_rps_* benchmarks.
+static constexpr size_t Request_size = 64;
+
+    // Size of each block, in the network_gather_* benchmarks.
+static constexpr size_t Gather_size = size_t{ 1 } << 12;
+
+
+static void CheckError( const boost::system::error_code &ec )
+{
+    if (ec) throw boost::system::system_error( ec );
+}
+
+
+    // Loopback TCP server, whose io_service runs on the secondary core.
+struct AsioServer
+{
+    enum class Mode
+    {
+        accept, // Reset each connection, upon accepting it.
+        echo,   // Echo each message.
+        sink    // Read each message, and reply with a 1-byte acknowledgement.
+    };
+
+    using Buffer = std::vector< uint8_t >;
+
+    const Mode mode_;
+    const size_t message_size_;
+    asio::io_service iosvc_;
+    boost::optional< asio::io_service::work > work_;
+    tcp::acceptor acceptor_;
+    std::thread thread_;
+
+    AsioServer( Mode mode, size_t message_size )
+    :
+        mode_( mode ),
+        message_size_( message_size ),
+        acceptor_( iosvc_, tcp::endpoint( asio::ip::address_v4::loopback(), 0 ) )
+    {
+        work_.emplace( iosvc_ );
+        this->accept_next();
+
+        // Block on thread actually starting.
+        std::promise< void > started_promise;
+        iosvc_.post( [&started_promise]() { started_promise.set_value(); } );
+        thread_ = std::thread{ [this]()
+            {
+                SetCoreAffinity( GetSecondaryCoreId() );
+                iosvc_.run();
+            } };
+        started_promise.get_future().wait();
+    }
+
+    ~AsioServer()
+    {
+        work_.reset();
+        iosvc_.stop();
+        thread_.join();
+    }
+
+    tcp::endpoint endpoint() const
+    {
+        return acceptor_.local_endpoint();
+    }
+
+    void accept_next()
+    {
+        std::shared_ptr< tcp::socket > socket = std::make_shared< tcp::socket >( iosvc_ );
+        acceptor_.async_accept( *socket, [this, socket]( const boost::system::error_code &ec )
+            {
+                if (ec) return;
+
+                switch (mode_)
+                {
+                case Mode::accept:
+                    socket->set_option( asio::socket_base::linger( true, 0 ) );
+                    socket->close();
+                    break;
+
+                case Mode::echo:
+                    socket->set_option( tcp::no_delay( true ) );
+                    this->serve( socket, std::make_shared< Buffer >( message_size_ ) );
+                    break;
+
+                case Mode::sink:
+                    socket->set_option( tcp::no_delay( true ) );
+                    this->sink( socket, std::make_shared< Buffer >( message_size_ ),
+                        std::make_shared< Acks >() );
+                    break;
+                }
+
+                this->accept_next();
+            } );
+    }
+
+        // Acknowledgements owed on a sink connection, which are written in batches.
+    struct Acks
+    {
+        Buffer buf;
+        size_t pending = 0;
+        bool writing = false;
+    };
+
+        // Echoes messages on a connection, until it's closed.
+    void serve( std::shared_ptr< tcp::socket > socket, std::shared_ptr< Buffer > buf )
+    {
+        asio::async_read( *socket, asio::buffer( *buf ),
+            [this, socket, buf]( const boost::system::error_code &ec, size_t )
+            {
+                if (ec) return;
+
+                asio::async_write( *socket, asio::buffer( *buf ),
+                    [this, socket, buf]( const boost::system::error_code &ec, size_t )
+                    {
+                        if (!ec) this->serve( socket, buf );
+                    } );
+            } );
+    }
+
+        // Reads messages on a connection, until it's closed, acknowledging each.  The client
+        // writes its blocks back-to-back, and reads the acks only as they arrive, so a blocking
+        // write could stall the io_service.  Instead, the next read starts right away, and the
+        // acks owed while one is being written are written together, after it.
+    void sink(
+        std::shared_ptr< tcp::socket > socket, std::shared_ptr< Buffer > buf,
+        std::shared_ptr< Acks > acks )
+    {
+        asio::async_read( *socket, asio::buffer( *buf ),
+            [this, socket, buf, acks]( const boost::system::error_code &ec, size_t )
+            {
+                if (ec) return;
+
+                ++acks->pending;
+                this->ack( socket, acks );
+                this->sink( socket, buf, acks );
+            } );
+    }
+
+    void ack( std::shared_ptr< tcp::socket > socket, std::shared_ptr< Acks > acks )
+    {
+        if (acks->writing || !acks->pending) return;
+
+        acks->writing = true;
+        acks->buf.assign( acks->pending, 0 );
+        acks->pending = 0;
+        asio::async_write( *socket, asio::buffer( acks->buf ),
+            [this, socket, acks]( const boost::system::error_code &ec, size_t )
+            {
+                acks->writing = false;
+                if (!ec) this->ack( socket, acks );
+            } );
+    }
+};
+
+
+    // Client connections to an AsioServer, whose io_service runs on the calling thread.
+struct AsioClient
+{
+    asio::io_service iosvc_;
+    std::vector< tcp::socket > sockets_;
+
+    AsioClient( const tcp::endpoint &endpoint, int num_connections )
+    {
+        sockets_.reserve( num_connections );
+        for (int i = 0; i < num_connections; ++i)
+        {
+            sockets_.emplace_back( iosvc_ );
+            sockets_.back().connect( endpoint );
+            sockets_.back().set_option( tcp::no_delay( true ) );
+        }
+    }
+};
+
+
+static Timer MakeAcceptTimer()
+{
+    std::shared_ptr< AsioServer > server =
+        std::make_shared< AsioServer >( AsioServer::Mode::accept, 0 );
+    std::shared_ptr< asio::io_service > iosvc = std::make_shared< asio::io_service >();
+
+    std::function< void() > f = [server, iosvc]()
+        {
+            tcp::socket socket{ *iosvc };
+            socket.connect( server->endpoint() );
+
+            // Returns once the server has accepted and reset the connection.
+            uint8_t byte = 0;
+            boost::system::error_code ec;
+            socket.read_some( asio::buffer( &byte, 1 ), ec );
+        };
+
+    return MakeTimer( f );
+}
+
+
+static Timer MakeRequestTimer( int concurrency )
+{
+    std::shared_ptr< AsioServer > server =
+        std::make_shared< AsioServer >( AsioServer::Mode::echo, Request_size );
+    std::shared_ptr< AsioClient > client =
+        std::make_shared< AsioClient >( server->endpoint(), concurrency );
+
+    // Each iteration is a request on every connection, so they're all kept busy, however few
+    // iterations there are.
+    return [server, client, concurrency]( int num_iters )
+        {
+            std::vector< std::vector< uint8_t > > bufs(
+                client->sockets_.size(), std::vector< uint8_t >( Request_size ) );
+            int unissued = num_iters * concurrency;
+
+            // Sends a request on connection i, and then the next one, upon reading the response.
+            std::function< void( size_t ) > issue = [&]( size_t i )
+                {
+                    if (unissued <= 0) return;
+                    --unissued;
+
+                    tcp::socket &socket = client->sockets_[i];
+                    asio::async_write( socket, asio::buffer( bufs[i] ),
+                        [&, i]( const boost::system::error_code &ec, size_t )
+                        {
+                            CheckError( ec );
+                            asio::async_read( socket, asio::buffer( bufs[i] ),
+                                [&, i]( const boost::system::error_code &ec, size_t )
+                                {
+                                    CheckError( ec );
+                                    issue( i );
+                                } );
+                        } );
+                };
+
+            client->iosvc_.reset();
+
+            TimePoints start_times = Start();
+            for (size_t i = 0; i < client->sockets_.size(); ++i) issue( i );
+            client->iosvc_.run();
+
+            Durations durs = End( start_times );
+            return durs / concurrency;
+        };
+}
+
+
+static Timer MakeStreamTimer( size_t block_size, int segments )
+{
+    std::shared_ptr< AsioServer > server =
+        std::make_shared< AsioServer >( AsioServer::Mode::sink, block_size );
+    std::shared_ptr< AsioClient > client = std::make_shared< AsioClient >( server->endpoint(), 1 );
+
+    return [server, client, block_size, segments]( int num_iters )
+        {
+            std::vector< uint8_t > data( block_size );
+            std::vector< asio::const_buffer > block;
+            const size_t segment_size = block_size / segments;
+            for (int i = 0; i < segments; ++i)
+            {
+                block.push_back( asio::buffer( data.data() + i * segment_size, segment_size ) );
+            }
+
+            std::vector< uint8_t > acks( num_iters );
+            tcp::socket &socket = client->sockets_.front();
+            int unsent = num_iters;
+
+            std::function< void() > send_next = [&]()
+                {
+                    if (unsent <= 0) return;
+                    --unsent;
+
+                    asio::async_write( socket, block,
+                        [&]( const boost::system::error_code &ec, size_t )
+                        {
+                            CheckError( ec );
+                            send_next();
+                        } );
+                };
+
+            client->iosvc_.reset();
+
+            TimePoints start_times = Start();
+            send_next();
+            asio::async_read( socket, asio::buffer( acks ),
+                []( const boost::system::error_code &ec, size_t )
+                {
+                    CheckError( ec );
+                } );
+            client->iosvc_.run();
+
+            return End( start_times );
+        };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_accept >()
+{
+    return { MakeAcceptTimer(), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_rps_1c >()
+{
+    return { MakeRequestTimer( 1 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_rps_2c >()
+{
+    return { MakeRequestTimer( 2 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_rps_4c >()
+{
+    return { MakeRequestTimer( 4 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_rps_8c >()
+{
+    return { MakeRequestTimer( 8 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_rps_16c >()
+{
+    return { MakeRequestTimer( 16 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_rps_32c >()
+{
+    return { MakeRequestTimer( 32 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_rps_64c >()
+{
+    return { MakeRequestTimer( 64 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_stream_256 >()
+{
+    return { MakeStreamTimer( 256, 1 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_stream_4k >()
+{
+    return { MakeStreamTimer( size_t{ 1 } << 12, 1 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_stream_64k >()
+{
+    return { MakeStreamTimer( size_t{ 1 } << 16, 1 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_stream_1M >()
+{
+    return { MakeStreamTimer( size_t{ 1 } << 20, 1 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_gather_1 >()
+{
+    return { MakeStreamTimer( Gather_size, 1 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_gather_4 >()
+{
+    return { MakeStreamTimer( Gather_size, 4 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_gather_16 >()
+{
+    return { MakeStreamTimer( Gather_size, 16 ), nullptr };
+}
+
+
+template<> BenchTimers MakeTimers< Benchmark::network_gather_64 >()
+{
+    return { MakeStreamTimer( Gather_size, 64 ), nullptr };
+}
+
+
+} // namespace bench
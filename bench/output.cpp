@@ -32,6 +32,8 @@ class PrettyOutputFormatter final: public IOutputFormatter
 public:
     explicit PrettyOutputFormatter( std::ostream &ostream );
     void write( Benchmark, NormDurations, int, CpuClockPeriod ) override;
+    void skip( Benchmark, const std::string & ) override;
+    void annotate( Benchmark, const std::string & ) override;
 
 private:
     std::ostream &ostream_;
@@ -142,6 +144,18 @@ void PrettyOutputFormatter::write(
 }
 
 
+void PrettyOutputFormatter::skip( Benchmark benchmark, const std::string &reason )
+{
+    ostream_ << benchmark << ": skipped (" << reason << ")\n";
+}
+
+
+void PrettyOutputFormatter::annotate( Benchmark, const std::string &note )
+{
+    ostream_ << "  " << note << "\n";
+}
+
+
 
 // class IOutputFormatter:
 std::unique_ptr< IOutputFormatter > IOutputFormatter::create(
@@ -18,6 +18,7 @@
 
 #include <iosfwd>
 #include <memory>
+#include <string>
 
 #include "enum_utils.hpp"
 #include "list.hpp"
@@ -64,6 +65,18 @@ public:
         int num_iters,
         autotime::CpuClockPeriod clockspeed
     ) = 0;
+
+        //! Notes a benchmark that couldn't be run.
+    virtual void skip(
+        Benchmark benchmark,
+        const std::string &reason
+    ) = 0;
+
+        //! Adds a note to the benchmark's result, which was just written.
+    virtual void annotate(
+        Benchmark benchmark,
+        const std::string &note
+    ) = 0;
 };
 
 
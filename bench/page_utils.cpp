@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Page-related utilities.
+/*! @file
+
+    See page_utils.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "page_utils.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include <sys/mman.h>
+
+#include "error_utils.hpp"
+
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+
+namespace bench
+{
+
+
+const char *ToCStr( PageKind kind )
+{
+    switch (kind)
+    {
+#define CASE( n ) \
+    case PageKind::n: \
+        return #n
+
+    CASE( small );
+    CASE( thp );
+    CASE( huge_2M );
+    CASE( huge_1G );
+
+#undef CASE
+    }
+
+    return nullptr;
+}
+
+
+size_t PageSize( PageKind kind )
+{
+    switch (kind)
+    {
+    case PageKind::small:
+        return size_t{ 1 } << 12;
+
+    case PageKind::thp:
+    case PageKind::huge_2M:
+        return size_t{ 1 } << 21;
+
+    case PageKind::huge_1G:
+        return size_t{ 1 } << 30;
+    }
+
+    return 0;
+}
+
+
+static bool IsThpEnabled()
+{
+    std::ifstream ifs( "/sys/kernel/mm/transparent_hugepage/enabled" );
+    std::string setting;
+    if (!std::getline( ifs, setting )) return false;
+
+    return setting.find( "[never]" ) == std::string::npos;
+}
+
+
+PageMapping::PageMapping( size_t size, PageKind kind, bool populate )
+{
+    const size_t page_size = PageSize( kind );
+    size_ = (size + page_size - 1) & ~(page_size - 1);
+
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    length_ = size_;
+    switch (kind)
+    {
+    case PageKind::small:
+        break;
+
+    case PageKind::thp:
+        if (!IsThpEnabled()) throw unavailable_error( "transparent huge pages are disabled" );
+
+        // Over-allocate, so the start can be aligned to a huge page.
+        length_ += page_size;
+        break;
+
+    case PageKind::huge_2M:
+        flags |= MAP_HUGETLB | (21 << MAP_HUGE_SHIFT);
+        break;
+
+    case PageKind::huge_1G:
+        flags |= MAP_HUGETLB | (30 << MAP_HUGE_SHIFT);
+        break;
+    }
+
+    base_ = mmap( nullptr, length_, PROT_READ | PROT_WRITE, flags, -1, 0 );
+    if (base_ == MAP_FAILED)
+    {
+        const int err = errno;
+        base_ = nullptr;
+        if ((flags & MAP_HUGETLB) && (err == ENOMEM || err == EINVAL))
+        {
+            const char *const name = (kind == PageKind::huge_1G) ? "1 GiB" : "2 MiB";
+            throw unavailable_error( std::string{ "not enough " } + name + " pages are reserved" );
+        }
+        throw_system_error( err, "mmap()" );
+    }
+
+    const uintptr_t addr = reinterpret_cast< uintptr_t >( base_ );
+    data_ = reinterpret_cast< void * >( (addr + page_size - 1) & ~(page_size - 1) );
+
+    // Without THP support in the kernel, MADV_NOHUGEPAGE fails, but 4 KiB pages are assured.
+    if (kind == PageKind::small) madvise( data_, size_, MADV_NOHUGEPAGE );
+    else if (kind == PageKind::thp && madvise( data_, size_, MADV_HUGEPAGE ) != 0)
+    {
+        const int err = errno;
+        munmap( base_, length_ );
+        throw_system_error( err, "madvise()" );
+    }
+
+    if (populate) memset( data_, 0, size_ );
+}
+
+
+PageMapping::~PageMapping()
+{
+    if (base_) munmap( base_, length_ );
+}
+
+
+std::shared_ptr< PageMapping > MapPages( size_t size, PageKind kind, bool populate )
+{
+    return std::make_shared< PageMapping >( size, kind, populate );
+}
+
+
+} // namespace bench
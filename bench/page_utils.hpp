@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Page-related utilities.
+/*! @file
+
+    Provides anonymous mappings backed by a specific page size, so benchmarks
+    can separate TLB effects from the cost of the memory accesses themselves.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_PAGE_UTILS_HPP
+#define BENCH_PAGE_UTILS_HPP
+
+
+#include <cstddef>
+#include <memory>
+
+
+namespace bench
+{
+
+
+enum class PageKind
+{
+    small,      //!< 4 KiB pages, with THP disabled via madvise(MADV_NOHUGEPAGE).
+    thp,        //!< Transparent huge pages, requested via madvise(MADV_HUGEPAGE).
+    huge_2M,    //!< 2 MiB hugetlbfs pages, which must be reserved via vm.nr_hugepages.
+    huge_1G     //!< 1 GiB hugetlbfs pages, which must be reserved at boot.
+};
+
+
+const char *ToCStr( PageKind kind );
+
+
+    //! Returns the size of the pages used for the specified kind of mapping.
+size_t PageSize( PageKind kind );
+
+
+    //! An anonymous, private mapping, which is unmapped upon destruction.
+class PageMapping
+{
+public:
+        //! Maps at least size bytes, aligned to the page size.
+        /*!
+            Throws unavailable_error, if the requested kind of page isn't
+            enabled or reserved.  Unless populate is false, all pages are
+            touched, so that no faults are taken when the memory is used.
+        */
+    PageMapping( size_t size, PageKind kind, bool populate = true );
+    ~PageMapping();
+
+    PageMapping( const PageMapping & ) = delete;
+    PageMapping &operator=( const PageMapping & ) = delete;
+
+    void *data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    void *base_ = nullptr;
+    size_t length_ = 0;     // Of the whole mapping, which can exceed size_ for alignment.
+    void *data_ = nullptr;
+    size_t size_ = 0;
+};
+
+
+std::shared_ptr< PageMapping > MapPages( size_t size, PageKind kind, bool populate = true );
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_PAGE_UTILS_HPP
@@ -0,0 +1,592 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements queue-category benchmarks.
+/*! @file
+
+    Each queue is adapted to passing uint64_t values, so that the same harnesses can measure
+    all of them: one-way latency, round trip, and saturated throughput with P producers and
+    C consumers.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "autotime/os.hpp"
+#include "autotime/time.hpp"
+
+#include "description.hpp"
+#include "dispatch.hpp"
+#include "list.hpp"
+#include "queue_utils.hpp"
+#include "thread_utils.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::queue >()
+{
+    Description desc;
+    desc.measures = "Cross-core handoff via lock-free SPSC, MPMC, and MPSC queues.";
+    desc.detail =
+        "*_latency benchmarks time from a push (on the primary core) to its pop (on the"
+        " secondary core), using timestamps in the values, with one value in flight at a time."
+        "  *_roundtrip benchmarks push a value to a thread on the secondary core, which pushes"
+        " it back on a second queue.  *_throughput benchmarks run P producers and C consumers"
+        " (e.g. _2p2c) flat out, and report the time per value, over 1000 values per"
+        " iteration.  *_batch_throughput consumers pop up to 32 values at once.";
+    desc.overhead = "Reading the clock once, in *_latency benchmarks.";
+    desc.notes =
+        {
+            "spsc re-reads the other side's index on every operation, while spsc_cached only"
+                " does when its copy shows the ring to be full or empty.",
+            "mpmc is Vyukov's bounded ring.  A batch pop claims consecutive, filled slots with"
+                " one compare-exchange.",
+            "mpsc is Vyukov's intrusive queue.  Each producer takes nodes from its own pool,"
+                " which the consumer returns them to via an spsc_cached ring, so recycling the"
+                " nodes is included.  A batch pop is just a series of pops.",
+            "The rings hold 1024 values.",
+            "Member 1 of each team runs on the secondary core (see --pair), and the rest"
+                " round-robin on the other online cores.",
+        };
+    desc.limits =
+        {
+            "Thread counts exceeding the number of online cores oversubscribe them, which"
+                " measures scheduling more than the queue.",
+            "Waiting threads spin and then yield, so a consumer which has been idle for a while"
+                " can add the latency of a sched_yield() call.",
+        };
+    return desc;
+}
+
+
+static constexpr size_t Ring_capacity = 1024;
+static constexpr size_t Batch_size = 32;
+
+    // Values per iteration of *_throughput benchmarks, which amortize the cost of waking the team.
+static constexpr int Values_per_iter = 1000;
+
+
+    // Each adapter is constructed with the number of producers, and provides:
+    //  bool push( uint64_t value, int producer ) - fails if full.
+    //  size_t pop( uint64_t *values, size_t max ) - returns the number popped.
+template<
+    bool Cached
+>
+struct SpscAdapter
+{
+    SpscRing< uint64_t, Cached > ring_{ Ring_capacity };
+
+    explicit SpscAdapter( int ) {}
+
+    bool push( uint64_t value, int ) { return ring_.push( value ); }
+
+    size_t pop( uint64_t *values, size_t max )
+    {
+        return (max == 1) ? ring_.pop( *values ) : ring_.popBatch( values, max );
+    }
+};
+
+
+struct MpmcAdapter
+{
+    MpmcRing< uint64_t > ring_{ Ring_capacity };
+
+    explicit MpmcAdapter( int ) {}
+
+    bool push( uint64_t value, int ) { return ring_.push( value ); }
+
+    size_t pop( uint64_t *values, size_t max ) { return ring_.popBatch( values, max ); }
+};
+
+
+struct MpscAdapter
+{
+    struct Node: MpscNode
+    {
+        uint64_t value = 0;
+        int owner = 0;
+    };
+
+        // A producer's nodes, and the ring via which the consumer returns them.
+    struct Pool
+    {
+        std::vector< Node > nodes_;
+        SpscRing< Node *, true > free_{ Ring_capacity };
+
+        explicit Pool( int owner )
+        :
+            nodes_( Ring_capacity )
+        {
+            for (Node &node: nodes_)
+            {
+                node.owner = owner;
+                free_.push( &node );
+            }
+        }
+    };
+
+    MpscQueue queue_;
+    std::vector< std::unique_ptr< Pool > > pools_;
+
+    explicit MpscAdapter( int num_producers )
+    {
+        for (int i = 0; i < num_producers; ++i) pools_.emplace_back( new Pool( i ) );
+    }
+
+    bool push( uint64_t value, int producer )
+    {
+        Node *node = nullptr;
+        if (!pools_[producer]->free_.pop( node )) return false;
+
+        node->value = value;
+        queue_.push( node );
+        return true;
+    }
+
+    size_t pop( uint64_t *values, size_t max )
+    {
+        size_t count = 0;
+        while (count < max)
+        {
+            Node *const node = static_cast< Node * >( queue_.pop() );
+            if (!node) break;
+
+            values[count++] = node->value;
+            pools_[node->owner]->free_.push( node );
+        }
+        return count;
+    }
+};
+
+
+template<
+    typename Queue
+>
+static void Push( Queue &queue, uint64_t value, int producer = 0 )
+{
+    SpinWait wait;
+    while (!queue.push( value, producer )) wait();
+}
+
+
+    // Pops one value, unless stop is set while waiting for it.
+template<
+    typename Queue
+>
+static bool Pop( Queue &queue, uint64_t &value, const std::atomic< bool > &stop )
+{
+    SpinWait wait;
+    while (!queue.pop( &value, 1 ))
+    {
+        if (stop.load( std::memory_order_relaxed )) return false;
+        wait();
+    }
+    return true;
+}
+
+
+    // Base of the harnesses with a thread on the secondary core, which runs serve() until stopped.
+class Server
+{
+public:
+    virtual ~Server() = default;
+
+protected:
+    void start()
+    {
+        std::promise< void > started_promise;
+        std::future< void > started_future = started_promise.get_future();
+        thread_ = std::thread( &Server::threadfunc, this, std::move( started_promise ) );
+        started_future.get();
+    }
+
+        // Must be called by the destructor of the derived class.
+    void stop()
+    {
+        stop_ = true;
+        thread_.join();
+    }
+
+    virtual void serve() = 0;
+
+    std::atomic< bool > stop_{ false };
+
+private:
+    void threadfunc( std::promise< void > started_promise )
+    {
+        SetCoreAffinity( GetSecondaryCoreId() );
+        started_promise.set_value();
+        serve();
+    }
+
+    std::thread thread_;
+};
+
+
+    // Sends timestamps to the secondary core, which accumulates the time until each is popped.
+template<
+    typename Queue
+>
+class OneWay: public Server
+{
+public:
+    OneWay() { start(); }
+    ~OneWay() { stop(); }
+
+    Durations time( int num_iters )
+    {
+        uint64_t received = received_.load( std::memory_order_acquire );
+        const uint64_t latency_start = latency_.load( std::memory_order_relaxed );
+
+        TimePoints start_times = Start();
+        for (int i = 0; i < num_iters; ++i)
+        {
+            Push( queue_, Now() );
+
+            // Wait for the consumer, so there's only ever one value in flight.
+            ++received;
+            SpinWait wait;
+            while (received_.load( std::memory_order_acquire ) != received) wait();
+        }
+        Durations durs = End( start_times );
+
+        const uint64_t latency = latency_.load( std::memory_order_relaxed ) - latency_start;
+        durs.real = std::chrono::duration_cast< steady_clock::duration >(
+            std::chrono::nanoseconds( latency ) );
+        return durs;
+    }
+
+private:
+    void serve() override
+    {
+        uint64_t sent = 0;
+        while (Pop( queue_, sent, stop_ ))
+        {
+            const uint64_t latency = Now() - sent;
+
+            // Only this thread writes either, and the release publishes the latency.
+            latency_.store( latency_.load( std::memory_order_relaxed ) + latency,
+                std::memory_order_relaxed );
+            received_.store( received_.load( std::memory_order_relaxed ) + 1,
+                std::memory_order_release );
+        }
+    }
+
+    Queue queue_{ 1 };
+    char pad_[64];  // Keeps the consumer's counters off the queue's lines.
+    std::atomic< uint64_t > received_{ 0 };
+    std::atomic< uint64_t > latency_{ 0 };  // ns
+};
+
+
+    // Sends values to the secondary core, which sends them back on a second queue.
+template<
+    typename Queue
+>
+class RoundTrip: public Server
+{
+public:
+    RoundTrip() { start(); }
+    ~RoundTrip() { stop(); }
+
+    Durations time( int num_iters )
+    {
+        const std::atomic< bool > never{ false };
+
+        TimePoints start_times = Start();
+        for (int i = 0; i < num_iters; ++i)
+        {
+            uint64_t value = 0;
+            Push( requests_, i );
+            Pop( responses_, value, never );
+        }
+        return End( start_times );
+    }
+
+private:
+    void serve() override
+    {
+        uint64_t value = 0;
+        while (Pop( requests_, value, stop_ )) Push( responses_, value );
+    }
+
+    Queue requests_{ 1 };
+    Queue responses_{ 1 };
+};
+
+
+    // Runs producers & consumers flat out, timing each value passed between them.
+template<
+    typename Queue
+>
+class Throughput
+{
+public:
+    Throughput( int num_producers, int num_consumers, size_t batch_size )
+    :
+        num_producers_( num_producers ),
+        num_consumers_( num_consumers ),
+        batch_size_( batch_size ),
+        queue_( num_producers ),
+        team_( num_producers + num_consumers, std::bind( &Throughput::run, this,
+            std::placeholders::_1, std::placeholders::_2 ) )
+    {
+    }
+
+    Durations time( int num_iters )
+    {
+        return team_.time( num_iters ) / Values_per_iter;
+    }
+
+private:
+    void run( int idx, int num_iters )
+    {
+        const int total = num_iters * Values_per_iter;
+        if (idx < num_producers_)
+        {
+            const int count = Share( total, num_producers_, idx );
+            for (int i = 0; i < count; ++i) Push( queue_, i, idx );
+            return;
+        }
+
+        // Each consumer pops a fixed share, which all add up to the values pushed.
+        const int consumer = idx - num_producers_;
+        size_t remaining = Share( total, num_consumers_, consumer );
+        std::vector< uint64_t > values( batch_size_ );
+        SpinWait wait;
+        while (remaining)
+        {
+            const size_t max = (remaining < batch_size_) ? remaining : batch_size_;
+            const size_t count = queue_.pop( values.data(), max );
+            if (count)
+            {
+                remaining -= count;
+                wait = SpinWait{};
+            }
+            else wait();
+        }
+    }
+
+        // Returns member i's share of total, with the remainder going to member 0.
+    static int Share( int total, int num_members, int i )
+    {
+        return total / num_members + ((i == 0) ? total % num_members : 0);
+    }
+
+    const int num_producers_;
+    const int num_consumers_;
+    const size_t batch_size_;
+    Queue queue_;
+
+    ThreadTeam team_;   // Last, since it starts the threads which use the other members.
+};
+
+
+template<
+    typename Queue
+>
+static autotime::BenchTimers MakeLatencyTimers()
+{
+    using namespace std::placeholders;
+    auto one_way = std::make_shared< OneWay< Queue > >();
+
+    std::function< void() > overhead = [](){ Now(); };
+    return { std::bind( &OneWay< Queue >::time, one_way, _1 ), MakeTimer( overhead ) };
+}
+
+
+template<
+    typename Queue
+>
+static autotime::BenchTimers MakeRoundTripTimers()
+{
+    using namespace std::placeholders;
+    auto round_trip = std::make_shared< RoundTrip< Queue > >();
+    return { std::bind( &RoundTrip< Queue >::time, round_trip, _1 ), nullptr };
+}
+
+
+template<
+    typename Queue
+>
+static autotime::BenchTimers MakeThroughputTimers(
+    int num_producers, int num_consumers, size_t batch_size = 1 )
+{
+    using namespace std::placeholders;
+    auto throughput =
+        std::make_shared< Throughput< Queue > >( num_producers, num_consumers, batch_size );
+    return { std::bind( &Throughput< Queue >::time, throughput, _1 ), nullptr };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_spsc_latency >()
+{
+    return MakeLatencyTimers< SpscAdapter< false > >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_spsc_roundtrip >()
+{
+    return MakeRoundTripTimers< SpscAdapter< false > >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_spsc_throughput >()
+{
+    return MakeThroughputTimers< SpscAdapter< false > >( 1, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_spsc_batch_throughput >()
+{
+    return MakeThroughputTimers< SpscAdapter< false > >( 1, 1, Batch_size );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_spsc_cached_latency >()
+{
+    return MakeLatencyTimers< SpscAdapter< true > >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_spsc_cached_roundtrip >()
+{
+    return MakeRoundTripTimers< SpscAdapter< true > >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_spsc_cached_throughput >()
+{
+    return MakeThroughputTimers< SpscAdapter< true > >( 1, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_spsc_cached_batch_throughput >()
+{
+    return MakeThroughputTimers< SpscAdapter< true > >( 1, 1, Batch_size );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpmc_latency >()
+{
+    return MakeLatencyTimers< MpmcAdapter >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpmc_roundtrip >()
+{
+    return MakeRoundTripTimers< MpmcAdapter >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpmc_throughput_1p1c >()
+{
+    return MakeThroughputTimers< MpmcAdapter >( 1, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpmc_throughput_2p2c >()
+{
+    return MakeThroughputTimers< MpmcAdapter >( 2, 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpmc_throughput_4p4c >()
+{
+    return MakeThroughputTimers< MpmcAdapter >( 4, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpmc_throughput_1p4c >()
+{
+    return MakeThroughputTimers< MpmcAdapter >( 1, 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpmc_throughput_4p1c >()
+{
+    return MakeThroughputTimers< MpmcAdapter >( 4, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpmc_batch_throughput_1p1c >()
+{
+    return MakeThroughputTimers< MpmcAdapter >( 1, 1, Batch_size );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpmc_batch_throughput_2p2c >()
+{
+    return MakeThroughputTimers< MpmcAdapter >( 2, 2, Batch_size );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpmc_batch_throughput_4p4c >()
+{
+    return MakeThroughputTimers< MpmcAdapter >( 4, 4, Batch_size );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpsc_latency >()
+{
+    return MakeLatencyTimers< MpscAdapter >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpsc_roundtrip >()
+{
+    return MakeRoundTripTimers< MpscAdapter >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpsc_throughput_1p >()
+{
+    return MakeThroughputTimers< MpscAdapter >( 1, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpsc_throughput_2p >()
+{
+    return MakeThroughputTimers< MpscAdapter >( 2, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpsc_throughput_4p >()
+{
+    return MakeThroughputTimers< MpscAdapter >( 4, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpsc_throughput_8p >()
+{
+    return MakeThroughputTimers< MpscAdapter >( 8, 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpsc_batch_throughput_1p >()
+{
+    return MakeThroughputTimers< MpscAdapter >( 1, 1, Batch_size );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::queue_mpsc_batch_throughput_4p >()
+{
+    return MakeThroughputTimers< MpscAdapter >( 4, 1, Batch_size );
+}
+
+
+} // namespace bench
@@ -0,0 +1,296 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Lock-free queues, for the queue benchmarks.
+/*! @file
+
+    These are the usual designs for passing work between threads: a bounded
+    single-producer/single-consumer ring, Dmitry Vyukov's bounded MPMC ring,
+    and his intrusive (unbounded) MPSC queue.  Pushes and pops never block;
+    they fail when the queue is full or empty, so callers choose how to wait.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_QUEUE_UTILS_HPP
+#define BENCH_QUEUE_UTILS_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+
+namespace bench
+{
+
+
+    //! Bounded single-producer/single-consumer ring.
+    /*!
+        With Cached, each side keeps a copy of the other side's index and only
+        re-reads it when the copy indicates the ring is full (or empty), which
+        keeps the index cache lines from bouncing between the cores on every
+        operation.
+    */
+template<
+    typename T,
+    bool Cached
+>
+class SpscRing
+{
+public:
+        //! Capacity must be a power of 2.
+    explicit SpscRing( size_t capacity )
+    :
+        mask_( capacity - 1 ),
+        slots_( new T[capacity] )
+    {
+    }
+
+    bool push( const T &value )
+    {
+        const size_t tail = tail_.load( std::memory_order_relaxed );
+        if (tail - headFor( tail ) > mask_) return false;
+
+        slots_[tail & mask_] = value;
+        tail_.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+
+    bool pop( T &value )
+    {
+        const size_t head = head_.load( std::memory_order_relaxed );
+        if (head == tailFor( head )) return false;
+
+        value = slots_[head & mask_];
+        head_.store( head + 1, std::memory_order_release );
+        return true;
+    }
+
+        //! Pops up to max values, publishing the new head only once.
+    size_t popBatch( T *values, size_t max )
+    {
+        const size_t head = head_.load( std::memory_order_relaxed );
+        size_t count = tailFor( head ) - head;
+        if (count > max) count = max;
+
+        for (size_t i = 0; i < count; ++i) values[i] = slots_[(head + i) & mask_];
+        if (count) head_.store( head + count, std::memory_order_release );
+        return count;
+    }
+
+private:
+        // Returns a head that's current enough to tell whether the ring is full.
+    size_t headFor( size_t tail )
+    {
+        if (!Cached) return head_.load( std::memory_order_acquire );
+
+        if (tail - cached_head_ > mask_) cached_head_ = head_.load( std::memory_order_acquire );
+        return cached_head_;
+    }
+
+        // Returns a tail that's current enough to tell whether the ring is empty.
+    size_t tailFor( size_t head )
+    {
+        if (!Cached) return tail_.load( std::memory_order_acquire );
+
+        if (head == cached_tail_) cached_tail_ = tail_.load( std::memory_order_acquire );
+        return cached_tail_;
+    }
+
+    const size_t mask_;
+    const std::unique_ptr< T[] > slots_;
+
+    // The consumer's line, then the producer's.  Whole lines of padding separate them, without
+    // needing an over-aligned allocation, since either pair can straddle a line boundary.
+    char pad0_[64];
+    std::atomic< size_t > head_{ 0 };
+    size_t cached_tail_ = 0;
+    char pad1_[64];
+    std::atomic< size_t > tail_{ 0 };
+    size_t cached_head_ = 0;
+    char pad2_[64];
+};
+
+
+    //! Dmitry Vyukov's bounded multi-producer/multi-consumer ring.
+    /*!
+        Each slot has a sequence number, indicating whether it's ready to be
+        written or read in the current lap, so producers and consumers only
+        contend on their own index.
+    */
+template<
+    typename T
+>
+class MpmcRing
+{
+public:
+        //! Capacity must be a power of 2.
+    explicit MpmcRing( size_t capacity )
+    :
+        mask_( capacity - 1 ),
+        cells_( new Cell[capacity] )
+    {
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            cells_[i].sequence.store( i, std::memory_order_relaxed );
+        }
+    }
+
+    bool push( const T &value )
+    {
+        size_t pos = enqueue_pos_.load( std::memory_order_relaxed );
+        for (;;)
+        {
+            Cell &cell = cells_[pos & mask_];
+            const size_t seq = cell.sequence.load( std::memory_order_acquire );
+            const intptr_t diff = static_cast< intptr_t >( seq - pos );
+            if (diff == 0)
+            {
+                if (enqueue_pos_.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ))
+                {
+                    cell.value = value;
+                    cell.sequence.store( pos + 1, std::memory_order_release );
+                    return true;
+                }
+            }
+            else if (diff < 0) return false;    // Full.
+            else pos = enqueue_pos_.load( std::memory_order_relaxed );
+        }
+    }
+
+    bool pop( T &value )
+    {
+        return popBatch( &value, 1 ) != 0;
+    }
+
+        //! Claims up to max consecutive, filled slots with one compare-exchange.
+    size_t popBatch( T *values, size_t max )
+    {
+        size_t pos = dequeue_pos_.load( std::memory_order_relaxed );
+        for (;;)
+        {
+            size_t count = 0;
+            while (count < max && sequence( pos + count ) == pos + count + 1) ++count;
+
+            if (count == 0)
+            {
+                // Either it's empty, or another consumer got here first.
+                const size_t seq = sequence( pos );
+                if (static_cast< intptr_t >( seq - (pos + 1) ) < 0) return 0;
+
+                pos = dequeue_pos_.load( std::memory_order_relaxed );
+                continue;
+            }
+
+            if (dequeue_pos_.compare_exchange_weak( pos, pos + count, std::memory_order_relaxed ))
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    Cell &cell = cells_[(pos + i) & mask_];
+                    values[i] = cell.value;
+                    cell.sequence.store( pos + i + mask_ + 1, std::memory_order_release );
+                }
+                return count;
+            }
+        }
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic< size_t > sequence;
+        T value;
+    };
+
+    size_t sequence( size_t pos ) const
+    {
+        return cells_[pos & mask_].sequence.load( std::memory_order_acquire );
+    }
+
+    const size_t mask_;
+    const std::unique_ptr< Cell[] > cells_;
+
+    // Padding keeps the producers' index and the consumers' on separate cache lines.
+    char pad0_[64];
+    std::atomic< size_t > enqueue_pos_{ 0 };
+    char pad1_[64 - sizeof( std::atomic< size_t > )];
+    std::atomic< size_t > dequeue_pos_{ 0 };
+    char pad2_[64 - sizeof( std::atomic< size_t > )];
+};
+
+
+    //! Link field of an element of an MpscQueue.
+struct MpscNode
+{
+    std::atomic< MpscNode * > next{ nullptr };
+};
+
+
+    //! Dmitry Vyukov's intrusive, unbounded multi-producer/single-consumer queue.
+    /*!
+        A push is a single exchange, regardless of contention.  A pop can fail
+        transiently while a producer is between its exchange and linking its
+        node, even though the queue isn't empty.
+    */
+class MpscQueue
+{
+public:
+    void push( MpscNode *node )
+    {
+        node->next.store( nullptr, std::memory_order_relaxed );
+        MpscNode *const prev = head_.exchange( node, std::memory_order_acq_rel );
+        prev->next.store( node, std::memory_order_release );
+    }
+
+        //! Returns nullptr if the queue is empty, or a push is in progress.
+    MpscNode *pop()
+    {
+        MpscNode *tail = tail_;
+        MpscNode *next = tail->next.load( std::memory_order_acquire );
+        if (tail == &stub_)
+        {
+            if (!next) return nullptr;
+
+            tail_ = tail = next;
+            next = next->next.load( std::memory_order_acquire );
+        }
+
+        if (next)
+        {
+            tail_ = next;
+            return tail;
+        }
+
+        if (tail != head_.load( std::memory_order_acquire )) return nullptr;
+
+        // The tail is the last node, so put the stub behind it before popping it.
+        push( &stub_ );
+
+        next = tail->next.load( std::memory_order_acquire );
+        if (!next) return nullptr;
+
+        tail_ = next;
+        return tail;
+    }
+
+private:
+    MpscNode stub_;
+
+    // Padding keeps the producers' end and the consumer's on separate cache lines.
+    char pad0_[64];
+    std::atomic< MpscNode * > head_{ &stub_ };  // Producers' end.
+    char pad1_[64 - sizeof( std::atomic< MpscNode * > )];
+    MpscNode *tail_ = &stub_;                   // Consumer's end.
+    char pad2_[64 - sizeof( MpscNode * )];
+};
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_QUEUE_UTILS_HPP
@@ -0,0 +1,38 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Recording of per-operation samples, for percentiles.
+/*! @file
+
+    See sample_utils.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "sample_utils.hpp"
+
+#include <algorithm>
+
+
+namespace bench
+{
+
+
+std::vector< int64_t > SampleSet::sorted() const
+{
+    std::vector< int64_t > result = samples_;
+    std::sort( result.begin(), result.end() );
+    return result;
+}
+
+
+double Percentile( const std::vector< int64_t > &sorted, double p )
+{
+    const size_t i = static_cast< size_t >( p * (sorted.size() - 1) + 0.5 );
+    return static_cast< double >( sorted[i] );
+}
+
+
+} // namespace bench
@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Recording of per-operation samples, for percentiles.
+/*! @file
+
+    Some benchmarks report a distribution (e.g. of sleep overshoots, or of
+    completion latencies), in addition to the mean that AutoTime() gives.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_SAMPLE_UTILS_HPP
+#define BENCH_SAMPLE_UTILS_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace bench
+{
+
+
+    //! Holds up to a limited number of samples, discarding any more.
+class SampleSet
+{
+public:
+        //! The default limit keeps a benchmark's samples to 8 MiB.
+    explicit SampleSet( size_t capacity = size_t{ 1 } << 20 ): capacity_( capacity ) {}
+
+    void clear() { samples_.clear(); }
+
+    void record( int64_t sample )
+    {
+        if (samples_.size() < capacity_) samples_.push_back( sample );
+    }
+
+    size_t size() const { return samples_.size(); }
+    bool empty() const { return samples_.empty(); }
+
+        //! Returns the samples in ascending order, for Percentile().
+    std::vector< int64_t > sorted() const;
+
+private:
+    const size_t capacity_;
+    std::vector< int64_t > samples_;
+};
+
+
+    //! Returns the sample of the nearest rank to the p-th quantile (0 <= p <= 1).
+    /*!
+        The samples must be sorted, and non-empty.
+    */
+double Percentile( const std::vector< int64_t > &sorted, double p );
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_SAMPLE_UTILS_HPP
@@ -0,0 +1,326 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements simd-category benchmarks.
+/*! @file
+
+    These run the same kernels compiled for each instruction set, which is selected at runtime.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "dispatch.hpp"
+
+#include "autotime/overhead.hpp"
+#include "autotime/time.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "description.hpp"
+#include "error_utils.hpp"
+#include "simd_kernels.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::simd >()
+{
+    Description desc;
+    desc.measures = "Common kernels, implemented with scalar, SSE4.2, AVX2, and AVX-512 code.";
+    desc.detail =
+        "Each kernel is compiled for every instruction set, and the one named by the benchmark"
+        " is selected at runtime.  Benchmarks for instruction sets the CPU lacks are skipped.";
+    desc.notes =
+        {
+            "simd_sum_* & simd_dot_* reduce 4k floats, using two accumulators.",
+            "simd_find_* searches 16 KiB for a byte found only at the end, like memchr().",
+            "simd_prefix_sum_* computes an in-place inclusive scan of 4k 32-bit integers.",
+            "simd_mandelbrot_* computes up to 256 iterations, for each of 64 points along a line"
+                " through the set.  Vectors iterate until all of their points escape.",
+            "simd_fma_* runs 4 dependent chains of 256 FMAs, which is bound by FMA latency.  So,"
+                " differences between them are due to the core clock, which is printed after the"
+                " results.  This shows any frequency drop from heavy use of wide vectors.",
+        };
+    desc.limits =
+        {
+            "The inferred clock speed assumes an FMA latency of 4 cycles.",
+            "The clock speed reported by the OS might not reflect frequency licenses, and is"
+                " static in many VMs.",
+        };
+    return desc;
+}
+
+
+static constexpr size_t Num_elements = 4096;
+static constexpr size_t Find_size = 16384;
+static constexpr size_t Mandelbrot_points = 64;
+static constexpr int Mandelbrot_iters = 256;
+
+
+    // Results are stored here, so that the kernels aren't optimized away.
+static volatile float Float_sink;
+static const volatile uint8_t *Pointer_sink;
+
+
+static autotime::BenchTimers MakeSumTimers( Isa isa )
+{
+    const SimdKernels &kernels = GetSimdKernels( isa );
+    std::shared_ptr< std::vector< float > > data =
+        std::make_shared< std::vector< float > >( Num_elements, 0.5f );
+
+    std::function< void() > f = [&kernels, data]()
+        {
+            Float_sink = kernels.sum( data->data(), data->size() );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+static autotime::BenchTimers MakeDotTimers( Isa isa )
+{
+    const SimdKernels &kernels = GetSimdKernels( isa );
+    std::shared_ptr< std::vector< float > > a =
+        std::make_shared< std::vector< float > >( Num_elements, 0.5f );
+    std::shared_ptr< std::vector< float > > b =
+        std::make_shared< std::vector< float > >( Num_elements, 2.0f );
+
+    std::function< void() > f = [&kernels, a, b]()
+        {
+            Float_sink = kernels.dot( a->data(), b->data(), a->size() );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+static autotime::BenchTimers MakeFindTimers( Isa isa )
+{
+    const SimdKernels &kernels = GetSimdKernels( isa );
+    std::shared_ptr< std::vector< uint8_t > > data =
+        std::make_shared< std::vector< uint8_t > >( Find_size, 0 );
+    data->back() = 1;
+
+    std::function< void() > f = [&kernels, data]()
+        {
+            Pointer_sink = kernels.find( data->data(), data->size(), 1 );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+static autotime::BenchTimers MakePrefixSumTimers( Isa isa )
+{
+    const SimdKernels &kernels = GetSimdKernels( isa );
+    std::shared_ptr< std::vector< uint32_t > > data =
+        std::make_shared< std::vector< uint32_t > >( Num_elements, 1 );
+
+    // Each iteration scans the previous one's output, which wraps around harmlessly.
+    std::function< void() > f = [&kernels, data]()
+        {
+            kernels.prefix_sum( data->data(), data->size() );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+struct MandelbrotData
+{
+    std::vector< float > re, im;
+    std::vector< int32_t > iters;
+};
+
+
+static autotime::BenchTimers MakeMandelbrotTimers( Isa isa )
+{
+    const SimdKernels &kernels = GetSimdKernels( isa );
+    std::shared_ptr< MandelbrotData > data = std::make_shared< MandelbrotData >();
+    data->re.resize( Mandelbrot_points );
+    data->im.resize( Mandelbrot_points, 0.1f );
+    data->iters.resize( Mandelbrot_points );
+
+    // A line from outside the set on the left, through it, and out the right.
+    for (size_t i = 0; i < Mandelbrot_points; ++i)
+    {
+        data->re[i] = -2.25f + 3.0f * i / Mandelbrot_points;
+    }
+
+    std::function< void() > f = [&kernels, data]()
+        {
+            kernels.mandelbrot(
+                data->re.data(), data->im.data(), data->iters.data(), Mandelbrot_points,
+                Mandelbrot_iters );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+static autotime::BenchTimers MakeFmaTimers( Isa isa )
+{
+    // Even the scalar version uses FMA instructions, which are only assured with AVX2.
+    if (isa == Isa::scalar && !IsSupported( Isa::avx2 ))
+    {
+        throw unavailable_error( "FMA isn't supported by this CPU" );
+    }
+    const SimdKernels &kernels = GetSimdKernels( isa );
+
+    std::function< void() > f = [&kernels]()
+        {
+            Float_sink = kernels.fma_chains( 0.5f, Fma_steps );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_sum_scalar >()
+{
+    return MakeSumTimers( Isa::scalar );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_sum_sse42 >()
+{
+    return MakeSumTimers( Isa::sse42 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_sum_avx2 >()
+{
+    return MakeSumTimers( Isa::avx2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_sum_avx512 >()
+{
+    return MakeSumTimers( Isa::avx512 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_dot_scalar >()
+{
+    return MakeDotTimers( Isa::scalar );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_dot_sse42 >()
+{
+    return MakeDotTimers( Isa::sse42 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_dot_avx2 >()
+{
+    return MakeDotTimers( Isa::avx2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_dot_avx512 >()
+{
+    return MakeDotTimers( Isa::avx512 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_find_scalar >()
+{
+    return MakeFindTimers( Isa::scalar );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_find_sse42 >()
+{
+    return MakeFindTimers( Isa::sse42 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_find_avx2 >()
+{
+    return MakeFindTimers( Isa::avx2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_find_avx512 >()
+{
+    return MakeFindTimers( Isa::avx512 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_prefix_sum_scalar >()
+{
+    return MakePrefixSumTimers( Isa::scalar );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_prefix_sum_sse42 >()
+{
+    return MakePrefixSumTimers( Isa::sse42 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_prefix_sum_avx2 >()
+{
+    return MakePrefixSumTimers( Isa::avx2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_prefix_sum_avx512 >()
+{
+    return MakePrefixSumTimers( Isa::avx512 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_mandelbrot_scalar >()
+{
+    return MakeMandelbrotTimers( Isa::scalar );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_mandelbrot_sse42 >()
+{
+    return MakeMandelbrotTimers( Isa::sse42 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_mandelbrot_avx2 >()
+{
+    return MakeMandelbrotTimers( Isa::avx2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_mandelbrot_avx512 >()
+{
+    return MakeMandelbrotTimers( Isa::avx512 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_fma_scalar >()
+{
+    return MakeFmaTimers( Isa::scalar );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_fma_avx2 >()
+{
+    return MakeFmaTimers( Isa::avx2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::simd_fma_avx512 >()
+{
+    return MakeFmaTimers( Isa::avx512 );
+}
+
+
+} // namespace bench
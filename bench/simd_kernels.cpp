@@ -0,0 +1,753 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! SIMD kernels, for each supported instruction set.
+/*! @file
+
+    See simd_kernels.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "simd_kernels.hpp"
+#include "enum_impl.hpp"
+
+#include "autotime/work.hpp"
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include <immintrin.h>
+
+#include "error_utils.hpp"
+
+
+    // Keeps the compiler from vectorizing the scalar kernels, when built with -O3.
+#define SCALAR_KERNEL __attribute__(( optimize( "no-tree-vectorize" ) ))
+
+#define SSE42_KERNEL __attribute__(( target( "sse4.2" ) ))
+#define AVX2_KERNEL __attribute__(( target( "avx2,fma" ) ))
+#define AVX512_KERNEL __attribute__(( target( "avx512f,avx512bw,avx2,fma" ) ))
+
+
+namespace bench
+{
+
+
+// enum class Isa:
+Isa operator++( Isa &isa )
+{
+    isa = Next< Isa >( isa );
+    return isa;
+}
+
+
+template<> EnumRange< Isa > RangeOf< Isa >()
+{
+    return boost::irange< Isa >( Isa::first, boost::next( Isa::last ) );
+}
+
+
+const char *ToCStr( Isa isa )
+{
+    switch (isa)
+    {
+#define CASE( n ) \
+    case Isa::n: \
+        return #n
+
+    CASE( scalar );
+    CASE( sse42 );
+    CASE( avx2 );
+    CASE( avx512 );
+
+#undef CASE
+    }
+
+    return nullptr;
+}
+
+
+std::istream &operator>>( std::istream &istream, Isa &isa )
+{
+    std::string str;
+    if (istream >> str)
+    {
+        if (boost::optional< Isa > opt = FromString< Isa >( str ))
+        {
+            isa = *opt;
+            return istream;
+        }
+        istream.clear( std::ostream::failbit );
+    }
+
+    return istream;
+}
+
+
+std::ostream &operator<<( std::ostream &ostream, Isa isa )
+{
+    if (const char *c_str = ToCStr( isa )) ostream << c_str;
+    else ostream.clear( std::ostream::failbit );
+
+    return ostream;
+}
+
+
+
+bool IsSupported( Isa isa )
+{
+    __builtin_cpu_init();
+    switch (isa)
+    {
+    case Isa::scalar:
+        return true;
+
+    case Isa::sse42:
+        return __builtin_cpu_supports( "sse4.2" );
+
+    case Isa::avx2:
+        return __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" );
+
+    case Isa::avx512:
+        return __builtin_cpu_supports( "avx512f" ) && __builtin_cpu_supports( "avx512bw" );
+    }
+
+    return false;
+}
+
+
+
+// Scalar:
+
+SCALAR_KERNEL static float SumScalar( const float *data, size_t n )
+{
+    float sum = 0.0f;
+    for (size_t i = 0; i < n; ++i) sum += data[i];
+
+    return sum;
+}
+
+
+SCALAR_KERNEL static float DotScalar( const float *a, const float *b, size_t n )
+{
+    float sum = 0.0f;
+    for (size_t i = 0; i < n; ++i) sum += a[i] * b[i];
+
+    return sum;
+}
+
+
+SCALAR_KERNEL static const uint8_t *FindScalar( const uint8_t *data, size_t n, uint8_t value )
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (data[i] == value) return data + i;
+    }
+
+    return nullptr;
+}
+
+
+SCALAR_KERNEL static void PrefixSumScalar( uint32_t *data, size_t n )
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < n; ++i) data[i] = sum += data[i];
+}
+
+
+SCALAR_KERNEL static void MandelbrotScalar(
+    const float *re, const float *im, int32_t *iters, size_t n, int max_iters )
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        float zr = 0.0f, zi = 0.0f;
+        int32_t count = 0;
+        for (int iter = 0; iter < max_iters; ++iter)
+        {
+            const float zr2 = zr * zr, zi2 = zi * zi;
+            if (zr2 + zi2 > 4.0f) break;
+
+            ++count;
+            zi = 2.0f * zr * zi + im[i];
+            zr = zr2 - zi2 + re[i];
+        }
+        iters[i] = count;
+    }
+}
+
+
+    // Uses scalar FMA instructions, since the clock comparison needs the same latency as vectors.
+AVX2_KERNEL static float FmaChainsScalar( float x, size_t n )
+{
+    __m128 mul = _mm_set_ss( x ), add = _mm_set_ss( 1.0f );
+    __m128 acc0 = _mm_setzero_ps(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        acc0 = _mm_fmadd_ss( acc0, mul, add );
+        acc1 = _mm_fmadd_ss( acc1, mul, add );
+        acc2 = _mm_fmadd_ss( acc2, mul, add );
+        acc3 = _mm_fmadd_ss( acc3, mul, add );
+    }
+
+    return _mm_cvtss_f32( _mm_add_ss( _mm_add_ss( acc0, acc1 ), _mm_add_ss( acc2, acc3 ) ) );
+}
+
+
+
+// SSE4.2:
+
+SSE42_KERNEL static float HorizontalSum( __m128 v )
+{
+    v = _mm_add_ps( v, _mm_movehl_ps( v, v ) );
+    v = _mm_add_ss( v, _mm_shuffle_ps( v, v, 1 ) );
+    return _mm_cvtss_f32( v );
+}
+
+
+SSE42_KERNEL static float SumSse42( const float *data, size_t n )
+{
+    __m128 sum0 = _mm_setzero_ps(), sum1 = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        sum0 = _mm_add_ps( sum0, _mm_loadu_ps( data + i ) );
+        sum1 = _mm_add_ps( sum1, _mm_loadu_ps( data + i + 4 ) );
+    }
+
+    float sum = HorizontalSum( _mm_add_ps( sum0, sum1 ) );
+    for (; i < n; ++i) sum += data[i];
+
+    return sum;
+}
+
+
+SSE42_KERNEL static float DotSse42( const float *a, const float *b, size_t n )
+{
+    __m128 sum0 = _mm_setzero_ps(), sum1 = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        sum0 = _mm_add_ps( sum0, _mm_mul_ps( _mm_loadu_ps( a + i ), _mm_loadu_ps( b + i ) ) );
+        sum1 = _mm_add_ps(
+            sum1, _mm_mul_ps( _mm_loadu_ps( a + i + 4 ), _mm_loadu_ps( b + i + 4 ) ) );
+    }
+
+    float sum = HorizontalSum( _mm_add_ps( sum0, sum1 ) );
+    for (; i < n; ++i) sum += a[i] * b[i];
+
+    return sum;
+}
+
+
+SSE42_KERNEL static const uint8_t *FindSse42( const uint8_t *data, size_t n, uint8_t value )
+{
+    const __m128i needle = _mm_set1_epi8( static_cast< char >( value ) );
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const __m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i * >( data + i ) );
+        const int mask = _mm_movemask_epi8( _mm_cmpeq_epi8( block, needle ) );
+        if (mask) return data + i + __builtin_ctz( mask );
+    }
+
+    for (; i < n; ++i)
+    {
+        if (data[i] == value) return data + i;
+    }
+
+    return nullptr;
+}
+
+
+SSE42_KERNEL static void PrefixSumSse42( uint32_t *data, size_t n )
+{
+    __m128i carry = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128i *const p = reinterpret_cast< __m128i * >( data + i );
+        __m128i x = _mm_loadu_si128( p );
+        x = _mm_add_epi32( x, _mm_slli_si128( x, 4 ) );
+        x = _mm_add_epi32( x, _mm_slli_si128( x, 8 ) );
+        x = _mm_add_epi32( x, carry );
+        _mm_storeu_si128( p, x );
+        carry = _mm_shuffle_epi32( x, 0xff );
+    }
+
+    uint32_t sum = _mm_cvtsi128_si32( carry );
+    for (; i < n; ++i) data[i] = sum += data[i];
+}
+
+
+SSE42_KERNEL static void MandelbrotSse42(
+    const float *re, const float *im, int32_t *iters, size_t n, int max_iters )
+{
+    const __m128 four = _mm_set1_ps( 4.0f );
+    for (size_t i = 0; i < n; i += 4)
+    {
+        const __m128 cr = _mm_loadu_ps( re + i ), ci = _mm_loadu_ps( im + i );
+        __m128 zr = _mm_setzero_ps(), zi = _mm_setzero_ps();
+        __m128i count = _mm_setzero_si128();
+        for (int iter = 0; iter < max_iters; ++iter)
+        {
+            const __m128 zr2 = _mm_mul_ps( zr, zr ), zi2 = _mm_mul_ps( zi, zi );
+            const __m128 active = _mm_cmple_ps( _mm_add_ps( zr2, zi2 ), four );
+            if (!_mm_movemask_ps( active )) break;
+
+            // Active lanes are all ones (i.e. -1).
+            count = _mm_sub_epi32( count, _mm_castps_si128( active ) );
+            const __m128 zrzi = _mm_mul_ps( zr, zi );
+            zi = _mm_add_ps( _mm_add_ps( zrzi, zrzi ), ci );
+            zr = _mm_add_ps( _mm_sub_ps( zr2, zi2 ), cr );
+        }
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( iters + i ), count );
+    }
+}
+
+
+
+// AVX2:
+
+AVX2_KERNEL static float HorizontalSum( __m256 v )
+{
+    __m128 x = _mm_add_ps( _mm256_castps256_ps128( v ), _mm256_extractf128_ps( v, 1 ) );
+    x = _mm_add_ps( x, _mm_movehl_ps( x, x ) );
+    x = _mm_add_ss( x, _mm_shuffle_ps( x, x, 1 ) );
+    return _mm_cvtss_f32( x );
+}
+
+
+AVX2_KERNEL static float SumAvx2( const float *data, size_t n )
+{
+    __m256 sum0 = _mm256_setzero_ps(), sum1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        sum0 = _mm256_add_ps( sum0, _mm256_loadu_ps( data + i ) );
+        sum1 = _mm256_add_ps( sum1, _mm256_loadu_ps( data + i + 8 ) );
+    }
+
+    float sum = HorizontalSum( _mm256_add_ps( sum0, sum1 ) );
+    for (; i < n; ++i) sum += data[i];
+
+    return sum;
+}
+
+
+AVX2_KERNEL static float DotAvx2( const float *a, const float *b, size_t n )
+{
+    __m256 sum0 = _mm256_setzero_ps(), sum1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        sum0 = _mm256_fmadd_ps( _mm256_loadu_ps( a + i ), _mm256_loadu_ps( b + i ), sum0 );
+        sum1 = _mm256_fmadd_ps(
+            _mm256_loadu_ps( a + i + 8 ), _mm256_loadu_ps( b + i + 8 ), sum1 );
+    }
+
+    float sum = HorizontalSum( _mm256_add_ps( sum0, sum1 ) );
+    for (; i < n; ++i) sum += a[i] * b[i];
+
+    return sum;
+}
+
+
+AVX2_KERNEL static const uint8_t *FindAvx2( const uint8_t *data, size_t n, uint8_t value )
+{
+    const __m256i needle = _mm256_set1_epi8( static_cast< char >( value ) );
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        const __m256i block =
+            _mm256_loadu_si256( reinterpret_cast< const __m256i * >( data + i ) );
+        const unsigned mask = _mm256_movemask_epi8( _mm256_cmpeq_epi8( block, needle ) );
+        if (mask) return data + i + __builtin_ctz( mask );
+    }
+
+    for (; i < n; ++i)
+    {
+        if (data[i] == value) return data + i;
+    }
+
+    return nullptr;
+}
+
+
+AVX2_KERNEL static void PrefixSumAvx2( uint32_t *data, size_t n )
+{
+    __m256i carry = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i *const p = reinterpret_cast< __m256i * >( data + i );
+        __m256i x = _mm256_loadu_si256( p );
+
+        // Prefix sums within each 128-bit lane.
+        x = _mm256_add_epi32( x, _mm256_slli_si256( x, 4 ) );
+        x = _mm256_add_epi32( x, _mm256_slli_si256( x, 8 ) );
+
+        // Add the last element of the low lane to the high lane.
+        const __m256i low_last = _mm256_shuffle_epi32( x, 0xff );
+        x = _mm256_add_epi32( x, _mm256_permute2x128_si256( low_last, low_last, 0x08 ) );
+
+        x = _mm256_add_epi32( x, carry );
+        _mm256_storeu_si256( p, x );
+        carry = _mm256_permutevar8x32_epi32( x, _mm256_set1_epi32( 7 ) );
+    }
+
+    uint32_t sum = _mm256_cvtsi256_si32( carry );
+    for (; i < n; ++i) data[i] = sum += data[i];
+}
+
+
+AVX2_KERNEL static void MandelbrotAvx2(
+    const float *re, const float *im, int32_t *iters, size_t n, int max_iters )
+{
+    const __m256 four = _mm256_set1_ps( 4.0f );
+    for (size_t i = 0; i < n; i += 8)
+    {
+        const __m256 cr = _mm256_loadu_ps( re + i ), ci = _mm256_loadu_ps( im + i );
+        __m256 zr = _mm256_setzero_ps(), zi = _mm256_setzero_ps();
+        __m256i count = _mm256_setzero_si256();
+        for (int iter = 0; iter < max_iters; ++iter)
+        {
+            const __m256 zr2 = _mm256_mul_ps( zr, zr ), zi2 = _mm256_mul_ps( zi, zi );
+            const __m256 active = _mm256_cmp_ps( _mm256_add_ps( zr2, zi2 ), four, _CMP_LE_OQ );
+            if (!_mm256_movemask_ps( active )) break;
+
+            // Active lanes are all ones (i.e. -1).
+            count = _mm256_sub_epi32( count, _mm256_castps_si256( active ) );
+            const __m256 zrzi = _mm256_mul_ps( zr, zi );
+            zi = _mm256_add_ps( _mm256_add_ps( zrzi, zrzi ), ci );
+            zr = _mm256_add_ps( _mm256_sub_ps( zr2, zi2 ), cr );
+        }
+        _mm256_storeu_si256( reinterpret_cast< __m256i * >( iters + i ), count );
+    }
+}
+
+
+AVX2_KERNEL static float FmaChainsAvx2( float x, size_t n )
+{
+    const __m256 mul = _mm256_set1_ps( x ), add = _mm256_set1_ps( 1.0f );
+    __m256 acc0 = _mm256_setzero_ps(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        acc0 = _mm256_fmadd_ps( acc0, mul, add );
+        acc1 = _mm256_fmadd_ps( acc1, mul, add );
+        acc2 = _mm256_fmadd_ps( acc2, mul, add );
+        acc3 = _mm256_fmadd_ps( acc3, mul, add );
+    }
+
+    return HorizontalSum(
+        _mm256_add_ps( _mm256_add_ps( acc0, acc1 ), _mm256_add_ps( acc2, acc3 ) ) );
+}
+
+
+
+// AVX-512:
+
+AVX512_KERNEL static float SumAvx512( const float *data, size_t n )
+{
+    __m512 sum0 = _mm512_setzero_ps(), sum1 = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        sum0 = _mm512_add_ps( sum0, _mm512_loadu_ps( data + i ) );
+        sum1 = _mm512_add_ps( sum1, _mm512_loadu_ps( data + i + 16 ) );
+    }
+
+    float sum = _mm512_reduce_add_ps( _mm512_add_ps( sum0, sum1 ) );
+    for (; i < n; ++i) sum += data[i];
+
+    return sum;
+}
+
+
+AVX512_KERNEL static float DotAvx512( const float *a, const float *b, size_t n )
+{
+    __m512 sum0 = _mm512_setzero_ps(), sum1 = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        sum0 = _mm512_fmadd_ps( _mm512_loadu_ps( a + i ), _mm512_loadu_ps( b + i ), sum0 );
+        sum1 = _mm512_fmadd_ps(
+            _mm512_loadu_ps( a + i + 16 ), _mm512_loadu_ps( b + i + 16 ), sum1 );
+    }
+
+    float sum = _mm512_reduce_add_ps( _mm512_add_ps( sum0, sum1 ) );
+    for (; i < n; ++i) sum += a[i] * b[i];
+
+    return sum;
+}
+
+
+AVX512_KERNEL static const uint8_t *FindAvx512( const uint8_t *data, size_t n, uint8_t value )
+{
+    const __m512i needle = _mm512_set1_epi8( static_cast< char >( value ) );
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64)
+    {
+        const __mmask64 mask = _mm512_cmpeq_epi8_mask( _mm512_loadu_si512( data + i ), needle );
+        if (mask) return data + i + __builtin_ctzll( mask );
+    }
+
+    for (; i < n; ++i)
+    {
+        if (data[i] == value) return data + i;
+    }
+
+    return nullptr;
+}
+
+
+AVX512_KERNEL static void PrefixSumAvx512( uint32_t *data, size_t n )
+{
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i carry = zero;
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m512i x = _mm512_loadu_si512( data + i );
+
+        // Each alignr shifts x up by k elements, shifting in zeros.
+        x = _mm512_add_epi32( x, _mm512_alignr_epi32( x, zero, 16 - 1 ) );
+        x = _mm512_add_epi32( x, _mm512_alignr_epi32( x, zero, 16 - 2 ) );
+        x = _mm512_add_epi32( x, _mm512_alignr_epi32( x, zero, 16 - 4 ) );
+        x = _mm512_add_epi32( x, _mm512_alignr_epi32( x, zero, 16 - 8 ) );
+
+        x = _mm512_add_epi32( x, carry );
+        _mm512_storeu_si512( data + i, x );
+        carry = _mm512_permutexvar_epi32( _mm512_set1_epi32( 15 ), x );
+    }
+
+    uint32_t sum = _mm_cvtsi128_si32( _mm512_castsi512_si128( carry ) );
+    for (; i < n; ++i) data[i] = sum += data[i];
+}
+
+
+AVX512_KERNEL static void MandelbrotAvx512(
+    const float *re, const float *im, int32_t *iters, size_t n, int max_iters )
+{
+    const __m512 four = _mm512_set1_ps( 4.0f );
+    const __m512i one = _mm512_set1_epi32( 1 );
+    for (size_t i = 0; i < n; i += 16)
+    {
+        const __m512 cr = _mm512_loadu_ps( re + i ), ci = _mm512_loadu_ps( im + i );
+        __m512 zr = _mm512_setzero_ps(), zi = _mm512_setzero_ps();
+        __m512i count = _mm512_setzero_si512();
+        for (int iter = 0; iter < max_iters; ++iter)
+        {
+            const __m512 zr2 = _mm512_mul_ps( zr, zr ), zi2 = _mm512_mul_ps( zi, zi );
+            const __mmask16 active =
+                _mm512_cmp_ps_mask( _mm512_add_ps( zr2, zi2 ), four, _CMP_LE_OQ );
+            if (!active) break;
+
+            count = _mm512_mask_add_epi32( count, active, count, one );
+            const __m512 zrzi = _mm512_mul_ps( zr, zi );
+            zi = _mm512_add_ps( _mm512_add_ps( zrzi, zrzi ), ci );
+            zr = _mm512_add_ps( _mm512_sub_ps( zr2, zi2 ), cr );
+        }
+        _mm512_storeu_si512( iters + i, count );
+    }
+}
+
+
+AVX512_KERNEL static float FmaChainsAvx512( float x, size_t n )
+{
+    const __m512 mul = _mm512_set1_ps( x ), add = _mm512_set1_ps( 1.0f );
+    __m512 acc0 = _mm512_setzero_ps(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        acc0 = _mm512_fmadd_ps( acc0, mul, add );
+        acc1 = _mm512_fmadd_ps( acc1, mul, add );
+        acc2 = _mm512_fmadd_ps( acc2, mul, add );
+        acc3 = _mm512_fmadd_ps( acc3, mul, add );
+    }
+
+    return _mm512_reduce_add_ps(
+        _mm512_add_ps( _mm512_add_ps( acc0, acc1 ), _mm512_add_ps( acc2, acc3 ) ) );
+}
+
+
+
+const SimdKernels &GetSimdKernels( Isa isa )
+{
+    static const SimdKernels Scalar =
+        { &SumScalar, &DotScalar, &FindScalar, &PrefixSumScalar, &MandelbrotScalar,
+            &FmaChainsScalar };
+
+    // SSE4.2 has no FMA.
+    static const SimdKernels Sse42 =
+        { &SumSse42, &DotSse42, &FindSse42, &PrefixSumSse42, &MandelbrotSse42, nullptr };
+
+    static const SimdKernels Avx2 =
+        { &SumAvx2, &DotAvx2, &FindAvx2, &PrefixSumAvx2, &MandelbrotAvx2, &FmaChainsAvx2 };
+
+    static const SimdKernels Avx512 =
+        { &SumAvx512, &DotAvx512, &FindAvx512, &PrefixSumAvx512, &MandelbrotAvx512,
+            &FmaChainsAvx512 };
+
+    if (!IsSupported( isa ))
+    {
+        throw unavailable_error( std::string{ ToCStr( isa ) } + " isn't supported by this CPU" );
+    }
+
+    switch (isa)
+    {
+    case Isa::scalar:
+        return Scalar;
+
+    case Isa::sse42:
+        return Sse42;
+
+    case Isa::avx2:
+        return Avx2;
+
+    case Isa::avx512:
+        return Avx512;
+    }
+
+    return Scalar;
+}
+
+
+bool GetFmaIsa( Benchmark benchmark, Isa &isa )
+{
+    switch (benchmark)
+    {
+    case Benchmark::simd_fma_scalar:
+        isa = Isa::scalar;
+        return true;
+
+    case Benchmark::simd_fma_avx2:
+        isa = Isa::avx2;
+        return true;
+
+    case Benchmark::simd_fma_avx512:
+        isa = Isa::avx512;
+        return true;
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
+
+Isa GetLicenseIsa( Benchmark benchmark )
+{
+    switch (benchmark)
+    {
+#define CASE( n ) \
+    case Benchmark::n
+
+#define COPY_SIZES( kind ) \
+    CASE( copy_##kind##_avx2_64 ): \
+    CASE( copy_##kind##_avx2_256 ): \
+    CASE( copy_##kind##_avx2_1k ): \
+    CASE( copy_##kind##_avx2_4k ): \
+    CASE( copy_##kind##_avx2_16k ): \
+    CASE( copy_##kind##_avx2_64k ): \
+    CASE( copy_##kind##_avx2_256k ): \
+    CASE( copy_##kind##_avx2_1M ): \
+    CASE( copy_##kind##_avx2_4M ): \
+    CASE( copy_##kind##_avx2_16M ): \
+    CASE( copy_##kind##_avx2_64M )
+
+#define COPY_OFFSETS( end ) \
+    CASE( copy_memcpy_avx2_4k_##end##1 ): \
+    CASE( copy_memcpy_avx2_4k_##end##4 ): \
+    CASE( copy_memcpy_avx2_4k_##end##8 ): \
+    CASE( copy_memcpy_avx2_4k_##end##16 ): \
+    CASE( copy_memcpy_avx2_4k_##end##32 ): \
+    CASE( copy_memcpy_avx2_4k_##end##63 )
+
+    CASE( simd_sum_avx2 ):
+    CASE( simd_dot_avx2 ):
+    CASE( simd_find_avx2 ):
+    CASE( simd_prefix_sum_avx2 ):
+    CASE( simd_mandelbrot_avx2 ):
+    CASE( simd_fma_avx2 ):
+    COPY_SIZES( memcpy ):
+    COPY_SIZES( memset ):
+    COPY_OFFSETS( src ):
+    COPY_OFFSETS( dst ):
+        return Isa::avx2;
+
+    CASE( simd_sum_avx512 ):
+    CASE( simd_dot_avx512 ):
+    CASE( simd_find_avx512 ):
+    CASE( simd_prefix_sum_avx512 ):
+    CASE( simd_mandelbrot_avx512 ):
+    CASE( simd_fma_avx512 ):
+        return Isa::avx512;
+
+#undef COPY_OFFSETS
+#undef COPY_SIZES
+#undef CASE
+
+    default:
+        break;
+    }
+
+    return Isa::scalar;
+}
+
+
+void RunWarmupWorkload( Isa isa )
+{
+    static volatile float sink;
+
+    switch (isa)
+    {
+    case Isa::avx2:
+    case Isa::avx512:
+        sink = GetSimdKernels( isa ).fma_chains( sink, 16 * Fma_steps );
+        break;
+
+    case Isa::scalar:
+    case Isa::sse42:
+        autotime::Mandelbrot( 0.1f, 256 );
+        break;
+    }
+}
+
+
+std::ostream &PrintSimdClocks(
+    std::ostream &ostream,
+    const std::map< Isa, double > &ns_per_fma,
+    const std::map< Isa, double > &os_mhz
+)
+{
+    ostream << "Core clock during FMA-bound work (estimated from simd_fma_*):\n";
+
+    const auto scalar = ns_per_fma.find( Isa::scalar );
+    const auto precision_prev = ostream.precision( 4 );
+    for (const auto &isa_ns: ns_per_fma)
+    {
+        // With Fma_chains chains, each of 4-cycle latency, one FMA completes per cycle.
+        ostream << "  " << ToCStr( isa_ns.first ) << ": " << 1e3 / isa_ns.second << " MHz";
+        if (scalar != ns_per_fma.end() && isa_ns.first != Isa::scalar)
+        {
+            ostream << " (" << 100.0 * (scalar->second / isa_ns.second - 1.0) << "% vs. scalar)";
+        }
+
+        const auto mhz = os_mhz.find( isa_ns.first );
+        if (mhz != os_mhz.end() && mhz->second > 0.0)
+        {
+            ostream << ", " << mhz->second << " MHz reported by OS";
+        }
+        ostream << "\n";
+    }
+    ostream.precision( precision_prev );
+
+    return ostream;
+}
+
+
+} // namespace bench
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! SIMD kernels, for each supported instruction set.
+/*! @file
+
+    Each kernel is compiled for a specific instruction set (via function target
+    attributes), so that one binary can run on any x86-64 CPU.  The caller must
+    select an instruction set that's supported by the CPU, at runtime.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_SIMD_KERNELS_HPP
+#define BENCH_SIMD_KERNELS_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+
+#include "enum_utils.hpp"
+#include "list.hpp"
+
+
+namespace bench
+{
+
+
+enum class Isa
+{
+    scalar, first = scalar,
+    sse42,
+    avx2,   //!< Includes FMA.
+    avx512, //!< AVX-512 F & BW.
+        last = avx512
+};
+
+Isa operator++( Isa &isa );
+
+template<> EnumRange< Isa > RangeOf< Isa >();
+
+const char *ToCStr( Isa isa );
+
+std::istream &operator>>( std::istream &istream, Isa &isa );
+std::ostream &operator<<( std::ostream &ostream, Isa isa );
+
+
+    //! Returns true, if the CPU supports the specified instruction set.
+bool IsSupported( Isa isa );
+
+
+    //! Kernels, implemented for a single instruction set.
+struct SimdKernels
+{
+        //! Returns the sum of n floats.
+    float (*sum)( const float *data, size_t n );
+
+        //! Returns the dot product of two vectors of n floats.
+    float (*dot)( const float *a, const float *b, size_t n );
+
+        //! Returns a pointer to the first occurrence of value, or nullptr (like memchr()).
+    const uint8_t *(*find)( const uint8_t *data, size_t n, uint8_t value );
+
+        //! Replaces each element with the sum of it and all preceding elements.
+    void (*prefix_sum)( uint32_t *data, size_t n );
+
+        //! Computes the number of Mandelbrot iterations for each of n points.
+        /*!
+            @note
+            n must be a multiple of 16.
+        */
+    void (*mandelbrot)(
+        const float *re, const float *im, int32_t *iters, size_t n, int max_iters );
+
+        //! Performs Fma_chains dependent chains of n fused multiply-adds, in vector registers.
+    float (*fma_chains)( float x, size_t n );
+};
+
+
+    //! Independent chains in SimdKernels::fma_chains(), which is few enough to be latency-bound.
+constexpr int Fma_chains = 4;
+
+    //! Length of each chain, in an iteration of the simd_fma_* benchmarks.
+constexpr size_t Fma_steps = 256;
+
+
+    //! Returns the kernels for the specified instruction set.
+    /*!
+        @throws unavailable_error, if the CPU doesn't support the instruction set.
+    */
+const SimdKernels &GetSimdKernels( Isa isa );
+
+
+    //! Returns the instruction set whose frequency license applies to a benchmark.
+    /*!
+        This is avx2 or avx512, for the benchmarks which make heavy use of
+        256-bit or 512-bit vectors (e.g. simd_*_avx2 & copy_*_avx2_*), since
+        that can lower the core clock.  Otherwise, it's scalar.
+    */
+Isa GetLicenseIsa( Benchmark benchmark );
+
+
+    //! Runs a brief burst of the instruction set's heaviest work, to warm up a core.
+    /*!
+        For avx2 and avx512, this is vector FMAs, which put the core in the
+        corresponding frequency license.  Other instruction sets don't lower
+        the clock, so they use the scalar workload.
+    */
+void RunWarmupWorkload( Isa isa );
+
+
+    //! Returns true and sets isa, if benchmark is one of the simd_fma_* benchmarks.
+bool GetFmaIsa( Benchmark benchmark, Isa &isa );
+
+
+    //! Prints the core clock inferred from the simd_fma_* benchmarks.
+    /*!
+        Since each of them is bound by FMA latency, which is the same for
+        scalar and vector FMAs on recent x86 cores, differences in their
+        throughput are differences in the clock speed.  The clock reported by
+        the OS (e.g. /proc/cpuinfo) after each one is also shown.
+    */
+std::ostream &PrintSimdClocks(
+    std::ostream &ostream,
+    const std::map< Isa, double > &ns_per_fma,  //!< Time per FMA, by instruction set.
+    const std::map< Isa, double > &os_mhz       //!< OS-reported clock, by instruction set.
+);
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_SIMD_KERNELS_HPP
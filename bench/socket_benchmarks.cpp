@@ -0,0 +1,518 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements socket-category benchmarks.
+/*! @file
+
+    These use loopback TCP & UDP, and Unix-domain sockets, via the POSIX API.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "dispatch.hpp"
+
+#include "autotime/os.hpp"
+#include "autotime/overhead.hpp"
+#include "autotime/time.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include "description.hpp"
+#include "error_utils.hpp"
+#include "socket_utils.hpp"
+#include "thread_utils.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::socket >()
+{
+    Description desc;
+    desc.measures = "Socket setup, throughput, and latency, over loopback & Unix-domain sockets.";
+    desc.detail =
+        "TCP & UDP use 127.0.0.1, while Unix-domain sockets are either created with socketpair()"
+        " or listen on an autobound abstract name.";
+    desc.notes =
+        {
+            "socket_open_close_* is socket() & close(), without binding or connecting.",
+            "socket_connect_accept_* connects to a listening socket, accepts the connection, and"
+                " closes both ends.  The connecting end is reset (i.e. SO_LINGER of 0), so TCP"
+                " connections don't accumulate in TIME_WAIT.",
+            "socket_send_recv_* sends a message and receives it, on the same thread (like"
+                " pipe_write_read_*).  Stream sockets have 256 KiB buffers, so no message blocks.",
+            "socket_pingpong_* sends a message to a thread on the secondary core, which echoes it"
+                " back (like pipe_pingpong_*).  TCP sockets use TCP_NODELAY.",
+            "socket_pingpong_tcp_256_busy_poll sets SO_BUSY_POLL to 50 us on both ends.  It's"
+                " skipped if that exceeds net.core.busy_read and the process lacks CAP_NET_ADMIN.",
+            "socket_mmsg_udp_<n> sends n 64-byte datagrams with one sendmmsg() and receives them"
+                " with one recvmmsg().  Compare with n times socket_send_recv_udp_64.",
+        };
+    desc.limits =
+        {
+            "Loopback has no NAPI context, so busy polling usually has nothing to poll.  It"
+                " mostly affects how the receiver waits.",
+            "Loopback skips the NIC, driver, and interrupt costs of a real network.",
+        };
+    return desc;
+}
+
+
+    // Buffer size for stream sockets, which is enough to send the largest message without blocking.
+static constexpr size_t Stream_buffer_size = size_t{ 1 } << 18;
+
+static constexpr int Busy_poll_usec = 50;
+
+    // Size of the datagrams sent by socket_mmsg_udp_*.
+static constexpr size_t Mmsg_datagram_size = 64;
+
+
+static bool IsStream( SocketKind kind )
+{
+    return kind == SocketKind::tcp || kind == SocketKind::unix_stream;
+}
+
+
+    // Returns a connected pair, with the buffers & options used by the stream benchmarks.
+static std::shared_ptr< SocketPair > MakeSocketPair( SocketKind kind )
+{
+    std::shared_ptr< SocketPair > pair = std::make_shared< SocketPair >( kind );
+    for (int i = 0; i < 2; ++i)
+    {
+        if (IsStream( kind )) SetBufferSizes( pair->fd( i ), Stream_buffer_size );
+        if (kind == SocketKind::tcp) SetNoDelay( pair->fd( i ) );
+    }
+
+    return pair;
+}
+
+
+static autotime::BenchTimers MakeOpenClose( SocketKind kind )
+{
+    std::function< void() > f = [kind]()
+        {
+            int fd = OpenSocket( kind );
+            CloseSocket( fd );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+static autotime::BenchTimers MakeConnectAccept( SocketKind kind )
+{
+    std::shared_ptr< SocketListener > listener = std::make_shared< SocketListener >( kind );
+
+    std::function< void() > f = [listener]()
+        {
+            int client = listener->connect();
+            int server = listener->accept();
+            AbortSocket( client );
+            CloseSocket( server );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+static autotime::BenchTimers MakeSendRecv( SocketKind kind, size_t size )
+{
+    std::shared_ptr< SocketPair > pair = MakeSocketPair( kind );
+    auto buf = std::make_shared< std::vector< uint8_t > >( size );
+
+    std::function< void() > f;
+    if (IsStream( kind ))
+    {
+        f = [pair, buf]()
+            {
+                if (SendAll( pair->fd( 0 ), buf->data(), buf->size() ) < buf->size()
+                    || RecvAll( pair->fd( 1 ), buf->data(), buf->size() ) < buf->size())
+                {
+                    throw std::runtime_error( "Socket closed by peer" );
+                }
+            };
+    }
+    else
+    {
+        f = [pair, buf]()
+            {
+                if (send( pair->fd( 0 ), buf->data(), buf->size(), 0 ) < 0)
+                {
+                    throw_system_error( errno, "send()" );
+                }
+
+                if (recv( pair->fd( 1 ), buf->data(), buf->size(), 0 ) < 0)
+                {
+                    throw_system_error( errno, "recv()" );
+                }
+            };
+    }
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+    // Echoes messages on the secondary core, until its peer shuts down.
+struct SocketPonger
+{
+    const size_t message_size_;
+    std::shared_ptr< SocketPair > pair_;
+    std::thread thread_;
+
+    SocketPonger( SocketKind kind, size_t message_size, int busy_poll_usec )
+    :
+        message_size_( message_size ),
+        pair_( MakeSocketPair( kind ) )
+    {
+        if (busy_poll_usec > 0)
+        {
+            for (int i = 0; i < 2; ++i) SetBusyPoll( pair_->fd( i ), busy_poll_usec );
+        }
+
+        // Block on thread actually starting.
+        std::promise< void > started_promise;
+        std::future< void > started_future = started_promise.get_future();
+        thread_ = std::thread( &SocketPonger::threadfunc, this, std::move( started_promise ) );
+        started_future.get();
+    }
+
+    ~SocketPonger()
+    {
+        pair_->shutdown( 0 );   // A short read will tell the thread to exit.
+        thread_.join();
+    }
+
+    void threadfunc( std::promise< void > started_promise )
+    {
+        SetCoreAffinity( GetSecondaryCoreId() );
+
+        started_promise.set_value();
+
+        std::vector< uint8_t > buf( message_size_ );
+        while (RecvAll( pair_->fd( 1 ), buf.data(), buf.size() ) == message_size_)
+        {
+            if (SendAll( pair_->fd( 1 ), buf.data(), buf.size() ) < message_size_) break;
+        }
+    }
+};
+
+
+static autotime::BenchTimers MakePingPong( SocketKind kind, size_t size, int busy_poll_usec )
+{
+    // Fail here, rather than in the timer, if busy polling isn't permitted.
+    if (busy_poll_usec > 0) SetBusyPoll( SocketPair{ kind }.fd( 0 ), busy_poll_usec );
+
+    Timer time_f = [kind, size, busy_poll_usec]( int num_iters )
+        {
+            SocketPonger ponger{ kind, size, busy_poll_usec };
+            std::vector< uint8_t > buf( size );
+            const int fd = ponger.pair_->fd( 0 );
+
+            std::function< void() > f = [fd, &buf]()
+                {
+                    if (SendAll( fd, buf.data(), buf.size() ) < buf.size()
+                        || RecvAll( fd, buf.data(), buf.size() ) < buf.size())
+                    {
+                        throw std::runtime_error( "Socket closed by peer" );
+                    }
+                };
+
+            return Time( f, num_iters );
+        };
+
+    return { time_f, MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+    // Buffers & headers for a batch of datagrams, which are reused for sending and receiving.
+struct MmsgBatch
+{
+    std::vector< uint8_t > data_;
+    std::vector< iovec > iovs_;
+    std::vector< mmsghdr > msgs_;
+
+    explicit MmsgBatch( int size )
+    :
+        data_( size * Mmsg_datagram_size ),
+        iovs_( size ),
+        msgs_( size )
+    {
+        for (int i = 0; i < size; ++i)
+        {
+            iovs_[i].iov_base = data_.data() + i * Mmsg_datagram_size;
+            iovs_[i].iov_len = Mmsg_datagram_size;
+            msgs_[i].msg_hdr = msghdr{};
+            msgs_[i].msg_hdr.msg_iov = &iovs_[i];
+            msgs_[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+};
+
+
+static autotime::BenchTimers MakeMmsg( int batch_size )
+{
+    std::shared_ptr< SocketPair > pair = MakeSocketPair( SocketKind::udp );
+    std::shared_ptr< MmsgBatch > batch = std::make_shared< MmsgBatch >( batch_size );
+
+    std::function< void() > f = [pair, batch]()
+        {
+            const unsigned int n = static_cast< unsigned int >( batch->msgs_.size() );
+
+            const int sent = sendmmsg( pair->fd( 0 ), batch->msgs_.data(), n, 0 );
+            if (sent < 0) throw_system_error( errno, "sendmmsg()" );
+            if (static_cast< unsigned int >( sent ) < n)
+            {
+                throw std::runtime_error( "sendmmsg() was short" );
+            }
+
+            const int received = recvmmsg( pair->fd( 1 ), batch->msgs_.data(), n, 0, nullptr );
+            if (received < 0) throw_system_error( errno, "recvmmsg()" );
+            if (static_cast< unsigned int >( received ) < n)
+            {
+                throw std::runtime_error( "recvmmsg() was short" );
+            }
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_open_close_tcp >()
+{
+    return MakeOpenClose( SocketKind::tcp );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_open_close_udp >()
+{
+    return MakeOpenClose( SocketKind::udp );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_open_close_unix >()
+{
+    return MakeOpenClose( SocketKind::unix_stream );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_connect_accept_tcp >()
+{
+    return MakeConnectAccept( SocketKind::tcp );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_connect_accept_unix >()
+{
+    return MakeConnectAccept( SocketKind::unix_stream );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_tcp_64 >()
+{
+    return MakeSendRecv( SocketKind::tcp, 64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_tcp_256 >()
+{
+    return MakeSendRecv( SocketKind::tcp, 256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_tcp_1k >()
+{
+    return MakeSendRecv( SocketKind::tcp, 1 << 10 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_tcp_4k >()
+{
+    return MakeSendRecv( SocketKind::tcp, 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_tcp_16k >()
+{
+    return MakeSendRecv( SocketKind::tcp, 1 << 14 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_tcp_64k >()
+{
+    return MakeSendRecv( SocketKind::tcp, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_unix_64 >()
+{
+    return MakeSendRecv( SocketKind::unix_stream, 64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_unix_256 >()
+{
+    return MakeSendRecv( SocketKind::unix_stream, 256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_unix_1k >()
+{
+    return MakeSendRecv( SocketKind::unix_stream, 1 << 10 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_unix_4k >()
+{
+    return MakeSendRecv( SocketKind::unix_stream, 1 << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_unix_16k >()
+{
+    return MakeSendRecv( SocketKind::unix_stream, 1 << 14 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_unix_64k >()
+{
+    return MakeSendRecv( SocketKind::unix_stream, 1 << 16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_udp_64 >()
+{
+    return MakeSendRecv( SocketKind::udp, 64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_udp_1k >()
+{
+    return MakeSendRecv( SocketKind::udp, 1 << 10 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_udp_16k >()
+{
+    return MakeSendRecv( SocketKind::udp, 1 << 14 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_unix_dgram_64 >()
+{
+    return MakeSendRecv( SocketKind::unix_dgram, 64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_unix_dgram_1k >()
+{
+    return MakeSendRecv( SocketKind::unix_dgram, 1 << 10 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_send_recv_unix_dgram_16k >()
+{
+    return MakeSendRecv( SocketKind::unix_dgram, 1 << 14 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_pingpong_tcp_256 >()
+{
+    return MakePingPong( SocketKind::tcp, 256, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_pingpong_tcp_1k >()
+{
+    return MakePingPong( SocketKind::tcp, 1 << 10, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_pingpong_tcp_4k >()
+{
+    return MakePingPong( SocketKind::tcp, 1 << 12, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_pingpong_tcp_16k >()
+{
+    return MakePingPong( SocketKind::tcp, 1 << 14, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_pingpong_tcp_64k >()
+{
+    return MakePingPong( SocketKind::tcp, 1 << 16, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_pingpong_tcp_256_busy_poll >()
+{
+    return MakePingPong( SocketKind::tcp, 256, Busy_poll_usec );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_pingpong_unix_256 >()
+{
+    return MakePingPong( SocketKind::unix_stream, 256, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_pingpong_unix_1k >()
+{
+    return MakePingPong( SocketKind::unix_stream, 1 << 10, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_pingpong_unix_4k >()
+{
+    return MakePingPong( SocketKind::unix_stream, 1 << 12, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_pingpong_unix_16k >()
+{
+    return MakePingPong( SocketKind::unix_stream, 1 << 14, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_pingpong_unix_64k >()
+{
+    return MakePingPong( SocketKind::unix_stream, 1 << 16, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_mmsg_udp_1 >()
+{
+    return MakeMmsg( 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_mmsg_udp_8 >()
+{
+    return MakeMmsg( 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::socket_mmsg_udp_32 >()
+{
+    return MakeMmsg( 32 );
+}
+
+
+} // namespace bench
@@ -0,0 +1,320 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Socket-related utilities.
+/*! @file
+
+    See socket_utils.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "socket_utils.hpp"
+
+#include "error_utils.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+#ifndef SO_BUSY_POLL
+#define SO_BUSY_POLL 46
+#endif
+
+
+namespace bench
+{
+
+
+const char *ToCStr( SocketKind kind )
+{
+    switch (kind)
+    {
+    case SocketKind::tcp:
+        return "tcp";
+
+    case SocketKind::udp:
+        return "udp";
+
+    case SocketKind::unix_stream:
+        return "unix_stream";
+
+    case SocketKind::unix_dgram:
+        return "unix_dgram";
+    }
+
+    return nullptr;
+}
+
+
+static bool IsUnixDomain( SocketKind kind )
+{
+    return kind == SocketKind::unix_stream || kind == SocketKind::unix_dgram;
+}
+
+
+int OpenSocket( SocketKind kind )
+{
+    const int domain = IsUnixDomain( kind ) ? AF_UNIX : AF_INET;
+    const bool stream = (kind == SocketKind::tcp || kind == SocketKind::unix_stream);
+
+    const int fd = socket( domain, (stream ? SOCK_STREAM : SOCK_DGRAM) | SOCK_CLOEXEC, 0 );
+    if (fd < 0) throw_system_error( errno, "socket()" );
+
+    return fd;
+}
+
+
+void CloseSocket( int &fd )
+{
+    if (fd >= 0 && close( fd )) throw_system_error( errno, "close()" );
+    fd = -1;
+}
+
+
+void AbortSocket( int &fd )
+{
+    const linger l = { 1, 0 };
+    if (fd >= 0 && setsockopt( fd, SOL_SOCKET, SO_LINGER, &l, sizeof( l ) ))
+    {
+        throw_system_error( errno, "setsockopt( SO_LINGER )" );
+    }
+
+    CloseSocket( fd );
+}
+
+
+size_t SendAll( int fd, const void *data, size_t n )
+{
+    const uint8_t *p = static_cast< const uint8_t * >( data );
+    size_t remain = n;
+    while (remain > 0)
+    {
+        const ssize_t result = send( fd, p + (n - remain), remain, MSG_NOSIGNAL );
+        if (result < 0)
+        {
+            if (errno == EPIPE || errno == ECONNRESET) break;
+            if (errno != EINTR) throw_system_error( errno, "send()" );
+        }
+        else remain -= result;
+    }
+
+    return n - remain;
+}
+
+
+size_t RecvAll( int fd, void *data, size_t n )
+{
+    uint8_t *p = static_cast< uint8_t * >( data );
+    size_t remain = n;
+    while (remain > 0)
+    {
+        const ssize_t result = recv( fd, p + (n - remain), remain, 0 );
+        if (result < 0)
+        {
+            if (errno == ECONNRESET) break;
+            if (errno != EINTR) throw_system_error( errno, "recv()" );
+        }
+        else if (result == 0) break;
+        else remain -= result;
+    }
+
+    return n - remain;
+}
+
+
+void SetNoDelay( int fd )
+{
+    const int one = 1;
+    if (setsockopt( fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof( one ) ))
+    {
+        throw_system_error( errno, "setsockopt( TCP_NODELAY )" );
+    }
+}
+
+
+void SetBufferSizes( int fd, size_t size )
+{
+    const int value = static_cast< int >( size );
+    if (setsockopt( fd, SOL_SOCKET, SO_SNDBUF, &value, sizeof( value ) ))
+    {
+        throw_system_error( errno, "setsockopt( SO_SNDBUF )" );
+    }
+
+    if (setsockopt( fd, SOL_SOCKET, SO_RCVBUF, &value, sizeof( value ) ))
+    {
+        throw_system_error( errno, "setsockopt( SO_RCVBUF )" );
+    }
+}
+
+
+void SetBusyPoll( int fd, int usec )
+{
+    if (setsockopt( fd, SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof( usec ) ))
+    {
+        if (errno == EPERM) throw unavailable_error( "SO_BUSY_POLL requires CAP_NET_ADMIN" );
+        throw_system_error( errno, "setsockopt( SO_BUSY_POLL )" );
+    }
+}
+
+
+    // Binds to an ephemeral address: a port on 127.0.0.1, or an autobound abstract Unix name.
+static void BindEphemeral( int fd, SocketKind kind, sockaddr_storage &addr, socklen_t &addr_len )
+{
+    memset( &addr, 0, sizeof( addr ) );
+    if (IsUnixDomain( kind ))
+    {
+        // Binding only the family autobinds a unique name, in the abstract namespace.
+        addr.ss_family = AF_UNIX;
+        addr_len = sizeof( sa_family_t );
+    }
+    else
+    {
+        sockaddr_in &in = reinterpret_cast< sockaddr_in & >( addr );
+        in.sin_family = AF_INET;
+        in.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+        in.sin_port = 0;
+        addr_len = sizeof( in );
+    }
+
+    if (bind( fd, reinterpret_cast< sockaddr * >( &addr ), addr_len ))
+    {
+        throw_system_error( errno, "bind()" );
+    }
+
+    addr_len = sizeof( addr );
+    if (getsockname( fd, reinterpret_cast< sockaddr * >( &addr ), &addr_len ))
+    {
+        throw_system_error( errno, "getsockname()" );
+    }
+}
+
+
+static void Connect( int fd, const sockaddr_storage &addr, socklen_t addr_len )
+{
+    if (::connect( fd, reinterpret_cast< const sockaddr * >( &addr ), addr_len ))
+    {
+        throw_system_error( errno, "connect()" );
+    }
+}
+
+
+
+// class SocketListener:
+SocketListener::SocketListener( SocketKind kind )
+:
+    kind_( kind ),
+    fd_( OpenSocket( kind ) )
+{
+    try
+    {
+        BindEphemeral( fd_, kind, addr_, addr_len_ );
+        if (listen( fd_, SOMAXCONN )) throw_system_error( errno, "listen()" );
+    }
+    catch (...)
+    {
+        close( fd_ );
+        throw;
+    }
+}
+
+
+SocketListener::~SocketListener()
+{
+    if (fd_ >= 0) close( fd_ );
+}
+
+
+int SocketListener::connect() const
+{
+    int fd = OpenSocket( kind_ );
+    try
+    {
+        Connect( fd, addr_, addr_len_ );
+    }
+    catch (...)
+    {
+        close( fd );
+        throw;
+    }
+
+    return fd;
+}
+
+
+int SocketListener::accept() const
+{
+    const int fd = accept4( fd_, nullptr, nullptr, SOCK_CLOEXEC );
+    if (fd < 0) throw_system_error( errno, "accept()" );
+
+    return fd;
+}
+
+
+
+// class SocketPair:
+SocketPair::SocketPair( SocketKind kind )
+{
+    switch (kind)
+    {
+    case SocketKind::tcp:
+        {
+            SocketListener listener{ kind };
+            fds_[0] = listener.connect();
+            fds_[1] = listener.accept();
+        }
+        break;
+
+    case SocketKind::udp:
+        {
+            sockaddr_storage addrs[2];
+            socklen_t addr_lens[2];
+            for (int i = 0; i < 2; ++i)
+            {
+                fds_[i] = OpenSocket( kind );
+                BindEphemeral( fds_[i], kind, addrs[i], addr_lens[i] );
+            }
+
+            Connect( fds_[0], addrs[1], addr_lens[1] );
+            Connect( fds_[1], addrs[0], addr_lens[0] );
+        }
+        break;
+
+    case SocketKind::unix_stream:
+    case SocketKind::unix_dgram:
+        {
+            const int type = (kind == SocketKind::unix_stream) ? SOCK_STREAM : SOCK_DGRAM;
+            if (socketpair( AF_UNIX, type | SOCK_CLOEXEC, 0, fds_ ))
+            {
+                throw_system_error( errno, "socketpair()" );
+            }
+        }
+        break;
+    }
+}
+
+
+SocketPair::~SocketPair()
+{
+    for (int fd: fds_)
+    {
+        if (fd >= 0) close( fd );
+    }
+}
+
+
+void SocketPair::shutdown( int i )
+{
+    if (::shutdown( fds_[i], SHUT_WR )) throw_system_error( errno, "shutdown()" );
+}
+
+
+} // namespace bench
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Socket-related utilities.
+/*! @file
+
+    Everything here uses the loopback interface or Unix-domain sockets, so
+    that results don't depend on a network.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_SOCKET_UTILS_HPP
+#define BENCH_SOCKET_UTILS_HPP
+
+
+#include <cstddef>
+
+#include <sys/socket.h>
+
+
+namespace bench
+{
+
+
+enum class SocketKind
+{
+    tcp,            //!< Over 127.0.0.1.
+    udp,            //!< Over 127.0.0.1.
+    unix_stream,    //!< Unix-domain, in the abstract namespace.
+    unix_dgram      //!< Unix-domain, in the abstract namespace.
+};
+
+
+const char *ToCStr( SocketKind kind );
+
+
+    //! Returns a new, unbound socket of the specified kind.
+    /*!
+        @throws std::system_error if the socket() fails.
+    */
+int OpenSocket( SocketKind kind );
+
+
+    //! Closes fd, if it's valid, and invalidates it.
+    /*!
+        @throws std::system_error if the close() fails.
+    */
+void CloseSocket( int &fd );
+
+
+    //! Closes a connected socket with SO_LINGER of 0, so it's reset instead of left in TIME_WAIT.
+void AbortSocket( int &fd );
+
+
+    //! Sends all n bytes, unless the peer shuts down.
+    /*!
+        @returns Number of bytes actually sent.
+
+        @throws std::system_error if a send() fails.
+    */
+size_t SendAll( int fd, const void *data, size_t n );
+
+
+    //! Receives exactly n bytes, unless the peer shuts down.
+    /*!
+        @returns Number of bytes actually received.
+
+        @throws std::system_error if a recv() fails.
+    */
+size_t RecvAll( int fd, void *data, size_t n );
+
+
+    //! Disables Nagle's algorithm on a TCP socket.
+void SetNoDelay( int fd );
+
+
+    //! Sets both SO_SNDBUF & SO_RCVBUF.
+void SetBufferSizes( int fd, size_t size );
+
+
+    //! Sets SO_BUSY_POLL.
+    /*!
+        @throws unavailable_error if the process lacks CAP_NET_ADMIN and usec
+        exceeds the net.core.busy_read limit.
+    */
+void SetBusyPoll( int fd, int usec );
+
+
+    //! A socket listening on an ephemeral address, of a connection-oriented kind.
+class SocketListener
+{
+public:
+    explicit SocketListener( SocketKind kind );
+    ~SocketListener();
+
+    SocketListener( const SocketListener & ) = delete;
+    SocketListener &operator=( const SocketListener & ) = delete;
+
+        //! Returns a new socket, which has initiated a connection to this listener.
+    int connect() const;
+
+        //! Returns the next pending connection.
+    int accept() const;
+
+private:
+    SocketKind kind_;
+    int fd_ = -1;
+    sockaddr_storage addr_{};
+    socklen_t addr_len_ = 0;
+};
+
+
+    //! A pair of connected sockets (or datagram sockets, each connected to the other).
+class SocketPair
+{
+public:
+    explicit SocketPair( SocketKind kind );
+    ~SocketPair();
+
+    SocketPair( const SocketPair & ) = delete;
+    SocketPair &operator=( const SocketPair & ) = delete;
+
+    int fd( int i ) const { return fds_[i]; }
+
+        //! Signals the end of transmission, from fd( i ) to its peer.
+    void shutdown( int i );
+
+private:
+    int fds_[2] = { -1, -1 };
+};
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_SOCKET_UTILS_HPP
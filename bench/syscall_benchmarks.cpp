@@ -0,0 +1,366 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements syscall-category benchmarks.
+/*! @file
+
+    These measure the cost of entering the kernel, via trivial system calls, and of the calls
+    which the vDSO can handle in userspace.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "dispatch.hpp"
+
+#include "autotime/overhead.hpp"
+#include "autotime/time.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <future>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "description.hpp"
+#include "error_utils.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::syscall >()
+{
+    Description desc;
+    desc.measures = "System calls which do little besides entering and leaving the kernel.";
+    desc.detail =
+        "syscall_getpid & syscall_gettid use syscall(), since libc might cache their results."
+        "  syscall_clock_gettime_<clock>_vdso calls clock_gettime(), which libc directs to the"
+        " vDSO, where possible, while _syscall forces a system call.  Likewise,"
+        " syscall_getcpu_vdso calls sched_getcpu() and syscall_getcpu_syscall forces one.";
+    desc.notes =
+        {
+            "syscall_getpid_seccomp runs on a thread with a seccomp filter that compares the"
+                " system call number against 16 others before allowing it.  Since the result"
+                " only depends on the number, recent kernels (5.11+) cache it and skip the"
+                " filter.  syscall_getpid_seccomp_args instead compares the first argument,"
+                " which defeats this caching.",
+            "syscall_ioctl_badfd calls ioctl() on an invalid file descriptor, which fails with"
+                " EBADF after a minimum of work in the kernel.",
+            "syscall_sched_yield returns immediately, unless another thread is runnable on the"
+                " same core.",
+        };
+    desc.limits =
+        {
+            "The cost of kernel entry & exit depends heavily on the CPU vulnerability"
+                " mitigations in effect (see /sys/devices/system/cpu/vulnerabilities/).",
+            "The CPU-time clocks can't be read in userspace, so their _vdso variants also make a"
+                " system call.  Likewise, the vDSO falls back to one if the clocksource isn't"
+                " usable from userspace (e.g. in some VMs).",
+            "If the process already runs under a seccomp filter (e.g. in a container), all of"
+                " these include it.",
+        };
+    return desc;
+}
+
+
+    // Comparisons made by the filters of the syscall_getpid_seccomp* benchmarks.
+static constexpr int Seccomp_filter_checks = 16;
+
+    // First of the values compared by the filters, which none of the calls should match.
+static constexpr uint32_t Seccomp_unmatched_value = 0xdead0000;
+
+
+    // Installs a seccomp filter on the calling thread, which allows any system call.
+static void InstallSeccompFilter( bool check_args )
+{
+    // The usual architecture check is omitted, so only the comparisons are counted.
+    const uint32_t offset =
+        check_args ? offsetof( seccomp_data, args[0] ) : offsetof( seccomp_data, nr );
+
+    std::vector< sock_filter > filter;
+    filter.push_back( BPF_STMT( BPF_LD | BPF_W | BPF_ABS, offset ) );
+    for (int i = 0; i < Seccomp_filter_checks; ++i)
+    {
+        // A match jumps to the final instruction, which denies the call.
+        const uint8_t jump = static_cast< uint8_t >( Seccomp_filter_checks - i );
+        filter.push_back(
+            BPF_JUMP( BPF_JMP | BPF_JEQ | BPF_K, Seccomp_unmatched_value + i, jump, 0 ) );
+    }
+    filter.push_back( BPF_STMT( BPF_RET | BPF_K, SECCOMP_RET_ALLOW ) );
+    filter.push_back( BPF_STMT( BPF_RET | BPF_K, SECCOMP_RET_ERRNO | EPERM ) );
+
+    sock_fprog prog;
+    prog.len = static_cast< unsigned short >( filter.size() );
+    prog.filter = filter.data();
+
+    // Both of these only apply to the calling thread.
+    if (prctl( PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0 ) != 0) throw_system_error( errno, "prctl()" );
+    if (prctl( PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &prog, 0, 0 ) != 0)
+    {
+        throw_system_error( errno, "prctl()" );
+    }
+}
+
+
+    // Times getpid() on a new thread (on the same core), since a seccomp filter can't be removed.
+static autotime::Timer MakeSeccompTimer( bool check_args )
+{
+    if (prctl( PR_GET_SECCOMP, 0, 0, 0, 0 ) < 0 && errno == EINVAL)
+    {
+        throw unavailable_error( "seccomp isn't supported by this kernel" );
+    }
+
+    return [check_args]( int num_iters )
+        {
+            std::packaged_task< Durations() > task{ [check_args, num_iters]()
+                {
+                    InstallSeccompFilter( check_args );
+
+                    std::function< void() > f = []()
+                        {
+                            syscall( SYS_getpid );
+                        };
+
+                    return Time( f, num_iters );
+                } };
+
+            std::future< Durations > durations = task.get_future();
+            std::thread thread{ std::move( task ) };
+            thread.join();
+
+            return durations.get();
+        };
+}
+
+
+static autotime::BenchTimers MakeClockGettime( clockid_t clock, bool force_syscall )
+{
+    std::function< void() > f;
+    if (force_syscall)
+    {
+        f = [clock]()
+            {
+                timespec ts;
+                syscall( SYS_clock_gettime, clock, &ts );
+            };
+    }
+    else
+    {
+        f = [clock]()
+            {
+                timespec ts;
+                clock_gettime( clock, &ts );
+            };
+    }
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_getpid >()
+{
+    std::function< void() > f = []()
+        {
+            syscall( SYS_getpid );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_getpid_seccomp >()
+{
+    return { MakeSeccompTimer( false ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_getpid_seccomp_args >()
+{
+    return { MakeSeccompTimer( true ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_gettid >()
+{
+    std::function< void() > f = []()
+        {
+            syscall( SYS_gettid );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_realtime_vdso >()
+{
+    return MakeClockGettime( CLOCK_REALTIME, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_realtime_syscall >()
+{
+    return MakeClockGettime( CLOCK_REALTIME, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_realtime_coarse_vdso >()
+{
+    return MakeClockGettime( CLOCK_REALTIME_COARSE, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_realtime_coarse_syscall >()
+{
+    return MakeClockGettime( CLOCK_REALTIME_COARSE, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_monotonic_vdso >()
+{
+    return MakeClockGettime( CLOCK_MONOTONIC, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_monotonic_syscall >()
+{
+    return MakeClockGettime( CLOCK_MONOTONIC, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_monotonic_coarse_vdso >()
+{
+    return MakeClockGettime( CLOCK_MONOTONIC_COARSE, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_monotonic_coarse_syscall >()
+{
+    return MakeClockGettime( CLOCK_MONOTONIC_COARSE, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_monotonic_raw_vdso >()
+{
+    return MakeClockGettime( CLOCK_MONOTONIC_RAW, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_monotonic_raw_syscall >()
+{
+    return MakeClockGettime( CLOCK_MONOTONIC_RAW, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_boottime_vdso >()
+{
+    return MakeClockGettime( CLOCK_BOOTTIME, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_boottime_syscall >()
+{
+    return MakeClockGettime( CLOCK_BOOTTIME, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_process_cputime_vdso >()
+{
+    return MakeClockGettime( CLOCK_PROCESS_CPUTIME_ID, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_process_cputime_syscall >()
+{
+    return MakeClockGettime( CLOCK_PROCESS_CPUTIME_ID, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_thread_cputime_vdso >()
+{
+    return MakeClockGettime( CLOCK_THREAD_CPUTIME_ID, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_clock_gettime_thread_cputime_syscall >()
+{
+    return MakeClockGettime( CLOCK_THREAD_CPUTIME_ID, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_getcpu_vdso >()
+{
+    std::function< void() > f = []()
+        {
+            sched_getcpu();
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_getcpu_syscall >()
+{
+    std::function< void() > f = []()
+        {
+            unsigned cpu;
+            syscall( SYS_getcpu, &cpu, nullptr, nullptr );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_getrusage >()
+{
+    std::function< void() > f = []()
+        {
+            rusage usage;
+            getrusage( RUSAGE_SELF, &usage );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_sched_yield >()
+{
+    std::function< void() > f = []()
+        {
+            sched_yield();
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::syscall_ioctl_badfd >()
+{
+    std::function< void() > f = []()
+        {
+            int n;
+            ioctl( -1, FIONREAD, &n );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+} // namespace bench
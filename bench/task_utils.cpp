@@ -0,0 +1,277 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Task pools, for the task-scheduling benchmarks.
+/*! @file
+
+    See task_utils.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "task_utils.hpp"
+
+#include "autotime/os.hpp"
+
+#include "thread_utils.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+uint64_t EventCount::prepareWait()
+{
+    waiters_.fetch_add( 1, std::memory_order_seq_cst );
+
+    // Orders the announcement before the waiter's last check for work.
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    return epoch_.load( std::memory_order_relaxed );
+}
+
+
+void EventCount::cancelWait()
+{
+    waiters_.fetch_sub( 1, std::memory_order_relaxed );
+}
+
+
+void EventCount::commitWait( uint64_t key )
+{
+    std::unique_lock< std::mutex > lock{ mutex_ };
+    while (epoch_.load( std::memory_order_relaxed ) == key) cond_.wait( lock );
+    waiters_.fetch_sub( 1, std::memory_order_relaxed );
+}
+
+
+void EventCount::notify( bool all )
+{
+    // Orders the caller's publication of work before the check for waiters.
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    if (waiters_.load( std::memory_order_relaxed ) == 0) return;
+
+    {
+        std::lock_guard< std::mutex > lock{ mutex_ };
+        epoch_.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    if (all) cond_.notify_all();
+    else cond_.notify_one();
+}
+
+
+    // Failed attempts to find a task, before an idle worker sleeps.
+static constexpr int Idle_spins = 4096;
+
+    // Deque capacity of each worker of a WorkStealingPool.
+static constexpr size_t Deque_capacity = 4096;
+
+
+namespace
+{
+
+    // The pool & index of the worker that the current thread is running as, if any.
+struct CurrentWorker
+{
+    TaskPool *pool;
+    int idx;
+};
+
+thread_local CurrentWorker Current = { nullptr, 0 };
+
+} // namespace
+
+
+TaskPool::TaskPool( int num_workers )
+:
+    num_workers_( num_workers )
+{
+}
+
+
+TaskPool::~TaskPool()
+{
+}
+
+
+void TaskPool::run( const std::function< void() > &root )
+{
+    const CurrentWorker prev = Current;
+    Current = { this, 0 };
+    root();
+    Current = prev;
+}
+
+
+void TaskPool::spawn( TaskGroup &group, void (*fn)( void *arg ), void *arg )
+{
+    group.pending.fetch_add( 1, std::memory_order_relaxed );
+
+    const Task task = { fn, arg, &group };
+    if (!push( Current.idx, task ))
+    {
+        execute( task );
+        return;
+    }
+
+    events_.notify( false );
+}
+
+
+void TaskPool::wait( TaskGroup &group )
+{
+    SpinWait wait;
+    while (group.pending.load( std::memory_order_acquire ) != 0)
+    {
+        Task task;
+        if (take( Current.idx, task )) execute( task );
+        else wait();
+    }
+}
+
+
+void TaskPool::start()
+{
+    for (int i = 1; i < num_workers_; ++i) threads_.emplace_back( &TaskPool::threadfunc, this, i );
+}
+
+
+void TaskPool::stop()
+{
+    stop_.store( true, std::memory_order_seq_cst );
+    events_.notify( true );
+    for (std::thread &thread: threads_) thread.join();
+    threads_.clear();
+}
+
+
+void TaskPool::threadfunc( int idx )
+{
+    SetCoreAffinity( GetTeamCoreId( idx ) );
+    Current = { this, idx };
+
+    int idle = 0;
+    while (!stop_.load( std::memory_order_relaxed ))
+    {
+        Task task;
+        if (take( idx, task ))
+        {
+            execute( task );
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < Idle_spins)
+        {
+            CpuRelax();
+            continue;
+        }
+        idle = 0;
+
+        // Look once more after announcing the wait, so that a spawn can't be missed.
+        const uint64_t key = events_.prepareWait();
+        if (take( idx, task ))
+        {
+            events_.cancelWait();
+            execute( task );
+        }
+        else if (stop_.load( std::memory_order_seq_cst )) events_.cancelWait();
+        else events_.commitWait( key );
+    }
+}
+
+
+void TaskPool::execute( const Task &task )
+{
+    task.fn( task.arg );
+    task.group->pending.fetch_sub( 1, std::memory_order_release );
+}
+
+
+WorkStealingPool::WorkStealingPool( int num_workers )
+:
+    TaskPool( num_workers )
+{
+    for (int i = 0; i < num_workers; ++i)
+    {
+        deques_.emplace_back( new ChaseLevDeque< Task >( Deque_capacity ) );
+    }
+    start();
+}
+
+
+WorkStealingPool::~WorkStealingPool()
+{
+    stop();
+}
+
+
+bool WorkStealingPool::push( int worker, const Task &task )
+{
+    return deques_[worker]->push( task );
+}
+
+
+bool WorkStealingPool::take( int worker, Task &task )
+{
+    if (deques_[worker]->pop( task )) return true;
+
+    // Visit the others, starting from a random victim (xorshift).
+    thread_local uint32_t state = 2463534242u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    const int n = static_cast< int >( deques_.size() );
+    for (int i = 0; i < n; ++i)
+    {
+        const int victim = static_cast< int >( (state + i) % n );
+        if (victim != worker && deques_[victim]->steal( task )) return true;
+    }
+
+    return false;
+}
+
+
+SharedQueuePool::SharedQueuePool( int num_workers )
+:
+    TaskPool( num_workers )
+{
+    start();
+}
+
+
+SharedQueuePool::~SharedQueuePool()
+{
+    stop();
+}
+
+
+bool SharedQueuePool::push( int, const Task &task )
+{
+    std::lock_guard< std::mutex > lock{ mutex_ };
+    queue_.push_back( task );
+    size_.store( queue_.size(), std::memory_order_relaxed );
+    return true;
+}
+
+
+bool SharedQueuePool::take( int, Task &task )
+{
+    if (size_.load( std::memory_order_relaxed ) == 0) return false;
+
+    std::lock_guard< std::mutex > lock{ mutex_ };
+    if (queue_.empty()) return false;
+
+    task = queue_.front();
+    queue_.pop_front();
+    size_.store( queue_.size(), std::memory_order_relaxed );
+    return true;
+}
+
+
+} // namespace bench
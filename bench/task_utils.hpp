@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Task pools, for the task-scheduling benchmarks.
+/*! @file
+
+    These are the two usual designs: a work-stealing pool, where each worker
+    has a Chase-Lev deque of its own and steals from the others when it runs
+    out, and a pool whose workers all share one locked queue.  Both park idle
+    workers the same way (see EventCount), so they differ only in how tasks
+    are queued.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_TASK_UTILS_HPP
+#define BENCH_TASK_UTILS_HPP
+
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace bench
+{
+
+
+    //! David Chase & Yossi Lev's work-stealing deque, with a fixed capacity.
+    /*!
+        The owner pushes and pops at the bottom, without contention except
+        when taking the last element.  Thieves take from the top, with one
+        compare-exchange each.  The memory orders are those of Lê et al.,
+        "Correct and Efficient Work-Stealing for Weak Memory Models" (2013).
+    */
+template<
+    typename T
+>
+class ChaseLevDeque
+{
+public:
+        //! Capacity must be a power of 2.
+    explicit ChaseLevDeque( size_t capacity )
+    :
+        mask_( capacity - 1 ),
+        slots_( new T[capacity] )
+    {
+    }
+
+        //! Owner only.  Fails if full.
+    bool push( const T &value )
+    {
+        const int64_t bottom = bottom_.load( std::memory_order_relaxed );
+        const int64_t top = top_.load( std::memory_order_acquire );
+        if (bottom - top > static_cast< int64_t >( mask_ )) return false;
+
+        slots_[bottom & mask_] = value;
+        std::atomic_thread_fence( std::memory_order_release );
+        bottom_.store( bottom + 1, std::memory_order_relaxed );
+        return true;
+    }
+
+        //! Owner only.  Takes the most recently pushed value.
+    bool pop( T &value )
+    {
+        const int64_t bottom = bottom_.load( std::memory_order_relaxed ) - 1;
+        bottom_.store( bottom, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        int64_t top = top_.load( std::memory_order_relaxed );
+
+        bool taken = false;
+        if (top <= bottom)
+        {
+            value = slots_[bottom & mask_];
+            taken = true;
+
+            // The last value, which a thief might also be taking.
+            if (top == bottom)
+            {
+                taken = top_.compare_exchange_strong(
+                    top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed );
+                bottom_.store( bottom + 1, std::memory_order_relaxed );
+            }
+        }
+        else bottom_.store( bottom + 1, std::memory_order_relaxed );
+
+        return taken;
+    }
+
+        //! Any thread.  Takes the least recently pushed value.
+        /*!
+            This fails both when the deque is empty and when another thread
+            took the value first.
+        */
+    bool steal( T &value )
+    {
+        int64_t top = top_.load( std::memory_order_acquire );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        const int64_t bottom = bottom_.load( std::memory_order_acquire );
+        if (top >= bottom) return false;
+
+        value = slots_[top & mask_];
+        return top_.compare_exchange_strong(
+            top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed );
+    }
+
+private:
+    const size_t mask_;
+    const std::unique_ptr< T[] > slots_;
+
+    // Padding keeps the thieves' index and the owner's on separate cache lines, without
+    // needing an over-aligned allocation.
+    char pad0_[64];
+    std::atomic< int64_t > top_{ 0 };
+    char pad1_[64 - sizeof( std::atomic< int64_t > )];
+    std::atomic< int64_t > bottom_{ 0 };
+    char pad2_[64 - sizeof( std::atomic< int64_t > )];
+};
+
+
+    //! Lets idle threads sleep, at the cost of an uncontended load per notification.
+    /*!
+        A waiter calls prepareWait(), checks once more for work, and then
+        either cancelWait() or commitWait().  A notification between
+        prepareWait() and commitWait() isn't lost, since it changes the epoch.
+    */
+class EventCount
+{
+public:
+    uint64_t prepareWait();
+    void cancelWait();
+    void commitWait( uint64_t key );
+
+        //! Wakes one or all waiters, if there are any.
+    void notify( bool all );
+
+private:
+    std::atomic< int > waiters_{ 0 };
+    std::atomic< uint64_t > epoch_{ 0 };
+    std::mutex mutex_;
+    std::condition_variable cond_;
+};
+
+
+    //! Join counter of a set of tasks.
+struct TaskGroup
+{
+    std::atomic< int > pending{ 0 };
+};
+
+
+struct Task
+{
+    void (*fn)( void *arg );
+    void *arg;
+    TaskGroup *group;
+};
+
+
+    //! Base of the task pools, which owns the workers and runs their tasks.
+    /*!
+        The caller of run() is worker 0, while the others are threads pinned
+        like the members of a ThreadTeam (see GetTeamCoreId()).  Tasks can
+        only be spawned from within run(), or from other tasks.  Derived
+        classes must call start() once constructed, and stop() before being
+        destroyed, since the workers call push() & take().
+    */
+class TaskPool
+{
+public:
+    explicit TaskPool( int num_workers );
+    virtual ~TaskPool();
+
+    TaskPool( const TaskPool & ) = delete;
+    TaskPool &operator=( const TaskPool & ) = delete;
+
+    int size() const { return num_workers_; }
+
+        //! Calls root as worker 0, and returns when it does.
+    void run( const std::function< void() > &root );
+
+        //! Queues fn( arg ) as a member of group, or runs it immediately if the queue is full.
+    void spawn( TaskGroup &group, void (*fn)( void *arg ), void *arg );
+
+        //! Runs queued tasks until all of the group's tasks have completed.
+    void wait( TaskGroup &group );
+
+protected:
+    void start();
+    void stop();
+
+        //! Queues a task spawned by the given worker.  Fails if full.
+    virtual bool push( int worker, const Task &task ) = 0;
+
+        //! Takes a task for the given worker to run.
+    virtual bool take( int worker, Task &task ) = 0;
+
+private:
+    void threadfunc( int idx );
+    static void execute( const Task &task );
+
+    const int num_workers_;
+    std::vector< std::thread > threads_;
+    std::atomic< bool > stop_{ false };
+    EventCount events_;
+};
+
+
+    //! Each worker has its own deque, and steals from a random other when it's empty.
+class WorkStealingPool: public TaskPool
+{
+public:
+    explicit WorkStealingPool( int num_workers );
+    ~WorkStealingPool() override;
+
+protected:
+    bool push( int worker, const Task &task ) override;
+    bool take( int worker, Task &task ) override;
+
+private:
+    std::vector< std::unique_ptr< ChaseLevDeque< Task > > > deques_;
+};
+
+
+    //! All workers share one FIFO queue, guarded by a mutex.
+class SharedQueuePool: public TaskPool
+{
+public:
+    explicit SharedQueuePool( int num_workers );
+    ~SharedQueuePool() override;
+
+protected:
+    bool push( int worker, const Task &task ) override;
+    bool take( int worker, Task &task ) override;
+
+private:
+    std::mutex mutex_;
+    std::deque< Task > queue_;
+    std::atomic< size_t > size_{ 0 };  // Lets idle workers poll without taking the lock.
+};
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_TASK_UTILS_HPP
@@ -10,16 +10,21 @@
 */
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <chrono>
+#include <cstdint>
 #include <future>
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include "autotime/os.hpp"
 #include "autotime/overhead.hpp"
 #include "autotime/time.hpp"
 
+#include "description.hpp"
 #include "dispatch.hpp"
 #include "list.hpp"
+#include "task_utils.hpp"
 #include "thread_utils.hpp"
 
 
@@ -29,6 +34,46 @@ namespace bench
 {
 
 
+template<> Description Describe< Category::thread >()
+{
+    Description desc;
+    desc.measures = "Thread creation, synchronous communication, and scheduling tasks on a pool.";
+    desc.detail =
+        "thread_task_* compares a work-stealing pool (steal), where each worker has a Chase-Lev"
+        " deque and steals from a random other when its own is empty, with a pool whose workers"
+        " share one mutex-guarded FIFO queue (shared), and with std::async() (async), which runs"
+        " each task on a new thread.  The caller is worker 0 of the pools, and the rest of the"
+        " <N>w workers are threads.";
+    desc.notes =
+        {
+            "thread_task_spawn_* is the cost of spawning and then running an empty task, on a"
+                " single worker.  For async, that includes creating & joining a thread.",
+            "thread_task_tree_* runs a binary tree of tasks, where each inner task spawns one"
+                " child, runs the other itself, and waits for both.  The time is per task, of"
+                " which there are 8191 per tree (127 for async).",
+            "thread_task_handoff_* is the latency from spawning a task on worker 0 to another"
+                " worker starting it, while worker 0 waits without taking it back.  For steal,"
+                " this is the latency of a steal.",
+            "thread_task_tiny_* and thread_task_medium_* spawn tasks which spin for 100 ns, or"
+                " 10 us, from worker 0 and wait for them to complete: 1000 tiny or 100 medium"
+                " tasks for the pools, and 100 of either for async.  The time is per task, so"
+                " it's the inverse of the throughput, and ideally halves as the workers double.",
+            "Idle workers make 4096 attempts to find a task, and then sleep until one is"
+                " spawned.",
+            "The main thread runs on the primary core, while the other threads are pinned to the"
+                " secondary core and then round-robin to the other online cores.",
+        };
+    desc.limits =
+        {
+            "Tasks are a function pointer and argument, so the pools exclude allocating closures"
+                " (e.g. std::function), which many real pools add.",
+            "Worker counts exceeding the number of online cores oversubscribe them, which"
+                " measures scheduling more than the pools.",
+        };
+    return desc;
+}
+
+
 template<> autotime::BenchTimers MakeTimers< Benchmark::thread_create_destroy >()
 {
     void (*f)() = []()
@@ -105,5 +150,389 @@ template<> autotime::BenchTimers MakeTimers< Benchmark::thread_pingpong >()
 }
 
 
-} // namespace bench
 
+    // Empty tasks spawned per iteration of thread_task_spawn_*, which must fit a worker's deque.
+static constexpr int Spawns_per_iter = 1000;
+
+    // Depth of the trees of thread_task_tree_*, which have 2^(depth + 1) - 1 tasks.
+static constexpr int Tree_depth = 12;
+static constexpr int Async_tree_depth = 6;
+
+    // Durations (ns) of the tasks of thread_task_tiny_* & thread_task_medium_*, and the numbers
+    // of each spawned per iteration.
+static constexpr int Tiny_task_ns = 100;
+static constexpr int Medium_task_ns = 10000;
+static constexpr int Tiny_tasks_per_iter = 1000;
+static constexpr int Medium_tasks_per_iter = 100;
+static constexpr int Async_tasks_per_iter = 100;
+
+
+static void EmptyTask( void * )
+{
+}
+
+
+template<
+    typename Pool
+>
+static autotime::BenchTimers MakeSpawnTimers()
+{
+    auto pool = std::make_shared< Pool >( 1 );
+    autotime::Timer timer = [pool]( int num_iters )
+        {
+            TimePoints start_times = Start();
+            pool->run( [&pool, num_iters]()
+                {
+                    for (int i = 0; i < num_iters; ++i)
+                    {
+                        TaskGroup group;
+                        for (int j = 0; j < Spawns_per_iter; ++j)
+                        {
+                            pool->spawn( group, &EmptyTask, nullptr );
+                        }
+                        pool->wait( group );
+                    }
+                } );
+            return End( start_times ) / Spawns_per_iter;
+        };
+
+    return { timer, nullptr };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_spawn_steal >()
+{
+    return MakeSpawnTimers< WorkStealingPool >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_spawn_shared >()
+{
+    return MakeSpawnTimers< SharedQueuePool >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_spawn_async >()
+{
+    void (*f)() = []()
+        {
+            std::async( std::launch::async, [](){} ).get();
+        };
+
+    return { MakeTimer( f ), MakeTimer( &Overhead_void<> ) };
+}
+
+
+struct TreeNode
+{
+    TaskPool *pool;
+    int depth;
+};
+
+
+    // Spawns one subtree and runs the other, so that either could be stolen.
+static void TreeTask( void *arg )
+{
+    const TreeNode &node = *static_cast< const TreeNode * >( arg );
+    if (node.depth == 0) return;
+
+    TreeNode child = { node.pool, node.depth - 1 };
+    TaskGroup group;
+    node.pool->spawn( group, &TreeTask, &child );
+    TreeTask( &child );
+    node.pool->wait( group );
+}
+
+
+static void AsyncTree( int depth )
+{
+    if (depth == 0) return;
+
+    std::future< void > subtree = std::async( std::launch::async, &AsyncTree, depth - 1 );
+    AsyncTree( depth - 1 );
+    subtree.get();
+}
+
+
+template<
+    typename Pool
+>
+static autotime::BenchTimers MakeTreeTimers( int num_workers )
+{
+    auto pool = std::make_shared< Pool >( num_workers );
+    autotime::Timer timer = [pool]( int num_iters )
+        {
+            TreeNode root = { pool.get(), Tree_depth };
+
+            TimePoints start_times = Start();
+            pool->run( [&root, num_iters]()
+                {
+                    for (int i = 0; i < num_iters; ++i) TreeTask( &root );
+                } );
+            return End( start_times ) / ((2 << Tree_depth) - 1);
+        };
+
+    return { timer, nullptr };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tree_steal_4w >()
+{
+    return MakeTreeTimers< WorkStealingPool >( 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tree_shared_4w >()
+{
+    return MakeTreeTimers< SharedQueuePool >( 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tree_async >()
+{
+    autotime::Timer timer = []( int num_iters )
+        {
+            TimePoints start_times = Start();
+            for (int i = 0; i < num_iters; ++i) AsyncTree( Async_tree_depth );
+            return End( start_times ) / ((2 << Async_tree_depth) - 1);
+        };
+
+    return { timer, nullptr };
+}
+
+
+struct Handoff
+{
+    uint64_t spawned = 0;   // steady_clock ticks
+    uint64_t latency = 0;   // Sum of ticks from spawning to starting.
+};
+
+
+static void HandoffTask( void *arg )
+{
+    Handoff &handoff = *static_cast< Handoff * >( arg );
+    handoff.latency += Now() - handoff.spawned;
+}
+
+
+template<
+    typename Pool
+>
+static autotime::BenchTimers MakeHandoffTimers()
+{
+    auto pool = std::make_shared< Pool >( 2 );
+    autotime::Timer timer = [pool]( int num_iters )
+        {
+            Handoff handoff;
+
+            TimePoints start_times = Start();
+            pool->run( [&pool, &handoff, num_iters]()
+                {
+                    for (int i = 0; i < num_iters; ++i)
+                    {
+                        TaskGroup group;
+                        handoff.spawned = Now();
+                        pool->spawn( group, &HandoffTask, &handoff );
+
+                        // Wait without taking the task back, so that the other worker must.
+                        SpinWait wait;
+                        while (group.pending.load( std::memory_order_acquire ) != 0) wait();
+                    }
+                } );
+            Durations durs = End( start_times );
+
+            durs.real = std::chrono::duration_cast< steady_clock::duration >(
+                steady_clock::duration( handoff.latency ) );
+            return durs;
+        };
+
+    std::function< void() > overhead = [](){ Now(); };
+    return { timer, MakeTimer( overhead ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_handoff_steal >()
+{
+    return MakeHandoffTimers< WorkStealingPool >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_handoff_shared >()
+{
+    return MakeHandoffTimers< SharedQueuePool >();
+}
+
+
+static void SpinTask( void *arg )
+{
+    SpinFor( *static_cast< const std::chrono::nanoseconds * >( arg ) );
+}
+
+
+template<
+    typename Pool
+>
+static autotime::BenchTimers MakeThroughputTimers(
+    int num_workers, int task_ns, int tasks_per_iter )
+{
+    auto pool = std::make_shared< Pool >( num_workers );
+    autotime::Timer timer = [pool, task_ns, tasks_per_iter]( int num_iters )
+        {
+            std::chrono::nanoseconds duration{ task_ns };
+
+            TimePoints start_times = Start();
+            pool->run( [&pool, &duration, tasks_per_iter, num_iters]()
+                {
+                    for (int i = 0; i < num_iters; ++i)
+                    {
+                        TaskGroup group;
+                        for (int j = 0; j < tasks_per_iter; ++j)
+                        {
+                            pool->spawn( group, &SpinTask, &duration );
+                        }
+                        pool->wait( group );
+                    }
+                } );
+            return End( start_times ) / tasks_per_iter;
+        };
+
+    return { timer, nullptr };
+}
+
+
+static autotime::BenchTimers MakeAsyncThroughputTimers( int task_ns )
+{
+    autotime::Timer timer = [task_ns]( int num_iters )
+        {
+            const std::chrono::nanoseconds duration{ task_ns };
+            std::vector< std::future< void > > futures;
+            futures.reserve( Async_tasks_per_iter );
+
+            TimePoints start_times = Start();
+            for (int i = 0; i < num_iters; ++i)
+            {
+                for (int j = 0; j < Async_tasks_per_iter; ++j)
+                {
+                    futures.push_back( std::async( std::launch::async, &SpinFor, duration ) );
+                }
+                for (std::future< void > &future: futures) future.get();
+                futures.clear();
+            }
+            return End( start_times ) / Async_tasks_per_iter;
+        };
+
+    return { timer, nullptr };
+}
+
+
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tiny_steal_1w >()
+{
+    return MakeThroughputTimers< WorkStealingPool >( 1, Tiny_task_ns, Tiny_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tiny_steal_2w >()
+{
+    return MakeThroughputTimers< WorkStealingPool >( 2, Tiny_task_ns, Tiny_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tiny_steal_4w >()
+{
+    return MakeThroughputTimers< WorkStealingPool >( 4, Tiny_task_ns, Tiny_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tiny_steal_8w >()
+{
+    return MakeThroughputTimers< WorkStealingPool >( 8, Tiny_task_ns, Tiny_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tiny_shared_1w >()
+{
+    return MakeThroughputTimers< SharedQueuePool >( 1, Tiny_task_ns, Tiny_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tiny_shared_2w >()
+{
+    return MakeThroughputTimers< SharedQueuePool >( 2, Tiny_task_ns, Tiny_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tiny_shared_4w >()
+{
+    return MakeThroughputTimers< SharedQueuePool >( 4, Tiny_task_ns, Tiny_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tiny_shared_8w >()
+{
+    return MakeThroughputTimers< SharedQueuePool >( 8, Tiny_task_ns, Tiny_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_tiny_async >()
+{
+    return MakeAsyncThroughputTimers( Tiny_task_ns );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_medium_steal_1w >()
+{
+    return MakeThroughputTimers< WorkStealingPool >( 1, Medium_task_ns, Medium_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_medium_steal_2w >()
+{
+    return MakeThroughputTimers< WorkStealingPool >( 2, Medium_task_ns, Medium_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_medium_steal_4w >()
+{
+    return MakeThroughputTimers< WorkStealingPool >( 4, Medium_task_ns, Medium_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_medium_steal_8w >()
+{
+    return MakeThroughputTimers< WorkStealingPool >( 8, Medium_task_ns, Medium_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_medium_shared_1w >()
+{
+    return MakeThroughputTimers< SharedQueuePool >( 1, Medium_task_ns, Medium_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_medium_shared_2w >()
+{
+    return MakeThroughputTimers< SharedQueuePool >( 2, Medium_task_ns, Medium_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_medium_shared_4w >()
+{
+    return MakeThroughputTimers< SharedQueuePool >( 4, Medium_task_ns, Medium_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_medium_shared_8w >()
+{
+    return MakeThroughputTimers< SharedQueuePool >( 8, Medium_task_ns, Medium_tasks_per_iter );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::thread_task_medium_async >()
+{
+    return MakeAsyncThroughputTimers( Medium_task_ns );
+}
+
+
+} // namespace bench
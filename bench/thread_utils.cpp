@@ -13,9 +13,21 @@
 
 #include "thread_utils.hpp"
 
+#include "enum_impl.hpp"
 #include "error_utils.hpp"
 
+#include "autotime/os.hpp"
+#include "autotime/time.hpp"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include <linux/futex.h>
 #include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 
 namespace bench
@@ -57,5 +69,252 @@ void SetSecondaryCoreId( int id )
 }
 
 
+    // Returns the online cores, starting with core0 (if it's online) and wrapping around.
+static std::vector< int > GetOnlineCoreIdsFrom( int core0 )
+{
+    std::vector< int > cores;
+    for (const autotime::CpuTopology &cpu: autotime::GetCpuTopology())
+    {
+        cores.push_back( cpu.cpu_id );
+    }
+
+    // The online cores needn't be numbered contiguously, so rotate rather than add.
+    std::rotate( cores.begin(), std::lower_bound( cores.begin(), cores.end(), core0 ),
+        cores.end() );
+    return cores;
+}
+
+
+int GetRoundRobinCoreId( int i )
+{
+    const std::vector< int > cores = GetOnlineCoreIdsFrom( autotime::GetCurrentCoreId() );
+    if (cores.empty()) return -1;
+
+    return cores[i % cores.size()];
+}
+
+
+int GetTeamCoreId( int i )
+{
+    const int core0 = autotime::GetCurrentCoreId();
+    if (i == 0) return core0;
+
+    const int core1 = GetSecondaryCoreId();
+    std::vector< int > others;
+    if (core1 >= 0 && core1 != core0) others.push_back( core1 );
+    for (int core: GetOnlineCoreIdsFrom( core0 ))
+    {
+        if (core != core0 && core != core1) others.push_back( core );
+    }
+    if (others.empty()) return (core1 >= 0) ? core1 : core0;
+
+    return others[(i - 1) % others.size()];
+}
+
+
+void SpinFor( std::chrono::nanoseconds duration )
+{
+    using std::chrono::steady_clock;
+
+    const steady_clock::time_point end = steady_clock::now() + duration;
+    while (steady_clock::now() < end);
+}
+
+
+long FutexWait( std::atomic< int > &word, int expected )
+{
+    return syscall(
+        SYS_futex, FutexWord( word ), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0 );
+}
+
+
+long FutexWake( std::atomic< int > &word, int num_waiters )
+{
+    return syscall(
+        SYS_futex, FutexWord( word ), FUTEX_WAKE_PRIVATE, num_waiters, nullptr, nullptr, 0 );
+}
+
+
+ThreadTeam::ThreadTeam( int num_threads, Body body )
+:
+    num_threads_( num_threads ),
+    body_( std::move( body ) )
+{
+    for (int i = 1; i < num_threads; ++i)
+    {
+        threads_.emplace_back( &ThreadTeam::threadfunc, this, i, GetTeamCoreId( i ) );
+    }
+}
+
+
+ThreadTeam::~ThreadTeam()
+{
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        stop_ = true;
+    }
+    start_cond_.notify_all();
+
+    for (std::thread &thread: threads_) thread.join();
+}
+
+
+autotime::Durations ThreadTeam::time( int num_iters )
+{
+    autotime::TimePoints start_times = autotime::Start();
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        ++generation_;
+        num_iters_ = num_iters;
+        remaining_ = num_threads_ - 1;
+        arrived_ = 0;
+    }
+    start_cond_.notify_all();
+
+    runBody( 0, num_iters );
+
+    std::unique_lock< std::mutex > lock( mutex_ );
+    done_cond_.wait( lock, [this]() { return remaining_ == 0; } );
+
+    return autotime::End( start_times );
+}
+
+
+void ThreadTeam::threadfunc( int idx, int core )
+{
+    if (core >= 0) autotime::SetCoreAffinity( core );
+
+    uint64_t generation = 0;
+    for (;;)
+    {
+        int num_iters = 0;
+        {
+            std::unique_lock< std::mutex > lock( mutex_ );
+            start_cond_.wait( lock, [&]() { return stop_ || generation_ != generation; } );
+            if (stop_) return;
+
+            generation = generation_;
+            num_iters = num_iters_;
+        }
+
+        runBody( idx, num_iters );
+
+        std::lock_guard< std::mutex > lock( mutex_ );
+        if (--remaining_ == 0) done_cond_.notify_one();
+    }
+}
+
+
+void ThreadTeam::runBody( int idx, int num_iters )
+{
+    // Don't let early arrivals get a head start.
+    arrived_.fetch_add( 1 );
+    SpinWait wait;
+    while (arrived_.load() < num_threads_) wait();
+
+    body_( idx, num_iters );
+}
+
+
+PairPolicy operator++( PairPolicy &policy )
+{
+    policy = Next< PairPolicy >( policy );
+    return policy;
+}
+
+
+template<> EnumRange< PairPolicy > RangeOf< PairPolicy >()
+{
+    return boost::irange< PairPolicy >( PairPolicy::first, boost::next( PairPolicy::last ) );
+}
+
+
+const char *ToCStr( PairPolicy policy )
+{
+    switch (policy)
+    {
+#define CASE( n ) \
+    case PairPolicy::n: \
+        return #n
+
+    case PairPolicy::automatic:
+        return "auto";
+
+    CASE( smt );
+    CASE( same_l2 );
+    CASE( same_l3 );
+    CASE( cross_l3 );
+    CASE( cross_package );
+
+#undef CASE
+    }
+
+    return nullptr;
+}
+
+
+std::istream &operator>>( std::istream &istream, PairPolicy &policy )
+{
+    std::string str;
+    if (istream >> str)
+    {
+        if (boost::optional< PairPolicy > opt = FromString< PairPolicy >( str ))
+        {
+            policy = *opt;
+            return istream;
+        }
+        istream.clear( std::ostream::failbit );
+    }
+
+    return istream;
+}
+
+
+std::ostream &operator<<( std::ostream &ostream, PairPolicy policy )
+{
+    if (const char *c_str = ToCStr( policy )) ostream << c_str;
+    else ostream.clear( std::ostream::failbit );
+
+    return ostream;
+}
+
+
+int SelectPairedCoreId(
+    const std::vector< autotime::CpuTopology > &topology, int core0, PairPolicy policy )
+{
+    using autotime::CorePlacement;
+
+    switch (policy)
+    {
+    case PairPolicy::automatic:
+        for (CorePlacement placement: {
+                CorePlacement::same_l2, CorePlacement::same_l3, CorePlacement::cross_l3,
+                CorePlacement::cross_package, CorePlacement::smt })
+        {
+            const int core1 = autotime::SelectPairedCore( topology, core0, placement );
+            if (core1 >= 0) return core1;
+        }
+        return -1;
+
+    case PairPolicy::smt:
+        return autotime::SelectPairedCore( topology, core0, CorePlacement::smt );
+
+    case PairPolicy::same_l2:
+        return autotime::SelectPairedCore( topology, core0, CorePlacement::same_l2 );
+
+    case PairPolicy::same_l3:
+        return autotime::SelectPairedCore( topology, core0, CorePlacement::same_l3 );
+
+    case PairPolicy::cross_l3:
+        return autotime::SelectPairedCore( topology, core0, CorePlacement::cross_l3 );
+
+    case PairPolicy::cross_package:
+        return autotime::SelectPairedCore( topology, core0, CorePlacement::cross_package );
+    }
+
+    return -1;
+}
+
+
 } // namespace bench
 
@@ -15,6 +15,23 @@
 #define BENCH_THREAD_UTILS_HPP
 
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "autotime/types.hpp"
+
+#include "autotime/topology.hpp"
+
+#include "enum_utils.hpp"
+
+
 namespace bench
 {
 
@@ -27,12 +44,177 @@ void *InitLibpthread();
 int GetSecondaryCoreId();
 
 
-    //! Returns the ID of the secondary core to use for threaded benchmarks.
+    //! Returns the ID of the i-th online core following the current one, wrapping around.
+    /*!
+        This is for benchmarks that spread N threads over the cores, with
+        thread 0 being the caller.  It returns -1 if the online cores can't
+        be determined.
+    */
+int GetRoundRobinCoreId( int i );
+
+
+    //! Returns the ID of the core for member i of a team of threads, where 0 is the caller.
+    /*!
+        Member 1 gets the secondary core, so that pairs of threads are placed
+        by the same policy as the other threaded benchmarks.  The rest get the
+        other online cores following the current one, wrapping around.
+    */
+int GetTeamCoreId( int i );
+
+
+    //! Sets the ID of the secondary core to use for threaded benchmarks.
 void SetSecondaryCoreId(
     int id      //!< Core ID (-1 for current core).
 );
 
 
+    //! Hints to the CPU that the caller is spinning (e.g. x86 PAUSE).
+inline void CpuRelax()
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+    __builtin_ia32_pause();
+#endif
+}
+
+
+    //! Waits by spinning, at first, and then by yielding the core.
+    /*!
+        Spinning alone could take a whole timeslice to make progress, when
+        there are more threads than cores.
+    */
+class SpinWait
+{
+public:
+    void operator()()
+    {
+        if (count_ < Spin_limit)
+        {
+            ++count_;
+            CpuRelax();
+        }
+        else std::this_thread::yield();
+    }
+
+private:
+    static constexpr int Spin_limit = 4096;
+
+    int count_ = 0;
+};
+
+
+    //! Spins, reading the steady clock, until the duration has elapsed.
+void SpinFor( std::chrono::nanoseconds duration );
+
+
+    //! Returns the steady clock's ticks, as a timestamp which can be passed through an atomic.
+inline uint64_t Now()
+{
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+
+    //! Returns the address of an atomic's value, for use as a futex.
+inline int *FutexWord( std::atomic< int > &atomic )
+{
+    static_assert( sizeof( std::atomic< int > ) == sizeof( int ), "atomic< int > isn't an int" );
+    return reinterpret_cast< int * >( &atomic );
+}
+
+
+    //! Sleeps until woken, unless word no longer holds expected (FUTEX_WAIT_PRIVATE).
+long FutexWait( std::atomic< int > &word, int expected );
+
+
+    //! Wakes up to num_waiters threads sleeping on word (FUTEX_WAKE_PRIVATE).
+long FutexWake( std::atomic< int > &word, int num_waiters );
+
+
+    //! Runs a function on a team of threads, simultaneously.
+    /*!
+        The caller is member 0 of the team.  The others are started by the
+        constructor and pinned to the secondary core and then round-robin to
+        the other online cores (see GetTeamCoreId()).  In each call to time(), every
+        member waits at a spinning barrier, so they start together, and then
+        calls the function with its index and the iteration count.
+    */
+class ThreadTeam
+{
+public:
+    using Body = std::function< void ( int idx, int num_iters ) >;
+
+    ThreadTeam( int num_threads, Body body );
+    ~ThreadTeam();
+
+    ThreadTeam( const ThreadTeam & ) = delete;
+    ThreadTeam &operator=( const ThreadTeam & ) = delete;
+
+    int size() const { return num_threads_; }
+
+        //! Runs the body on all members, returning once all are done.
+        /*!
+            Waking the other members and waiting for them to finish is
+            included in the time.
+        */
+    autotime::Durations time( int num_iters );
+
+private:
+    void threadfunc( int idx, int core );
+    void runBody( int idx, int num_iters );
+
+    const int num_threads_;
+    const Body body_;
+    std::vector< std::thread > threads_;
+
+    std::mutex mutex_;
+    std::condition_variable start_cond_;
+    std::condition_variable done_cond_;
+    uint64_t generation_ = 0;
+    int num_iters_ = 0;
+    int remaining_ = 0;
+    bool stop_ = false;
+
+    std::atomic< int > arrived_{ 0 };
+};
+
+
+    //! How the secondary core is placed, relative to the primary.
+enum class PairPolicy
+{
+    automatic, first = automatic,   //!< The first of same_l2, same_l3, cross_l3, cross_package, smt.
+    smt,
+    same_l2,
+    same_l3,
+    cross_l3,
+    cross_package,
+        last = cross_package
+};
+
+PairPolicy operator++( PairPolicy &policy );
+
+template<> EnumRange< PairPolicy > RangeOf< PairPolicy >();
+
+const char *ToCStr( PairPolicy policy );
+
+std::istream &operator>>( std::istream &istream, PairPolicy &policy );
+std::ostream &operator<<( std::ostream &ostream, PairPolicy policy );
+
+
+    //! Selects a core with the specified placement, relative to core0.
+    /*!
+        The automatic policy prefers a separate physical core which shares
+        the most cache with core0, since that's the typical case for two
+        communicating threads, and resorts to an SMT sibling only if there's
+        no other core.
+
+        @returns -1, if no online core satisfies the policy.
+    */
+int SelectPairedCoreId(
+    const std::vector< autotime::CpuTopology > &topology,  //!< From autotime::GetCpuTopology().
+    int core0,
+    PairPolicy policy
+);
+
+
 } // namespace bench
 
 
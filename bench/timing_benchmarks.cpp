@@ -0,0 +1,658 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements timing-category benchmarks.
+/*! @file
+
+    These measure how late a thread wakes from each of the usual ways of
+    sleeping, for a given duration.  The distribution of overshoots is kept
+    by timing_utils.cpp, and printed after the results.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <system_error>
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <boost/asio.hpp>
+
+#include "autotime/time.hpp"
+
+#include "description.hpp"
+#include "dispatch.hpp"
+#include "error_utils.hpp"
+#include "list.hpp"
+#include "timing_utils.hpp"
+
+
+namespace asio = boost::asio;
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::timing >()
+{
+    Description desc;
+    desc.measures = "Mean time by which a sleep overshoots the requested duration.";
+    desc.detail =
+        "Each sleep reads steady_clock before & after, to find how much later than requested"
+        " the thread resumed, and an iteration is the mean of 100 sleeps.  The p50, p99 &"
+        " max overshoots of each benchmark's reported run are printed after the results.";
+    desc.notes =
+        {
+            "timing_nanosleep_* calls nanosleep(), timing_abstime_* calls clock_nanosleep() on"
+                " CLOCK_MONOTONIC with TIMER_ABSTIME, and timing_timerfd_* read()s a timerfd"
+                " armed for the request.  timing_epoll_* waits on an empty epoll set, and"
+                " timing_asio_* runs an io_service until a steady_timer's async_wait()"
+                " handler is called.",
+            "timing_*_fifo runs at the lowest SCHED_FIFO priority, where the kernel doesn't"
+                " apply timer slack.  It's skipped, if the process isn't permitted to use"
+                " SCHED_FIFO.",
+        };
+    desc.limits =
+        {
+            "Under SCHED_OTHER, every overshoot includes the thread's timer slack (50 us, by"
+                " default), which the kernel adds so it can coalesce wakeups.",
+            "timing_epoll_* calls epoll_wait() for the whole-millisecond requests, and"
+                " epoll_pwait2() for the others, since epoll_wait()'s timeout is in whole"
+                " milliseconds.  Those are skipped, on kernels older than 5.11.",
+            "The overshoot includes a steady_clock read and, for asio, the io_service's"
+                " dispatch of the handler.",
+        };
+    return desc;
+}
+
+
+static std::chrono::steady_clock::time_point Now()
+{
+    return std::chrono::steady_clock::now();
+}
+
+
+    // Converts a steady_clock time point to CLOCK_MONOTONIC, which it uses on Linux.
+static timespec ToTimespec( std::chrono::steady_clock::time_point time )
+{
+    const std::chrono::nanoseconds ns = time.time_since_epoch();
+    timespec ts;
+    ts.tv_sec = static_cast< time_t >( ns.count() / 1000000000 );
+    ts.tv_nsec = static_cast< long >( ns.count() % 1000000000 );
+    return ts;
+}
+
+
+static timespec ToTimespec( std::chrono::nanoseconds duration )
+{
+    timespec ts;
+    ts.tv_sec = static_cast< time_t >( duration.count() / 1000000000 );
+    ts.tv_nsec = static_cast< long >( duration.count() % 1000000000 );
+    return ts;
+}
+
+
+    // Each of the following sleeps for request, after start.
+
+class NanosleepDelay
+{
+public:
+    void wait( std::chrono::steady_clock::time_point, std::chrono::nanoseconds request )
+    {
+        const timespec ts = ToTimespec( request );
+        if (nanosleep( &ts, nullptr ) < 0) throw_system_error( errno, "nanosleep()" );
+    }
+};
+
+
+class AbstimeDelay
+{
+public:
+    void wait( std::chrono::steady_clock::time_point start, std::chrono::nanoseconds request )
+    {
+        const timespec ts = ToTimespec( start + request );
+        const int err = clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr );
+        if (err) throw_system_error( err, "clock_nanosleep()" );
+    }
+};
+
+
+class TimerfdDelay
+{
+public:
+    TimerfdDelay()
+    :
+        fd_( timerfd_create( CLOCK_MONOTONIC, TFD_CLOEXEC ) )
+    {
+        if (fd_ < 0) throw_system_error( errno, "timerfd_create()" );
+    }
+
+    ~TimerfdDelay() { close( fd_ ); }
+
+    void wait( std::chrono::steady_clock::time_point, std::chrono::nanoseconds request )
+    {
+        itimerspec spec = {};
+        spec.it_value = ToTimespec( request );
+        if (timerfd_settime( fd_, 0, &spec, nullptr ) < 0)
+        {
+            throw_system_error( errno, "timerfd_settime()" );
+        }
+
+        uint64_t expirations;
+        if (read( fd_, &expirations, sizeof( expirations ) ) < 0)
+        {
+            throw_system_error( errno, "read()" );
+        }
+    }
+
+private:
+    const int fd_;
+};
+
+
+    // Uses epoll_wait() for whole milliseconds, and otherwise epoll_pwait2(), since
+    // epoll_wait() would round the request up to whole milliseconds.
+class EpollDelay
+{
+public:
+        // Returns true, if the request needs epoll_pwait2().
+    static bool NeedsPwait2( std::chrono::nanoseconds request )
+    {
+        return request % std::chrono::milliseconds( 1 ) != std::chrono::nanoseconds::zero();
+    }
+
+        // Throws unavailable_error, if the kernel lacks epoll_pwait2().
+    static void RequirePwait2()
+    {
+        // With an invalid fd, it fails with EBADF, if it exists.
+        epoll_event event;
+        const long result = syscall( __NR_epoll_pwait2, -1, &event, 1, nullptr, nullptr, 0 );
+        if (result < 0 && errno == ENOSYS)
+        {
+            throw unavailable_error( "epoll_pwait2() needs Linux 5.11." );
+        }
+    }
+
+    EpollDelay()
+    :
+        fd_( epoll_create1( EPOLL_CLOEXEC ) )
+    {
+        if (fd_ < 0) throw_system_error( errno, "epoll_create1()" );
+    }
+
+    ~EpollDelay() { close( fd_ ); }
+
+    void wait( std::chrono::steady_clock::time_point, std::chrono::nanoseconds request )
+    {
+        epoll_event event;
+        if (!NeedsPwait2( request ))
+        {
+            const auto ms = std::chrono::duration_cast< std::chrono::milliseconds >( request );
+            if (epoll_wait( fd_, &event, 1, static_cast< int >( ms.count() ) ) < 0)
+            {
+                throw_system_error( errno, "epoll_wait()" );
+            }
+            return;
+        }
+
+        // glibc only wraps epoll_pwait2() since 2.35.
+        const timespec ts = ToTimespec( request );
+        if (syscall( __NR_epoll_pwait2, fd_, &event, 1, &ts, nullptr, 0 ) < 0)
+        {
+            throw_system_error( errno, "epoll_pwait2()" );
+        }
+    }
+
+private:
+    const int fd_;
+};
+
+
+class AsioDelay
+{
+public:
+    AsioDelay()
+    :
+        timer_( iosvc_ )
+    {
+    }
+
+    void wait( std::chrono::steady_clock::time_point start, std::chrono::nanoseconds request )
+    {
+        timer_.expires_at( start + request );
+        timer_.async_wait( []( const boost::system::error_code & ){} );
+        iosvc_.run();
+        iosvc_.reset();
+    }
+
+private:
+    asio::io_service iosvc_;
+    asio::steady_timer timer_;
+};
+
+
+    // Runs the current thread at the lowest SCHED_FIFO priority, while it exists.
+class FifoScope
+{
+public:
+        // Returns false, if the process isn't permitted to use SCHED_FIFO.
+    static bool Permitted()
+    {
+        int policy;
+        sched_param param;
+        int err = pthread_getschedparam( pthread_self(), &policy, &param );
+        if (err) throw_system_error( err, "pthread_getschedparam()" );
+
+        sched_param fifo_param = {};
+        fifo_param.sched_priority = sched_get_priority_min( SCHED_FIFO );
+        err = pthread_setschedparam( pthread_self(), SCHED_FIFO, &fifo_param );
+        if (err == EPERM) return false;
+        if (err) throw_system_error( err, "pthread_setschedparam()" );
+
+        Restore( policy, param );
+        return true;
+    }
+
+    explicit FifoScope( bool enable )
+    :
+        enabled_( enable )
+    {
+        if (!enabled_) return;
+
+        int err = pthread_getschedparam( pthread_self(), &policy_, &param_ );
+        if (err) throw_system_error( err, "pthread_getschedparam()" );
+
+        sched_param param = {};
+        param.sched_priority = sched_get_priority_min( SCHED_FIFO );
+        err = pthread_setschedparam( pthread_self(), SCHED_FIFO, &param );
+        if (err) throw_system_error( err, "pthread_setschedparam()" );
+    }
+
+    ~FifoScope()
+    {
+        if (enabled_) Restore( policy_, param_ );
+    }
+
+    FifoScope( const FifoScope & ) = delete;
+    FifoScope &operator=( const FifoScope & ) = delete;
+
+private:
+    static void Restore( int policy, const sched_param &param )
+    {
+        pthread_setschedparam( pthread_self(), policy, &param );
+    }
+
+    const bool enabled_;
+    int policy_ = SCHED_OTHER;
+    sched_param param_ = {};
+};
+
+
+    // Sleeps in each iteration, so the percentiles have enough samples to mean something.
+static constexpr int Sleeps_per_iter = 100;
+
+
+    // The overshoot replaces the real time, so the result is the mean overshoot per sleep.
+template<
+    typename Delay
+>
+static autotime::BenchTimers MakeOvershootTimers( std::chrono::nanoseconds request, bool fifo )
+{
+    if (fifo && !FifoScope::Permitted())
+    {
+        throw unavailable_error( "Not permitted to use SCHED_FIFO." );
+    }
+
+    auto delay = std::make_shared< Delay >();
+
+    auto time_f = [delay, request, fifo]( int num_iters )
+        {
+            // AutoTime() reports its last run, so the overshoots are of that run, alone.
+            ClearOvershoots();
+            FifoScope scope( fifo );
+
+            std::chrono::nanoseconds total{ 0 };
+            TimePoints start_times = Start();
+            for (int i = 0; i < num_iters * Sleeps_per_iter; ++i)
+            {
+                const std::chrono::steady_clock::time_point start = Now();
+                delay->wait( start, request );
+                const std::chrono::nanoseconds overshoot = Now() - start - request;
+
+                RecordOvershoot( overshoot );
+                total += overshoot;
+            }
+            Durations durs = End( start_times );
+
+            durs.real = std::chrono::duration_cast< steady_clock::duration >( total );
+            return durs / Sleeps_per_iter;
+        };
+
+    return { time_f, nullptr };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_nanosleep_1us >()
+{
+    return MakeOvershootTimers< NanosleepDelay >( std::chrono::nanoseconds( 1000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_nanosleep_1us_fifo >()
+{
+    return MakeOvershootTimers< NanosleepDelay >( std::chrono::nanoseconds( 1000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_nanosleep_10us >()
+{
+    return MakeOvershootTimers< NanosleepDelay >( std::chrono::nanoseconds( 10000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_nanosleep_10us_fifo >()
+{
+    return MakeOvershootTimers< NanosleepDelay >( std::chrono::nanoseconds( 10000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_nanosleep_100us >()
+{
+    return MakeOvershootTimers< NanosleepDelay >( std::chrono::nanoseconds( 100000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_nanosleep_100us_fifo >()
+{
+    return MakeOvershootTimers< NanosleepDelay >( std::chrono::nanoseconds( 100000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_nanosleep_1ms >()
+{
+    return MakeOvershootTimers< NanosleepDelay >( std::chrono::nanoseconds( 1000000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_nanosleep_1ms_fifo >()
+{
+    return MakeOvershootTimers< NanosleepDelay >( std::chrono::nanoseconds( 1000000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_nanosleep_10ms >()
+{
+    return MakeOvershootTimers< NanosleepDelay >( std::chrono::nanoseconds( 10000000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_nanosleep_10ms_fifo >()
+{
+    return MakeOvershootTimers< NanosleepDelay >( std::chrono::nanoseconds( 10000000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_abstime_1us >()
+{
+    return MakeOvershootTimers< AbstimeDelay >( std::chrono::nanoseconds( 1000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_abstime_1us_fifo >()
+{
+    return MakeOvershootTimers< AbstimeDelay >( std::chrono::nanoseconds( 1000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_abstime_10us >()
+{
+    return MakeOvershootTimers< AbstimeDelay >( std::chrono::nanoseconds( 10000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_abstime_10us_fifo >()
+{
+    return MakeOvershootTimers< AbstimeDelay >( std::chrono::nanoseconds( 10000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_abstime_100us >()
+{
+    return MakeOvershootTimers< AbstimeDelay >( std::chrono::nanoseconds( 100000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_abstime_100us_fifo >()
+{
+    return MakeOvershootTimers< AbstimeDelay >( std::chrono::nanoseconds( 100000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_abstime_1ms >()
+{
+    return MakeOvershootTimers< AbstimeDelay >( std::chrono::nanoseconds( 1000000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_abstime_1ms_fifo >()
+{
+    return MakeOvershootTimers< AbstimeDelay >( std::chrono::nanoseconds( 1000000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_abstime_10ms >()
+{
+    return MakeOvershootTimers< AbstimeDelay >( std::chrono::nanoseconds( 10000000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_abstime_10ms_fifo >()
+{
+    return MakeOvershootTimers< AbstimeDelay >( std::chrono::nanoseconds( 10000000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_timerfd_1us >()
+{
+    return MakeOvershootTimers< TimerfdDelay >( std::chrono::nanoseconds( 1000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_timerfd_1us_fifo >()
+{
+    return MakeOvershootTimers< TimerfdDelay >( std::chrono::nanoseconds( 1000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_timerfd_10us >()
+{
+    return MakeOvershootTimers< TimerfdDelay >( std::chrono::nanoseconds( 10000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_timerfd_10us_fifo >()
+{
+    return MakeOvershootTimers< TimerfdDelay >( std::chrono::nanoseconds( 10000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_timerfd_100us >()
+{
+    return MakeOvershootTimers< TimerfdDelay >( std::chrono::nanoseconds( 100000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_timerfd_100us_fifo >()
+{
+    return MakeOvershootTimers< TimerfdDelay >( std::chrono::nanoseconds( 100000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_timerfd_1ms >()
+{
+    return MakeOvershootTimers< TimerfdDelay >( std::chrono::nanoseconds( 1000000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_timerfd_1ms_fifo >()
+{
+    return MakeOvershootTimers< TimerfdDelay >( std::chrono::nanoseconds( 1000000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_timerfd_10ms >()
+{
+    return MakeOvershootTimers< TimerfdDelay >( std::chrono::nanoseconds( 10000000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_timerfd_10ms_fifo >()
+{
+    return MakeOvershootTimers< TimerfdDelay >( std::chrono::nanoseconds( 10000000 ), true );
+}
+
+
+    // Only the sub-millisecond requests are skipped, on kernels lacking epoll_pwait2().
+static autotime::BenchTimers MakeEpollTimers( std::chrono::nanoseconds request, bool fifo )
+{
+    if (EpollDelay::NeedsPwait2( request )) EpollDelay::RequirePwait2();
+
+    return MakeOvershootTimers< EpollDelay >( request, fifo );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_epoll_1us >()
+{
+    return MakeEpollTimers( std::chrono::nanoseconds( 1000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_epoll_1us_fifo >()
+{
+    return MakeEpollTimers( std::chrono::nanoseconds( 1000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_epoll_10us >()
+{
+    return MakeEpollTimers( std::chrono::nanoseconds( 10000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_epoll_10us_fifo >()
+{
+    return MakeEpollTimers( std::chrono::nanoseconds( 10000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_epoll_100us >()
+{
+    return MakeEpollTimers( std::chrono::nanoseconds( 100000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_epoll_100us_fifo >()
+{
+    return MakeEpollTimers( std::chrono::nanoseconds( 100000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_epoll_1ms >()
+{
+    return MakeEpollTimers( std::chrono::nanoseconds( 1000000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_epoll_1ms_fifo >()
+{
+    return MakeEpollTimers( std::chrono::nanoseconds( 1000000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_epoll_10ms >()
+{
+    return MakeEpollTimers( std::chrono::nanoseconds( 10000000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_epoll_10ms_fifo >()
+{
+    return MakeEpollTimers( std::chrono::nanoseconds( 10000000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_asio_1us >()
+{
+    return MakeOvershootTimers< AsioDelay >( std::chrono::nanoseconds( 1000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_asio_1us_fifo >()
+{
+    return MakeOvershootTimers< AsioDelay >( std::chrono::nanoseconds( 1000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_asio_10us >()
+{
+    return MakeOvershootTimers< AsioDelay >( std::chrono::nanoseconds( 10000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_asio_10us_fifo >()
+{
+    return MakeOvershootTimers< AsioDelay >( std::chrono::nanoseconds( 10000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_asio_100us >()
+{
+    return MakeOvershootTimers< AsioDelay >( std::chrono::nanoseconds( 100000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_asio_100us_fifo >()
+{
+    return MakeOvershootTimers< AsioDelay >( std::chrono::nanoseconds( 100000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_asio_1ms >()
+{
+    return MakeOvershootTimers< AsioDelay >( std::chrono::nanoseconds( 1000000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_asio_1ms_fifo >()
+{
+    return MakeOvershootTimers< AsioDelay >( std::chrono::nanoseconds( 1000000 ), true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_asio_10ms >()
+{
+    return MakeOvershootTimers< AsioDelay >( std::chrono::nanoseconds( 10000000 ), false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::timing_asio_10ms_fifo >()
+{
+    return MakeOvershootTimers< AsioDelay >( std::chrono::nanoseconds( 10000000 ), true );
+}
+
+
+} // namespace bench
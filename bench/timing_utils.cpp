@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Support for the timing benchmarks.
+/*! @file
+
+    See timing_utils.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "timing_utils.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <string>
+
+#include "sample_utils.hpp"
+
+
+namespace bench
+{
+
+
+const char *ToCStr( SleepKind kind )
+{
+    switch (kind)
+    {
+#define CASE( n ) \
+    case SleepKind::n: \
+        return #n
+
+    CASE( nanosleep );
+    CASE( abstime );
+    CASE( timerfd );
+    CASE( epoll );
+    CASE( asio );
+
+#undef CASE
+    }
+
+    return nullptr;
+}
+
+
+bool GetTimingParams( Benchmark benchmark, TimingParams &params )
+{
+    switch (benchmark)
+    {
+#define CASE( k, d, ns ) \
+    case Benchmark::timing_##k##_##d: \
+        params = { SleepKind::k, std::chrono::nanoseconds( ns ), false }; \
+        return true; \
+    case Benchmark::timing_##k##_##d##_fifo: \
+        params = { SleepKind::k, std::chrono::nanoseconds( ns ), true }; \
+        return true
+
+#define CASES( k ) \
+    CASE( k, 1us, 1000 ); \
+    CASE( k, 10us, 10000 ); \
+    CASE( k, 100us, 100000 ); \
+    CASE( k, 1ms, 1000000 ); \
+    CASE( k, 10ms, 10000000 )
+
+    CASES( nanosleep );
+    CASES( abstime );
+    CASES( timerfd );
+    CASES( epoll );
+    CASES( asio );
+
+#undef CASES
+#undef CASE
+
+    default:
+        return false;
+    }
+}
+
+
+static SampleSet Overshoots;     // ns
+
+
+void ClearOvershoots()
+{
+    Overshoots.clear();
+}
+
+
+void RecordOvershoot( std::chrono::nanoseconds overshoot )
+{
+    Overshoots.record( overshoot.count() );
+}
+
+
+TimingStats GetOvershootStats()
+{
+    TimingStats stats;
+    stats.samples = Overshoots.size();
+    if (Overshoots.empty()) return stats;
+
+    const std::vector< int64_t > sorted = Overshoots.sorted();
+    stats.p50_ns = Percentile( sorted, 0.50 );
+    stats.p99_ns = Percentile( sorted, 0.99 );
+    stats.max_ns = static_cast< double >( sorted.back() );
+    return stats;
+}
+
+
+    // Formats a request as a whole number of the largest unit that fits.
+static std::string RequestStr( std::chrono::nanoseconds request )
+{
+    const int64_t ns = request.count();
+    if (ns % 1000000 == 0) return std::to_string( ns / 1000000 ) + " ms";
+    if (ns % 1000 == 0) return std::to_string( ns / 1000 ) + " us";
+    return std::to_string( ns ) + " ns";
+}
+
+
+std::ostream &PrintTimingSummary(
+    std::ostream &ostream,
+    const std::vector< TimingResult > &results )
+{
+    std::vector< TimingResult > sorted = results;
+    std::stable_sort( sorted.begin(), sorted.end(),
+        []( const TimingResult &a, const TimingResult &b )
+        {
+            if (a.params.kind != b.params.kind) return a.params.kind < b.params.kind;
+            if (a.params.fifo != b.params.fifo) return !a.params.fifo;
+            return a.params.request < b.params.request;
+        } );
+
+    ostream << "Sleep overshoot (us beyond the request, by steady_clock):\n";
+    ostream << "  " << std::setw( 10 ) << "sleep" << std::setw( 8 ) << "policy"
+        << std::setw( 9 ) << "request" << std::setw( 9 ) << "samples"
+        << std::setw( 10 ) << "p50" << std::setw( 10 ) << "p99" << std::setw( 10 ) << "max"
+        << "\n";
+
+    const auto flags_prev = ostream.flags();
+    const auto precision_prev = ostream.precision( 1 );
+    ostream << std::fixed;
+    for (const TimingResult &result: sorted)
+    {
+        const TimingParams &params = result.params;
+        const TimingStats &stats = result.stats;
+        ostream << "  " << std::setw( 10 ) << ToCStr( params.kind )
+            << std::setw( 8 ) << (params.fifo ? "fifo" : "other")
+            << std::setw( 9 ) << RequestStr( params.request )
+            << std::setw( 9 ) << stats.samples
+            << std::setw( 10 ) << stats.p50_ns * 1e-3
+            << std::setw( 10 ) << stats.p99_ns * 1e-3
+            << std::setw( 10 ) << stats.max_ns * 1e-3 << "\n";
+    }
+
+    ostream.precision( precision_prev );
+    ostream.flags( flags_prev );
+
+    return ostream;
+}
+
+
+} // namespace bench
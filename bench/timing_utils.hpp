@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Support for the timing benchmarks.
+/*! @file
+
+    Each timing_* benchmark records the overshoot of every sleep it makes,
+    beyond the duration requested.  AutoTime reports the mean, while the
+    distribution is printed after the results.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_TIMING_UTILS_HPP
+#define BENCH_TIMING_UTILS_HPP
+
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+#include "list.hpp"
+
+
+namespace bench
+{
+
+
+    //! How a timing_* benchmark sleeps.
+enum class SleepKind
+{
+    nanosleep,  //!< nanosleep(), for a relative duration.
+    abstime,    //!< clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME ), until a deadline.
+    timerfd,    //!< read() of a timerfd, armed for a relative duration.
+    epoll,      //!< epoll_pwait2() with nothing to wait for, which times out.
+    asio        //!< boost::asio::steady_timer::async_wait(), run by an io_service.
+};
+
+
+const char *ToCStr( SleepKind kind );
+
+
+    //! Parameters of a timing_* benchmark.
+struct TimingParams
+{
+    SleepKind kind;
+    std::chrono::nanoseconds request;
+    bool fifo;      //!< Whether it runs under SCHED_FIFO (or else SCHED_OTHER).
+};
+
+
+    //! Returns true and sets params, if benchmark is one of the timing_* benchmarks.
+bool GetTimingParams( Benchmark benchmark, TimingParams &params );
+
+
+    //! Discards the overshoots recorded so far.
+void ClearOvershoots();
+
+    //! Records the amount by which a sleep exceeded its request.
+void RecordOvershoot( std::chrono::nanoseconds overshoot );
+
+
+    //! Distribution of the overshoots recorded since the last ClearOvershoots().
+struct TimingStats
+{
+    size_t samples = 0;
+    double p50_ns = 0.0;
+    double p99_ns = 0.0;
+    double max_ns = 0.0;
+};
+
+TimingStats GetOvershootStats();
+
+
+struct TimingResult
+{
+    TimingParams params;
+    TimingStats stats;
+};
+
+
+    //! Prints the overshoot percentiles by sleep kind, request, and scheduling policy.
+std::ostream &PrintTimingSummary(
+    std::ostream &ostream,
+    const std::vector< TimingResult > &results );
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_TIMING_UTILS_HPP
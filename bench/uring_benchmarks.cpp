@@ -0,0 +1,598 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements uring-category benchmarks.
+/*! @file
+
+    Where the file_read_* & file_write_* benchmarks make one blocking call
+    at a time, these keep a number of requests in flight via io_uring, as an
+    asynchronous storage engine would.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "autotime/time.hpp"
+
+#include "description.hpp"
+#include "dispatch.hpp"
+#include "error_utils.hpp"
+#include "file_utils.hpp"
+#include "list.hpp"
+#include "uring_utils.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::uring >()
+{
+    Description desc;
+    desc.measures = "Time per completion (i.e. 1 / IOPS) of 4 KiB file I/O via io_uring.";
+    desc.detail =
+        "The ring is set up with raw syscalls, rather than liburing.  The file is 64 MiB, in"
+        " the current working directory, and *_qd<N> keeps N requests in flight, queuing"
+        " another as each completes, for 1024 completions per iteration.  The IOPS, bandwidth"
+        " & percentiles of the completion latency (from queuing to reaping) of each"
+        " benchmark's reported run are printed after the results.";
+    desc.notes =
+        {
+            "uring_buffered_* uses the page cache, while uring_direct_* opens the file with"
+                " O_DIRECT.  *_rand* accesses random blocks and *_seq* consecutive ones.",
+            "*_fixed_* registers the buffers & the file with the ring, and uses"
+                " IORING_OP_READ_FIXED & IORING_OP_WRITE_FIXED.",
+            "*_sqpoll_* has a kernel thread poll the submission queue, so submitting doesn't"
+                " need a syscall.  It also registers the file, as SQPOLL requires before Linux"
+                " 5.11.  It's skipped, if the process isn't permitted to use SQPOLL.",
+            "*_fsync_* links each write to an fsync (IOSQE_IO_LINK), and a request completes"
+                " with the fsync.",
+        };
+    desc.limits =
+        {
+            "Buffered reads are served from the page cache, since the file was just written,"
+                " and buffered writes only dirty it.",
+            "The SQPOLL thread needs a core of its own.  On a machine with few cores, it"
+                " competes with the benchmark thread.",
+            "These are skipped if io_uring is unavailable (e.g. disabled by the"
+                " kernel.io_uring_disabled sysctl), and uring_direct_* is skipped if the"
+                " filesystem doesn't support O_DIRECT (e.g. tmpfs).",
+            "Beware that the writes, and especially the fsyncs, cause host writes on the"
+                " device.",
+        };
+    return desc;
+}
+
+
+    // Size of the file that the benchmarks read & write.
+static constexpr size_t File_size = size_t{ 64 } << 20;
+
+    // Completions in each iteration, so the queue stays full for most of it, and the
+    // percentiles have enough samples to mean something.
+static constexpr int Ios_per_iter = 1024;
+
+    // Marks the user_data of a write which is linked to an fsync, whose completion is ignored.
+static constexpr uint64_t Linked_write = uint64_t{ 1 } << 63;
+
+
+    // Creates the file, which is filled with random data and (for O_DIRECT) flushed to disk.
+static ScopedFile MakeUringFile( bool direct )
+{
+    ScopedFile writing = ScopedFile::make_random();
+    FillFile( writing.fd, File_size );
+    if (!direct) return writing;
+
+    if (fsync( writing.fd ) < 0) throw_system_error( errno, "fsync()" );
+    writing.close();
+
+    const int fd = open( writing.filename.c_str(), O_RDWR | O_DIRECT );
+    if (fd < 0)
+    {
+        if (errno == EINVAL)
+        {
+            throw unavailable_error( "The filesystem doesn't support O_DIRECT." );
+        }
+        throw_system_error( errno, "open()" );
+    }
+
+    ScopedFile reading = ScopedFile::make_bound( fd );
+    reading.filename.swap( writing.filename );     // Moves responsibility for the unlink().
+    return reading;
+}
+
+
+    // Keeps a number of reads or writes in flight, each of which uses a buffer of its own.
+class UringJob
+{
+public:
+    explicit UringJob( const UringParams &params )
+    :
+        params_( params ),
+        file_( MakeUringFile( params.direct ) ),
+        ring_( params.depth * (params.fsync ? 2 : 1), params.sqpoll ? IORING_SETUP_SQPOLL : 0 ),
+        fixed_file_( params.fixed || params.sqpoll ),
+        issued_( params.depth )
+    {
+        // Page-aligned, as O_DIRECT usually requires.
+        void *memory = nullptr;
+        if (int err = posix_memalign( &memory, 4096, params.depth * Uring_block_size ))
+        {
+            throw_system_error( err, "posix_memalign()" );
+        }
+        buffers_.reset( static_cast< uint8_t * >( memory ) );
+        std::fill( buffers_.get(), buffers_.get() + params.depth * Uring_block_size, 0x5a );
+
+        if (params.fixed)
+        {
+            std::vector< iovec > iovecs( params.depth );
+            for (int i = 0; i < params.depth; ++i)
+            {
+                iovecs[i].iov_base = buffer( i );
+                iovecs[i].iov_len = Uring_block_size;
+            }
+            ring_.registerBuffers( iovecs.data(), params.depth );
+        }
+
+        // Before Linux 5.11 (IORING_FEAT_SQPOLL_NONFIXED), SQPOLL needs registered files.
+        if (fixed_file_) ring_.registerFiles( &file_.fd, 1 );
+    }
+
+    Durations time( int num_iters )
+    {
+        // AutoTime() reports its last run, so the latencies are of that run, alone.
+        ClearCompletionLatencies();
+
+        const int num_ios = num_iters * Ios_per_iter;
+        const int depth = std::min( params_.depth, num_ios );
+        int queued = 0;
+        int completed = 0;
+
+        TimePoints start_times = Start();
+        for (; queued < depth; ++queued) queue( queued );
+
+        while (completed < num_ios)
+        {
+            ring_.submit( 1 );
+
+            while (io_uring_cqe *cqe = ring_.peekCqe())
+            {
+                const uint64_t user_data = cqe->user_data;
+                const int res = cqe->res;
+                ring_.seenCqe();
+
+                if (res < 0) throw_system_error( -res, "io_uring request" );
+
+                // Each read or write must transfer a whole block, to count as one.  With
+                // fsync, it's the linked write, rather than the completion of the fsync.
+                const bool transfer = !params_.fsync || (user_data & Linked_write);
+                if (transfer && res < static_cast< int >( Uring_block_size ))
+                {
+                    throw std::runtime_error( "io_uring request transferred a partial block." );
+                }
+                if (user_data & Linked_write) continue;
+
+                const int slot = static_cast< int >( user_data );
+                RecordCompletionLatency( std::chrono::steady_clock::now() - issued_[slot] );
+                ++completed;
+
+                if (queued < num_ios)
+                {
+                    queue( slot );
+                    ++queued;
+                }
+            }
+        }
+
+        return End( start_times ) / Ios_per_iter;
+    }
+
+private:
+    uint8_t *buffer( int slot ) { return buffers_.get() + slot * Uring_block_size; }
+
+    uint64_t nextOffset()
+    {
+        const uint64_t num_blocks = File_size / Uring_block_size;
+        if (params_.op == UringOp::seqread || params_.op == UringOp::seqwrite)
+        {
+            next_block_ = (next_block_ + 1) % num_blocks;
+        }
+        else
+        {
+            // xorshift
+            state_ ^= state_ << 13;
+            state_ ^= state_ >> 17;
+            state_ ^= state_ << 5;
+            next_block_ = state_ % num_blocks;
+        }
+
+        return next_block_ * Uring_block_size;
+    }
+
+        // Fills an entry with the read or write for the slot (and its fsync, if linked).
+    void queue( int slot )
+    {
+        const bool read = (params_.op == UringOp::randread || params_.op == UringOp::seqread);
+
+        io_uring_sqe *sqe = ring_.getSqe();
+        if (params_.fixed)
+        {
+            sqe->opcode = read ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+            sqe->buf_index = static_cast< uint16_t >( slot );
+        }
+        else sqe->opcode = read ? IORING_OP_READ : IORING_OP_WRITE;
+        sqe->fd = fixed_file_ ? 0 : file_.fd;   // 0 is the index of the registered file.
+        sqe->flags = fixed_file_ ? IOSQE_FIXED_FILE : 0;
+        sqe->addr = reinterpret_cast< uintptr_t >( buffer( slot ) );
+        sqe->len = Uring_block_size;
+        sqe->off = nextOffset();
+        sqe->user_data = static_cast< uint64_t >( slot );
+
+        if (params_.fsync)
+        {
+            sqe->flags |= IOSQE_IO_LINK;
+            sqe->user_data |= Linked_write;
+
+            io_uring_sqe *sync = ring_.getSqe();
+            sync->opcode = IORING_OP_FSYNC;
+            sync->fd = fixed_file_ ? 0 : file_.fd;
+            sync->flags = fixed_file_ ? IOSQE_FIXED_FILE : 0;
+            sync->user_data = static_cast< uint64_t >( slot );
+        }
+
+        issued_[slot] = std::chrono::steady_clock::now();
+    }
+
+    const UringParams params_;
+    ScopedFile file_;
+    IoUring ring_;
+    const bool fixed_file_;     // Whether the file is registered.
+    std::unique_ptr< uint8_t, decltype( &free ) > buffers_{ nullptr, &free };
+    std::vector< std::chrono::steady_clock::time_point > issued_;     // By slot.
+    uint64_t next_block_ = 0;
+    uint32_t state_ = 2463534242u;
+};
+
+
+static autotime::BenchTimers MakeUringTimers( Benchmark benchmark )
+{
+    using namespace std::placeholders;
+
+    UringParams params;
+    GetUringParams( benchmark, params );
+
+    auto job = std::make_shared< UringJob >( params );
+    return { std::bind( &UringJob::time, job, _1 ), nullptr };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randread_qd1 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randread_qd1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randread_qd4 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randread_qd4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randread_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randread_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randread_qd64 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randread_qd64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randread_qd256 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randread_qd256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqread_qd1 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqread_qd1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqread_qd4 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqread_qd4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqread_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqread_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqread_qd64 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqread_qd64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqread_qd256 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqread_qd256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randwrite_qd1 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randwrite_qd1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randwrite_qd4 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randwrite_qd4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randwrite_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randwrite_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randwrite_qd64 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randwrite_qd64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randwrite_qd256 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randwrite_qd256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqwrite_qd1 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqwrite_qd1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqwrite_qd4 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqwrite_qd4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqwrite_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqwrite_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqwrite_qd64 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqwrite_qd64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqwrite_qd256 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqwrite_qd256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randread_fixed_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randread_fixed_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randwrite_fixed_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randwrite_fixed_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randread_sqpoll_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randread_sqpoll_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_randwrite_sqpoll_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_randwrite_sqpoll_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqwrite_fsync_qd1 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqwrite_fsync_qd1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_buffered_seqwrite_fsync_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_buffered_seqwrite_fsync_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randread_qd1 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randread_qd1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randread_qd4 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randread_qd4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randread_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randread_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randread_qd64 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randread_qd64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randread_qd256 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randread_qd256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqread_qd1 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqread_qd1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqread_qd4 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqread_qd4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqread_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqread_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqread_qd64 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqread_qd64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqread_qd256 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqread_qd256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randwrite_qd1 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randwrite_qd1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randwrite_qd4 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randwrite_qd4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randwrite_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randwrite_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randwrite_qd64 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randwrite_qd64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randwrite_qd256 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randwrite_qd256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqwrite_qd1 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqwrite_qd1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqwrite_qd4 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqwrite_qd4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqwrite_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqwrite_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqwrite_qd64 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqwrite_qd64 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqwrite_qd256 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqwrite_qd256 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randread_fixed_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randread_fixed_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randwrite_fixed_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randwrite_fixed_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randread_sqpoll_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randread_sqpoll_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_randwrite_sqpoll_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_randwrite_sqpoll_qd16 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqwrite_fsync_qd1 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqwrite_fsync_qd1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::uring_direct_seqwrite_fsync_qd16 >()
+{
+    return MakeUringTimers( Benchmark::uring_direct_seqwrite_fsync_qd16 );
+}
+
+
+} // namespace bench
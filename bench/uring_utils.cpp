@@ -0,0 +1,402 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! A minimal io_uring, and support for the uring benchmarks.
+/*! @file
+
+    See uring_utils.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "uring_utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "error_utils.hpp"
+#include "sample_utils.hpp"
+
+
+namespace bench
+{
+
+
+    // Time (ms) an idle SQPOLL thread keeps polling, before it sleeps (and must be woken).
+static constexpr unsigned Sqpoll_idle_ms = 1000;
+
+
+static int UringSetup( unsigned entries, io_uring_params *params )
+{
+    return static_cast< int >( syscall( __NR_io_uring_setup, entries, params ) );
+}
+
+
+static int UringEnter( int fd, unsigned to_submit, unsigned min_complete, unsigned flags )
+{
+    return static_cast< int >(
+        syscall( __NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0 ) );
+}
+
+
+static int UringRegister( int fd, unsigned opcode, const void *arg, unsigned nr_args )
+{
+    return static_cast< int >( syscall( __NR_io_uring_register, fd, opcode, arg, nr_args ) );
+}
+
+
+    // The kernel updates the ring indices concurrently, so access them as atomics.
+static unsigned LoadAcquire( const unsigned *p )
+{
+    return __atomic_load_n( p, __ATOMIC_ACQUIRE );
+}
+
+
+static void StoreRelease( unsigned *p, unsigned value )
+{
+    __atomic_store_n( p, value, __ATOMIC_RELEASE );
+}
+
+
+    // Throws unavailable_error, unless the kernel supports every opcode the benchmarks use.
+static void RequireOpcodes( int fd )
+{
+    // Room for every possible opcode, since ops_len is a byte.
+    std::vector< uint8_t > buffer(
+        sizeof( io_uring_probe ) + 256 * sizeof( io_uring_probe_op ) );
+    io_uring_probe *probe = reinterpret_cast< io_uring_probe * >( buffer.data() );
+    if (UringRegister( fd, IORING_REGISTER_PROBE, probe, 256 ) < 0)
+    {
+        const int err = errno;
+        if (err == EINVAL) throw unavailable_error( "io_uring can't be probed (Linux < 5.6)." );
+        throw_system_error( err, "io_uring_register( IORING_REGISTER_PROBE )" );
+    }
+
+    for (unsigned op: { IORING_OP_READ, IORING_OP_WRITE, IORING_OP_READ_FIXED,
+        IORING_OP_WRITE_FIXED, IORING_OP_FSYNC })
+    {
+        if (op >= probe->ops_len || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED))
+        {
+            throw unavailable_error(
+                "io_uring doesn't support opcode " + std::to_string( op ) + "." );
+        }
+    }
+}
+
+
+IoUring::IoUring( unsigned entries, unsigned flags )
+{
+    io_uring_params params;
+    memset( &params, 0, sizeof( params ) );
+    params.flags = flags;
+    if (flags & IORING_SETUP_SQPOLL) params.sq_thread_idle = Sqpoll_idle_ms;
+
+    fd_ = UringSetup( entries, &params );
+    if (fd_ < 0)
+    {
+        const int err = errno;
+        if (err == ENOSYS) throw unavailable_error( "The kernel doesn't support io_uring." );
+        if (err == EPERM)
+        {
+            if (flags & IORING_SETUP_SQPOLL)
+            {
+                throw unavailable_error( "Not permitted to use io_uring with SQPOLL." );
+            }
+            throw unavailable_error( "io_uring is disabled (see kernel.io_uring_disabled)." );
+        }
+        throw_system_error( err, "io_uring_setup()" );
+    }
+
+    try
+    {
+        if (!(params.features & IORING_FEAT_SINGLE_MMAP))
+        {
+            throw unavailable_error( "io_uring lacks IORING_FEAT_SINGLE_MMAP (Linux < 5.4)." );
+        }
+        RequireOpcodes( fd_ );
+
+        map( params );
+    }
+    catch (...)
+    {
+        unmap();
+        close( fd_ );
+        throw;
+    }
+
+    sqpoll_ = (flags & IORING_SETUP_SQPOLL) != 0;
+}
+
+
+IoUring::~IoUring()
+{
+    unmap();
+    close( fd_ );
+}
+
+
+void IoUring::map( const io_uring_params &params )
+{
+    // Both queues share one mapping, given IORING_FEAT_SINGLE_MMAP.
+    ring_size_ = std::max(
+        params.sq_off.array + params.sq_entries * sizeof( unsigned ),
+        params.cq_off.cqes + params.cq_entries * sizeof( io_uring_cqe ) );
+    void *ring = mmap( nullptr, ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+        fd_, IORING_OFF_SQ_RING );
+    if (ring == MAP_FAILED) throw_system_error( errno, "mmap()" );
+    ring_ = ring;
+
+    sqes_size_ = params.sq_entries * sizeof( io_uring_sqe );
+    void *sqes = mmap( nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+        fd_, IORING_OFF_SQES );
+    if (sqes == MAP_FAILED) throw_system_error( errno, "mmap()" );
+    sqes_ = static_cast< io_uring_sqe * >( sqes );
+
+    char *base = static_cast< char * >( ring_ );
+    sq_head_ = reinterpret_cast< unsigned * >( base + params.sq_off.head );
+    sq_tail_ = reinterpret_cast< unsigned * >( base + params.sq_off.tail );
+    sq_flags_ = reinterpret_cast< unsigned * >( base + params.sq_off.flags );
+    sq_mask_ = *reinterpret_cast< unsigned * >( base + params.sq_off.ring_mask );
+    sq_entries_ = params.sq_entries;
+    cq_head_ = reinterpret_cast< unsigned * >( base + params.cq_off.head );
+    cq_tail_ = reinterpret_cast< unsigned * >( base + params.cq_off.tail );
+    cq_mask_ = *reinterpret_cast< unsigned * >( base + params.cq_off.ring_mask );
+    cqes_ = reinterpret_cast< io_uring_cqe * >( base + params.cq_off.cqes );
+
+    // Each slot of the submission queue always refers to the entry of the same index.
+    unsigned *sq_array = reinterpret_cast< unsigned * >( base + params.sq_off.array );
+    for (unsigned i = 0; i < sq_entries_; ++i) sq_array[i] = i;
+
+    sqe_tail_ = *sq_tail_;
+}
+
+
+void IoUring::unmap()
+{
+    if (sqes_) munmap( sqes_, sqes_size_ );
+    if (ring_) munmap( ring_, ring_size_ );
+    sqes_ = nullptr;
+    ring_ = nullptr;
+}
+
+
+io_uring_sqe *IoUring::getSqe()
+{
+    if (sqe_tail_ - LoadAcquire( sq_head_ ) >= sq_entries_) return nullptr;
+
+    io_uring_sqe *sqe = &sqes_[sqe_tail_ & sq_mask_];
+    ++sqe_tail_;
+
+    memset( sqe, 0, sizeof( *sqe ) );
+    return sqe;
+}
+
+
+void IoUring::submit( unsigned wait_nr )
+{
+    StoreRelease( sq_tail_, sqe_tail_ );
+
+    unsigned flags = wait_nr ? IORING_ENTER_GETEVENTS : 0;
+    if (sqpoll_)
+    {
+        // The polling thread submits the entries, unless it's gone to sleep.  The fence orders
+        // the store of the tail before the load of the flags, as the kernel expects.
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        if (__atomic_load_n( sq_flags_, __ATOMIC_RELAXED ) & IORING_SQ_NEED_WAKEUP)
+        {
+            flags |= IORING_ENTER_SQ_WAKEUP;
+        }
+        if (!flags) return;
+    }
+
+    for (;;)
+    {
+        // Anything the kernel hasn't yet consumed, so a retry doesn't resubmit.
+        const unsigned to_submit = sqpoll_ ? 0 : sqe_tail_ - LoadAcquire( sq_head_ );
+        if (!to_submit && !flags) return;
+
+        if (UringEnter( fd_, to_submit, wait_nr, flags ) >= 0) return;
+        if (errno != EINTR) throw_system_error( errno, "io_uring_enter()" );
+    }
+}
+
+
+io_uring_cqe *IoUring::peekCqe()
+{
+    const unsigned head = *cq_head_;
+    if (head == LoadAcquire( cq_tail_ )) return nullptr;
+
+    return &cqes_[head & cq_mask_];
+}
+
+
+void IoUring::seenCqe()
+{
+    StoreRelease( cq_head_, *cq_head_ + 1 );
+}
+
+
+void IoUring::registerBuffers( const iovec *iovecs, unsigned num_iovecs )
+{
+    if (UringRegister( fd_, IORING_REGISTER_BUFFERS, iovecs, num_iovecs ) < 0)
+    {
+        if (errno == ENOMEM)
+        {
+            throw unavailable_error( "Couldn't register buffers (see RLIMIT_MEMLOCK)." );
+        }
+        throw_system_error( errno, "io_uring_register( IORING_REGISTER_BUFFERS )" );
+    }
+}
+
+
+void IoUring::registerFiles( const int *fds, unsigned num_fds )
+{
+    if (UringRegister( fd_, IORING_REGISTER_FILES, fds, num_fds ) < 0)
+    {
+        throw_system_error( errno, "io_uring_register( IORING_REGISTER_FILES )" );
+    }
+}
+
+
+const char *ToCStr( UringOp op )
+{
+    switch (op)
+    {
+#define CASE( n ) \
+    case UringOp::n: \
+        return #n
+
+    CASE( randread );
+    CASE( seqread );
+    CASE( randwrite );
+    CASE( seqwrite );
+
+#undef CASE
+    }
+
+    return nullptr;
+}
+
+
+bool GetUringParams( Benchmark benchmark, UringParams &params )
+{
+    switch (benchmark)
+    {
+#define CASE( name, o, direct, depth, fixed, sqpoll, fsync ) \
+    case Benchmark::name: \
+        params = { UringOp::o, direct, depth, fixed, sqpoll, fsync }; \
+        return true
+
+#define DEPTHS( m, o, direct ) \
+    CASE( uring_##m##_##o##_qd1, o, direct, 1, false, false, false ); \
+    CASE( uring_##m##_##o##_qd4, o, direct, 4, false, false, false ); \
+    CASE( uring_##m##_##o##_qd16, o, direct, 16, false, false, false ); \
+    CASE( uring_##m##_##o##_qd64, o, direct, 64, false, false, false ); \
+    CASE( uring_##m##_##o##_qd256, o, direct, 256, false, false, false )
+
+#define CASES( m, direct ) \
+    DEPTHS( m, randread, direct ); \
+    DEPTHS( m, seqread, direct ); \
+    DEPTHS( m, randwrite, direct ); \
+    DEPTHS( m, seqwrite, direct ); \
+    CASE( uring_##m##_randread_fixed_qd16, randread, direct, 16, true, false, false ); \
+    CASE( uring_##m##_randwrite_fixed_qd16, randwrite, direct, 16, true, false, false ); \
+    CASE( uring_##m##_randread_sqpoll_qd16, randread, direct, 16, false, true, false ); \
+    CASE( uring_##m##_randwrite_sqpoll_qd16, randwrite, direct, 16, false, true, false ); \
+    CASE( uring_##m##_seqwrite_fsync_qd1, seqwrite, direct, 1, false, false, true ); \
+    CASE( uring_##m##_seqwrite_fsync_qd16, seqwrite, direct, 16, false, false, true )
+
+    CASES( buffered, false );
+    CASES( direct, true );
+
+#undef CASES
+#undef DEPTHS
+#undef CASE
+
+    default:
+        return false;
+    }
+}
+
+
+static SampleSet Latencies;      // ns
+
+
+void ClearCompletionLatencies()
+{
+    Latencies.clear();
+}
+
+
+void RecordCompletionLatency( std::chrono::nanoseconds latency )
+{
+    Latencies.record( latency.count() );
+}
+
+
+UringLatencyStats GetCompletionLatencyStats()
+{
+    UringLatencyStats stats;
+    stats.samples = Latencies.size();
+    if (Latencies.empty()) return stats;
+
+    const std::vector< int64_t > sorted = Latencies.sorted();
+    stats.p50_ns = Percentile( sorted, 0.50 );
+    stats.p90_ns = Percentile( sorted, 0.90 );
+    stats.p99_ns = Percentile( sorted, 0.99 );
+    stats.p999_ns = Percentile( sorted, 0.999 );
+    stats.max_ns = static_cast< double >( sorted.back() );
+    return stats;
+}
+
+
+std::ostream &PrintUringSummary(
+    std::ostream &ostream,
+    const std::vector< UringResult > &results )
+{
+    ostream << "io_uring throughput & completion latency (us), with "
+        << Uring_block_size << " byte blocks:\n";
+    ostream << "  " << std::setw( 38 ) << std::left << "benchmark" << std::right
+        << std::setw( 10 ) << "kIOPS" << std::setw( 9 ) << "MB/s"
+        << std::setw( 9 ) << "p50" << std::setw( 9 ) << "p90" << std::setw( 9 ) << "p99"
+        << std::setw( 9 ) << "p99.9" << std::setw( 9 ) << "max" << "\n";
+
+    const auto flags_prev = ostream.flags();
+    const auto precision_prev = ostream.precision( 1 );
+    ostream << std::fixed;
+    for (const UringResult &result: results)
+    {
+        const double iops = (result.ns_per_io > 0.0) ? 1e9 / result.ns_per_io : 0.0;
+        const UringLatencyStats &latency = result.latency;
+        ostream << "  " << std::setw( 38 ) << std::left << ToCStr( result.benchmark )
+            << std::right
+            << std::setw( 10 ) << iops * 1e-3
+            << std::setw( 9 ) << iops * Uring_block_size * 1e-6
+            << std::setw( 9 ) << latency.p50_ns * 1e-3
+            << std::setw( 9 ) << latency.p90_ns * 1e-3
+            << std::setw( 9 ) << latency.p99_ns * 1e-3
+            << std::setw( 9 ) << latency.p999_ns * 1e-3
+            << std::setw( 9 ) << latency.max_ns * 1e-3 << "\n";
+    }
+
+    ostream.precision( precision_prev );
+    ostream.flags( flags_prev );
+
+    return ostream;
+}
+
+
+} // namespace bench
@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! A minimal io_uring, and support for the uring benchmarks.
+/*! @file
+
+    IoUring sets up a ring with the raw io_uring_setup(), io_uring_enter()
+    & io_uring_register() syscalls, rather than depending on liburing.  It
+    covers only what the benchmarks need.
+
+    Each uring_* benchmark records the latency of every completion, from
+    the time its request was queued.  AutoTime reports the time per
+    completion (i.e. the inverse of IOPS), while the distribution is
+    printed after the results.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_URING_UTILS_HPP
+#define BENCH_URING_UTILS_HPP
+
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+
+#include "list.hpp"
+
+
+namespace bench
+{
+
+
+    //! A submission & completion queue pair, shared with the kernel.
+    /*!
+        This is for use by a single thread.  Any of the members may throw
+        std::system_error, upon failure.
+    */
+class IoUring
+{
+public:
+        //! Sets up a ring with (at least) the specified number of submission queue entries.
+        /*!
+            @throws unavailable_error, if the kernel lacks io_uring (or it's
+            disabled) or any of the read, write & fsync opcodes, or flags
+            requests SQPOLL and that's not permitted.
+        */
+    explicit IoUring( unsigned entries, unsigned flags = 0 );
+    ~IoUring();
+
+    IoUring( const IoUring & ) = delete;
+    IoUring &operator=( const IoUring & ) = delete;
+
+        //! Returns a zeroed entry to fill, or nullptr if the submission queue is full.
+    io_uring_sqe *getSqe();
+
+        //! Submits the entries filled since the last call, and waits for wait_nr completions.
+    void submit( unsigned wait_nr = 0 );
+
+        //! Returns the oldest unconsumed completion, or nullptr if there are none.
+    io_uring_cqe *peekCqe();
+
+        //! Consumes the completion returned by peekCqe().
+    void seenCqe();
+
+        //! Registers buffers, for IORING_OP_READ_FIXED & IORING_OP_WRITE_FIXED.
+        /*!
+            @throws unavailable_error, if the buffers exceed RLIMIT_MEMLOCK.
+        */
+    void registerBuffers( const iovec *iovecs, unsigned num_iovecs );
+
+        //! Registers files, which entries with IOSQE_FIXED_FILE refer to by index.
+    void registerFiles( const int *fds, unsigned num_fds );
+
+private:
+    void map( const io_uring_params &params );
+    void unmap();
+
+    int fd_ = -1;
+    bool sqpoll_ = false;
+
+    void *ring_ = nullptr;
+    size_t ring_size_ = 0;
+    io_uring_sqe *sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+
+    // Pointers into the ring, which the kernel also accesses.
+    unsigned *sq_head_ = nullptr;
+    unsigned *sq_tail_ = nullptr;
+    unsigned *sq_flags_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned sq_entries_ = 0;
+    unsigned *cq_head_ = nullptr;
+    unsigned *cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe *cqes_ = nullptr;
+
+    unsigned sqe_tail_ = 0;     // Of the entries returned by getSqe(), not yet submitted.
+};
+
+
+    //! Access pattern of a uring_* benchmark.
+enum class UringOp
+{
+    randread,   //!< Reads of random blocks.
+    seqread,    //!< Reads of consecutive blocks, wrapping at the end of the file.
+    randwrite,  //!< Writes of random blocks.
+    seqwrite    //!< Writes of consecutive blocks, wrapping at the end of the file.
+};
+
+
+const char *ToCStr( UringOp op );
+
+
+    //! Size of every read & write, by the uring_* benchmarks.
+static constexpr size_t Uring_block_size = 4096;
+
+
+    //! Parameters of a uring_* benchmark.
+struct UringParams
+{
+    UringOp op;
+    bool direct;    //!< Whether the file is opened with O_DIRECT.
+    int depth;      //!< Number of requests kept in flight.
+    bool fixed;     //!< Whether the buffers & file are registered.
+    bool sqpoll;    //!< Whether a kernel thread polls the submission queue.
+    bool fsync;     //!< Whether each write is linked to an fsync.
+};
+
+
+    //! Returns true and sets params, if benchmark is one of the uring_* benchmarks.
+bool GetUringParams( Benchmark benchmark, UringParams &params );
+
+
+    //! Discards the completion latencies recorded so far.
+void ClearCompletionLatencies();
+
+    //! Records the time from queuing a request to reaping its completion.
+void RecordCompletionLatency( std::chrono::nanoseconds latency );
+
+
+    //! Distribution of the latencies recorded since the last ClearCompletionLatencies().
+struct UringLatencyStats
+{
+    size_t samples = 0;
+    double p50_ns = 0.0;
+    double p90_ns = 0.0;
+    double p99_ns = 0.0;
+    double p999_ns = 0.0;
+    double max_ns = 0.0;
+};
+
+UringLatencyStats GetCompletionLatencyStats();
+
+
+struct UringResult
+{
+    Benchmark benchmark;
+    UringParams params;
+    double ns_per_io;
+    UringLatencyStats latency;
+};
+
+
+    //! Prints the IOPS, bandwidth & completion latency percentiles of each benchmark.
+std::ostream &PrintUringSummary(
+    std::ostream &ostream,
+    const std::vector< UringResult > &results );
+
+
+} // namespace bench
+
+
+#endif  // ndef BENCH_URING_UTILS_HPP
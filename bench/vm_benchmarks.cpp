@@ -0,0 +1,472 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements vm-category benchmarks.
+/*! @file
+
+    These measure page faults and the virtual memory operations which cause or avoid them.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "dispatch.hpp"
+
+#include "autotime/os.hpp"
+#include "autotime/overhead.hpp"
+#include "autotime/time.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sys/mman.h>
+
+#include "description.hpp"
+#include "error_utils.hpp"
+#include "file_utils.hpp"
+#include "page_utils.hpp"
+#include "thread_utils.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::vm >()
+{
+    Description desc;
+    desc.measures = "Page faults and virtual memory operations, on private mappings.";
+    desc.notes =
+        {
+            "vm_fault_* is the cost of the first touch of one page, which is a minor fault."
+                "  _anon_4k & _anon_thp touch anonymous memory, with 4 KiB or 2 MiB pages, while"
+                " _file_4k reads a file that's already in the page cache.",
+            "vm_mmap_populate_* maps memory with MAP_POPULATE, while vm_mmap_touch_* faults each"
+                " page on first touch.  Both include the munmap().",
+            "vm_munmap_<n>t unmaps a 4 KiB page, while n - 1 other threads of the process spin"
+                " on other cores.  Each of those must have its TLB shot down.",
+            "vm_madvise_* discards 1 MiB of touched memory, which must be faulted back in.",
+            "vm_mprotect_* toggles write access to a touched region.",
+            "vm_mremap_grow_* doubles the size of a mapping, which moves page table entries"
+                " instead of data.  vm_realloc_grow_* does the same with realloc(), and"
+                " vm_copy_grow_* allocates, copies, and frees.",
+        };
+    desc.limits =
+        {
+            "For file mappings, the kernel maps neighboring pages on each fault (i.e."
+                " fault-around), so fewer faults are taken than pages are touched.",
+            "glibc's realloc() uses mremap() for blocks above its mmap threshold, so"
+                " vm_realloc_grow_* typically differs from vm_copy_grow_*.",
+            "Thread counts exceeding the number of online cores don't cause additional"
+                " shootdowns.",
+        };
+    return desc;
+}
+
+
+    // The largest region faulted in at once, to bound memory usage at high iteration counts.
+static constexpr size_t Fault_chunk_size = size_t{ 1 } << 26;
+
+static constexpr size_t Small_page_size = 4096;
+
+
+static void TouchPages( void *data, size_t size, size_t page_size )
+{
+    volatile uint8_t *const p = static_cast< uint8_t * >( data );
+    for (size_t offset = 0; offset < size; offset += page_size) p[offset] = 1;
+}
+
+
+    // Each iteration faults one page of anonymous memory.
+static Durations AnonFaultTimer( PageKind kind, int num_iters )
+{
+    const size_t page_size = PageSize( kind );
+    const size_t chunk_pages = Fault_chunk_size / page_size;
+
+    Durations durations{};
+    for (size_t remaining = num_iters; remaining > 0; )
+    {
+        const size_t n = std::min( remaining, chunk_pages );
+        PageMapping mapping( n * page_size, kind, false );
+
+        TimePoints start_times = Start();
+        TouchPages( mapping.data(), n * page_size, page_size );
+        durations += End( start_times );
+
+        remaining -= n;
+    }
+
+    return durations;
+}
+
+
+static void *MMap( void *addr, size_t size, int prot, int flags, int fd )
+{
+    void *p = mmap( addr, size, prot, flags, fd, 0 );
+    if (p == MAP_FAILED) throw_system_error( errno, "mmap()" );
+
+    return p;
+}
+
+
+static void MUnmap( void *addr, size_t size )
+{
+    if (munmap( addr, size ) != 0) throw_system_error( errno, "munmap()" );
+}
+
+
+    // Each iteration reads one page of a file mapping, whose contents are in the page cache.
+static Durations FileFaultTimer( std::shared_ptr< ScopedFile > file, int num_iters )
+{
+    const size_t chunk_pages = Fault_chunk_size / Small_page_size;
+
+    Durations durations{};
+    uint8_t sum = 0;
+    for (size_t remaining = num_iters; remaining > 0; )
+    {
+        const size_t n = std::min( remaining, chunk_pages );
+        const size_t size = n * Small_page_size;
+        void *data = MMap( nullptr, size, PROT_READ, MAP_PRIVATE, file->fd );
+        const volatile uint8_t *const p = static_cast< const uint8_t * >( data );
+
+        TimePoints start_times = Start();
+        for (size_t offset = 0; offset < size; offset += Small_page_size) sum += p[offset];
+        durations += End( start_times );
+
+        MUnmap( data, size );
+        remaining -= n;
+    }
+
+    return durations;
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_fault_anon_4k >()
+{
+    using namespace std::placeholders;
+    return { std::bind( &AnonFaultTimer, PageKind::small, _1 ), nullptr };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_fault_anon_thp >()
+{
+    using namespace std::placeholders;
+
+    // Fail here, rather than in the timer, if THP is disabled.
+    PageMapping( PageSize( PageKind::thp ), PageKind::thp, false );
+
+    return { std::bind( &AnonFaultTimer, PageKind::thp, _1 ), nullptr };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_fault_file_4k >()
+{
+    using namespace std::placeholders;
+
+    std::shared_ptr< ScopedFile > file =
+        std::make_shared< ScopedFile >( ScopedFile::make_random() );
+    FillFile( file->fd, Fault_chunk_size );
+
+    return { std::bind( &FileFaultTimer, file, _1 ), nullptr };
+}
+
+
+static autotime::BenchTimers MakeMMapTimers( size_t size, bool populate )
+{
+    std::function< void() > f = [size, populate]()
+        {
+            const int flags = MAP_PRIVATE | MAP_ANONYMOUS | (populate ? MAP_POPULATE : 0);
+            void *data = MMap( nullptr, size, PROT_READ | PROT_WRITE, flags, -1 );
+            if (!populate) TouchPages( data, size, Small_page_size );
+            MUnmap( data, size );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_mmap_populate_1M >()
+{
+    return MakeMMapTimers( size_t{ 1 } << 20, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_mmap_populate_16M >()
+{
+    return MakeMMapTimers( size_t{ 1 } << 24, true );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_mmap_touch_1M >()
+{
+    return MakeMMapTimers( size_t{ 1 } << 20, false );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_mmap_touch_16M >()
+{
+    return MakeMMapTimers( size_t{ 1 } << 24, false );
+}
+
+
+    // Threads which spin on other cores, so that the process' mm is active on them.
+class SpinningThreads
+{
+public:
+    explicit SpinningThreads( int num_threads )
+    {
+        // Start the threads and wait until each is on its core.
+        for (int i = 1; i < num_threads; ++i)
+        {
+            std::promise< void > started_promise;
+            std::future< void > started_future = started_promise.get_future();
+            threads_.emplace_back(
+                &SpinningThreads::threadfunc, this, GetRoundRobinCoreId( i ),
+                std::move( started_promise ) );
+            started_future.get();
+        }
+    }
+
+    ~SpinningThreads()
+    {
+        stop_ = true;
+        for (std::thread &thread: threads_) thread.join();
+    }
+
+private:
+    void threadfunc( int core, std::promise< void > started_promise )
+    {
+        if (core >= 0) SetCoreAffinity( core );
+        started_promise.set_value();
+
+        while (!stop_.load( std::memory_order_relaxed )) {}
+    }
+
+    std::atomic< bool > stop_{ false };
+    std::vector< std::thread > threads_;
+};
+
+
+static autotime::BenchTimers MakeMUnmapTimers( int num_threads )
+{
+    std::shared_ptr< SpinningThreads > threads = std::make_shared< SpinningThreads >( num_threads );
+
+    std::function< void( TimingState & ) > f = [threads]( TimingState &state )
+        {
+            state.pause();
+            void *data = MMap(
+                nullptr, Small_page_size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1 );
+            state.resume();
+
+            MUnmap( data, Small_page_size );
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void, TimingState & >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_munmap_1t >()
+{
+    return MakeMUnmapTimers( 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_munmap_2t >()
+{
+    return MakeMUnmapTimers( 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_munmap_4t >()
+{
+    return MakeMUnmapTimers( 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_munmap_8t >()
+{
+    return MakeMUnmapTimers( 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_munmap_16t >()
+{
+    return MakeMUnmapTimers( 16 );
+}
+
+
+static autotime::BenchTimers MakeMAdviseTimers( int advice )
+{
+    constexpr size_t size = size_t{ 1 } << 20;
+    std::shared_ptr< PageMapping > mapping = MapPages( size, PageKind::small );
+
+    std::function< void( TimingState & ) > f = [mapping, advice]( TimingState &state )
+        {
+            state.pause();
+            TouchPages( mapping->data(), size, Small_page_size );
+            state.resume();
+
+            if (madvise( mapping->data(), size, advice ) != 0)
+            {
+                throw_system_error( errno, "madvise()" );
+            }
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void, TimingState & >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_madvise_dontneed_1M >()
+{
+    return MakeMAdviseTimers( MADV_DONTNEED );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_madvise_free_1M >()
+{
+    return MakeMAdviseTimers( MADV_FREE );
+}
+
+
+static autotime::BenchTimers MakeMProtectTimers( size_t size )
+{
+    std::shared_ptr< PageMapping > mapping = MapPages( size, PageKind::small );
+    std::shared_ptr< bool > writable = std::make_shared< bool >( true );
+
+    std::function< void() > f = [mapping, writable]()
+        {
+            *writable = !*writable;
+            const int prot = *writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+            if (mprotect( mapping->data(), mapping->size(), prot ) != 0)
+            {
+                throw_system_error( errno, "mprotect()" );
+            }
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_mprotect_4k >()
+{
+    return MakeMProtectTimers( size_t{ 1 } << 12 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_mprotect_1M >()
+{
+    return MakeMProtectTimers( size_t{ 1 } << 20 );
+}
+
+
+enum class GrowMethod
+{
+    mremap,
+    realloc,
+    copy
+};
+
+
+static autotime::BenchTimers MakeGrowTimers( size_t size, GrowMethod method )
+{
+    std::function< void( TimingState & ) > f = [size, method]( TimingState &state )
+        {
+            state.pause();
+            void *data = nullptr;
+            if (method == GrowMethod::mremap)
+            {
+                data = MMap(
+                    nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1 );
+            }
+            else
+            {
+                data = malloc( size );
+                if (!data) throw std::bad_alloc();
+                memset( data, 1, size );
+            }
+            state.resume();
+
+            void *grown = nullptr;
+            switch (method)
+            {
+            case GrowMethod::mremap:
+                grown = mremap( data, size, 2 * size, MREMAP_MAYMOVE );
+                if (grown == MAP_FAILED) throw_system_error( errno, "mremap()" );
+                break;
+
+            case GrowMethod::realloc:
+                grown = realloc( data, 2 * size );
+                if (!grown) throw std::bad_alloc();
+                break;
+
+            case GrowMethod::copy:
+                grown = malloc( 2 * size );
+                if (!grown) throw std::bad_alloc();
+                memcpy( grown, data, size );
+                free( data );
+                break;
+            }
+
+            state.pause();
+            if (method == GrowMethod::mremap) MUnmap( grown, 2 * size );
+            else free( grown );
+            state.resume();
+        };
+
+    return { MakeTimer( f ), MakeTimer( MakeOverheadFn< void, TimingState & >() ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_mremap_grow_1M >()
+{
+    return MakeGrowTimers( size_t{ 1 } << 20, GrowMethod::mremap );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_mremap_grow_64M >()
+{
+    return MakeGrowTimers( size_t{ 1 } << 26, GrowMethod::mremap );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_realloc_grow_1M >()
+{
+    return MakeGrowTimers( size_t{ 1 } << 20, GrowMethod::realloc );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_realloc_grow_64M >()
+{
+    return MakeGrowTimers( size_t{ 1 } << 26, GrowMethod::realloc );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_copy_grow_1M >()
+{
+    return MakeGrowTimers( size_t{ 1 } << 20, GrowMethod::copy );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::vm_copy_grow_64M >()
+{
+    return MakeGrowTimers( size_t{ 1 } << 26, GrowMethod::copy );
+}
+
+
+} // namespace bench
@@ -0,0 +1,599 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements wakeup-category benchmarks.
+/*! @file
+
+    These isolate the primitives beneath condition variables and thread
+    handoffs: putting a thread to sleep in the kernel, and waking it from
+    another core.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "autotime/os.hpp"
+#include "autotime/overhead.hpp"
+#include "autotime/time.hpp"
+
+#include "description.hpp"
+#include "dispatch.hpp"
+#include "error_utils.hpp"
+#include "list.hpp"
+#include "thread_utils.hpp"
+
+
+using namespace autotime;
+
+namespace bench
+{
+
+
+template<> Description Describe< Category::wakeup >()
+{
+    Description desc;
+    desc.measures = "Cost & latency of putting a thread to sleep, and of waking it.";
+    desc.detail =
+        "The futex benchmarks call FUTEX_WAIT_PRIVATE & FUTEX_WAKE_PRIVATE via syscall(), and"
+        " the eventfd benchmarks block in read() until another thread write()s.  The other"
+        " thread runs on the secondary core.";
+    desc.notes =
+        {
+            "wakeup_futex_wake_no_waiters is the cost of waking a futex nobody waits on, which"
+                " a lock or event pays whenever it can't tell there are no waiters."
+                "  wakeup_futex_wait_mismatch is a FUTEX_WAIT that returns immediately, because"
+                " the futex no longer has the expected value.",
+            "wakeup_*_pingpong is the round trip, where each thread wakes the other and then"
+                " sleeps until it's woken in return.  The futex version wakes unconditionally.",
+            "wakeup_*_latency is the time from a wake to the sleeping thread running, after"
+                " giving it 50 us to get to sleep.",
+            "wakeup_park_spin<N> is a ping-pong where each thread spins for up to N PAUSEs,"
+                " waiting to be woken, before sleeping on a futex, and a thread only makes the"
+                " FUTEX_WAKE syscall when the other is asleep.  In *_reply10us, the"
+                " secondary thread spins for 10 us before replying, which is excluded from the"
+                " real time.",
+            "wakeup_futex_herd_<N> has N threads sleeping on one futex, and is the time from"
+                " waking them all to the last of them running.",
+        };
+    desc.limits =
+        {
+            "The duration of a PAUSE varies widely between CPU models (e.g. about 10 cycles"
+                " before Skylake, and 140 after).",
+            "A thread that's slow to get to sleep, in wakeup_*_latency and wakeup_futex_herd_*,"
+                " skips the wake and underestimates its latency.",
+            "Thread counts exceeding the number of online cores oversubscribe them, which"
+                " measures scheduling more than waking.",
+        };
+    return desc;
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_futex_wake_no_waiters >()
+{
+    void (*f)() = []()
+        {
+            static std::atomic< int > word{ 0 };
+            FutexWake( word, 1 );
+        };
+
+    return { MakeTimer( f ), MakeTimer( &Overhead_void<> ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_futex_wait_mismatch >()
+{
+    void (*f)() = []()
+        {
+            static std::atomic< int > word{ 0 };
+            FutexWait( word, 1 );
+        };
+
+    return { MakeTimer( f ), MakeTimer( &Overhead_void<> ) };
+}
+
+
+    // Wakes a single waiter, with a futex syscall on every post.
+class FutexSignal
+{
+public:
+    void wait()
+    {
+        while (word_.exchange( 0, std::memory_order_acquire ) == 0) FutexWait( word_, 0 );
+    }
+
+    void post()
+    {
+        word_.store( 1, std::memory_order_release );
+        FutexWake( word_, 1 );
+    }
+
+private:
+    std::atomic< int > word_{ 0 };
+};
+
+
+    // Wakes a single waiter, blocked in read() of an eventfd.
+class EventfdSignal
+{
+public:
+    EventfdSignal()
+    :
+        fd_( eventfd( 0, EFD_CLOEXEC ) )
+    {
+        if (fd_ < 0) throw_system_error( errno, "eventfd()" );
+    }
+
+    ~EventfdSignal()
+    {
+        close( fd_ );
+    }
+
+    void wait()
+    {
+        uint64_t count = 0;
+        while (read( fd_, &count, sizeof( count ) ) != sizeof( count ));
+    }
+
+    void post()
+    {
+        const uint64_t count = 1;
+        while (write( fd_, &count, sizeof( count ) ) != sizeof( count ));
+    }
+
+private:
+    const int fd_;
+};
+
+
+    // Spins for a budget of PAUSEs and then sleeps, like a parking lot.  The waker only makes a
+    // syscall when the waiter has announced that it's sleeping.
+class ParkSignal
+{
+public:
+    explicit ParkSignal( int spin_budget )
+    :
+        spin_budget_( spin_budget )
+    {
+    }
+
+    void wait()
+    {
+        for (int i = 0; i < spin_budget_; ++i)
+        {
+            if (state_.load( std::memory_order_acquire ) == Notified) break;
+            CpuRelax();
+        }
+
+        int state = Empty;
+        if (state_.compare_exchange_strong( state, Parked, std::memory_order_acquire ))
+        {
+            do FutexWait( state_, Parked );
+            while (state_.load( std::memory_order_acquire ) == Parked);
+        }
+
+        state_.store( Empty, std::memory_order_relaxed );
+    }
+
+    void post()
+    {
+        if (state_.exchange( Notified, std::memory_order_release ) == Parked)
+        {
+            FutexWake( state_, 1 );
+        }
+    }
+
+private:
+    enum { Empty, Notified, Parked };
+
+    const int spin_budget_;
+    std::atomic< int > state_{ Empty };
+};
+
+
+    // Base of the harnesses with a thread on the secondary core, which runs serve().
+class Sleeper
+{
+public:
+    virtual ~Sleeper() = default;
+
+protected:
+    void start()
+    {
+        std::promise< void > started_promise;
+        std::future< void > started_future = started_promise.get_future();
+        thread_ = std::thread( &Sleeper::threadfunc, this, std::move( started_promise ) );
+        started_future.get();
+    }
+
+        // Must be called by the destructor of the derived class, after waking serve() with
+        // stop_ set.
+    void join()
+    {
+        thread_.join();
+    }
+
+    virtual void serve() = 0;
+
+    std::atomic< bool > stop_{ false };
+
+private:
+    void threadfunc( std::promise< void > started_promise )
+    {
+        SetCoreAffinity( GetSecondaryCoreId() );
+        started_promise.set_value();
+        serve();
+    }
+
+    std::thread thread_;
+};
+
+
+    // Wakes the secondary core, which wakes this one in return.
+template<
+    typename Signal
+>
+class SignalPingPong: public Sleeper
+{
+public:
+    template<
+        typename... Args
+    >
+    explicit SignalPingPong( std::chrono::nanoseconds reply_delay, Args... args )
+    :
+        reply_delay_( reply_delay ),
+        ping_( args... ),
+        pong_( args... )
+    {
+        start();
+    }
+
+    ~SignalPingPong()
+    {
+        stop_ = true;
+        ping_.post();
+        join();
+    }
+
+    Durations time( int num_iters )
+    {
+        TimePoints start_times = Start();
+        for (int i = 0; i < num_iters; ++i)
+        {
+            ping_.post();
+            pong_.wait();
+        }
+        Durations durs = End( start_times );
+
+        // This thread is blocked during the reply delay, so it only counts in real time.
+        durs.real -= std::chrono::duration_cast< steady_clock::duration >(
+            reply_delay_ * num_iters );
+        return durs;
+    }
+
+private:
+    void serve() override
+    {
+        for (;;)
+        {
+            ping_.wait();
+            if (stop_) return;
+
+            if (reply_delay_.count()) SpinFor( reply_delay_ );
+            pong_.post();
+        }
+    }
+
+    const std::chrono::nanoseconds reply_delay_;
+    Signal ping_;
+    Signal pong_;
+};
+
+
+    // Time given to a thread to get to sleep, before it's woken.
+static constexpr std::chrono::microseconds Settle_time{ 50 };
+
+
+    // Wakes the secondary core, which accumulates the time until it runs.
+template<
+    typename Signal
+>
+class WakeLatency: public Sleeper
+{
+public:
+    WakeLatency() { start(); }
+
+    ~WakeLatency()
+    {
+        stop_ = true;
+        signal_.post();
+        join();
+    }
+
+    Durations time( int num_iters )
+    {
+        uint64_t received = received_.load( std::memory_order_acquire );
+        const uint64_t latency_start = latency_.load( std::memory_order_relaxed );
+
+        TimePoints start_times = Start();
+        for (int i = 0; i < num_iters; ++i)
+        {
+            SpinWait wait;
+            while (!asleep_.load( std::memory_order_acquire )) wait();
+            std::this_thread::sleep_for( Settle_time );
+            asleep_.store( false, std::memory_order_relaxed );
+
+            sent_.store( Now(), std::memory_order_relaxed );
+            signal_.post();
+
+            ++received;
+            wait = SpinWait{};
+            while (received_.load( std::memory_order_acquire ) != received) wait();
+        }
+        Durations durs = End( start_times );
+
+        const uint64_t latency = latency_.load( std::memory_order_relaxed ) - latency_start;
+        durs.real = std::chrono::duration_cast< steady_clock::duration >(
+            steady_clock::duration( latency ) );
+        return durs;
+    }
+
+private:
+    void serve() override
+    {
+        for (;;)
+        {
+            asleep_.store( true, std::memory_order_release );
+            signal_.wait();
+            if (stop_) return;
+
+            // Only this thread writes either, and the release publishes the latency.
+            const uint64_t latency = Now() - sent_.load( std::memory_order_relaxed );
+            latency_.store( latency_.load( std::memory_order_relaxed ) + latency,
+                std::memory_order_relaxed );
+            received_.store( received_.load( std::memory_order_relaxed ) + 1,
+                std::memory_order_release );
+        }
+    }
+
+    Signal signal_;
+    std::atomic< bool > asleep_{ false };
+    std::atomic< uint64_t > sent_{ 0 };     // steady_clock ticks
+    std::atomic< uint64_t > received_{ 0 };
+    std::atomic< uint64_t > latency_{ 0 };  // steady_clock ticks
+};
+
+
+template<
+    typename Signal,
+    typename... Args
+>
+static autotime::BenchTimers MakePingPongTimers(
+    std::chrono::nanoseconds reply_delay, Args... args )
+{
+    using namespace std::placeholders;
+    auto ping_pong = std::make_shared< SignalPingPong< Signal > >( reply_delay, args... );
+    return { std::bind( &SignalPingPong< Signal >::time, ping_pong, _1 ), nullptr };
+}
+
+
+template<
+    typename Signal
+>
+static autotime::BenchTimers MakeLatencyTimers()
+{
+    using namespace std::placeholders;
+    auto latency = std::make_shared< WakeLatency< Signal > >();
+
+    std::function< void() > overhead = [](){ Now(); };
+    return { std::bind( &WakeLatency< Signal >::time, latency, _1 ), MakeTimer( overhead ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_futex_pingpong >()
+{
+    return MakePingPongTimers< FutexSignal >( std::chrono::nanoseconds::zero() );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_eventfd_pingpong >()
+{
+    return MakePingPongTimers< EventfdSignal >( std::chrono::nanoseconds::zero() );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_futex_latency >()
+{
+    return MakeLatencyTimers< FutexSignal >();
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_eventfd_latency >()
+{
+    return MakeLatencyTimers< EventfdSignal >();
+}
+
+
+    // Reply delay of the wakeup_park_spin*_reply10us benchmarks.
+static const std::chrono::nanoseconds Reply_delay{ 10000 };
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_park_spin0 >()
+{
+    return MakePingPongTimers< ParkSignal >( std::chrono::nanoseconds::zero(), 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_park_spin100 >()
+{
+    return MakePingPongTimers< ParkSignal >( std::chrono::nanoseconds::zero(), 100 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_park_spin1k >()
+{
+    return MakePingPongTimers< ParkSignal >( std::chrono::nanoseconds::zero(), 1000 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_park_spin10k >()
+{
+    return MakePingPongTimers< ParkSignal >( std::chrono::nanoseconds::zero(), 10000 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_park_spin0_reply10us >()
+{
+    return MakePingPongTimers< ParkSignal >( Reply_delay, 0 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_park_spin100_reply10us >()
+{
+    return MakePingPongTimers< ParkSignal >( Reply_delay, 100 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_park_spin1k_reply10us >()
+{
+    return MakePingPongTimers< ParkSignal >( Reply_delay, 1000 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_park_spin10k_reply10us >()
+{
+    return MakePingPongTimers< ParkSignal >( Reply_delay, 10000 );
+}
+
+
+    // Threads sleeping on one futex, which are all woken at once.
+class Herd
+{
+public:
+    explicit Herd( int num_waiters )
+    {
+        for (int i = 1; i <= num_waiters; ++i)
+        {
+            threads_.emplace_back( &Herd::threadfunc, this, i );
+        }
+    }
+
+    ~Herd()
+    {
+        stop_ = true;
+        generation_.fetch_add( 1, std::memory_order_release );
+        FutexWake( generation_, INT_MAX );
+        for (std::thread &thread: threads_) thread.join();
+    }
+
+    Durations time( int num_iters )
+    {
+        const int num_waiters = static_cast< int >( threads_.size() );
+        uint64_t latency = 0;
+
+        TimePoints start_times = Start();
+        for (int i = 0; i < num_iters; ++i)
+        {
+            SpinWait wait;
+            while (asleep_.load( std::memory_order_acquire ) != num_waiters) wait();
+            std::this_thread::sleep_for( Settle_time );
+            asleep_.store( 0, std::memory_order_relaxed );
+            woken_.store( 0, std::memory_order_relaxed );
+
+            const uint64_t sent = Now();
+            generation_.fetch_add( 1, std::memory_order_release );
+            FutexWake( generation_, INT_MAX );
+
+            wait = SpinWait{};
+            while (woken_.load( std::memory_order_acquire ) != num_waiters) wait();
+            latency += Now() - sent;
+        }
+        Durations durs = End( start_times );
+
+        durs.real = std::chrono::duration_cast< steady_clock::duration >(
+            steady_clock::duration( latency ) );
+        return durs;
+    }
+
+private:
+    void threadfunc( int idx )
+    {
+        SetCoreAffinity( GetTeamCoreId( idx ) );
+
+        int generation = generation_.load( std::memory_order_acquire );
+        for (;;)
+        {
+            asleep_.fetch_add( 1, std::memory_order_release );
+            while (generation_.load( std::memory_order_acquire ) == generation)
+            {
+                FutexWait( generation_, generation );
+            }
+            if (stop_) return;
+
+            generation = generation_.load( std::memory_order_acquire );
+            woken_.fetch_add( 1, std::memory_order_release );
+        }
+    }
+
+    std::vector< std::thread > threads_;
+    std::atomic< bool > stop_{ false };
+    std::atomic< int > generation_{ 0 };
+    std::atomic< int > asleep_{ 0 };
+    std::atomic< int > woken_{ 0 };
+};
+
+
+static autotime::BenchTimers MakeHerdTimers( int num_waiters )
+{
+    using namespace std::placeholders;
+    auto herd = std::make_shared< Herd >( num_waiters );
+
+    std::function< void() > overhead = [](){ Now(); };
+    return { std::bind( &Herd::time, herd, _1 ), MakeTimer( overhead ) };
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_futex_herd_1 >()
+{
+    return MakeHerdTimers( 1 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_futex_herd_2 >()
+{
+    return MakeHerdTimers( 2 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_futex_herd_4 >()
+{
+    return MakeHerdTimers( 4 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_futex_herd_8 >()
+{
+    return MakeHerdTimers( 8 );
+}
+
+
+template<> autotime::BenchTimers MakeTimers< Benchmark::wakeup_futex_herd_16 >()
+{
+    return MakeHerdTimers( 16 );
+}
+
+
+} // namespace bench
@@ -41,6 +41,15 @@ Timer MakeTimer(
 );
 
 
+class TimingState;  // See below.
+
+
+    //! Convenience function for creating a timer object for f( state ).
+Timer MakeTimer(
+    const std::function< void( TimingState & ) > f  //!< Function to measure.
+);
+
+
     //! Measures f() over a given number of iterations.
     /*!
         @returns the duration of num_iter calls of f().
@@ -71,6 +80,20 @@ Durations Time(
 );
 
 
+    //! Measures f( state ) over a given number of iterations.
+    /*!
+        Any intervals f() excludes via state.pause() and state.resume() are
+        subtracted from the result, along with the cost of each pause()/resume()
+        pair, as calibrated by timing back-to-back pairs.
+
+        @returns the duration of num_iter calls of f(), less excluded intervals.
+    */
+Durations Time(
+    const std::function< void( TimingState & ) > &f,   //!< Function to measure.
+    int num_iter                        //!< Number of iterations to measure.
+);
+
+
     //! Measures inst->f() over a given number of iterations.
     /*!
         @returns the time taken by num_iter of f().
@@ -113,6 +136,72 @@ Durations End(
 );
 
 
+    //! Passed to functions measured by Time(), to exclude parts of each call.
+    /*!
+        This is intended for per-iteration setup and cleanup work (e.g.
+        releasing the previous iteration's results) which would otherwise need
+        either a separate overhead timer or a Start()/End() pair per iteration.
+
+        Calls to pause() and resume() must alternate, and the state must not be
+        left paused when the measured function returns.  They're inline, so
+        that the only unaccounted cost is that of sampling the clocks, which
+        Time() estimates and subtracts.
+    */
+class TimingState
+{
+public:
+        //! Stops the accumulation of measured time.
+    void pause();
+
+        //! Resumes the accumulation of measured time.
+    void resume();
+
+        //! Returns the total duration of all completed pause() intervals.
+    const Durations &excluded() const;
+
+        //! Returns the number of completed pause() intervals.
+    int numPauses() const;
+
+private:
+    TimePoints paused_{};
+    Durations excluded_{};
+    int numPauses_ = 0;
+};
+
+
+// class TimingState:
+inline void TimingState::pause()
+{
+    // Sample real time first, to mirror End().
+    paused_.real = steady_clock::now();
+    paused_.thread = thread_clock::now();
+}
+
+
+inline void TimingState::resume()
+{
+    // Sample real time last, to mirror Start().
+    const thread_clock::time_point thread = thread_clock::now();
+    const steady_clock::time_point real = steady_clock::now();
+
+    excluded_.real += real - paused_.real;
+    excluded_.thread += thread - paused_.thread;
+    ++numPauses_;
+}
+
+
+inline const Durations &TimingState::excluded() const
+{
+    return excluded_;
+}
+
+
+inline int TimingState::numPauses() const
+{
+    return numPauses_;
+}
+
+
 } // namespace autotime
 
 
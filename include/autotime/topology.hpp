@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at
+//   http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Defines interface for discovering the CPU topology.
+/*! @file
+
+    The topology is read from Linux sysfs (/sys/devices/system/cpu), so that
+    the cores used by multithreaded benchmarks can be chosen by how closely
+    they're coupled, rather than left to the scheduler.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef AUTOTIME_TOPOLOGY_HPP
+#define AUTOTIME_TOPOLOGY_HPP
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+namespace autotime
+{
+
+
+    //! Location of a logical CPU, in the hierarchy of cores, caches, and packages.
+    /*!
+        Fields which couldn't be determined are -1 (or 0, for sizes).  Caches
+        are identified by the lowest-numbered CPU sharing them, since not all
+        kernels provide a cache ID.
+    */
+struct CpuTopology
+{
+    int cpu_id = -1;        //!< Logical CPU number, as accepted by SetCoreAffinity().
+    int core_id = -1;       //!< Physical core, which is only unique within a die.
+    int die_id = -1;        //!< Die, which is only unique within a package.
+    int package_id = -1;    //!< Physical package (i.e. socket).
+    int numa_node = -1;     //!< NUMA node of the CPU's local memory.
+    int l2_id = -1;         //!< Lowest-numbered CPU sharing the L2 cache.
+    int l3_id = -1;         //!< Lowest-numbered CPU sharing the L3 cache.
+    size_t l3_size = 0;     //!< Size of the L3 cache, in bytes.
+    std::vector< int > smt_siblings;    //!< CPUs sharing the physical core, including this one.
+};
+
+
+    //! Relationship between two logical CPUs, from the closest to the farthest.
+enum class CorePlacement
+{
+    same_cpu,
+    smt,            //!< Hardware threads of the same physical core.
+    same_l2,        //!< Distinct cores sharing an L2 cache (e.g. a cluster of small cores).
+    same_l3,        //!< Distinct cores sharing only the L3 cache.
+    cross_l3,       //!< Same package, but with different L3 caches (e.g. separate CCXs).
+    cross_package,  //!< Different packages (i.e. sockets).
+    unknown
+};
+
+
+    //! Returns the name of a placement, or nullptr if it's invalid.
+const char *ToCStr( CorePlacement placement );
+
+
+    //! Parses a sysfs CPU list, such as "0-3,8,10-11".
+    /*!
+        @returns the CPU numbers, in the order listed.  Parsing stops at the
+        first malformed entry.
+    */
+std::vector< int > ParseCpuList(
+    const std::string &list     //!< Comma-separated CPUs and ranges of CPUs.
+);
+
+
+    //! Reads the topology of all online CPUs.
+    /*!
+        @returns one entry per online CPU, sorted by cpu_id.  Empty, if the
+        online CPUs couldn't be determined.
+    */
+std::vector< CpuTopology > GetCpuTopology();
+
+
+    //! Classifies how closely cpu_b is coupled to cpu_a.
+    /*!
+        The closest applicable placement is returned.  When cache information
+        is missing, the die is used in place of the L3 cache.
+
+        @returns CorePlacement::unknown, if either CPU isn't in topology.
+    */
+CorePlacement ClassifyCorePair(
+    const std::vector< CpuTopology > &topology,     //!< From GetCpuTopology().
+    int cpu_a,
+    int cpu_b
+);
+
+
+    //! Selects a CPU having the specified placement, relative to cpu.
+    /*!
+        CPUs are considered in order, starting after cpu and wrapping around.
+
+        @returns -1, if no CPU has the requested placement.
+    */
+int SelectPairedCore(
+    const std::vector< CpuTopology > &topology,     //!< From GetCpuTopology().
+    int cpu,
+    CorePlacement placement
+);
+
+
+} // namespace autotime
+
+
+#endif // ndef AUTOTIME_TOPOLOGY_HPP
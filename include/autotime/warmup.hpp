@@ -64,6 +64,24 @@ public:
     virtual void maxClockSpeedDecrease(
         double thresh   //!< Maximum threshold as normalized value.
     ) = 0;
+
+        //! Gets the number of consecutive stable samples that completes warmup.
+    virtual int settleSamples() const;
+
+        //! Sets the number of consecutive stable samples that completes warmup.
+        /*!
+            This is for workloads which settle below the reported peak, such as
+            when heavy vector instructions impose a lower frequency license.
+            When nonzero, warmup is instead complete once this many consecutive
+            samples are within maxClockSpeedDecrease() of the first of them,
+            and regressions from the peak sample aren't treated as errors.
+
+            Implementations needn't support this.  By default, the count is
+            ignored and settleSamples() returns 0.
+        */
+    virtual void settleSamples(
+        int count       //!< Number of samples (0 -> disabled).
+    );
 };
 
 
@@ -12,6 +12,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "autotime/overhead_impl.hpp"
+#include "autotime/time.hpp"
 
 
 namespace autotime
@@ -24,6 +25,10 @@ template std::function< void() > MakeOverheadFn< void >();
 
 template void(*MakeOverheadPtr< void >())();
 
+template void Overhead_void< TimingState & >( TimingState & );
+
+template std::function< void( TimingState & ) > MakeOverheadFn< void, TimingState & >();
+
 
 } // namespace autotime
 
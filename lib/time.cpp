@@ -15,7 +15,9 @@
 #include "autotime/autotime.hpp"
 #include "internal.hpp"
 
+#include <algorithm>
 #include <mutex>
+#include <vector>
 
 
 namespace autotime
@@ -86,6 +88,68 @@ Durations End( const TimePoints &start )
 }
 
 
+    // Measures f( state ) over num_iter calls, less the intervals it excludes.
+static Durations TimeUnpaused(
+    const std::function< void( TimingState & ) > &f, int num_iter, TimingState &state )
+{
+    TimePoints start_times = Start();
+
+    for (int i = 0; i < num_iter; ++i) f( state );
+
+    Durations durs = End( start_times );
+    durs.real -= state.excluded().real;
+    durs.thread -= state.excluded().thread;
+
+    return durs;
+}
+
+
+    // Each pause()/resume() pair samples both clocks twice, inside the measured interval, and
+    //  only part of that lands between the samples.  How much depends on the surrounding code,
+    //  so rather than derive it from the cost of the clocks, time empty pairs in a Time() loop.
+static Durations GetPauseOverhead()
+{
+    static std::recursive_mutex mutex;
+    std::lock_guard< std::recursive_mutex > lock{ mutex };
+
+    static Durations overhead{};
+    static bool called = false;
+    if (!called)
+    {
+        called = true;
+
+        const std::function< void( TimingState & ) > empty =
+            []( TimingState &state )
+            {
+                state.pause();
+                state.resume();
+            };
+
+        // A fixed count, rather than AutoTime(), so End()'s own error is spread thin.  The
+        //  median of several runs discards those that were interrupted.
+        constexpr int num_pairs = 1000;
+        constexpr int num_runs = 15;
+        std::vector< steady_clock::duration > real;
+        std::vector< thread_clock::duration > thread;
+        for (int run = 0; run < num_runs; ++run)
+        {
+            TimingState state;
+            const Durations durs = TimeUnpaused( empty, num_pairs, state ) / num_pairs;
+            real.push_back( durs.real );
+            thread.push_back( durs.thread );
+        }
+
+        std::nth_element( real.begin(), real.begin() + num_runs / 2, real.end() );
+        std::nth_element( thread.begin(), thread.begin() + num_runs / 2, thread.end() );
+        overhead = { real[num_runs / 2], thread[num_runs / 2] };
+
+        AUTOTIME_DEBUG( "pause()/resume(): " << overhead.real.count() << " ns" );
+    }
+
+    return overhead;
+}
+
+
 Durations Time( const std::function< void() > &f, int num_iter )
 {
     TimePoints start_times = Start();
@@ -106,6 +170,19 @@ Durations Time( const std::function< Durations() > &f, int num_iter )
 }
 
 
+Durations Time( const std::function< void( TimingState & ) > &f, int num_iter )
+{
+    const Durations pause_overhead = GetPauseOverhead();
+
+    TimingState state;
+    Durations durs = TimeUnpaused( f, num_iter, state );
+    durs.real -= state.numPauses() * pause_overhead.real;
+    durs.thread -= state.numPauses() * pause_overhead.thread;
+
+    return durs;
+}
+
+
 Durations Time( void (*f)(), int num_iter )
 {
     TimePoints start_times = Start();
@@ -145,5 +222,14 @@ Timer MakeTimer( void (*f)() )
 }
 
 
+Timer MakeTimer( const std::function< void( TimingState & ) > f )
+{
+    return [f]( int num_iters )
+        {
+            return Time( f, num_iters );
+        };
+}
+
+
 } // namespace autotime
 
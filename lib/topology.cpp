@@ -0,0 +1,266 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Implements CPU topology discovery.
+/*! @file
+
+    See topology.hpp, for details.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "autotime/topology.hpp"
+#include "internal.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include <dirent.h>
+
+
+namespace autotime
+{
+
+
+static const std::string Cpu_dir = "/sys/devices/system/cpu/";
+
+
+const char *ToCStr( CorePlacement placement )
+{
+    switch (placement)
+    {
+#define CASE( n ) \
+    case CorePlacement::n: \
+        return #n
+
+    CASE( same_cpu );
+    CASE( smt );
+    CASE( same_l2 );
+    CASE( same_l3 );
+    CASE( cross_l3 );
+    CASE( cross_package );
+    CASE( unknown );
+
+#undef CASE
+    }
+
+    return nullptr;
+}
+
+
+std::vector< int > ParseCpuList( const std::string &list )
+{
+    std::vector< int > result;
+
+    const char *p = list.c_str();
+    while (*p)
+    {
+        char *end = nullptr;
+        const long first = strtol( p, &end, 10 );
+        if (end == p || first < 0) break;
+
+        long last = first;
+        p = end;
+        if (*p == '-')
+        {
+            last = strtol( ++p, &end, 10 );
+            if (end == p || last < first) break;
+            p = end;
+        }
+
+        for (long cpu = first; cpu <= last; ++cpu) result.push_back( static_cast< int >( cpu ) );
+
+        if (*p != ',') break;
+        ++p;
+    }
+
+    return result;
+}
+
+
+    // Returns the first line of a sysfs file, or an empty string if it can't be read.
+static std::string ReadLine( const std::string &path )
+{
+    std::ifstream file{ path };
+    std::string line;
+    std::getline( file, line );
+    return line;
+}
+
+
+    // Returns the integer in a sysfs file, or -1 if it can't be read.
+static int ReadInt( const std::string &path )
+{
+    std::ifstream file{ path };
+    int value = -1;
+    if (!(file >> value)) return -1;
+    return value;
+}
+
+
+    // Returns the size in a sysfs cache file (e.g. "32768K"), in bytes, or 0 if it can't be read.
+static size_t ReadSize( const std::string &path )
+{
+    std::ifstream file{ path };
+    size_t value = 0;
+    if (!(file >> value)) return 0;
+
+    char suffix = 0;
+    if (file >> suffix)
+    {
+        if (suffix == 'K') value <<= 10;
+        else if (suffix == 'M') value <<= 20;
+        else if (suffix == 'G') value <<= 30;
+    }
+    return value;
+}
+
+
+    // Returns the NUMA node, from the cpuN/nodeM link, or -1 if there's none.
+static int ReadNumaNode( const std::string &cpu_path )
+{
+    DIR *dir = opendir( cpu_path.c_str() );
+    if (!dir) return -1;
+
+    int node = -1;
+    while (dirent *entry = readdir( dir ))
+    {
+        const char *name = entry->d_name;
+        if (strncmp( name, "node", 4 ) != 0 || name[4] < '0' || name[4] > '9') continue;
+
+        node = atoi( name + 4 );
+        break;
+    }
+    closedir( dir );
+
+    return node;
+}
+
+
+    // Fills in the L2 & L3 IDs and the L3 size, from the cpuN/cache/indexK directories.
+static void ReadCaches( const std::string &cpu_path, CpuTopology &cpu )
+{
+    for (int index = 0; ; ++index)
+    {
+        const std::string cache_path = cpu_path + "cache/index" + std::to_string( index ) + "/";
+        const int level = ReadInt( cache_path + "level" );
+        if (level < 0) break;
+
+        // Instruction caches aren't shared between threads doing the same work.
+        if (ReadLine( cache_path + "type" ) == "Instruction") continue;
+
+        std::vector< int > sharing = ParseCpuList( ReadLine( cache_path + "shared_cpu_list" ) );
+        if (sharing.empty()) continue;
+
+        const int id = *std::min_element( sharing.begin(), sharing.end() );
+        if (level == 2) cpu.l2_id = id;
+        else if (level == 3)
+        {
+            cpu.l3_id = id;
+            cpu.l3_size = ReadSize( cache_path + "size" );
+        }
+    }
+}
+
+
+std::vector< CpuTopology > GetCpuTopology()
+{
+    std::vector< int > online = ParseCpuList( ReadLine( Cpu_dir + "online" ) );
+    if (online.empty())
+    {
+        AUTOTIME_ERROR( "failed to read online CPUs from " << Cpu_dir << "online" );
+        return {};
+    }
+
+    std::sort( online.begin(), online.end() );
+
+    std::vector< CpuTopology > result;
+    result.reserve( online.size() );
+    for (int cpu_id: online)
+    {
+        const std::string cpu_path = Cpu_dir + "cpu" + std::to_string( cpu_id ) + "/";
+        const std::string topo_path = cpu_path + "topology/";
+
+        CpuTopology cpu;
+        cpu.cpu_id = cpu_id;
+        cpu.core_id = ReadInt( topo_path + "core_id" );
+        cpu.die_id = ReadInt( topo_path + "die_id" );
+        cpu.package_id = ReadInt( topo_path + "physical_package_id" );
+        cpu.numa_node = ReadNumaNode( cpu_path );
+        cpu.smt_siblings = ParseCpuList( ReadLine( topo_path + "thread_siblings_list" ) );
+        if (cpu.smt_siblings.empty()) cpu.smt_siblings.push_back( cpu_id );
+
+        ReadCaches( cpu_path, cpu );
+
+        AUTOTIME_DEBUG( "cpu " << cpu_id << ": core " << cpu.core_id << ", die " << cpu.die_id
+            << ", package " << cpu.package_id << ", node " << cpu.numa_node
+            << ", L2 " << cpu.l2_id << ", L3 " << cpu.l3_id );
+
+        result.push_back( std::move( cpu ) );
+    }
+
+    return result;
+}
+
+
+static const CpuTopology *Find( const std::vector< CpuTopology > &topology, int cpu_id )
+{
+    auto iter = std::lower_bound( topology.begin(), topology.end(), cpu_id,
+        []( const CpuTopology &cpu, int id ){ return cpu.cpu_id < id; } );
+
+    return (iter != topology.end() && iter->cpu_id == cpu_id) ? &*iter : nullptr;
+}
+
+
+CorePlacement ClassifyCorePair( const std::vector< CpuTopology > &topology, int cpu_a, int cpu_b )
+{
+    const CpuTopology *a = Find( topology, cpu_a );
+    const CpuTopology *b = Find( topology, cpu_b );
+    if (!a || !b) return CorePlacement::unknown;
+
+    if (cpu_a == cpu_b) return CorePlacement::same_cpu;
+
+    const auto &siblings = a->smt_siblings;
+    if (std::find( siblings.begin(), siblings.end(), cpu_b ) != siblings.end())
+    {
+        return CorePlacement::smt;
+    }
+
+    if (a->package_id != b->package_id) return CorePlacement::cross_package;
+
+    if (a->l2_id >= 0 && a->l2_id == b->l2_id) return CorePlacement::same_l2;
+
+    if (a->l3_id >= 0 && b->l3_id >= 0)
+    {
+        return (a->l3_id == b->l3_id) ? CorePlacement::same_l3 : CorePlacement::cross_l3;
+    }
+
+    return (a->die_id == b->die_id) ? CorePlacement::same_l3 : CorePlacement::cross_l3;
+}
+
+
+int SelectPairedCore(
+    const std::vector< CpuTopology > &topology, int cpu, CorePlacement placement )
+{
+    auto start = std::upper_bound( topology.begin(), topology.end(), cpu,
+        []( int id, const CpuTopology &other ){ return id < other.cpu_id; } );
+    const size_t offset = static_cast< size_t >( start - topology.begin() );
+
+    for (size_t i = 0; i < topology.size(); ++i)
+    {
+        const CpuTopology &candidate = topology[(offset + i) % topology.size()];
+        if (ClassifyCorePair( topology, cpu, candidate.cpu_id ) == placement)
+        {
+            return candidate.cpu_id;
+        }
+    }
+
+    return -1;
+}
+
+
+} // namespace autotime
@@ -15,6 +15,7 @@
 #include "autotime/os.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <stdexcept>
 
 
@@ -38,6 +39,9 @@ public:
     double maxClockSpeedDecrease() const override;
     void maxClockSpeedDecrease( double thresh ) override;
 
+    int settleSamples() const override;
+    void settleSamples( int count ) override;
+
 private:
     void checkCoreId() const;
     double getClockSpeedRatio() const;
@@ -45,11 +49,14 @@ private:
     // Parameters:
     double minClockSpeed_ = 0.0;
     double maxDecrease_ = 0.01;
+    int settleSamples_ = 0;
 
     // Runtime state:
     const int coreId_ = -1;
     const CpuClockPeriod_double minClockTick_;
     double peak_ = 0.0;
+    double settleStart_ = 0.0;  // First sample of the current run of stable samples.
+    int numSettled_ = 0;        // Length of the current run of stable samples.
 };
 
 
@@ -77,7 +84,7 @@ void CoreWarmupMonitor::checkCoreId() const
 double CoreWarmupMonitor::getClockSpeedRatio() const
 {
     const double current = minClockTick_ / GetCoreClockTick( coreId_ );
-    if (current < peak_ - maxDecrease_)
+    if (!settleSamples_ && current < peak_ - maxDecrease_)
     {
         std::string message =
             "During warmup, core clock speed ratio dropped from " + std::to_string( peak_ )
@@ -91,7 +98,17 @@ double CoreWarmupMonitor::getClockSpeedRatio() const
 bool CoreWarmupMonitor::operator()()
 {
     this->checkCoreId();
-    peak_ = std::max( peak_, this->getClockSpeedRatio() );
+    const double current = this->getClockSpeedRatio();
+    peak_ = std::max( peak_, current );
+
+    if (numSettled_ > 0 && std::abs( current - settleStart_ ) <= maxDecrease_) ++numSettled_;
+    else
+    {
+        settleStart_ = current;
+        numSettled_ = 1;
+    }
+
+    if (settleSamples_ > 0) return (numSettled_ < settleSamples_);
     return (peak_ < minClockSpeed_);
 }
 
@@ -120,6 +137,18 @@ void CoreWarmupMonitor::maxClockSpeedDecrease( double thresh )
 }
 
 
+int CoreWarmupMonitor::settleSamples() const
+{
+    return settleSamples_;
+}
+
+
+void CoreWarmupMonitor::settleSamples( int count )
+{
+    settleSamples_ = count;
+}
+
+
 
 // class ICoreWarmupMonitor:
 std::unique_ptr< ICoreWarmupMonitor > ICoreWarmupMonitor::create( int coreId )
@@ -133,5 +162,16 @@ ICoreWarmupMonitor::~ICoreWarmupMonitor()
 }
 
 
+int ICoreWarmupMonitor::settleSamples() const
+{
+    return 0;
+}
+
+
+void ICoreWarmupMonitor::settleSamples( int )
+{
+}
+
+
 } // namespace autotime
 
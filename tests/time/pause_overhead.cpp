@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////////////////////
+//  Copyright Matthew A. Gruenke 2022.
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//! Checks that Time() subtracts the cost of pause()/resume() pairs.
+/*! @file
+
+    A function consisting of nothing but an empty pause()/resume() pair should normalize to
+    about 0, in both real and thread time.  Since a single measurement can be disturbed, the
+    median of several is compared against a tolerance.  That's relative to the uncorrected
+    cost of the pair, since sampling the clocks is far slower on some hosts (e.g. VMs without
+    a usable TSC) than others.
+*/
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <autotime/os.hpp>
+#include <autotime/time.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+
+    // Normalized times of an empty paused body can't be further than this from 0 (ns), or this
+    // fraction of the uncorrected cost of the pair, whichever is greater.
+static constexpr double Tolerance_ns = 25.0;
+static constexpr double Tolerance_fraction = 0.1;
+
+static constexpr int Num_iters = 10000;
+static constexpr int Num_runs = 7;
+
+
+static double Median( std::vector< double > values )
+{
+    std::sort( values.begin(), values.end() );
+    return values[values.size() / 2];
+}
+
+
+    // Converts the duration of Num_iters calls to ns per call.
+template<
+    typename duration_t
+>
+static double ToNs( duration_t duration )
+{
+    return std::chrono::duration< double, std::nano >( duration ).count() / Num_iters;
+}
+
+
+int main()
+{
+    autotime::SetCoreAffinity();
+
+    autotime::Timer timer = autotime::MakeTimer(
+        []( autotime::TimingState &state )
+        {
+            state.pause();
+            state.resume();
+        } );
+
+    // The same pair, timed without the correction, by excluding nothing.
+    autotime::TimingState unused;
+    autotime::Timer uncorrected = autotime::MakeTimer(
+        [&unused]()
+        {
+            unused.pause();
+            unused.resume();
+        } );
+
+    std::vector< double > real_ns, thread_ns, cost_ns;
+    for (int i = 0; i < Num_runs; ++i)
+    {
+        const autotime::Durations durs = timer( Num_iters );
+        real_ns.push_back( ToNs( durs.real ) );
+        thread_ns.push_back( ToNs( durs.thread ) );
+        cost_ns.push_back( ToNs( uncorrected( Num_iters ).real ) );
+    }
+
+    const double real = Median( real_ns );
+    const double thread = Median( thread_ns );
+    const double cost = Median( cost_ns );
+    const double tolerance = std::max( Tolerance_ns, Tolerance_fraction * cost );
+    std::cout << "Empty pause()/resume() pair: { " << real << " ns, " << thread << " ns }, vs. "
+        << cost << " ns uncorrected.\n";
+
+    if (std::fabs( real ) > tolerance || std::fabs( thread ) > tolerance)
+    {
+        std::cout << "FAILED: expected both within " << tolerance << " ns of 0.\n";
+        return 1;
+    }
+
+    return 0;
+}